@@ -0,0 +1,43 @@
+#!/usr/bin/env bash
+set -e
+
+echo "Compiling benchmarks..."
+
+# Allow overriding compiler via CXX, default to g++, fall back to clang++ if needed.
+if [ -z "$CXX" ]; then
+  if command -v g++ >/dev/null 2>&1; then
+    CXX="g++"
+  elif command -v clang++ >/dev/null 2>&1; then
+    CXX="clang++"
+  else
+    echo "Error: No suitable C++ compiler found (g++ or clang++ required)." >&2
+    exit 1
+  fi
+fi
+
+# Optional: use ./build if it exists, otherwise current directory.
+OUT_DIR="."
+if [ -d "./build" ]; then
+  OUT_DIR="./build"
+fi
+
+OUT_BIN="${OUT_DIR}/build_bench_dsp"
+
+# Same optimisation level as the tests and the plugin build.
+"$CXX" -std=c++17 -O2 -Wall -Isrc -DSHORTWAV_DSP_RUN_BENCHMARKS -o "$OUT_BIN" src/tests/bench_dsp.cpp
+
+# Results go to bench_results.csv; a baseline (if present) is compared against.
+# Create or refresh the baseline on the reference machine with:
+#   ./run_benchmarks.sh --save-baseline bench_baseline.csv
+# Extra arguments are passed through (see src/tests/bench_dsp.cpp).
+BASELINE="${BENCH_BASELINE:-bench_baseline.csv}"
+
+echo "Running benchmarks..."
+if "$OUT_BIN" --csv "${OUT_DIR}/bench_results.csv" --baseline "$BASELINE" "$@"; then
+  echo "Benchmarks finished."
+  exit 0
+else
+  status=$?
+  echo "Benchmarks reported regressions against ${BASELINE}."
+  exit $status
+fi
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "plugin.hpp"
+#include "dsp/control-rate.h"
+
+// Control-rate settings shared by all modules
+// - Parameters/CV are decoded and coefficients recomputed once per block
+// - DSP coefficients ramp linearly across the block (no zipper noise, no latency)
+// - Block length is chosen from the context menu and saved with the patch;
+//   patches saved before the setting existed keep per-sample evaluation,
+//   whether they have module data without the key (controlRateFromJson) or
+//   no module data at all (ShortwavDSP::ControlRateStartup)
+
+// Selectable block lengths in samples (1 = every sample, the legacy behaviour)
+static const int kControlRateDivisions[] = {1, 16, 32, 64};
+static const int kNumControlRateDivisions = 4;
+
+inline void appendControlRateMenu(Menu *menu, ShortwavDSP::ControlRateDivider *divider)
+{
+  struct ControlRateItem : MenuItem
+  {
+    ShortwavDSP::ControlRateDivider *divider;
+    int division;
+    void onAction(const event::Action &e) override
+    {
+      divider->setDivision(division);
+    }
+    void step() override
+    {
+      rightText = (divider->getDivision() == division) ? "✔" : "";
+      MenuItem::step();
+    }
+  };
+
+  menu->addChild(new MenuEntry);
+  menu->addChild(createMenuLabel("Control rate"));
+
+  for (int i = 0; i < kNumControlRateDivisions; ++i)
+  {
+    const int division = kControlRateDivisions[i];
+    std::string label = (division == 1) ? "Every sample" : ("Every " + std::to_string(division) + " samples");
+    ControlRateItem *item = createMenuItem<ControlRateItem>(label);
+    item->divider = divider;
+    item->division = division;
+    menu->addChild(item);
+  }
+}
+
+inline void controlRateToJson(json_t *rootJ, const ShortwavDSP::ControlRateDivider &divider)
+{
+  json_object_set_new(rootJ, "controlRate", json_integer(divider.getDivision()));
+}
+
+inline void controlRateFromJson(json_t *rootJ, ShortwavDSP::ControlRateDivider &divider)
+{
+  // No key: the patch predates control-rate blocks, so keep it sounding as
+  // it was saved (kDefaultDivision applies to new instances only)
+  json_t *controlRateJ = json_object_get(rootJ, "controlRate");
+  divider.setDivision(controlRateJ ? (int)json_integer_value(controlRateJ) : 1);
+}
@@ -2,36 +2,47 @@
 
 void Drift::process(const ProcessArgs &args)
 {
-  const float in = inputs[IN_INPUT].getVoltage();
-
-  // Map parameters to DriftGenerator.
-
-  // Depth shaping:
-  // Use a gentle exponential curve so low knob positions are still audible
-  // and high positions ramp up more strongly:
-  //
-  //   depthEff = (DEPTH^2) * kMaxDriftVolts
-  //
-  // This preserves determinism and smoothness while making the control
-  // musically useful across its full travel.
-  const float depthParam = params[DEPTH_PARAM].getValue();
-  const float shapedDepth = depthParam * depthParam; // quadratic curve
-  const float effectiveDepthVolts = shapedDepth * kMaxDriftVolts;
-
-  // Rate directly mapped in Hz; DriftGenerator clamps internally.
-  const float uiRate = params[RATE_PARAM].getValue();
-
-  // Configure underlying generator.
-  drift.setDepth(effectiveDepthVolts);
-  drift.setRateHz(uiRate);
+  // Map parameters to the generators once per control-rate block.
+  if (controlRate.tick())
+  {
+    // One drift voice per input channel (at least one with nothing patched)
+    numChannels = clamp(inputs[IN_INPUT].getChannels(), 1, kMaxChannels);
+
+    // Depth shaping:
+    // Use a gentle exponential curve so low knob positions are still audible
+    // and high positions ramp up more strongly:
+    //
+    //   depthEff = (DEPTH^2) * kMaxDriftVolts
+    //
+    // This preserves determinism and smoothness while making the control
+    // musically useful across its full travel.
+    const float depthParam = params[DEPTH_PARAM].getValue();
+    const float shapedDepth = depthParam * depthParam; // quadratic curve
+    const float effectiveDepthVolts = shapedDepth * kMaxDriftVolts;
+
+    // Rate directly mapped in Hz; DriftGenerator clamps internally.
+    // Shared by all channels, so coefficients are derived once per change.
+    const float uiRate = params[RATE_PARAM].getValue();
+
+    // Configure underlying generators.
+    drift.setDepth(effectiveDepthVolts);
+    drift.setRateHz(uiRate);
+
+    // The drift signal does not depend on the input, so the whole block is
+    // rendered up front; the input itself still passes through per sample.
+    const int blockSize = controlRate.getBlockSize();
+    for (int i = 0; i < blockSize; ++i)
+      drift.processFrame(block[i], numChannels);
+    blockPos = 0;
+  }
 
   // Per-sample drift (sample-accurate).
-  const float d = drift.next();
+  const float *d = block[blockPos++];
 
   // Apply drift as an additive modulation in volts.
-  const float out = in + d;
-
-  outputs[OUT_OUTPUT].setVoltage(out);
+  outputs[OUT_OUTPUT].setChannels(numChannels);
+  for (int c = 0; c < numChannels; ++c)
+    outputs[OUT_OUTPUT].setVoltage(inputs[IN_INPUT].getVoltage(c) + d[c], c);
 }
 
 // Instantiate the VCV Rack model for the Drift module.
@@ -2,12 +2,15 @@
 
 #include "plugin.hpp"
 #include "dsp/drift.h"
+#include "ControlRate.hpp"
+#include "DspStats.hpp"
 
 // Drift Module
-// - One audio/CV input ("In").
-// - One audio/CV output ("Out").
-// - Applies a smooth analog-style drift (ShortwavDSP::DriftGenerator) as an
-//   additive modulation: Out = In + Drift.
+// - One polyphonic audio/CV input ("In").
+// - One audio/CV output ("Out") with as many channels as the input.
+// - Applies a smooth analog-style drift as an additive modulation:
+//   Out[c] = In[c] + Drift[c], with an independent generator per channel
+//   (ShortwavDSP::DriftGeneratorBank, seeded from one base seed).
 // - Parameters:
 //     * DEPTH_PARAM : 0..1, scales DriftGenerator depth (intensity).
 //     * RATE_PARAM  : 0.001..2 Hz, maps to DriftGenerator rateHz.
@@ -15,8 +18,10 @@
 // Design:
 // - Follows patterns from RandomLfo and Waveshaper modules.
 // - Real-time safe: no allocations or locks in process().
-// - Deterministic: seeds DriftGenerator using the module instance pointer.
-// - Sample-rate aware: updates DriftGenerator on sample-rate change.
+// - Deterministic: seeds the generators using the module instance pointer.
+// - Sample-rate aware: updates the generators on sample-rate change.
+// - Parameters evaluated at control rate; drift rendered one block at a time.
+// - Drift state advanced at a decimated rate and interpolated per sample.
 
 struct Drift : Module
 {
@@ -44,12 +49,26 @@ struct Drift : Module
     NUM_LIGHTS
   };
 
-  ShortwavDSP::DriftGenerator drift;
+  static constexpr int kMaxChannels = ShortwavDSP::DriftGeneratorBank::kMaxChannels;
+
+  ShortwavDSP::DriftGeneratorBank drift;
+  ShortwavDSP::ControlRateDivider controlRate;
+  ShortwavDSP::ControlRateStartup controlRateStartup{controlRate};
+
+  // Drift frames rendered for the current control-rate block, and the
+  // channel count they were rendered for.
+  float block[ShortwavDSP::ControlRateDivider::kMaxDivision][kMaxChannels] = {};
+  int blockPos = 0;
+  int numChannels = 1;
 
   // Maximum drift amplitude (in volts) applied at DEPTH_PARAM == 1.
   // Chosen to be clearly audible for both CV and audio-rate signals while
   static constexpr float kMaxDriftVolts = .5f;
 
+  // Drift moves at a few Hz at most, so its state is advanced once every
+  // kDriftDecimation samples and interpolated in between.
+  static constexpr int kDriftDecimation = 32;
+
   Drift()
   {
     config(NUM_PARAMS, NUM_INPUTS, NUM_OUTPUTS, NUM_LIGHTS);
@@ -83,18 +102,45 @@ struct Drift : Module
   {
     const float sr = APP->engine->getSampleRate();
     drift.setSampleRate(sr);
+    drift.setDecimation(kDriftDecimation);
 
     // Seed per-instance deterministically based on address,
-    // consistent with RandomLfo style.
+    // consistent with RandomLfo style (channel c gets
+    // DriftGeneratorBank::channelSeed(seed, c)).
     const uint32_t seed =
         static_cast<uint32_t>(reinterpret_cast<uintptr_t>(this) & 0xFFFFFFFFu);
     drift.seed(seed);
 
     // Reset to zero drift at SR change for determinism.
     drift.reset(0.0f);
+    controlRate.reset();
   }
 
   void process(const ProcessArgs &args) override;
+
+  // Patches are restored before the instance is added (see ControlRateStartup)
+  void fromJson(json_t *rootJ) override
+  {
+    controlRateStartup.restoring();
+    Module::fromJson(rootJ);
+  }
+
+  void onAdd() override
+  {
+    controlRateStartup.added();
+  }
+
+  json_t *dataToJson() override
+  {
+    json_t *rootJ = json_object();
+    controlRateToJson(rootJ, controlRate);
+    return rootJ;
+  }
+
+  void dataFromJson(json_t *rootJ) override
+  {
+    controlRateFromJson(rootJ, controlRate);
+  }
 };
 
 struct DriftWidget : ModuleWidget
@@ -198,6 +244,9 @@ struct DriftWidget : ModuleWidget
       presetItem->preset = i;
       menu->addChild(presetItem);
     }
+
+    appendControlRateMenu(menu, &module->controlRate);
+    appendDspStatsMenu(menu, "Drift", {{"Drift", &module->drift.getStats(), false}});
   }
 };
 
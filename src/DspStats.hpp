@@ -0,0 +1,123 @@
+#pragma once
+
+#include <initializer_list>
+
+#include "plugin.hpp"
+#include "dsp/instrumentation.h"
+
+// DSP load counters shared by all modules
+// - Only present in builds with SHORTWAV_DSP_INSTRUMENTATION=1 (see Makefile);
+//   otherwise the menu section is omitted and the counters are compiled out
+// - Labels refresh while the menu is open; counters are read lock-free
+// - "Log stats as JSON" writes every engine's counters to the Rack log
+
+// One engine of a module, e.g. {"Classic", &filter.getStats(), false}.
+// playback adds the WavPlayer-only lines (underruns, interpolation tiers).
+struct DspStatsSource
+{
+  const char *name;
+  ShortwavDSP::DspStats *stats;
+  bool playback;
+};
+
+inline json_t *dspStatsToJson(const ShortwavDSP::DspStatsSnapshot &s)
+{
+  json_t *statsJ = json_object();
+  json_object_set_new(statsJ, "calls", json_integer((json_int_t)s.calls));
+  json_object_set_new(statsJ, "samples", json_integer((json_int_t)s.samples));
+  json_object_set_new(statsJ, "cycles", json_integer((json_int_t)s.cycles));
+  json_object_set_new(statsJ, "cycleUnit", json_string(ShortwavDSP::DspStats::cycleUnit()));
+  json_object_set_new(statsJ, "cyclesPerSample", json_real(s.cyclesPerSample()));
+  json_object_set_new(statsJ, "coefficientUpdates", json_integer((json_int_t)s.coefficientUpdates));
+  json_object_set_new(statsJ, "denormalFlushes", json_integer((json_int_t)s.denormalFlushes));
+  json_object_set_new(statsJ, "underruns", json_integer((json_int_t)s.underruns));
+  json_t *tiersJ = json_array();
+  for (int t = 0; t < ShortwavDSP::DspStatsSnapshot::kMaxTiers; ++t)
+    json_array_append_new(tiersJ, json_integer((json_int_t)s.tiers[t]));
+  json_object_set_new(statsJ, "tiers", tiersJ);
+  return statsJ;
+}
+
+inline void appendDspStatsMenu(Menu *menu, const char *moduleName, std::initializer_list<DspStatsSource> sources)
+{
+  if (!ShortwavDSP::DspStats::kEnabled)
+    return;
+
+  struct StatsLabel : MenuLabel
+  {
+    DspStatsSource source;
+    int line;
+    void step() override
+    {
+      const ShortwavDSP::DspStatsSnapshot s = source.stats->snapshot();
+      char label[128];
+      if (line == 0)
+        snprintf(label, sizeof(label), "%s: %.1f %s/sample", source.name, s.cyclesPerSample(),
+                 ShortwavDSP::DspStats::cycleUnit());
+      else if (line == 1)
+        snprintf(label, sizeof(label), "  %llu calls, %llu coeff updates, %llu denormal flushes",
+                 (unsigned long long)s.calls, (unsigned long long)s.coefficientUpdates,
+                 (unsigned long long)s.denormalFlushes);
+      else
+        snprintf(label, sizeof(label), "  %llu underruns, frames none/lin/cubic/sinc %llu/%llu/%llu/%llu",
+                 (unsigned long long)s.underruns, (unsigned long long)s.tiers[0],
+                 (unsigned long long)s.tiers[1], (unsigned long long)s.tiers[2],
+                 (unsigned long long)s.tiers[3]);
+      text = label;
+      MenuLabel::step();
+    }
+  };
+
+  struct ResetStatsItem : MenuItem
+  {
+    std::vector<DspStatsSource> sources;
+    void onAction(const event::Action &e) override
+    {
+      for (const DspStatsSource &source : sources)
+        source.stats->reset();
+    }
+  };
+
+  struct LogStatsItem : MenuItem
+  {
+    std::string moduleName;
+    std::vector<DspStatsSource> sources;
+    void onAction(const event::Action &e) override
+    {
+      json_t *rootJ = json_object();
+      for (const DspStatsSource &source : sources)
+        json_object_set_new(rootJ, source.name, dspStatsToJson(source.stats->snapshot()));
+      char *dump = json_dumps(rootJ, JSON_COMPACT);
+      if (dump)
+      {
+        INFO("%s DSP stats: %s", moduleName.c_str(), dump);
+        free(dump);
+      }
+      json_decref(rootJ);
+    }
+  };
+
+  menu->addChild(new MenuEntry);
+  menu->addChild(createMenuLabel("DSP load"));
+
+  for (const DspStatsSource &source : sources)
+  {
+    const int lines = source.playback ? 3 : 2;
+    for (int line = 0; line < lines; ++line)
+    {
+      StatsLabel *label = new StatsLabel;
+      label->source = source;
+      label->line = line;
+      menu->addChild(label);
+    }
+  }
+
+  ResetStatsItem *resetItem = createMenuItem<ResetStatsItem>("Reset counters");
+  resetItem->sources = sources;
+  menu->addChild(resetItem);
+
+  LogStatsItem *logItem = createMenuItem<LogStatsItem>("Log stats as JSON");
+  logItem->moduleName = moduleName;
+  logItem->sources = sources;
+  menu->addChild(logItem);
+}
@@ -2,60 +2,120 @@
 
 void FormantOsc::process(const ProcessArgs &args)
 {
-  // Pull base parameter values.
-  float carrierFreq = params[CARRIER_FREQ_PARAM].getValue();
-  float formantFreq = params[FORMANT_FREQ_PARAM].getValue();
-  float formantWidth = params[FORMANT_WIDTH_PARAM].getValue();
-  float outputGain = params[OUTPUT_GAIN_PARAM].getValue();
-
-  // Apply CV modulation where available.
-  // Assumptions for CV inputs:
-  // - CARRIER_FREQ_CV_INPUT: 1V/oct pitch modulation
-  // - FORMANT_FREQ_CV_INPUT: 1V/oct frequency modulation
-  // - FORMANT_WIDTH_CV_INPUT: 0-10V mapped to 0..1 additive modulation
-
-  if (inputs[CARRIER_FREQ_CV_INPUT].isConnected())
+  // Voice count follows the carrier CV cable (1 = classic mono engine).
+  const int channels = clamp(inputs[CARRIER_FREQ_CV_INPUT].getChannels(), 1,
+                             ShortwavDSP::FormantOscillatorBank::kMaxVoices);
+  if (channels != numVoices)
   {
-    // 1V/oct: for each volt, multiply frequency by 2^(V/1).
-    float cv = clamp(inputs[CARRIER_FREQ_CV_INPUT].getVoltage(), -10.0f, 10.0f);
-    float factor = std::pow(2.0f, cv);
-    carrierFreq *= factor;
+    numVoices = channels;
+    controlRate.reset(); // Start a fresh block for the new engine
   }
 
-  if (inputs[FORMANT_FREQ_CV_INPUT].isConnected())
+  // Decode parameters and CV once per control-rate block.
+  if (controlRate.tick())
   {
-    // 1V/oct: for each volt, multiply frequency by 2^(V/1).
-    float cv = clamp(inputs[FORMANT_FREQ_CV_INPUT].getVoltage(), -10.0f, 10.0f);
-    float factor = std::pow(2.0f, cv);
-    formantFreq *= factor;
-  }
+    // Pull base parameter values.
+    float carrierBase = params[CARRIER_FREQ_PARAM].getValue();
+    float formantBase = params[FORMANT_FREQ_PARAM].getValue();
+    float widthBase = params[FORMANT_WIDTH_PARAM].getValue();
+    float outputGain = params[OUTPUT_GAIN_PARAM].getValue();
+    outputGain = clamp(outputGain, 0.0f, 2.0f);
 
-  if (inputs[FORMANT_WIDTH_CV_INPUT].isConnected())
-  {
-    // 0-10V mapped to 0..1, additive with parameter.
-    float cv = clamp(inputs[FORMANT_WIDTH_CV_INPUT].getVoltage() / 10.0f, 0.0f, 1.0f);
-    formantWidth = clamp(formantWidth + cv * 0.5f, 0.0f, 1.0f);
-  }
+    const int blockSize = controlRate.getBlockSize();
+    const int oversamplingFactor = oversampling.load();
+
+    // Apply CV modulation where available (polyphonic cables are read per
+    // voice, a mono cable is shared by all voices).
+    // Assumptions for CV inputs:
+    // - CARRIER_FREQ_CV_INPUT: 1V/oct pitch modulation
+    // - FORMANT_FREQ_CV_INPUT: 1V/oct frequency modulation
+    // - FORMANT_WIDTH_CV_INPUT: 0-10V mapped to 0..1 additive modulation
+    auto decodeVoice = [&](int c, float &carrierFreq, float &formantFreq, float &formantWidth) {
+      carrierFreq = carrierBase;
+      formantFreq = formantBase;
+      formantWidth = widthBase;
+
+      if (inputs[CARRIER_FREQ_CV_INPUT].isConnected())
+      {
+        // 1V/oct: for each volt, multiply frequency by 2^(V/1).
+        float cv = clamp(inputs[CARRIER_FREQ_CV_INPUT].getPolyVoltage(c), -10.0f, 10.0f);
+        float factor = std::pow(2.0f, cv);
+        carrierFreq *= factor;
+      }
+
+      if (inputs[FORMANT_FREQ_CV_INPUT].isConnected())
+      {
+        // 1V/oct: for each volt, multiply frequency by 2^(V/1).
+        float cv = clamp(inputs[FORMANT_FREQ_CV_INPUT].getPolyVoltage(c), -10.0f, 10.0f);
+        float factor = std::pow(2.0f, cv);
+        formantFreq *= factor;
+      }
+
+      if (inputs[FORMANT_WIDTH_CV_INPUT].isConnected())
+      {
+        // 0-10V mapped to 0..1, additive with parameter.
+        float cv = clamp(inputs[FORMANT_WIDTH_CV_INPUT].getPolyVoltage(c) / 10.0f, 0.0f, 1.0f);
+        formantWidth = clamp(formantWidth + cv * 0.5f, 0.0f, 1.0f);
+      }
 
-  // Clamp frequencies to reasonable ranges for stability.
-  carrierFreq = clamp(carrierFreq, 0.0f, 20000.0f);
-  formantFreq = clamp(formantFreq, 0.0f, 20000.0f);
-  formantWidth = clamp(formantWidth, 0.0f, 1.0f);
-  outputGain = clamp(outputGain, 0.0f, 2.0f);
+      // Clamp frequencies to reasonable ranges for stability.
+      carrierFreq = clamp(carrierFreq, 0.0f, 20000.0f);
+      formantFreq = clamp(formantFreq, 0.0f, 20000.0f);
+      formantWidth = clamp(formantWidth, 0.0f, 1.0f);
+    };
 
-  // Apply to oscillator engine.
-  osc.setCarrierFreq(carrierFreq);
-  osc.setFormantFreq(formantFreq);
-  osc.setFormantWidth(formantWidth);
-  osc.setOutputGain(outputGain);
+    if (numVoices == 1)
+    {
+      float carrierFreq, formantFreq, formantWidth;
+      decodeVoice(0, carrierFreq, formantFreq, formantWidth);
 
-  // Generate one audio sample per process() call; Rack drives this at audio rate.
-  float sample = osc.processSample();
+      // Apply to oscillator engine (frequency changes ramp across the block).
+      osc.setParameterRamp(blockSize);
+      osc.setCarrierFreq(carrierFreq);
+      osc.setFormantFreq(formantFreq);
+      osc.setFormantWidth(formantWidth);
+      osc.setOutputGain(outputGain);
+      osc.setOversampling(oversamplingFactor);
+
+      // The oscillator has no audio input, so the whole block can be rendered
+      // up front without adding latency.
+      osc.processBuffer(nullptr, block, (size_t)blockSize);
+      blockPos = 0;
+    }
+    else
+    {
+      // One vectorised engine for all voices, ramped across the block.
+      bank.setParameterRamp(blockSize);
+      bank.setOutputGain(outputGain);
+      bank.setOversampling(oversamplingFactor);
+      for (int c = 0; c < numVoices; ++c)
+      {
+        float carrierFreq, formantFreq, formantWidth;
+        decodeVoice(c, carrierFreq, formantFreq, formantWidth);
+        bank.setVoice(c, carrierFreq, formantFreq, formantWidth);
+      }
+    }
+  }
 
   // Map to audio output voltage range: typical ±5V for audio in Rack.
-  float outV = sample * 5.0f;
+  if (numVoices == 1)
+  {
+    // Render one sample per process() call from the current block.
+    float sample = block[blockPos++];
+    float outV = sample * 5.0f;
 
-  outputs[AUDIO_OUTPUT].setVoltage(outV);
+    outputs[AUDIO_OUTPUT].setChannels(1);
+    outputs[AUDIO_OUTPUT].setVoltage(outV);
+  }
+  else
+  {
+    float voices[ShortwavDSP::FormantOscillatorBank::kMaxVoices];
+    bank.processSample(voices, numVoices);
+
+    outputs[AUDIO_OUTPUT].setChannels(numVoices);
+    for (int c = 0; c < numVoices; ++c)
+      outputs[AUDIO_OUTPUT].setVoltage(voices[c] * 5.0f, c);
+  }
 }
 
 Model *modelFormantOsc = createModel<FormantOsc, FormantOscWidget>("FormantOsc");
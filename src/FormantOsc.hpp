@@ -3,6 +3,8 @@
 #include "plugin.hpp"
 
 #include "dsp/formant-osc.h"
+#include "ControlRate.hpp"
+#include "DspStats.hpp"
 
 struct FormantOsc : Module
 {
@@ -34,7 +36,19 @@ struct FormantOsc : Module
     NUM_LIGHTS
   };
 
-  ShortwavDSP::FormantOscillator osc;
+  ShortwavDSP::FormantOscillator osc;          // Mono engine (1 voice)
+  ShortwavDSP::FormantOscillatorBank bank;     // Poly engine (2-16 voices)
+  int numVoices = 1;
+  ShortwavDSP::ControlRateDivider controlRate;
+  ShortwavDSP::ControlRateStartup controlRateStartup{controlRate};
+
+  // Internal oversampling factor requested from the menu (1, 2, 4, 8);
+  // applied by the audio thread at the next control-rate block.
+  std::atomic<int> oversampling{1};
+
+  // Samples rendered for the current control-rate block.
+  float block[ShortwavDSP::ControlRateDivider::kMaxDivision] = {};
+  int blockPos = 0;
 
   FormantOsc()
   {
@@ -60,9 +74,39 @@ struct FormantOsc : Module
   {
     float sr = APP->engine->getSampleRate();
     osc.setSampleRate(sr);
+    bank.setSampleRate(sr);
+    controlRate.reset();
   }
 
   void process(const ProcessArgs &args) override;
+
+  // Patches are restored before the instance is added (see ControlRateStartup)
+  void fromJson(json_t *rootJ) override
+  {
+    controlRateStartup.restoring();
+    Module::fromJson(rootJ);
+  }
+
+  void onAdd() override
+  {
+    controlRateStartup.added();
+  }
+
+  json_t *dataToJson() override
+  {
+    json_t *rootJ = json_object();
+    controlRateToJson(rootJ, controlRate);
+    json_object_set_new(rootJ, "oversampling", json_integer(oversampling.load()));
+    return rootJ;
+  }
+
+  void dataFromJson(json_t *rootJ) override
+  {
+    controlRateFromJson(rootJ, controlRate);
+    json_t *oversamplingJ = json_object_get(rootJ, "oversampling");
+    if (oversamplingJ)
+      oversampling.store(clamp((int)json_integer_value(oversamplingJ), 1, 8));
+  }
 };
 
 struct FormantOscWidget : ModuleWidget
@@ -164,5 +208,36 @@ struct FormantOscWidget : ModuleWidget
       presetItem->preset = i;
       menu->addChild(presetItem);
     }
+
+    struct OversamplingItem : MenuItem
+    {
+      FormantOsc *module;
+      int factor;
+      void onAction(const event::Action &e) override
+      {
+        module->oversampling.store(factor);
+      }
+      void step() override
+      {
+        rightText = (module->oversampling.load() == factor) ? "✔" : "";
+        MenuItem::step();
+      }
+    };
+
+    menu->addChild(new MenuEntry);
+    menu->addChild(createMenuLabel("Oversampling"));
+
+    const int factors[] = {1, 2, 4, 8};
+    for (int factor : factors)
+    {
+      std::string label = (factor == 1) ? "Off" : (std::to_string(factor) + "x");
+      OversamplingItem *item = createMenuItem<OversamplingItem>(label);
+      item->module = module;
+      item->factor = factor;
+      menu->addChild(item);
+    }
+
+    appendControlRateMenu(menu, &module->controlRate);
+    appendDspStatsMenu(menu, "Formant Osc", {{"Mono", &module->osc.getStats(), false}, {"Poly", &module->bank.getStats(), false}});
   }
 };
@@ -2,71 +2,79 @@
 
 void LowPassFilter::process(const ProcessArgs &args)
 {
-  // Get base parameter values
-  // Cutoff is stored as log2(Hz), so convert back to linear Hz
-  float cutoffHz = std::pow(2.f, params[CUTOFF_PARAM].getValue());
-  float resonance = params[RESONANCE_PARAM].getValue();
-
-  // Apply CV modulation
-  // Cutoff CV: 1V/oct standard (additive in log space)
-  if (inputs[CUTOFF_CV_INPUT].isConnected())
+  // Decode parameters and CV once per control-rate block
+  if (controlRate.tick())
   {
-    float cvVoltage = inputs[CUTOFF_CV_INPUT].getVoltage();
-    // Each volt adds one octave: multiply frequency by 2^(V/1)
-    cutoffHz *= std::pow(2.f, cvVoltage);
-  }
-
-  // Resonance CV: 0-10V mapped to 0..1 (multiplicative)
-  if (inputs[RESONANCE_CV_INPUT].isConnected())
-  {
-    float cvVoltage = clamp(inputs[RESONANCE_CV_INPUT].getVoltage(), 0.f, 10.f);
-    resonance = clamp(resonance * (cvVoltage / 10.f), 0.f, 1.f);
-  }
+    // Switch models (or honour a preset's reset request) at a block boundary,
+    // starting the filter from silence
+    const int model = filterModel.load();
+    const bool modelChanged = (model != activeModel);
+    const bool restarted = resetRequested.exchange(false) || modelChanged;
+    activeModel = model;
+    if (restarted)
+    {
+      resetFilters();
+    }
 
-  // Update filter parameters
-  // (Clamping happens inside the filter setters)
-  filterL.setCutoff(cutoffHz);
-  filterL.setResonance(resonance);
-  filterR.setCutoff(cutoffHz);
-  filterR.setResonance(resonance);
+    // Get base parameter values
+    // Cutoff is stored as log2(Hz), so convert back to linear Hz
+    float cutoffHz = std::pow(2.f, params[CUTOFF_PARAM].getValue());
+    float resonance = params[RESONANCE_PARAM].getValue();
 
-  // Process audio
-  // Left channel
-  if (inputs[AUDIO_INPUT_L].isConnected() && outputs[AUDIO_OUTPUT_L].isConnected())
-  {
-    float inputL = inputs[AUDIO_INPUT_L].getVoltage();
-    float outputL = filterL.processSample(inputL);
-    outputs[AUDIO_OUTPUT_L].setVoltage(outputL);
-  }
-  else if (outputs[AUDIO_OUTPUT_L].isConnected())
-  {
-    // No input connected - output silence
-    outputs[AUDIO_OUTPUT_L].setVoltage(0.f);
-  }
+    // Apply CV modulation
+    // Cutoff CV: 1V/oct standard (additive in log space)
+    if (inputs[CUTOFF_CV_INPUT].isConnected())
+    {
+      float cvVoltage = inputs[CUTOFF_CV_INPUT].getVoltage();
+      // Each volt adds one octave: multiply frequency by 2^(V/1)
+      cutoffHz *= std::pow(2.f, cvVoltage);
+    }
 
-  // Right channel (or copy left if only left input is connected)
-  if (outputs[AUDIO_OUTPUT_R].isConnected())
-  {
-    if (inputs[AUDIO_INPUT_R].isConnected())
+    // Resonance CV: 0-10V mapped to 0..1 (multiplicative)
+    if (inputs[RESONANCE_CV_INPUT].isConnected())
     {
-      // True stereo: process right input through right filter
-      float inputR = inputs[AUDIO_INPUT_R].getVoltage();
-      float outputR = filterR.processSample(inputR);
-      outputs[AUDIO_OUTPUT_R].setVoltage(outputR);
+      float cvVoltage = clamp(inputs[RESONANCE_CV_INPUT].getVoltage(), 0.f, 10.f);
+      resonance = clamp(resonance * (cvVoltage / 10.f), 0.f, 1.f);
     }
-    else if (inputs[AUDIO_INPUT_L].isConnected())
+
+    // Update the active filter pair
+    // (Clamping happens inside the filter setters; coefficients ramp across the
+    // block, except after a restart: the idle filter's values are stale after a
+    // model switch, and a preset's new values should apply at once)
+    const int rampSamples = restarted ? 0 : controlRate.getBlockSize();
+    if (activeModel == MODEL_ZDF)
     {
-      // Mono to stereo: copy left input to right channel
-      float inputL = inputs[AUDIO_INPUT_L].getVoltage();
-      float outputR = filterR.processSample(inputL);
-      outputs[AUDIO_OUTPUT_R].setVoltage(outputR);
+      zdf.setOversampling(oversampling.load());
+      zdf.setSaturation(saturation.load());
+      zdf.setParameterRamp(rampSamples);
+      zdf.setCutoff(cutoffHz);
+      zdf.setResonance(resonance);
     }
     else
     {
-      // No input - output silence
-      outputs[AUDIO_OUTPUT_R].setVoltage(0.f);
+      filter.setParameterRamp(rampSamples);
+      filter.setCutoff(cutoffHz);
+      filter.setResonance(resonance);
     }
   }
+
+  // Process audio
+  // Both channels run through the filter together; an unpatched right input
+  // follows the left one (mono to stereo), an unpatched left input is silence
+  const bool leftIn = inputs[AUDIO_INPUT_L].isConnected();
+  const bool rightIn = inputs[AUDIO_INPUT_R].isConnected();
+  if (!outputs[AUDIO_OUTPUT_L].isConnected() && !outputs[AUDIO_OUTPUT_R].isConnected())
+    return;
+
+  float in[2];
+  in[0] = leftIn ? inputs[AUDIO_INPUT_L].getVoltage() : 0.f;
+  in[1] = rightIn ? inputs[AUDIO_INPUT_R].getVoltage() : in[0];
+  float out[2];
+  processFilter(in, out);
+
+  // No input connected - output silence
+  outputs[AUDIO_OUTPUT_L].setVoltage(leftIn ? out[0] : 0.f);
+  outputs[AUDIO_OUTPUT_R].setVoltage((leftIn || rightIn) ? out[1] : 0.f);
 }
 
 Model *modelLowPassFilter = createModel<LowPassFilter, LowPassFilterWidget>("LowPassFilter");
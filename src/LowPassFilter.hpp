@@ -2,14 +2,22 @@
 
 #include "plugin.hpp"
 #include "dsp/low-pass.h"
+#include "ControlRate.hpp"
+#include "DspStats.hpp"
 
 // LowPassFilter Module
 // - Moog-style 4-pole (24dB/oct) resonant low-pass filter
-// - Stereo processing with separate filter instances per channel
+// - Stereo processing: independent L/R state, shared coefficients, both
+//   channels advanced together in one SIMD register
 // - Controls for:
 //     * Cutoff frequency (20Hz - Nyquist/2)
 //     * Resonance (0.0 = none, 1.0 = self-oscillation)
 //     * CV modulation for cutoff and resonance
+// - Parameters evaluated at control rate (see ControlRate.hpp)
+// - Context menu selects the filter model:
+//     * Classic: the original Euler-integrated ladder
+//     * ZDF: zero-delay-feedback ladder (accurate cutoff up to Nyquist), with
+//       optional 2x/4x internal oversampling and tanh saturation
 
 struct LowPassFilter : Module
 {
@@ -41,8 +49,28 @@ struct LowPassFilter : Module
     NUM_LIGHTS
   };
 
-  ShortwavDSP::MoogLowPassFilter filterL;
-  ShortwavDSP::MoogLowPassFilter filterR;
+  enum FilterModel
+  {
+    MODEL_CLASSIC,
+    MODEL_ZDF,
+    NUM_MODELS
+  };
+
+  // The ZDF saturation stage expects signals around +/-1; Rack audio is +/-5V
+  static constexpr float kZdfInputScale = 0.2f;
+
+  ShortwavDSP::StereoMoogLowPassFilter filter; // Classic model, channels L/R
+  ShortwavDSP::ZdfLadderFilter4 zdf;           // ZDF model, lanes 0/1 = L/R
+  ShortwavDSP::ControlRateDivider controlRate;
+  ShortwavDSP::ControlRateStartup controlRateStartup{controlRate};
+
+  // Menu selections (UI thread), applied by the audio thread at the next
+  // control-rate block
+  std::atomic<int> filterModel{MODEL_CLASSIC};
+  std::atomic<int> oversampling{1};       // ZDF only: 1, 2 or 4
+  std::atomic<bool> saturation{false};    // ZDF only: tanh input stage
+  std::atomic<bool> resetRequested{false}; // Presets: restart the filters from silence
+  int activeModel = MODEL_CLASSIC;
 
   LowPassFilter()
   {
@@ -69,17 +97,75 @@ struct LowPassFilter : Module
   void onSampleRateChange() override
   {
     float sr = APP->engine->getSampleRate();
-    filterL.setSampleRate(sr);
-    filterR.setSampleRate(sr);
+    filter.setSampleRate(sr);
+    zdf.setSampleRate(sr);
   }
 
   void onReset() override
   {
-    filterL.reset();
-    filterR.reset();
+    resetFilters();
+    controlRate.reset();
+  }
+
+  void resetFilters()
+  {
+    filter.reset();
+    zdf.reset();
+  }
+
+  // Run one stereo frame through the active model
+  void processFilter(const float in[2], float out[2])
+  {
+    if (activeModel == MODEL_ZDF)
+    {
+      using ShortwavDSP::simd::float4;
+      const float4 y = zdf.processSample(float4(in[0], in[1], 0.f, 0.f) * kZdfInputScale);
+      out[0] = y[0] / kZdfInputScale;
+      out[1] = y[1] / kZdfInputScale;
+    }
+    else
+    {
+      filter.processFrame(in, out, 2);
+    }
   }
 
   void process(const ProcessArgs &args) override;
+
+  // Patches are restored before the instance is added (see ControlRateStartup)
+  void fromJson(json_t *rootJ) override
+  {
+    controlRateStartup.restoring();
+    Module::fromJson(rootJ);
+  }
+
+  void onAdd() override
+  {
+    controlRateStartup.added();
+  }
+
+  json_t *dataToJson() override
+  {
+    json_t *rootJ = json_object();
+    controlRateToJson(rootJ, controlRate);
+    json_object_set_new(rootJ, "filterModel", json_integer(filterModel.load()));
+    json_object_set_new(rootJ, "oversampling", json_integer(oversampling.load()));
+    json_object_set_new(rootJ, "saturation", json_boolean(saturation.load()));
+    return rootJ;
+  }
+
+  void dataFromJson(json_t *rootJ) override
+  {
+    controlRateFromJson(rootJ, controlRate);
+    json_t *modelJ = json_object_get(rootJ, "filterModel");
+    if (modelJ)
+      filterModel.store(clamp((int)json_integer_value(modelJ), 0, NUM_MODELS - 1));
+    json_t *oversamplingJ = json_object_get(rootJ, "oversampling");
+    if (oversamplingJ)
+      oversampling.store(clamp((int)json_integer_value(oversamplingJ), 1, 4));
+    json_t *saturationJ = json_object_get(rootJ, "saturation");
+    if (saturationJ)
+      saturation.store(json_boolean_value(saturationJ));
+  }
 };
 
 struct LowPassFilterWidget : ModuleWidget
@@ -162,9 +248,9 @@ struct LowPassFilterWidget : ModuleWidget
           module->params[LowPassFilter::RESONANCE_PARAM].setValue(1.0f);
           break;
         }
-        // Reset filter state to prevent clicks
-        module->filterL.reset();
-        module->filterR.reset();
+        // Reset filter state to prevent clicks (on the audio thread, at the
+        // next control-rate block)
+        module->resetRequested.store(true);
       }
     };
 
@@ -191,5 +277,83 @@ struct LowPassFilterWidget : ModuleWidget
     selfOscItem->module = module;
     selfOscItem->preset = 3;
     menu->addChild(selfOscItem);
+
+    struct ModelItem : MenuItem
+    {
+      LowPassFilter *module;
+      int model;
+      void onAction(const event::Action &e) override
+      {
+        module->filterModel.store(model);
+      }
+      void step() override
+      {
+        rightText = (module->filterModel.load() == model) ? "✔" : "";
+        MenuItem::step();
+      }
+    };
+
+    struct OversamplingItem : MenuItem
+    {
+      LowPassFilter *module;
+      int factor;
+      void onAction(const event::Action &e) override
+      {
+        module->oversampling.store(factor);
+      }
+      void step() override
+      {
+        rightText = (module->oversampling.load() == factor) ? "✔" : "";
+        disabled = (module->filterModel.load() != LowPassFilter::MODEL_ZDF);
+        MenuItem::step();
+      }
+    };
+
+    struct SaturationItem : MenuItem
+    {
+      LowPassFilter *module;
+      void onAction(const event::Action &e) override
+      {
+        module->saturation.store(!module->saturation.load());
+      }
+      void step() override
+      {
+        rightText = module->saturation.load() ? "✔" : "";
+        disabled = (module->filterModel.load() != LowPassFilter::MODEL_ZDF);
+        MenuItem::step();
+      }
+    };
+
+    menu->addChild(new MenuEntry);
+    menu->addChild(createMenuLabel("Filter model"));
+
+    const char *modelNames[LowPassFilter::NUM_MODELS] = {"Classic", "Zero-delay feedback (ZDF)"};
+    for (int model = 0; model < LowPassFilter::NUM_MODELS; ++model)
+    {
+      ModelItem *item = createMenuItem<ModelItem>(modelNames[model]);
+      item->module = module;
+      item->model = model;
+      menu->addChild(item);
+    }
+
+    menu->addChild(new MenuEntry);
+    menu->addChild(createMenuLabel("ZDF oversampling"));
+
+    const int factors[] = {1, 2, 4};
+    for (int factor : factors)
+    {
+      std::string label = (factor == 1) ? "Off" : (std::to_string(factor) + "x");
+      OversamplingItem *item = createMenuItem<OversamplingItem>(label);
+      item->module = module;
+      item->factor = factor;
+      menu->addChild(item);
+    }
+
+    SaturationItem *saturationItem = createMenuItem<SaturationItem>("ZDF saturation (tanh)");
+    saturationItem->module = module;
+    menu->addChild(saturationItem);
+
+    appendControlRateMenu(menu, &module->controlRate);
+    appendDspStatsMenu(menu, "Low Pass Filter", {{"Classic", &module->filter.getStats(), false}, {"ZDF", &module->zdf.getStats(), false}});
   }
 };
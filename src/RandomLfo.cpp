@@ -2,65 +2,87 @@
 
 void RandomLfo::process(const ProcessArgs &args)
 {
-  // Pull base params.
-  float rate = params[RATE_PARAM].getValue();
-  float depth = params[DEPTH_PARAM].getValue();
-  float smooth = params[SMOOTH_PARAM].getValue();
-  bool bipolar = params[BIPOLAR_PARAM].getValue() >= 0.5f;
-
-  // Apply simple CV modulation where available.
-  // Assumptions:
-  // - RATE_CV_INPUT: 1V/oct style modulation around the param (clamped reasonable).
-  // - DEPTH_CV_INPUT: 0-10V mapped to 0..1 additive.
-  // - SMOOTH_CV_INPUT: 0-10V mapped to 0..1 additive.
-  if (inputs[RATE_CV_INPUT].isConnected())
+  // Decode parameters and CV once per control-rate block.
+  if (controlRate.tick())
   {
-    // Map 0-10V to a multiplicative factor ~[0.25,4] around base rate.
-    float v = clamp(inputs[RATE_CV_INPUT].getVoltage(), -10.f, 10.f);
-    float factor = std::pow(2.f, v / 5.f); // +/-5V = +/- one octave
-    rate *= factor;
-  }
+    numChannels = channelCount.load();
 
-  if (inputs[DEPTH_CV_INPUT].isConnected())
-  {
-    float v = clamp(inputs[DEPTH_CV_INPUT].getVoltage() / 10.f, 0.f, 1.f);
-    depth *= v;
-  }
+    // Pull base params.
+    const float rateBase = params[RATE_PARAM].getValue();
+    const float depthBase = params[DEPTH_PARAM].getValue();
+    const float smoothBase = params[SMOOTH_PARAM].getValue();
+    bool bipolar = params[BIPOLAR_PARAM].getValue() >= 0.5f;
 
-  if (inputs[SMOOTH_CV_INPUT].isConnected())
-  {
-    float v = clamp(inputs[SMOOTH_CV_INPUT].getVoltage() / 10.f, 0.f, 1.f);
-    // Blend parameter and CV for stability.
-    smooth = clamp(smooth * 0.5f + v * 0.5f, 0.f, 1.f);
-  }
+    // Apply simple CV modulation where available (polyphonic cables are read
+    // per channel, a mono cable is shared by all channels).
+    // Assumptions:
+    // - RATE_CV_INPUT: 1V/oct style modulation around the param (clamped reasonable).
+    // - DEPTH_CV_INPUT: 0-10V mapped to 0..1 additive.
+    // - SMOOTH_CV_INPUT: 0-10V mapped to 0..1 additive.
+    auto decodeChannel = [&](int c, float &rate, float &depth, float &smooth) {
+      rate = rateBase;
+      depth = depthBase;
+      smooth = smoothBase;
 
-  // Clamp and apply to LFO engine.
-  rate = clamp(rate, 0.0f, 40.f); // hard guard
-  depth = clamp(depth, 0.f, 1.f);
-  smooth = clamp(smooth, 0.f, 1.f);
+      if (inputs[RATE_CV_INPUT].isConnected())
+      {
+        // Map 0-10V to a multiplicative factor ~[0.25,4] around base rate.
+        float v = clamp(inputs[RATE_CV_INPUT].getPolyVoltage(c), -10.f, 10.f);
+        float factor = std::pow(2.f, v / 5.f); // +/-5V = +/- one octave
+        rate *= factor;
+      }
 
-  lfo.setRate(rate);
-  lfo.setDepth(depth);
-  lfo.setSmooth(smooth);
-  lfo.setBipolar(bipolar);
+      if (inputs[DEPTH_CV_INPUT].isConnected())
+      {
+        float v = clamp(inputs[DEPTH_CV_INPUT].getPolyVoltage(c) / 10.f, 0.f, 1.f);
+        depth *= v;
+      }
 
-  // Generate one sample per audio sample; Rack drives process() at audio rate.
-  float value = lfo.processSample();
+      if (inputs[SMOOTH_CV_INPUT].isConnected())
+      {
+        float v = clamp(inputs[SMOOTH_CV_INPUT].getPolyVoltage(c) / 10.f, 0.f, 1.f);
+        // Blend parameter and CV for stability.
+        smooth = clamp(smooth * 0.5f + v * 0.5f, 0.f, 1.f);
+      }
 
-  // Map to a useful voltage range for modulation:
-  // - Bipolar: [-5V, +5V]
-  // - Unipolar: [0V, +10V]
-  float outV = 0.f;
-  if (bipolar)
-  {
-    outV = value * 5.f; // value already in [-1,1]*depth
-  }
-  else
-  {
-    outV = value * 10.f; // value in [0,1]*depth
+      // Clamp before handing to the LFO engine.
+      rate = clamp(rate, 0.0f, 40.f); // hard guard
+      depth = clamp(depth, 0.f, 1.f);
+      smooth = clamp(smooth, 0.f, 1.f);
+    };
+
+    // Without polyphonic CV every channel shares one decode (one std::pow)
+    const bool polyCv = inputs[RATE_CV_INPUT].getChannels() > 1 ||
+                        inputs[DEPTH_CV_INPUT].getChannels() > 1 ||
+                        inputs[SMOOTH_CV_INPUT].getChannels() > 1;
+    float rate, depth, smooth;
+    decodeChannel(0, rate, depth, smooth);
+    for (int c = 0; c < numChannels; ++c)
+    {
+      if (polyCv && c > 0)
+        decodeChannel(c, rate, depth, smooth);
+      lfo.setChannel(c, rate, depth, smooth);
+    }
+    lfo.setBipolar(bipolar);
+    outputBipolar = bipolar;
+
+    // Output only, so the whole block can be rendered up front.
+    const int blockSize = controlRate.getBlockSize();
+    for (int i = 0; i < blockSize; ++i)
+      lfo.processFrame(block[i], numChannels);
+    blockPos = 0;
   }
 
-  outputs[LFO_OUTPUT].setVoltage(outV);
+  // Emit one frame of the current block per audio sample.
+  const float *frame = block[blockPos++];
+
+  // Map to a useful voltage range for modulation:
+  // - Bipolar: [-5V, +5V]  (value already in [-1,1]*depth)
+  // - Unipolar: [0V, +10V] (value in [0,1]*depth)
+  const float scale = outputBipolar ? 5.f : 10.f;
+  outputs[LFO_OUTPUT].setChannels(numChannels);
+  for (int c = 0; c < numChannels; ++c)
+    outputs[LFO_OUTPUT].setVoltage(frame[c] * scale, c);
 }
 
 Model *modelRandomLfo = createModel<RandomLfo, RandomLfoWidget>("RandomLfo");
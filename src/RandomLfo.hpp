@@ -3,6 +3,14 @@
 #include "plugin.hpp"
 
 #include "dsp/random-lfo.h"
+#include "ControlRate.hpp"
+#include "DspStats.hpp"
+
+// RandomLfo Module
+// - Up to 16 independent random LFOs on one polyphonic output (context menu
+//   → Channels), each with its own seed, run as one SIMD RandomLFOBank
+// - Polyphonic CV inputs modulate matching channels; mono CV applies to all
+// - Parameters and CV decoded at control rate, blocks rendered up front
 
 struct RandomLfo : Module
 {
@@ -34,7 +42,21 @@ struct RandomLfo : Module
     NUM_LIGHTS
   };
 
-  ShortwavDSP::RandomLFO lfo;
+  static constexpr int kMaxChannels = ShortwavDSP::RandomLFOBank::kMaxChannels;
+
+  ShortwavDSP::RandomLFOBank lfo;
+  ShortwavDSP::ControlRateDivider controlRate;
+  ShortwavDSP::ControlRateStartup controlRateStartup{controlRate};
+
+  // Output channel count chosen from the menu (UI thread), applied by the
+  // audio thread at the next control-rate block
+  std::atomic<int> channelCount{1};
+  int numChannels = 1;
+
+  // Frames rendered for the current control-rate block.
+  float block[ShortwavDSP::ControlRateDivider::kMaxDivision][kMaxChannels] = {};
+  int blockPos = 0;
+  bool outputBipolar = true; // polarity the current block was rendered with
 
   RandomLfo()
   {
@@ -58,10 +80,40 @@ struct RandomLfo : Module
     float sr = APP->engine->getSampleRate();
     lfo.setSampleRate(sr);
     // Seed based on module id pointer for deterministic but distinct instances
+    // (channel 0 keeps the single-LFO sequence, the others derive from it)
     lfo.seed(reinterpret_cast<uint64_t>(this) & 0xFFFFFFFFu);
+    controlRate.reset();
   }
 
   void process(const ProcessArgs &args) override;
+
+  // Patches are restored before the instance is added (see ControlRateStartup)
+  void fromJson(json_t *rootJ) override
+  {
+    controlRateStartup.restoring();
+    Module::fromJson(rootJ);
+  }
+
+  void onAdd() override
+  {
+    controlRateStartup.added();
+  }
+
+  json_t *dataToJson() override
+  {
+    json_t *rootJ = json_object();
+    controlRateToJson(rootJ, controlRate);
+    json_object_set_new(rootJ, "channels", json_integer(channelCount.load()));
+    return rootJ;
+  }
+
+  void dataFromJson(json_t *rootJ) override
+  {
+    controlRateFromJson(rootJ, controlRate);
+    json_t *channelsJ = json_object_get(rootJ, "channels");
+    if (channelsJ)
+      channelCount.store(clamp((int)json_integer_value(channelsJ), 1, kMaxChannels));
+  }
 };
 
 struct RandomLfoWidget : ModuleWidget
@@ -156,5 +208,34 @@ struct RandomLfoWidget : ModuleWidget
       presetItem->preset = i;
       menu->addChild(presetItem);
     }
+
+    struct ChannelsItem : MenuItem
+    {
+      RandomLfo *module;
+      int channels;
+      void onAction(const event::Action &e) override
+      {
+        module->channelCount.store(channels);
+      }
+      void step() override
+      {
+        rightText = (module->channelCount.load() == channels) ? "✔" : "";
+        MenuItem::step();
+      }
+    };
+
+    menu->addChild(new MenuEntry);
+    menu->addChild(createMenuLabel("Channels"));
+
+    for (int channels = 1; channels <= RandomLfo::kMaxChannels; ++channels)
+    {
+      ChannelsItem *item = createMenuItem<ChannelsItem>(std::to_string(channels));
+      item->module = module;
+      item->channels = channels;
+      menu->addChild(item);
+    }
+
+    appendControlRateMenu(menu, &module->controlRate);
+    appendDspStatsMenu(menu, "Random LFO", {{"LFO", &module->lfo.getStats(), false}});
   }
 };
@@ -1,5 +1,15 @@
 #include "ThreeBandEQ.hpp"
 
+// Band outputs carry nothing while there is no input or the EQ is bypassed
+void ThreeBandEQ::silenceBandOutputs()
+{
+  for (int output = LOW_L_OUTPUT; output <= HIGH_R_OUTPUT; ++output)
+  {
+    outputs[output].setChannels(1);
+    outputs[output].setVoltage(0.0f);
+  }
+}
+
 void ThreeBandEQ::process(const ProcessArgs &args)
 {
   // Update bypass state from parameter
@@ -16,81 +26,113 @@ void ThreeBandEQ::process(const ProcessArgs &args)
   // Update bypass LED
   lights[BYPASS_LIGHT].setBrightness(bypassed ? 1.0f : 0.0f);
 
-  // Get base parameter values
-  float lowFreq = params[LOW_FREQ_PARAM].getValue();
-  float highFreq = params[HIGH_FREQ_PARAM].getValue();
-  float lowGainDB = params[LOW_GAIN_PARAM].getValue();
-  float midGainDB = params[MID_GAIN_PARAM].getValue();
-  float highGainDB = params[HIGH_GAIN_PARAM].getValue();
-
-  // Apply CV modulation to crossover frequencies
-  // CV is 0-10V, map to frequency range with exponential scaling for musical response
-  if (inputs[LOW_FREQ_CV_INPUT].isConnected())
+  // Decode parameters and CV once per control-rate block
+  if (controlRate.tick())
   {
-    float cv = inputs[LOW_FREQ_CV_INPUT].getVoltage();
-    // Map 0-10V to 0-1 range, then scale exponentially
-    float cvNorm = clamp(cv / 10.0f, 0.0f, 1.0f);
-    float freqRange = 250.0f - 80.0f; // 170 Hz range
-    lowFreq = 80.0f + cvNorm * freqRange;
-  }
+    // Get base parameter values
+    float lowFreq = params[LOW_FREQ_PARAM].getValue();
+    float highFreq = params[HIGH_FREQ_PARAM].getValue();
+    float lowGainDB = params[LOW_GAIN_PARAM].getValue();
+    float midGainDB = params[MID_GAIN_PARAM].getValue();
+    float highGainDB = params[HIGH_GAIN_PARAM].getValue();
+
+    // Apply CV modulation to crossover frequencies
+    // CV is 0-10V, map to frequency range with exponential scaling for musical response
+    if (inputs[LOW_FREQ_CV_INPUT].isConnected())
+    {
+      float cv = inputs[LOW_FREQ_CV_INPUT].getVoltage();
+      // Map 0-10V to 0-1 range, then scale exponentially
+      float cvNorm = clamp(cv / 10.0f, 0.0f, 1.0f);
+      float freqRange = 250.0f - 80.0f; // 170 Hz range
+      lowFreq = 80.0f + cvNorm * freqRange;
+    }
 
-  if (inputs[HIGH_FREQ_CV_INPUT].isConnected())
-  {
-    float cv = inputs[HIGH_FREQ_CV_INPUT].getVoltage();
-    float cvNorm = clamp(cv / 10.0f, 0.0f, 1.0f);
-    float freqRange = 4000.0f - 1000.0f; // 3000 Hz range
-    highFreq = 1000.0f + cvNorm * freqRange;
-  }
+    if (inputs[HIGH_FREQ_CV_INPUT].isConnected())
+    {
+      float cv = inputs[HIGH_FREQ_CV_INPUT].getVoltage();
+      float cvNorm = clamp(cv / 10.0f, 0.0f, 1.0f);
+      float freqRange = 4000.0f - 1000.0f; // 3000 Hz range
+      highFreq = 1000.0f + cvNorm * freqRange;
+    }
 
-  // Apply CV modulation to gains
-  // CV is -5V to +5V bipolar, maps to -12dB to +12dB
-  if (inputs[LOW_GAIN_CV_INPUT].isConnected())
-  {
-    float cv = inputs[LOW_GAIN_CV_INPUT].getVoltage();
-    // Map -5V to +5V -> -12dB to +12dB
-    float cvDB = clamp(cv * 2.4f, -12.0f, 12.0f); // 2.4 = 12/5
-    lowGainDB = clamp(lowGainDB + cvDB, -12.0f, 12.0f);
-  }
+    // Apply CV modulation to gains
+    // CV is -5V to +5V bipolar, maps to -12dB to +12dB
+    if (inputs[LOW_GAIN_CV_INPUT].isConnected())
+    {
+      float cv = inputs[LOW_GAIN_CV_INPUT].getVoltage();
+      // Map -5V to +5V -> -12dB to +12dB
+      float cvDB = clamp(cv * 2.4f, -12.0f, 12.0f); // 2.4 = 12/5
+      lowGainDB = clamp(lowGainDB + cvDB, -12.0f, 12.0f);
+    }
 
-  if (inputs[MID_GAIN_CV_INPUT].isConnected())
-  {
-    float cv = inputs[MID_GAIN_CV_INPUT].getVoltage();
-    float cvDB = clamp(cv * 2.4f, -12.0f, 12.0f);
-    midGainDB = clamp(midGainDB + cvDB, -12.0f, 12.0f);
-  }
+    if (inputs[MID_GAIN_CV_INPUT].isConnected())
+    {
+      float cv = inputs[MID_GAIN_CV_INPUT].getVoltage();
+      float cvDB = clamp(cv * 2.4f, -12.0f, 12.0f);
+      midGainDB = clamp(midGainDB + cvDB, -12.0f, 12.0f);
+    }
 
-  if (inputs[HIGH_GAIN_CV_INPUT].isConnected())
-  {
-    float cv = inputs[HIGH_GAIN_CV_INPUT].getVoltage();
-    float cvDB = clamp(cv * 2.4f, -12.0f, 12.0f);
-    highGainDB = clamp(highGainDB + cvDB, -12.0f, 12.0f);
-  }
+    if (inputs[HIGH_GAIN_CV_INPUT].isConnected())
+    {
+      float cv = inputs[HIGH_GAIN_CV_INPUT].getVoltage();
+      float cvDB = clamp(cv * 2.4f, -12.0f, 12.0f);
+      highGainDB = clamp(highGainDB + cvDB, -12.0f, 12.0f);
+    }
 
-  // Update EQ parameters
-  eq.setCrossoverFreqs(lowFreq, highFreq);
-  eq.setGainsDB(lowGainDB, midGainDB, highGainDB);
+    // Update EQ parameters (coefficients ramp across the block); a new
+    // crossover mode starts from cleared filter state
+    eq.setCrossoverMode(static_cast<ShortwavDSP::CrossoverMode>(crossoverMode.load()));
+    eq.setParameterRamp(controlRate.getBlockSize());
+    eq.setCrossoverFreqs(lowFreq, highFreq);
+    eq.setGainsDB(lowGainDB, midGainDB, highGainDB);
+    analysis.storeSettings(eq);
+  }
 
-  // Process audio
+  // Process audio (polyphonic: one output channel per input channel)
   bool leftConnected = inputs[AUDIO_L_INPUT].isConnected();
   bool rightConnected = inputs[AUDIO_R_INPUT].isConnected();
 
   if (!leftConnected && !rightConnected)
   {
     // No inputs connected, output silence
+    outputs[AUDIO_L_OUTPUT].setChannels(1);
+    outputs[AUDIO_R_OUTPUT].setChannels(1);
     outputs[AUDIO_L_OUTPUT].setVoltage(0.0f);
     outputs[AUDIO_R_OUTPUT].setVoltage(0.0f);
+    silenceBandOutputs();
+    if (analysis.isActive())
+    {
+      const float silence[3] = {0.0f, 0.0f, 0.0f};
+      analysis.analyzer.push(silence);
+    }
     return;
   }
 
+  const int channels = std::min(std::max(inputs[AUDIO_L_INPUT].getChannels(),
+                                         inputs[AUDIO_R_INPUT].getChannels()),
+                                ShortwavDSP::ThreeBandEQ::kMaxPolyChannels);
+  outputs[AUDIO_L_OUTPUT].setChannels(channels);
+  outputs[AUDIO_R_OUTPUT].setChannels(channels);
+
   // Get input voltages (Rack uses -10V to +10V for audio)
-  float leftIn = leftConnected ? inputs[AUDIO_L_INPUT].getVoltage() : 0.0f;
-  float rightIn = rightConnected ? inputs[AUDIO_R_INPUT].getVoltage() : leftIn; // Mono to stereo
+  // A mono cable is spread across all channels; R normals to L (mono to stereo)
+  float leftIn[ShortwavDSP::ThreeBandEQ::kMaxPolyChannels];
+  float rightIn[ShortwavDSP::ThreeBandEQ::kMaxPolyChannels];
+  for (int c = 0; c < channels; ++c)
+  {
+    leftIn[c] = leftConnected ? inputs[AUDIO_L_INPUT].getPolyVoltage(c) : 0.0f;
+    rightIn[c] = rightConnected ? inputs[AUDIO_R_INPUT].getPolyVoltage(c) : leftIn[c];
+  }
 
   // If bypassed, pass audio through without processing
   if (bypassed)
   {
-    outputs[AUDIO_L_OUTPUT].setVoltage(leftIn);
-    outputs[AUDIO_R_OUTPUT].setVoltage(rightIn);
+    for (int c = 0; c < channels; ++c)
+    {
+      outputs[AUDIO_L_OUTPUT].setVoltage(leftIn[c], c);
+      outputs[AUDIO_R_OUTPUT].setVoltage(rightIn[c], c);
+    }
+    silenceBandOutputs();
     return;
   }
 
@@ -98,23 +140,62 @@ void ThreeBandEQ::process(const ProcessArgs &args)
   const float rackToNorm = 0.1f; // 1/10
   const float normToRack = 10.0f;
 
-  float leftNorm = leftIn * rackToNorm;
-  float rightNorm = rightIn * rackToNorm;
+  float leftNorm[ShortwavDSP::ThreeBandEQ::kMaxPolyChannels];
+  float rightNorm[ShortwavDSP::ThreeBandEQ::kMaxPolyChannels];
+  for (int c = 0; c < channels; ++c)
+  {
+    leftNorm[c] = leftIn[c] * rackToNorm;
+    rightNorm[c] = rightIn[c] * rackToNorm;
+  }
 
-  // Process through equalizer
-  eq.processStereoSample(leftNorm, rightNorm);
+  // Process through equalizer (4 channels per SIMD group); while a display
+  // is open, the band outputs also go to the analyzer, and connected band
+  // outputs get every channel's bands from the same pass
+  bool splitConnected = false;
+  for (int output = LOW_L_OUTPUT; output <= HIGH_R_OUTPUT; ++output)
+    splitConnected = splitConnected || outputs[output].isConnected();
 
-  // Scale back to Rack voltage range and output
-  float leftOut = leftNorm * normToRack;
-  float rightOut = rightNorm * normToRack;
+  ShortwavDSP::ThreeBandEQ::BandSplit splitL, splitR;
+  if (analysis.isActive() || splitConnected)
+  {
+    float bands[3];
+    const bool active = analysis.isActive();
+    eq.processPolyStereo(leftNorm, rightNorm, leftNorm, rightNorm, channels, active ? bands : nullptr,
+                         splitConnected ? &splitL : nullptr, splitConnected ? &splitR : nullptr);
+    if (active)
+      analysis.analyzer.push(bands);
+  }
+  else
+  {
+    eq.processPolyStereo(leftNorm, rightNorm, leftNorm, rightNorm, channels);
+  }
 
-  // Soft clipping to prevent harsh digital clipping
-  // (EQ boost can increase levels significantly)
-  leftOut = clamp(leftOut, -10.0f, 10.0f);
-  rightOut = clamp(rightOut, -10.0f, 10.0f);
+  if (splitConnected)
+  {
+    const float *splitBands[6] = {splitL.low, splitR.low, splitL.mid, splitR.mid, splitL.high, splitR.high};
+    for (int b = 0; b < 6; ++b)
+    {
+      Output &output = outputs[LOW_L_OUTPUT + b];
+      output.setChannels(channels);
+      for (int c = 0; c < channels; ++c)
+        output.setVoltage(clamp(splitBands[b][c] * normToRack, -10.0f, 10.0f), c);
+    }
+  }
+
+  for (int c = 0; c < channels; ++c)
+  {
+    // Scale back to Rack voltage range and output
+    float leftOut = leftNorm[c] * normToRack;
+    float rightOut = rightNorm[c] * normToRack;
 
-  outputs[AUDIO_L_OUTPUT].setVoltage(leftOut);
-  outputs[AUDIO_R_OUTPUT].setVoltage(rightOut);
+    // Soft clipping to prevent harsh digital clipping
+    // (EQ boost can increase levels significantly)
+    leftOut = clamp(leftOut, -10.0f, 10.0f);
+    rightOut = clamp(rightOut, -10.0f, 10.0f);
+
+    outputs[AUDIO_L_OUTPUT].setVoltage(leftOut, c);
+    outputs[AUDIO_R_OUTPUT].setVoltage(rightOut, c);
+  }
 }
 
 // Create the model (required for plugin registration)
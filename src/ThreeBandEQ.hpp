@@ -3,6 +3,8 @@
 #include "plugin.hpp"
 #include "dsp/3-band-eq.h"
 #include "ThreeBandEQDisplay.hpp"
+#include "ControlRate.hpp"
+#include "DspStats.hpp"
 
 struct ThreeBandEQ : Module
 {
@@ -33,6 +35,12 @@ struct ThreeBandEQ : Module
   {
     AUDIO_L_OUTPUT,
     AUDIO_R_OUTPUT,
+    LOW_L_OUTPUT, // Band outputs: gain-scaled, polyphonic; the three sum to AUDIO
+    LOW_R_OUTPUT,
+    MID_L_OUTPUT,
+    MID_R_OUTPUT,
+    HIGH_L_OUTPUT,
+    HIGH_R_OUTPUT,
     NUM_OUTPUTS
   };
 
@@ -43,8 +51,17 @@ struct ThreeBandEQ : Module
   };
 
   ShortwavDSP::ThreeBandEQ eq;
+  ShortwavDSP::ControlRateDivider controlRate;
+  ShortwavDSP::ControlRateStartup controlRateStartup{controlRate};
   bool bypassed = false;
 
+  // Menu selection (UI thread), applied by the audio thread at the next
+  // control-rate block
+  std::atomic<int> crossoverMode{(int)ShortwavDSP::CrossoverMode::Classic};
+
+  // Band levels, spectrum and applied settings for the displays
+  EQAnalysis analysis;
+
   ThreeBandEQ()
   {
     config(NUM_PARAMS, NUM_INPUTS, NUM_OUTPUTS, NUM_LIGHTS);
@@ -64,8 +81,8 @@ struct ThreeBandEQ : Module
     configParam(BYPASS_PARAM, 0.f, 1.f, 0.f, "Bypass");
 
     // Configure inputs
-    configInput(AUDIO_L_INPUT, "Audio L");
-    configInput(AUDIO_R_INPUT, "Audio R");
+    configInput(AUDIO_L_INPUT, "Audio L (polyphonic)");
+    configInput(AUDIO_R_INPUT, "Audio R (polyphonic)");
     configInput(LOW_FREQ_CV_INPUT, "Low Freq CV");
     configInput(HIGH_FREQ_CV_INPUT, "High Freq CV");
     configInput(LOW_GAIN_CV_INPUT, "Low Gain CV");
@@ -75,6 +92,12 @@ struct ThreeBandEQ : Module
     // Configure outputs
     configOutput(AUDIO_L_OUTPUT, "Audio L");
     configOutput(AUDIO_R_OUTPUT, "Audio R");
+    configOutput(LOW_L_OUTPUT, "Low band L");
+    configOutput(LOW_R_OUTPUT, "Low band R");
+    configOutput(MID_L_OUTPUT, "Mid band L");
+    configOutput(MID_R_OUTPUT, "Mid band R");
+    configOutput(HIGH_L_OUTPUT, "High band L");
+    configOutput(HIGH_R_OUTPUT, "High band R");
 
     onSampleRateChange();
   }
@@ -83,20 +106,38 @@ struct ThreeBandEQ : Module
   {
     float sr = APP->engine->getSampleRate();
     eq.setSampleRate(sr);
+    analysis.analyzer.setSampleRate(sr);
+    analysis.storeSettings(eq);
   }
 
   void onReset() override
   {
     eq.reset();
+    controlRate.reset();
     bypassed = false;
   }
 
   void process(const ProcessArgs &args) override;
+  void silenceBandOutputs();
+
+  // Patches are restored before the instance is added (see ControlRateStartup)
+  void fromJson(json_t *rootJ) override
+  {
+    controlRateStartup.restoring();
+    Module::fromJson(rootJ);
+  }
+
+  void onAdd() override
+  {
+    controlRateStartup.added();
+  }
 
   json_t *dataToJson() override
   {
     json_t *rootJ = json_object();
     json_object_set_new(rootJ, "bypassed", json_boolean(bypassed));
+    json_object_set_new(rootJ, "crossoverMode", json_integer(crossoverMode.load()));
+    controlRateToJson(rootJ, controlRate);
     return rootJ;
   }
 
@@ -105,6 +146,10 @@ struct ThreeBandEQ : Module
     json_t *bypassedJ = json_object_get(rootJ, "bypassed");
     if (bypassedJ)
       bypassed = json_boolean_value(bypassedJ);
+    json_t *modeJ = json_object_get(rootJ, "crossoverMode");
+    if (modeJ)
+      crossoverMode.store(clamp((int)json_integer_value(modeJ), 0, (int)ShortwavDSP::CrossoverMode::LinkwitzRiley));
+    controlRateFromJson(rootJ, controlRate);
   }
 };
 
@@ -124,9 +169,16 @@ struct ThreeBandEQWidget : ModuleWidget
     EQFrequencyResponseDisplay *freqDisplay = new EQFrequencyResponseDisplay();
     freqDisplay->box.pos = Vec(0, 20);
     freqDisplay->box.size = Vec(240, 135);
-    freqDisplay->module = module;
+    freqDisplay->analysis = module ? &module->analysis : nullptr;
     addChild(freqDisplay);
 
+    // Band level meters (right of the response display)
+    EQGainMeterDisplay *meterDisplay = new EQGainMeterDisplay();
+    meterDisplay->box.pos = Vec(245, 20);
+    meterDisplay->box.size = Vec(80, 135);
+    meterDisplay->analysis = module ? &module->analysis : nullptr;
+    addChild(meterDisplay);
+
     // Crossover frequency knobs
     addParam(createParam<RoundLargeBlackKnob>(Vec(25, 245), module, ThreeBandEQ::LOW_FREQ_PARAM));
     addParam(createParam<RoundLargeBlackKnob>(Vec(75, 245), module, ThreeBandEQ::HIGH_FREQ_PARAM));
@@ -155,6 +207,14 @@ struct ThreeBandEQWidget : ModuleWidget
     // Audio outputs (bottom)
     addOutput(createOutput<PJ301MPort>(Vec(195, 315), module, ThreeBandEQ::AUDIO_L_OUTPUT));
     addOutput(createOutput<PJ301MPort>(Vec(195, 345), module, ThreeBandEQ::AUDIO_R_OUTPUT));
+
+    // Band outputs (bottom right: low, mid, high columns; L above R)
+    addOutput(createOutput<PJ301MPort>(Vec(235, 315), module, ThreeBandEQ::LOW_L_OUTPUT));
+    addOutput(createOutput<PJ301MPort>(Vec(235, 345), module, ThreeBandEQ::LOW_R_OUTPUT));
+    addOutput(createOutput<PJ301MPort>(Vec(265, 315), module, ThreeBandEQ::MID_L_OUTPUT));
+    addOutput(createOutput<PJ301MPort>(Vec(265, 345), module, ThreeBandEQ::MID_R_OUTPUT));
+    addOutput(createOutput<PJ301MPort>(Vec(295, 315), module, ThreeBandEQ::HIGH_L_OUTPUT));
+    addOutput(createOutput<PJ301MPort>(Vec(295, 345), module, ThreeBandEQ::HIGH_R_OUTPUT));
   }
 
   void appendContextMenu(Menu *menu) override
@@ -243,5 +303,35 @@ struct ThreeBandEQWidget : ModuleWidget
       presetItem->preset = i;
       menu->addChild(presetItem);
     }
+
+    struct CrossoverItem : MenuItem
+    {
+      ThreeBandEQ *module;
+      int mode;
+      void onAction(const event::Action &e) override
+      {
+        module->crossoverMode.store(mode);
+      }
+      void step() override
+      {
+        rightText = (module->crossoverMode.load() == mode) ? "✔" : "";
+        MenuItem::step();
+      }
+    };
+
+    menu->addChild(new MenuEntry);
+    menu->addChild(createMenuLabel("Crossover"));
+
+    const char *crossoverNames[] = {"Classic (one-pole cascades)", "Linkwitz-Riley 24 dB/oct (flat sum)"};
+    for (int mode = 0; mode < 2; ++mode)
+    {
+      CrossoverItem *item = createMenuItem<CrossoverItem>(crossoverNames[mode]);
+      item->module = module;
+      item->mode = mode;
+      menu->addChild(item);
+    }
+
+    appendControlRateMenu(menu, &module->controlRate);
+    appendDspStatsMenu(menu, "3-Band EQ", {{"EQ", &module->eq.getStats(), false}});
   }
 };
@@ -2,79 +2,130 @@
 
 #include "plugin.hpp"
 #include "dsp/3-band-eq.h"
+#include "dsp/spectrum-analyzer.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cmath>
+#include <memory>
+#include <thread>
+#include <vector>
 
-// Forward declaration
-struct ThreeBandEQ;
+// Analysis shared by the module and its displays
+// - The audio thread pushes the band outputs to a BandAnalyzer ring and
+//   stores the EQ settings it applied; nothing is pushed until a display
+//   has started the worker
+// - The worker thread drains the ring and publishes spectrum/level
+//   snapshots; the displays redraw from the latest snapshot and recompute
+//   the exact response only when the applied settings change
+struct EQAnalysis
+{
+  static constexpr float kMinFreq = 20.f;
+  static constexpr float kMaxFreq = 20000.f;
+  static constexpr int kNumPoints = 200;
+
+  ShortwavDSP::BandAnalyzer analyzer{kMinFreq, kMaxFreq, kNumPoints};
+
+  // Settings last applied by the audio thread (gains linear)
+  std::atomic<float> sampleRate{44100.f};
+  std::atomic<float> lowFreq{150.f};
+  std::atomic<float> highFreq{2500.f};
+  std::atomic<float> lowGain{1.f};
+  std::atomic<float> midGain{1.f};
+  std::atomic<float> highGain{1.f};
+  std::atomic<int> crossoverMode{(int)ShortwavDSP::CrossoverMode::Classic};
+
+  ~EQAnalysis()
+  {
+    workerExit_.store(true);
+    if (worker_.joinable())
+      worker_.join();
+  }
+
+  // Audio thread: true once a display wants band frames
+  bool isActive() const
+  {
+    return active_.load(std::memory_order_relaxed);
+  }
+
+  // Audio thread, once per control-rate block
+  void storeSettings(const ShortwavDSP::ThreeBandEQ &eq)
+  {
+    sampleRate.store(eq.getSampleRate(), std::memory_order_relaxed);
+    lowFreq.store(eq.getLowFreq(), std::memory_order_relaxed);
+    highFreq.store(eq.getHighFreq(), std::memory_order_relaxed);
+    lowGain.store(eq.getLowGain(), std::memory_order_relaxed);
+    midGain.store(eq.getMidGain(), std::memory_order_relaxed);
+    highGain.store(eq.getHighGain(), std::memory_order_relaxed);
+    crossoverMode.store((int)eq.getCrossoverMode(), std::memory_order_relaxed);
+  }
+
+  // UI thread: start the worker (first call only)
+  void start()
+  {
+    if (worker_.joinable())
+      return;
+    worker_ = std::thread([this]() {
+      while (!workerExit_.load())
+      {
+        analyzer.update();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
+    });
+    active_.store(true);
+  }
+
+private:
+  std::atomic<bool> active_{false};
+  std::atomic<bool> workerExit_{false};
+  std::thread worker_;
+};
 
 // Frequency Response Display Widget
-// Visualizes the EQ curve with low/mid/high band response
+// Draws the exact EQ response over the live output spectrum
 struct EQFrequencyResponseDisplay : TransparentWidget
 {
-  Module *module = nullptr;
-  
+  EQAnalysis *analysis = nullptr;
+
   // Frequency range for display (20 Hz - 20 kHz)
-  const float minFreq = 20.f;
-  const float maxFreq = 20000.f;
-  
-  // Number of points to calculate for curve
-  const int numPoints = 200;
+  const float minFreq = EQAnalysis::kMinFreq;
+  const float maxFreq = EQAnalysis::kMaxFreq;
+
+  // Spectrum level range (dB relative to 10V)
+  const float spectrumTopDB = 0.f;
+  const float spectrumBottomDB = -96.f;
+
+  // Response curve cache (recomputed when the applied settings change)
+  float cachedSettings[7] = {};
+  std::vector<float> responseDB;
+
+  void step() override
+  {
+    TransparentWidget::step();
+    if (analysis)
+      analysis->start();
+  }
 
   void drawLayer(const DrawArgs &args, int layer) override
   {
     if (layer != 1)
       return;
-    
-    if (!module)
+
+    if (!analysis)
     {
       drawPlaceholder(args);
       return;
     }
 
     NVGcontext *vg = args.vg;
-    
-    // Get current EQ parameters using enum values 0-5
-    float lowFreq = module->params[0].getValue();  // LOW_FREQ_PARAM
-    float highFreq = module->params[1].getValue(); // HIGH_FREQ_PARAM
-    float lowGain = module->params[2].getValue();  // LOW_GAIN_PARAM
-    float midGain = module->params[3].getValue();  // MID_GAIN_PARAM
-    float highGain = module->params[4].getValue(); // HIGH_GAIN_PARAM
-    
-    // Apply CV modulation if connected
-    if (module->inputs[2].isConnected()) // LOW_FREQ_CV_INPUT
-    {
-      float cv = module->inputs[2].getVoltage();
-      lowFreq += cv * 17.f; // 0-10V = 0-170Hz range
-      lowFreq = clamp(lowFreq, 80.f, 250.f);
-    }
-    
-    if (module->inputs[3].isConnected()) // HIGH_FREQ_CV_INPUT
-    {
-      float cv = module->inputs[3].getVoltage();
-      highFreq += cv * 300.f; // 0-10V = 0-3000Hz range
-      highFreq = clamp(highFreq, 1000.f, 4000.f);
-    }
-    
-    if (module->inputs[4].isConnected()) // LOW_GAIN_CV_INPUT
-    {
-      float cv = module->inputs[4].getVoltage();
-      lowGain += cv * 2.4f; // ±5V = ±12dB
-      lowGain = clamp(lowGain, -12.f, 12.f);
-    }
-    
-    if (module->inputs[5].isConnected()) // MID_GAIN_CV_INPUT
-    {
-      float cv = module->inputs[5].getVoltage();
-      midGain += cv * 2.4f;
-      midGain = clamp(midGain, -12.f, 12.f);
-    }
-    
-    if (module->inputs[6].isConnected()) // HIGH_GAIN_CV_INPUT
-    {
-      float cv = module->inputs[6].getVoltage();
-      highGain += cv * 2.4f;
-      highGain = clamp(highGain, -12.f, 12.f);
-    }
+
+    // Settings the audio thread last applied
+    const float lowFreq = analysis->lowFreq.load();
+    const float highFreq = analysis->highFreq.load();
+    const float lowGain = ShortwavDSP::detail::gainToDB(analysis->lowGain.load());
+    const float midGain = ShortwavDSP::detail::gainToDB(analysis->midGain.load());
+    const float highGain = ShortwavDSP::detail::gainToDB(analysis->highGain.load());
+    updateResponse();
 
     // Draw background
     nvgBeginPath(vg);
@@ -84,19 +135,22 @@ struct EQFrequencyResponseDisplay : TransparentWidget
 
     // Draw frequency grid lines
     drawFrequencyGrid(vg);
-    
+
     // Draw gain grid lines
     drawGainGrid(vg);
-    
+
     // Draw frequency band regions
     drawBandRegions(vg, lowFreq, highFreq);
-    
+
+    // Draw the live output spectrum behind the curve
+    drawSpectrum(vg);
+
     // Draw frequency response curve
-    drawResponseCurve(vg, lowFreq, highFreq, lowGain, midGain, highGain);
-    
+    drawResponseCurve(vg);
+
     // Draw crossover frequency markers
     drawCrossoverMarkers(vg, lowFreq, highFreq);
-    
+
     // Draw gain labels
     drawGainLabels(vg, lowGain, midGain, highGain);
   }
@@ -210,32 +264,64 @@ struct EQFrequencyResponseDisplay : TransparentWidget
     nvgFill(vg);
   }
 
-  void drawResponseCurve(NVGcontext *vg, float lowFreq, float highFreq, 
-                         float lowGain, float midGain, float highGain)
+  // Recompute the exact response at the display points if the applied
+  // settings changed (once per change, not per frame)
+  void updateResponse()
   {
+    const float settings[7] = {analysis->sampleRate.load(), analysis->lowFreq.load(), analysis->highFreq.load(),
+                               analysis->lowGain.load(), analysis->midGain.load(), analysis->highGain.load(),
+                               (float)analysis->crossoverMode.load()};
+    if (!responseDB.empty() && std::equal(settings, settings + 7, cachedSettings))
+      return;
+    std::copy(settings, settings + 7, cachedSettings);
+
+    const ShortwavDSP::BandAnalyzer &analyzer = analysis->analyzer;
+    responseDB.resize(analyzer.getNumPoints());
+    for (int i = 0; i < analyzer.getNumPoints(); i++)
+    {
+      const float magnitude = ShortwavDSP::ThreeBandEQ::magnitudeResponse(
+          analyzer.pointFrequency(i), settings[0], settings[1], settings[2], settings[3], settings[4], settings[5],
+          static_cast<ShortwavDSP::CrossoverMode>((int)settings[6]));
+      responseDB[i] = ShortwavDSP::detail::gainToDB(magnitude);
+    }
+  }
+
+  void drawSpectrum(NVGcontext *vg)
+  {
+    std::shared_ptr<const ShortwavDSP::BandAnalyzer::Analysis> latest = analysis->analyzer.get();
+    if (!latest)
+      return;
+
+    const ShortwavDSP::BandAnalyzer &analyzer = analysis->analyzer;
     nvgBeginPath(vg);
-    
-    bool firstPoint = true;
-    for (int i = 0; i < numPoints; i++)
+    nvgMoveTo(vg, 0, box.size.y);
+    for (int i = 0; i < analyzer.getNumPoints(); i++)
     {
-      float t = (float)i / (numPoints - 1);
-      float freq = minFreq * std::pow(maxFreq / minFreq, t);
-      float gain = approximateGainAtFreq(freq, lowFreq, highFreq, lowGain, midGain, highGain);
-      
-      float x = freqToX(freq);
-      float y = gainToY(gain);
-      
-      if (firstPoint)
-      {
+      const float x = freqToX(analyzer.pointFrequency(i));
+      nvgLineTo(vg, x, spectrumToY(latest->spectrumDB[i]));
+    }
+    nvgLineTo(vg, box.size.x, box.size.y);
+    nvgClosePath(vg);
+    nvgFillColor(vg, nvgRGBA(100, 160, 255, 60));
+    nvgFill(vg);
+  }
+
+  void drawResponseCurve(NVGcontext *vg)
+  {
+    const ShortwavDSP::BandAnalyzer &analyzer = analysis->analyzer;
+    nvgBeginPath(vg);
+
+    for (int i = 0; i < analyzer.getNumPoints(); i++)
+    {
+      float x = freqToX(analyzer.pointFrequency(i));
+      float y = gainToY(responseDB[i]);
+
+      if (i == 0)
         nvgMoveTo(vg, x, y);
-        firstPoint = false;
-      }
       else
-      {
         nvgLineTo(vg, x, y);
-      }
     }
-    
+
     nvgStrokeColor(vg, nvgRGBA(255, 200, 100, 255));
     nvgStrokeWidth(vg, 2.5f);
     nvgStroke(vg);
@@ -296,248 +382,153 @@ struct EQFrequencyResponseDisplay : TransparentWidget
     return centerY - (gainDB * scale);
   }
 
-  // Approximate gain at a specific frequency
-  // This is a simplified approximation for visualization
-  float approximateGainAtFreq(float freq, float lowFreq, float highFreq,
-                               float lowGain, float midGain, float highGain)
+  // Convert spectrum level (dB) to Y position
+  float spectrumToY(float levelDB)
   {
-    // Transition width factor (octaves)
-    float transitionWidth = 1.5f;
-    
-    // Calculate distance from crossover points
-    float lowDist = std::log2(freq / lowFreq);
-    float highDist = std::log2(freq / highFreq);
-    
-    // Low band influence (below lowFreq)
-    float lowInfluence = 1.0f / (1.0f + std::exp(lowDist / transitionWidth));
-    
-    // High band influence (above highFreq)
-    float highInfluence = 1.0f / (1.0f + std::exp(-highDist / transitionWidth));
-    
-    // Mid band influence (between crossovers)
-    float midInfluence = 1.0f - lowInfluence - highInfluence;
-    midInfluence = std::max(0.0f, midInfluence);
-    
-    // Combine gains
-    float totalGain = lowGain * lowInfluence + 
-                      midGain * midInfluence + 
-                      highGain * highInfluence;
-    
-    return totalGain;
+    float t = (levelDB - spectrumBottomDB) / (spectrumTopDB - spectrumBottomDB);
+    return box.size.y * (1.f - clamp(t, 0.f, 1.f));
   }
 };
 
-// Gain Level Meter Widget
-// Shows real-time gain levels for each band with peak hold
+// Band Level Meter Widget
+// Shows the RMS level of each band's audio with a held peak
 struct EQGainMeterDisplay : TransparentWidget
 {
-  Module *module = nullptr;
-  
-  // Peak hold values and timers
-  float lowPeak = 0.f;
-  float midPeak = 0.f;
-  float highPeak = 0.f;
-  float peakHoldTime = 1.5f; // seconds
-  float lowPeakTimer = 0.f;
-  float midPeakTimer = 0.f;
-  float highPeakTimer = 0.f;
-  
-  // RMS values for smoothing
-  float lowRMS = 0.f;
-  float midRMS = 0.f;
-  float highRMS = 0.f;
-  
+  EQAnalysis *analysis = nullptr;
+
+  // Meter range (dB relative to 10V)
+  const float topDB = 6.f;
+  const float bottomDB = -60.f;
+
   void step() override
   {
     TransparentWidget::step();
-    
-    if (!module)
-      return;
-    
-    float sampleTime = APP->engine->getSampleTime();
-    
-    // Decay peak hold timers
-    if (lowPeakTimer > 0.f)
-      lowPeakTimer -= sampleTime;
-    if (midPeakTimer > 0.f)
-      midPeakTimer -= sampleTime;
-    if (highPeakTimer > 0.f)
-      highPeakTimer -= sampleTime;
-    
-    // Reset peaks when timer expires
-    if (lowPeakTimer <= 0.f)
-      lowPeak = 0.f;
-    if (midPeakTimer <= 0.f)
-      midPeak = 0.f;
-    if (highPeakTimer <= 0.f)
-      highPeak = 0.f;
+    if (analysis)
+      analysis->start();
   }
 
   void drawLayer(const DrawArgs &args, int layer) override
   {
     if (layer != 1)
       return;
-    
-    if (!module)
+
+    if (!analysis)
     {
       drawPlaceholder(args);
       return;
     }
 
     NVGcontext *vg = args.vg;
-    
-    // Get current gain settings
-    float lowGain = module->params[2].getValue();  // LOW_GAIN_PARAM
-    float midGain = module->params[3].getValue();  // MID_GAIN_PARAM
-    float highGain = module->params[4].getValue(); // HIGH_GAIN_PARAM
-    
-    // Apply CV modulation if connected
-    if (module->inputs[4].isConnected()) // LOW_GAIN_CV_INPUT
-    {
-      float cv = module->inputs[4].getVoltage();
-      lowGain += cv * 2.4f;
-      lowGain = clamp(lowGain, -12.f, 12.f);
-    }
-    
-    if (module->inputs[5].isConnected()) // MID_GAIN_CV_INPUT
-    {
-      float cv = module->inputs[5].getVoltage();
-      midGain += cv * 2.4f;
-      midGain = clamp(midGain, -12.f, 12.f);
-    }
-    
-    if (module->inputs[6].isConnected()) // HIGH_GAIN_CV_INPUT
+
+    // Latest levels from the analyzer (silent until the first analysis)
+    std::shared_ptr<const ShortwavDSP::BandAnalyzer::Analysis> latest = analysis->analyzer.get();
+    float rmsDB[3] = {bottomDB, bottomDB, bottomDB};
+    float holdDB[3] = {bottomDB, bottomDB, bottomDB};
+    if (latest)
     {
-      float cv = module->inputs[6].getVoltage();
-      highGain += cv * 2.4f;
-      highGain = clamp(highGain, -12.f, 12.f);
+      std::copy(latest->rmsDB, latest->rmsDB + 3, rmsDB);
+      std::copy(latest->holdDB, latest->holdDB + 3, holdDB);
     }
-    
-    // Update peak values
-    updatePeaks(lowGain, midGain, highGain);
 
     // Draw background
     nvgBeginPath(vg);
     nvgRect(vg, 0, 0, box.size.x, box.size.y);
     nvgFillColor(vg, nvgRGBA(0, 0, 0, 200));
     nvgFill(vg);
-    
+
     // Draw meters
     float meterWidth = (box.size.x - 12.f) / 3.f;
-    float meterHeight = box.size.y - 20.f;
-    
-    drawMeter(vg, 4.f, 15.f, meterWidth, meterHeight, lowGain, lowPeak, 
+    float meterHeight = box.size.y - 30.f;
+
+    drawMeter(vg, 4.f, 15.f, meterWidth, meterHeight, rmsDB[0], holdDB[0],
               nvgRGBA(255, 100, 100, 255), "LOW");
-    drawMeter(vg, 4.f + meterWidth + 2.f, 15.f, meterWidth, meterHeight, midGain, midPeak,
+    drawMeter(vg, 4.f + meterWidth + 2.f, 15.f, meterWidth, meterHeight, rmsDB[1], holdDB[1],
               nvgRGBA(100, 255, 100, 255), "MID");
-    drawMeter(vg, 4.f + (meterWidth + 2.f) * 2.f, 15.f, meterWidth, meterHeight, highGain, highPeak,
+    drawMeter(vg, 4.f + (meterWidth + 2.f) * 2.f, 15.f, meterWidth, meterHeight, rmsDB[2], holdDB[2],
               nvgRGBA(100, 100, 255, 255), "HIGH");
   }
 
   void drawPlaceholder(const DrawArgs &args)
   {
     NVGcontext *vg = args.vg;
-    
+
     nvgBeginPath(vg);
     nvgRect(vg, 0, 0, box.size.x, box.size.y);
     nvgFillColor(vg, nvgRGBA(0, 0, 0, 200));
     nvgFill(vg);
-    
+
     nvgFontSize(vg, 10);
     nvgFontFaceId(vg, APP->window->uiFont->handle);
     nvgTextAlign(vg, NVG_ALIGN_CENTER | NVG_ALIGN_MIDDLE);
     nvgFillColor(vg, nvgRGBA(150, 150, 150, 255));
-    nvgText(vg, box.size.x * 0.5f, box.size.y * 0.5f, "Gain Meters", NULL);
+    nvgText(vg, box.size.x * 0.5f, box.size.y * 0.5f, "Band Levels", NULL);
+  }
+
+  // Position of a level within the meter (0 = bottom, 1 = top)
+  float levelToUnit(float levelDB)
+  {
+    return clamp((levelDB - bottomDB) / (topDB - bottomDB), 0.f, 1.f);
   }
 
   void drawMeter(NVGcontext *vg, float x, float y, float width, float height,
-                 float gain, float peak, NVGcolor color, const char *label)
+                 float levelDB, float peakDB, NVGcolor color, const char *label)
   {
     // Draw meter background
     nvgBeginPath(vg);
     nvgRect(vg, x, y, width, height);
     nvgFillColor(vg, nvgRGBA(40, 40, 40, 255));
     nvgFill(vg);
-    
+
     nvgStrokeColor(vg, nvgRGBA(80, 80, 80, 255));
     nvgStrokeWidth(vg, 1.0f);
     nvgStroke(vg);
-    
-    // Draw center line (0dB)
-    float centerY = y + height * 0.5f;
+
+    // Draw reference line (0dB = 10V)
+    float zeroY = y + height * (1.f - levelToUnit(0.f));
     nvgBeginPath(vg);
-    nvgMoveTo(vg, x, centerY);
-    nvgLineTo(vg, x + width, centerY);
+    nvgMoveTo(vg, x, zeroY);
+    nvgLineTo(vg, x + width, zeroY);
     nvgStrokeColor(vg, nvgRGBA(100, 100, 100, 255));
     nvgStrokeWidth(vg, 1.0f);
     nvgStroke(vg);
-    
-    // Calculate bar height
-    float normalizedGain = (gain + 12.f) / 24.f; // -12 to +12 -> 0 to 1
-    normalizedGain = clamp(normalizedGain, 0.f, 1.f);
-    
-    float barHeight = height * normalizedGain;
+
+    // Draw RMS bar
+    float barHeight = height * levelToUnit(levelDB);
     float barY = y + height - barHeight;
-    
-    // Draw gain bar
+
     nvgBeginPath(vg);
     nvgRect(vg, x + 2, barY, width - 4, barHeight);
-    
-    // Color gradient based on gain level
+
+    // Color gradient based on level
     NVGcolor topColor = color;
     NVGcolor bottomColor = nvgRGBA(color.r * 255 * 0.5f, color.g * 255 * 0.5f, color.b * 255 * 0.5f, 255);
     NVGpaint paint = nvgLinearGradient(vg, x, barY, x, y + height, topColor, bottomColor);
     nvgFillPaint(vg, paint);
     nvgFill(vg);
-    
-    // Draw peak indicator
-    if (peak > -12.f)
+
+    // Draw held peak indicator
+    if (peakDB > bottomDB)
     {
-      float normalizedPeak = (peak + 12.f) / 24.f;
-      normalizedPeak = clamp(normalizedPeak, 0.f, 1.f);
-      float peakY = y + height * (1.f - normalizedPeak);
-      
+      float peakY = y + height * (1.f - levelToUnit(peakDB));
+
       nvgBeginPath(vg);
       nvgRect(vg, x, peakY - 1, width, 2);
       nvgFillColor(vg, nvgRGBA(255, 255, 255, 200));
       nvgFill(vg);
     }
-    
+
     // Draw label
     nvgFontSize(vg, 8);
     nvgFontFaceId(vg, APP->window->uiFont->handle);
     nvgTextAlign(vg, NVG_ALIGN_CENTER | NVG_ALIGN_TOP);
     nvgFillColor(vg, color);
     nvgText(vg, x + width * 0.5f, y - 12, label, NULL);
-    
+
     // Draw value
     nvgFontSize(vg, 7);
     nvgTextAlign(vg, NVG_ALIGN_CENTER | NVG_ALIGN_BOTTOM);
     nvgFillColor(vg, nvgRGBA(200, 200, 200, 255));
-    nvgText(vg, x + width * 0.5f, y + height + 10, string::f("%+.1f", gain).c_str(), NULL);
-  }
-
-  void updatePeaks(float lowGain, float midGain, float highGain)
-  {
-    // Update low band peak
-    if (std::abs(lowGain) > std::abs(lowPeak))
-    {
-      lowPeak = lowGain;
-      lowPeakTimer = peakHoldTime;
-    }
-    
-    // Update mid band peak
-    if (std::abs(midGain) > std::abs(midPeak))
-    {
-      midPeak = midGain;
-      midPeakTimer = peakHoldTime;
-    }
-    
-    // Update high band peak
-    if (std::abs(highGain) > std::abs(highPeak))
-    {
-      highPeak = highGain;
-      highPeakTimer = peakHoldTime;
-    }
+    std::string value = (levelDB > bottomDB) ? string::f("%.0f", levelDB) : "-inf";
+    nvgText(vg, x + width * 0.5f, y + height + 10, value.c_str(), NULL);
   }
 };
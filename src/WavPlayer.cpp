@@ -1,12 +1,36 @@
 #include "WavPlayer.hpp"
+#include "DspStats.hpp"
 #include <osdialog.h>
 
 void WavPlayer::process(const ProcessArgs& args)
 {
+  // Latest slice table; valid until the next acquire, never locks
+  const SliceTable* table = sliceTable_.acquire();
+
+  // Switching between the main playhead and the voice pool silences the other
+  const int polyVoices = polyVoices_.load();
+  if (polyVoices != activePolyVoices_)
+  {
+    if (polyVoices > 0)
+    {
+      player.stop();
+      player.setVoiceCount(polyVoices);
+    }
+    else
+    {
+      player.stopVoices();
+    }
+    activePolyVoices_ = polyVoices;
+  }
+
   // Handle transport button triggers
   if (playTrigger_.process(params[PLAY_BUTTON_PARAM].getValue()))
   {
-    if (player.isPlaying())
+    if (polyVoices > 0)
+    {
+      triggerSliceVoice(table, getCurrentSlice(table), 0);
+    }
+    else if (player.isPlaying())
     {
       player.pause();
     }
@@ -19,60 +43,76 @@ void WavPlayer::process(const ProcessArgs& args)
   if (stopTrigger_.process(params[STOP_BUTTON_PARAM].getValue()))
   {
     player.stop();
+    player.stopVoices();
     currentSlice_ = 0;
   }
 
   // Update player parameters
   updatePlayerParameters();
 
-  // Handle external trigger input
-  handleTriggerInput();
-
-  // Process audio if file is loaded
-  if (fileLoaded_.load() && player.isPlaying())
+  if (polyVoices > 0)
   {
-    // Check slice boundary if slicing is active
-    if (!slices_.empty())
+    handlePolyTriggerInput(table);
+
+    // One output channel per voice
+    float left[kMaxVoices], right[kMaxVoices];
+    player.processVoicesStereo(left, right);
+    outputs[AUDIO_OUTPUT_L].setChannels(polyVoices);
+    outputs[AUDIO_OUTPUT_R].setChannels(polyVoices);
+    for (int v = 0; v < polyVoices; ++v)
     {
-      checkSliceBoundary();
-      
-      // Update current slice based on CV input (for LED display)
-      int selectedSlice = getCurrentSlice();
-      if (selectedSlice >= 0 && selectedSlice < static_cast<int>(slices_.size()))
-      {
-        currentSlice_ = selectedSlice;
-      }
+      outputs[AUDIO_OUTPUT_L].setVoltage(left[v] * 5.0f, v); // Scale to Eurorack levels
+      outputs[AUDIO_OUTPUT_R].setVoltage(right[v] * 5.0f, v);
     }
-
-    // Generate stereo output
-    float left, right;
-    player.processSampleStereo(left, right);
-
-    outputs[AUDIO_OUTPUT_L].setVoltage(left * 5.0f); // Scale to Eurorack levels
-    outputs[AUDIO_OUTPUT_R].setVoltage(right * 5.0f);
   }
   else
   {
-    outputs[AUDIO_OUTPUT_L].setVoltage(0.0f);
-    outputs[AUDIO_OUTPUT_R].setVoltage(0.0f);
-  }
+    // Handle external trigger input
+    handleTriggerInput(table);
 
-  // Update play LED
-  lights[PLAY_LIGHT].setBrightness(player.isPlaying() ? 1.0f : 0.0f);
+    outputs[AUDIO_OUTPUT_L].setChannels(1);
+    outputs[AUDIO_OUTPUT_R].setChannels(1);
 
-  // Update slice LEDs
-  {
-    std::lock_guard<std::mutex> lock(sliceMutex_);
-    for (int i = 0; i < 32; ++i)
+    // Process audio if file is loaded
+    if (fileLoaded_.load() && player.isPlaying())
     {
-      if (i < static_cast<int>(slices_.size()) && i == currentSlice_)
+      // Check slice boundary if slicing is active
+      if (sliceCount(table) > 0)
       {
-        lights[SLICE_LIGHTS + i].setBrightness(1.0f);
-      }
-      else
-      {
-        lights[SLICE_LIGHTS + i].setBrightness(0.0f);
+        checkSliceBoundary(table);
+
+        // Update current slice based on CV input (for LED display)
+        int selectedSlice = getCurrentSlice(table);
+        if (selectedSlice >= 0)
+        {
+          currentSlice_ = selectedSlice;
+        }
       }
+
+      // Generate stereo output
+      float left, right;
+      player.processSampleStereo(left, right);
+
+      outputs[AUDIO_OUTPUT_L].setVoltage(left * 5.0f); // Scale to Eurorack levels
+      outputs[AUDIO_OUTPUT_R].setVoltage(right * 5.0f);
+    }
+    else
+    {
+      outputs[AUDIO_OUTPUT_L].setVoltage(0.0f);
+      outputs[AUDIO_OUTPUT_R].setVoltage(0.0f);
+    }
+  }
+
+  // Update play and slice LEDs
+  if (lightDivider_.tick())
+  {
+    const bool sounding = polyVoices > 0 ? player.getActiveVoiceCount() > 0 : player.isPlaying();
+    lights[PLAY_LIGHT].setBrightness(sounding ? 1.0f : 0.0f);
+
+    const int numSlices = sliceCount(table);
+    for (int i = 0; i < 32; ++i)
+    {
+      lights[SLICE_LIGHTS + i].setBrightness((i < numSlices && i == currentSlice_) ? 1.0f : 0.0f);
     }
   }
 }
@@ -134,32 +174,13 @@ void WavPlayer::updatePlayerParameters()
     break;
   case 2:
   default:
-    player.setInterpolationQuality(ShortwavDSP::InterpolationQuality::Cubic);
+    player.setInterpolationQuality(sincInterpolation_.load() ? ShortwavDSP::InterpolationQuality::Sinc
+                                                             : ShortwavDSP::InterpolationQuality::Cubic);
     break;
   }
-
-  // Check if slice count changed
-  static int lastNumSlices = 1;
-  int numSlices = static_cast<int>(params[NUM_SLICES_PARAM].getValue());
-  if (numSlices != lastNumSlices)
-  {
-    updateSlices();
-    lastNumSlices = numSlices;
-    
-    // Update slice selector max value to match number of slices
-    if (paramQuantities[SLICE_SELECT_PARAM])
-    {
-      paramQuantities[SLICE_SELECT_PARAM]->maxValue = std::max(0.f, (float)(numSlices - 1));
-      // Clamp current value if it's now out of range
-      if (params[SLICE_SELECT_PARAM].getValue() > paramQuantities[SLICE_SELECT_PARAM]->maxValue)
-      {
-        params[SLICE_SELECT_PARAM].setValue(paramQuantities[SLICE_SELECT_PARAM]->maxValue);
-      }
-    }
-  }
 }
 
-void WavPlayer::handleTriggerInput()
+void WavPlayer::handleTriggerInput(const SliceTable* table)
 {
   if (!inputs[TRIGGER_INPUT].isConnected())
   {
@@ -176,8 +197,8 @@ void WavPlayer::handleTriggerInput()
     if (triggerHigh && !lastTriggerState_)
     {
       // Rising edge: start playback
-      int slice = getCurrentSlice();
-      triggerSlice(slice);
+      int slice = getCurrentSlice(table);
+      triggerSlice(table, slice);
     }
     else if (!triggerHigh && lastTriggerState_)
     {
@@ -191,8 +212,43 @@ void WavPlayer::handleTriggerInput()
     // Edge mode: trigger on rising edge only
     if (externalTrigger_.process(triggerVoltage))
     {
-      int slice = getCurrentSlice();
-      triggerSlice(slice);
+      int slice = getCurrentSlice(table);
+      triggerSlice(table, slice);
+    }
+  }
+}
+
+void WavPlayer::handlePolyTriggerInput(const SliceTable* table)
+{
+  if (!inputs[TRIGGER_INPUT].isConnected() || !fileLoaded_.load())
+  {
+    return;
+  }
+
+  // Each trigger channel starts voices tagged with its index, so a gate
+  // falling on that channel releases only what it started
+  const int channels = std::min(inputs[TRIGGER_INPUT].getChannels(), kMaxVoices);
+  bool gateMode = params[TRIGGER_MODE_PARAM].getValue() >= 0.5f; // 0=edge, 1=gate
+
+  for (int c = 0; c < channels; ++c)
+  {
+    float triggerVoltage = inputs[TRIGGER_INPUT].getVoltage(c);
+    if (gateMode)
+    {
+      bool triggerHigh = triggerVoltage >= 1.0f;
+      if (triggerHigh && !voiceGates_[c])
+      {
+        triggerSliceVoice(table, getCurrentSlice(table, c), c);
+      }
+      else if (!triggerHigh && voiceGates_[c])
+      {
+        player.releaseVoices(c);
+      }
+      voiceGates_[c] = triggerHigh;
+    }
+    else if (voiceTriggers_[c].process(triggerVoltage))
+    {
+      triggerSliceVoice(table, getCurrentSlice(table, c), c);
     }
   }
 }
@@ -261,6 +317,20 @@ WavPlayerWidget::WavPlayerWidget(WavPlayer* module)
   addOutput(createOutput<PJ301MPort>(Vec(73, yPos), module, WavPlayer::AUDIO_OUTPUT_R));
 }
 
+void WavPlayerWidget::step()
+{
+  WavPlayer* module = dynamic_cast<WavPlayer*>(this->module);
+  if (module)
+  {
+    // Free sample buffers and slice tables replaced since the last frame once
+    // the audio thread has let go, and rebuild slices after a NUM_SLICES change
+    module->player.collectRetired();
+    module->sliceTable_.collect();
+    module->refreshSlices();
+  }
+  ModuleWidget::step();
+}
+
 void WavPlayerWidget::appendContextMenu(Menu* menu)
 {
   WavPlayer* module = dynamic_cast<WavPlayer*>(this->module);
@@ -293,6 +363,31 @@ void WavPlayerWidget::appendContextMenu(Menu* menu)
   loadItem->module = module;
   menu->addChild(loadItem);
 
+  // Live progress of a load or rate conversion in flight (the player reports
+  // it as it decodes and resamples)
+  if (module->fileLoading_.load() || module->resampling_.load())
+  {
+    struct LoadProgressLabel : MenuLabel
+    {
+      WavPlayer* module;
+      void step() override
+      {
+        const bool resampling = module->resampling_.load();
+        const float progress =
+          (resampling || module->fileLoading_.load()) ? module->player.getLoadProgress() : 1.0f;
+        char label[32];
+        snprintf(label, sizeof(label), resampling ? "Resampling... %d%%" : "Loading... %d%%",
+                 static_cast<int>(progress * 100.0f));
+        text = label;
+        MenuLabel::step();
+      }
+    };
+
+    LoadProgressLabel* progressLabel = new LoadProgressLabel();
+    progressLabel->module = module;
+    menu->addChild(progressLabel);
+  }
+
   // Show current file
   if (!module->fileName_.empty())
   {
@@ -321,7 +416,7 @@ void WavPlayerWidget::appendContextMenu(Menu* menu)
       module->fileLoaded_.store(false);
       module->filePath_.clear();
       module->fileName_.clear();
-      module->slices_.clear();
+      module->updateSlices();
     }
   };
 
@@ -333,6 +428,151 @@ void WavPlayerWidget::appendContextMenu(Menu* menu)
     menu->addChild(clearItem);
   }
 
+  // Storage mode (applies to the next load)
+  struct StorageModeItem : MenuItem
+  {
+    WavPlayer* module;
+    ShortwavDSP::WavStorageMode mode;
+    void onAction(const event::Action& e) override
+    {
+      module->storageMode_.store(static_cast<int>(mode));
+    }
+    void step() override
+    {
+      rightText = (module->storageMode_.load() == static_cast<int>(mode)) ? "✔" : "";
+      MenuItem::step();
+    }
+  };
+
+  menu->addChild(new MenuEntry);
+  menu->addChild(createMenuLabel("Storage (next load)"));
+
+  const std::pair<ShortwavDSP::WavStorageMode, const char*> storageModes[] = {
+      {ShortwavDSP::WavStorageMode::Resident, "Load into RAM"},
+      {ShortwavDSP::WavStorageMode::MemoryMapped, "Memory-map (no RAM copy)"},
+      {ShortwavDSP::WavStorageMode::Streaming, "Stream from disk"},
+  };
+  for (const auto& entry : storageModes)
+  {
+    StorageModeItem* item = new StorageModeItem();
+    item->text = entry.second;
+    item->module = module;
+    item->mode = entry.first;
+    menu->addChild(item);
+  }
+
+  // Load-time sample rate conversion (Resident storage only)
+  struct ResampleItem : MenuItem
+  {
+    WavPlayer* module;
+    void onAction(const event::Action& e) override
+    {
+      module->player.setResampleOnLoad(!module->player.getResampleOnLoad());
+      module->resampleAsync();
+    }
+    void step() override
+    {
+      rightText = module->player.getResampleOnLoad() ? "✔" : "";
+      MenuItem::step();
+    }
+  };
+
+  ResampleItem* resampleItem = new ResampleItem();
+  resampleItem->text = "Resample to engine rate (RAM only)";
+  resampleItem->module = module;
+  menu->addChild(resampleItem);
+
+  // Interpolation used by the top QUALITY switch position
+  struct SincItem : MenuItem
+  {
+    WavPlayer* module;
+    void onAction(const event::Action& e) override
+    {
+      module->sincInterpolation_.store(!module->sincInterpolation_.load());
+    }
+    void step() override
+    {
+      rightText = module->sincInterpolation_.load() ? "✔" : "";
+      MenuItem::step();
+    }
+  };
+
+  SincItem* sincItem = new SincItem();
+  sincItem->text = "Sinc interpolation (QUALITY high)";
+  sincItem->module = module;
+  menu->addChild(sincItem);
+
+  // Voice pool size (0 = single playhead)
+  struct PolyVoicesItem : MenuItem
+  {
+    WavPlayer* module;
+    int voices;
+    void onAction(const event::Action& e) override
+    {
+      module->polyVoices_.store(voices);
+    }
+    void step() override
+    {
+      rightText = (module->polyVoices_.load() == voices) ? "✔" : "";
+      MenuItem::step();
+    }
+  };
+
+  menu->addChild(new MenuEntry);
+  menu->addChild(createMenuLabel("Voices"));
+
+  const std::pair<int, const char*> voiceCounts[] = {
+      {0, "Mono (one playhead)"},
+      {4, "4 voices (poly out)"},
+      {8, "8 voices (poly out)"},
+      {16, "16 voices (poly out)"},
+  };
+  for (const auto& entry : voiceCounts)
+  {
+    PolyVoicesItem* item = new PolyVoicesItem();
+    item->text = entry.second;
+    item->module = module;
+    item->voices = entry.first;
+    menu->addChild(item);
+  }
+
+  // Slice boundaries (rebuilt by refreshSlices() on the next UI frame)
+  struct SliceModeItem : MenuItem
+  {
+    WavPlayer* module;
+    int mode;
+    void onAction(const event::Action& e) override
+    {
+      module->sliceMode_.store(mode);
+    }
+    void step() override
+    {
+      rightText = (module->sliceMode_.load() == mode) ? "✔" : "";
+      MenuItem::step();
+    }
+  };
+
+  menu->addChild(new MenuEntry);
+  menu->addChild(createMenuLabel("Slicing"));
+
+  const std::pair<int, const char*> sliceModes[] = {
+      {WavPlayer::SLICE_EQUAL, "Equal lengths"},
+      {WavPlayer::SLICE_TRANSIENTS, "At transients"},
+  };
+  for (const auto& entry : sliceModes)
+  {
+    SliceModeItem* item = new SliceModeItem();
+    item->text = entry.second;
+    item->module = module;
+    item->mode = entry.first;
+    menu->addChild(item);
+  }
+
+  if (module->fileLoaded_.load() && module->player.isStreaming())
+  {
+    menu->addChild(createMenuLabel("Stream underruns: " + std::to_string(module->player.getStreamUnderruns())));
+  }
+
   menu->addChild(new MenuEntry);
 
   // Slice reorder submenu (advanced feature)
@@ -343,18 +583,18 @@ void WavPlayerWidget::appendContextMenu(Menu* menu)
     {
       Menu* menu = new Menu();
       
-      std::lock_guard<std::mutex> lock(module->sliceMutex_);
-      
-      if (module->slices_.empty())
+      std::shared_ptr<const WavPlayer::SliceTable> table = module->sliceTable_.get();
+
+      if (!table || table->slices.empty())
       {
         menu->addChild(createMenuLabel("No slices"));
         return menu;
       }
 
-      for (size_t i = 0; i < module->slices_.size(); ++i)
+      for (size_t i = 0; i < table->slices.size(); ++i)
       {
         char label[32];
-        snprintf(label, sizeof(label), "Slice %zu (order: %d)", i, module->slices_[i].order);
+        snprintf(label, sizeof(label), "Slice %zu (order: %d)", i, table->slices[i].order);
         menu->addChild(createMenuLabel(label));
       }
 
@@ -362,7 +602,7 @@ void WavPlayerWidget::appendContextMenu(Menu* menu)
     }
   };
 
-  if (!module->slices_.empty())
+  if (WavPlayer::sliceCount(module->sliceTable_.get().get()) > 0)
   {
     SliceReorderMenu* reorderMenu = new SliceReorderMenu();
     reorderMenu->text = "Slice order";
@@ -370,6 +610,8 @@ void WavPlayerWidget::appendContextMenu(Menu* menu)
     reorderMenu->module = module;
     menu->addChild(reorderMenu);
   }
+
+  appendDspStatsMenu(menu, "WAV Player", {{"Player", &module->player.getStats(), true}});
 }
 
 Model* modelWavPlayer = createModel<WavPlayer, WavPlayerWidget>("WavPlayer");
@@ -2,6 +2,8 @@
 
 #include "plugin.hpp"
 #include "dsp/wav-player.h"
+#include "dsp/snapshot.h"
+#include "dsp/control-rate.h"
 #include <thread>
 #include <atomic>
 
@@ -56,21 +58,63 @@ struct WavPlayer : Module
   // File loading state (thread-safe)
   std::atomic<bool> fileLoading_{false};
   std::atomic<bool> fileLoaded_{false};
-  std::atomic<float> loadProgress_{0.0f};
   std::string filePath_;
   std::string fileName_;
   std::mutex fileMutex_;
 
-  // Slice management
+  // Background loader and rate converter, joined on destruction. The
+  // converter reruns while resampleAgain_ is set, so rate changes during a
+  // conversion are coalesced instead of piling up threads.
+  std::thread loadThread_;
+  std::thread resampleThread_;
+  std::mutex resampleThreadMutex_;
+  std::atomic<bool> resampleRunning_{false};
+  std::atomic<bool> resampleAgain_{false};
+  std::atomic<bool> resampling_{false}; // A rate conversion is in progress
+
+  // How files are held: decoded in RAM, memory-mapped, or streamed from disk
+  std::atomic<int> storageMode_{static_cast<int>(ShortwavDSP::WavStorageMode::Resident)};
+
+  // Background reader that keeps the prefetch ring filled in Streaming mode
+  std::thread streamThread_;
+  std::atomic<bool> streamThreadExit_{false};
+
+  // Slice management. A slice table is immutable once published: the GUI
+  // and loader threads build a new one, the audio thread picks it up with
+  // SnapshotPublisher::acquire() and never locks.
   struct SliceInfo
   {
     size_t startSample;
     size_t endSample;
     int order;              // For slice reordering
   };
-  std::vector<SliceInfo> slices_;
+  struct SliceTable
+  {
+    std::vector<SliceInfo> slices;
+    int numSlices = 1;       // NUM_SLICES_PARAM it was built for
+    size_t totalSamples = 0; // File length it was built for (0 = no file)
+    int sliceMode = 0;       // SliceMode it was built for
+    uint64_t generation = 0; // Player buffer generation it was built for
+  };
+
+  // Equal slices, or slices starting at the file's strongest transients
+  // (detected by the loader, see OnsetDetector; falls back to equal slices
+  // when the file has too few onsets)
+  enum SliceMode
+  {
+    SLICE_EQUAL,
+    SLICE_TRANSIENTS
+  };
+  std::atomic<int> sliceMode_{SLICE_EQUAL};
+
+  // Top QUALITY switch position: cubic, or the 16-tap windowed sinc
+  std::atomic<bool> sincInterpolation_{false};
+  ShortwavDSP::SnapshotPublisher<SliceTable> sliceTable_;
+  std::mutex sliceWriteMutex_; // Serialises table rebuilds (never taken by the audio thread)
   int currentSlice_ = 0;
-  std::mutex sliceMutex_;
+
+  // Slice/play LEDs are refreshed once per block, not every sample
+  ShortwavDSP::ControlRateDivider lightDivider_;
 
   // Trigger state
   dsp::SchmittTrigger playTrigger_;
@@ -78,6 +122,16 @@ struct WavPlayer : Module
   dsp::SchmittTrigger externalTrigger_;
   bool lastTriggerState_ = false;
 
+  // Polyphonic mode: number of voices in the player's voice pool (0 = the
+  // single main playhead). Each TRIGGER_INPUT channel starts a voice on the
+  // slice picked by the matching SLICE_CV_INPUT channel; voice v is output
+  // on channel v of both audio outputs.
+  static constexpr int kMaxVoices = ShortwavDSP::WavPlayer::kMaxVoices;
+  std::atomic<int> polyVoices_{0};
+  int activePolyVoices_ = 0; // Audio thread copy, to detect mode changes
+  dsp::SchmittTrigger voiceTriggers_[kMaxVoices];
+  bool voiceGates_[kMaxVoices] = {};
+
   // Waveform display reference (set by widget)
   WaveformDisplay* waveformDisplay_ = nullptr;
 
@@ -125,12 +179,32 @@ struct WavPlayer : Module
     configOutput(AUDIO_OUTPUT_L, "Audio L");
     configOutput(AUDIO_OUTPUT_R, "Audio R");
 
+    lightDivider_.setDivision(64);
+    updateSlices();
     onSampleRateChange();
   }
 
   ~WavPlayer()
   {
-    // Ensure clean shutdown
+    // Ensure clean shutdown: cut short any rate conversion, then wait for the
+    // background threads before the player goes away
+    player.abortConversions();
+    if (loadThread_.joinable())
+    {
+      loadThread_.join();
+    }
+    {
+      std::lock_guard<std::mutex> lock(resampleThreadMutex_);
+      if (resampleThread_.joinable())
+      {
+        resampleThread_.join();
+      }
+    }
+    streamThreadExit_.store(true);
+    if (streamThread_.joinable())
+    {
+      streamThread_.join();
+    }
     player.stop();
     player.unload();
   }
@@ -139,33 +213,93 @@ struct WavPlayer : Module
   {
     float sr = APP->engine->getSampleRate();
     player.setSampleRate(sr);
+    resampleAsync();
+  }
+
+  // Convert the loaded file to the engine rate in the background (no-op unless
+  // "Resample to engine rate" is on and the rates differ). Playback continues
+  // on the old buffer until the converted one is published.
+  void resampleAsync()
+  {
+    if (!player.getResampleOnLoad() || !fileLoaded_.load())
+    {
+      return;
+    }
+
+    std::lock_guard<std::mutex> threadLock(resampleThreadMutex_);
+    resampleAgain_.store(true);
+    if (resampleRunning_.exchange(true))
+    {
+      return; // The running conversion picks the request up
+    }
+    if (resampleThread_.joinable())
+    {
+      resampleThread_.join(); // Finished; only its exit is pending
+    }
+
+    resampleThread_ = std::thread([this]() {
+      for (;;)
+      {
+        while (resampleAgain_.exchange(false))
+        {
+          std::lock_guard<std::mutex> lock(fileMutex_);
+          resampling_.store(true);
+          auto result = player.resampleToOutputRate();
+          resampling_.store(false);
+          if (result != ShortwavDSP::WavError::None)
+          {
+            WARN("Failed to resample WAV file: %s", ShortwavDSP::wavErrorToString(result));
+          }
+        }
+        resampleRunning_.store(false);
+        // A request made after the last check but before the flag dropped
+        if (!resampleAgain_.load() || resampleRunning_.exchange(true))
+        {
+          break;
+        }
+      }
+    });
   }
 
   void process(const ProcessArgs& args) override;
 
   // Internal helper methods
   void updatePlayerParameters();
-  void handleTriggerInput();
+  void handleTriggerInput(const SliceTable* table);
+  void handlePolyTriggerInput(const SliceTable* table);
 
   // File loading (async, thread-safe)
   void loadFileAsync(const std::string& path)
   {
-    if (fileLoading_.load())
+    if (fileLoading_.exchange(true))
     {
       return; // Already loading
     }
 
-    fileLoading_.store(true);
     fileLoaded_.store(false);
-    loadProgress_.store(0.0f);
+    if (loadThread_.joinable())
+    {
+      loadThread_.join(); // The previous load has finished
+    }
+
+    if (storageMode_.load() == static_cast<int>(ShortwavDSP::WavStorageMode::Streaming))
+    {
+      startStreamThread();
+    }
 
     // Launch loading thread
-    std::thread([this, path]() {
+    loadThread_ = std::thread([this, path]() {
       std::lock_guard<std::mutex> lock(fileMutex_);
       
-      loadProgress_.store(0.2f);
-      auto result = player.loadFile(path.c_str());
-      loadProgress_.store(0.8f);
+      auto mode = static_cast<ShortwavDSP::WavStorageMode>(storageMode_.load());
+      auto result = player.loadFile(path.c_str(), mode);
+      if (result == ShortwavDSP::WavError::None)
+      {
+        // Catch up with an engine rate change made while the file was loading
+        resampling_.store(true);
+        result = player.resampleToOutputRate();
+        resampling_.store(false);
+      }
 
       if (result == ShortwavDSP::WavError::None)
       {
@@ -183,45 +317,138 @@ struct WavPlayer : Module
         fileLoaded_.store(false);
       }
 
-      loadProgress_.store(1.0f);
       fileLoading_.store(false);
-    }).detach();
+    });
+  }
+
+  // Start the disk reader (once); it idles while no file is being streamed
+  void startStreamThread()
+  {
+    if (streamThread_.joinable())
+    {
+      return;
+    }
+
+    streamThread_ = std::thread([this]() {
+      while (!streamThreadExit_.load())
+      {
+        // Refill the ring ahead of the play head; poll faster while it is draining
+        size_t decoded = player.isStreaming() ? player.serviceStream() : 0;
+        std::this_thread::sleep_for(std::chrono::milliseconds(decoded > 0 ? 1 : 2));
+      }
+    });
   }
 
-  // Update slice boundaries based on NUM_SLICES_PARAM
+  // Rebuild and publish the slice table from NUM_SLICES_PARAM and the loaded
+  // file (non-audio threads)
   void updateSlices()
   {
-    std::lock_guard<std::mutex> lock(sliceMutex_);
-    
-    int numSlices = static_cast<int>(params[NUM_SLICES_PARAM].getValue());
-    numSlices = clamp(numSlices, 1, 32);
+    std::lock_guard<std::mutex> lock(sliceWriteMutex_);
 
-    slices_.clear();
-    
-    if (numSlices <= 1 || !fileLoaded_.load())
+    auto table = std::make_shared<SliceTable>();
+    table->numSlices = clamp(static_cast<int>(params[NUM_SLICES_PARAM].getValue()), 1, 32);
+    table->sliceMode = sliceMode_.load();
+    table->generation = player.getBufferGeneration();
+    std::shared_ptr<const ShortwavDSP::detail::SampleBuffer> buffer = player.getSampleBuffer();
+    table->totalSamples = (fileLoaded_.load() && buffer) ? buffer->frames : 0;
+
+    if (table->numSlices > 1 && table->totalSamples > 0)
     {
-      return; // No slicing
+      std::vector<size_t> starts;
+      if (table->sliceMode == SLICE_TRANSIENTS)
+      {
+        starts = transientSliceStarts(*buffer, table->numSlices);
+      }
+      if (starts.empty())
+      {
+        size_t samplesPerSlice = table->totalSamples / table->numSlices;
+        for (int i = 0; i < table->numSlices; ++i)
+        {
+          starts.push_back(i * samplesPerSlice);
+        }
+      }
+
+      table->slices.reserve(starts.size());
+      for (size_t i = 0; i < starts.size(); ++i)
+      {
+        SliceInfo slice;
+        slice.startSample = starts[i];
+        slice.endSample = (i + 1 == starts.size()) ? table->totalSamples : starts[i + 1];
+        slice.order = static_cast<int>(i);
+        table->slices.push_back(slice);
+      }
     }
 
-    size_t totalSamples = player.getNumSamples();
-    size_t samplesPerSlice = totalSamples / numSlices;
+    sliceTable_.publish(std::move(table));
+  }
 
-    for (int i = 0; i < numSlices; ++i)
+  // Start frames of numSlices slices cut at the strongest onsets (the first
+  // slice always starts at frame 0), or empty if the file has too few onsets
+  static std::vector<size_t> transientSliceStarts(const ShortwavDSP::detail::SampleBuffer& buffer, int numSlices)
+  {
+    std::vector<ShortwavDSP::OnsetDetector::Onset> onsets;
+    for (const auto& onset : buffer.onsets)
     {
-      SliceInfo slice;
-      slice.startSample = i * samplesPerSlice;
-      slice.endSample = (i == numSlices - 1) ? totalSamples : (i + 1) * samplesPerSlice;
-      slice.order = i;
-      slices_.push_back(slice);
+      if (onset.frame > 0 && onset.frame < buffer.frames)
+      {
+        onsets.push_back(onset);
+      }
     }
+    if (static_cast<int>(onsets.size()) < numSlices - 1)
+    {
+      return {};
+    }
+
+    std::partial_sort(onsets.begin(), onsets.begin() + (numSlices - 1), onsets.end(),
+                      [](const ShortwavDSP::OnsetDetector::Onset& a, const ShortwavDSP::OnsetDetector::Onset& b) {
+                        return a.strength > b.strength;
+                      });
+    std::vector<size_t> starts(1, 0);
+    for (int i = 0; i < numSlices - 1; ++i)
+    {
+      starts.push_back(onsets[i].frame);
+    }
+    std::sort(starts.begin(), starts.end());
+    return starts;
   }
 
-  // Get current slice based on CV input or manual selection
-  int getCurrentSlice()
+  // Rebuild the slice table if NUM_SLICES, the slice mode or the file changed
+  // (UI thread)
+  void refreshSlices()
   {
-    std::lock_guard<std::mutex> lock(sliceMutex_);
-    
-    if (slices_.empty())
+    std::shared_ptr<const SliceTable> table = sliceTable_.get();
+    int numSlices = clamp(static_cast<int>(params[NUM_SLICES_PARAM].getValue()), 1, 32);
+    size_t totalSamples = fileLoaded_.load() ? player.getNumSamples() : 0;
+    if (table && table->numSlices == numSlices && table->totalSamples == totalSamples &&
+        table->sliceMode == sliceMode_.load() && table->generation == player.getBufferGeneration())
+    {
+      return;
+    }
+
+    updateSlices();
+
+    // Update slice selector max value to match number of slices
+    if (paramQuantities[SLICE_SELECT_PARAM])
+    {
+      paramQuantities[SLICE_SELECT_PARAM]->maxValue = std::max(0.f, (float)(numSlices - 1));
+      // Clamp current value if it's now out of range
+      if (params[SLICE_SELECT_PARAM].getValue() > paramQuantities[SLICE_SELECT_PARAM]->maxValue)
+      {
+        params[SLICE_SELECT_PARAM].setValue(paramQuantities[SLICE_SELECT_PARAM]->maxValue);
+      }
+    }
+  }
+
+  static int sliceCount(const SliceTable* table)
+  {
+    return table ? static_cast<int>(table->slices.size()) : 0;
+  }
+
+  // Get current slice based on CV input (channel of a poly cable) or manual selection
+  int getCurrentSlice(const SliceTable* table, int channel = 0)
+  {
+    const int numSlices = sliceCount(table);
+    if (numSlices == 0)
     {
       return -1; // No slicing active
     }
@@ -231,25 +458,21 @@ struct WavPlayer : Module
     if (inputs[SLICE_CV_INPUT].isConnected())
     {
       // Map 0-10V to slice indices
-      float cv = clamp(inputs[SLICE_CV_INPUT].getVoltage(), 0.f, 10.f);
-      sliceIdx = static_cast<int>(cv / 10.f * slices_.size());
-      sliceIdx = clamp(sliceIdx, 0, static_cast<int>(slices_.size()) - 1);
+      float cv = clamp(inputs[SLICE_CV_INPUT].getPolyVoltage(channel), 0.f, 10.f);
+      sliceIdx = static_cast<int>(cv / 10.f * numSlices);
     }
     else
     {
       sliceIdx = static_cast<int>(params[SLICE_SELECT_PARAM].getValue());
-      sliceIdx = clamp(sliceIdx, 0, static_cast<int>(slices_.size()) - 1);
     }
 
-    return sliceIdx;
+    return clamp(sliceIdx, 0, numSlices - 1);
   }
 
   // Trigger slice playback
-  void triggerSlice(int sliceIdx)
+  void triggerSlice(const SliceTable* table, int sliceIdx)
   {
-    std::lock_guard<std::mutex> lock(sliceMutex_);
-    
-    if (sliceIdx < 0 || sliceIdx >= static_cast<int>(slices_.size()))
+    if (sliceIdx < 0 || sliceIdx >= sliceCount(table))
     {
       // Play full file
       bool isReverse = player.getReverse();
@@ -266,9 +489,9 @@ struct WavPlayer : Module
       return;
     }
 
-    const SliceInfo& slice = slices_[sliceIdx];
+    const SliceInfo& slice = table->slices[sliceIdx];
     bool isReverse = player.getReverse();
-    
+
     if (isReverse)
     {
       // When reversed, start from the end of the slice
@@ -279,27 +502,34 @@ struct WavPlayer : Module
       // Normal: start from the beginning of the slice
       player.seekToSample(slice.startSample);
     }
-    
+
     player.play();
     currentSlice_ = sliceIdx;
   }
 
-  // Check if playback should stop at slice boundary
-  bool checkSliceBoundary()
+  // Start a pool voice on a slice (or the whole file); tag is the trigger channel
+  void triggerSliceVoice(const SliceTable* table, int sliceIdx, int tag)
   {
-    std::lock_guard<std::mutex> lock(sliceMutex_);
-    
-    if (slices_.empty() || currentSlice_ < 0)
+    if (sliceIdx < 0 || sliceIdx >= sliceCount(table))
     {
-      return false;
+      player.triggerVoice(0, player.getNumSamples(), tag);
+      return;
     }
 
-    if (currentSlice_ >= static_cast<int>(slices_.size()))
+    const SliceInfo& slice = table->slices[sliceIdx];
+    player.triggerVoice(slice.startSample, slice.endSample, tag);
+    currentSlice_ = sliceIdx;
+  }
+
+  // Check if playback should stop at slice boundary
+  bool checkSliceBoundary(const SliceTable* table)
+  {
+    if (currentSlice_ < 0 || currentSlice_ >= sliceCount(table))
     {
       return false;
     }
 
-    const SliceInfo& slice = slices_[currentSlice_];
+    const SliceInfo& slice = table->slices[currentSlice_];
     double currentPos = player.getPlaybackPositionSamples();
     bool isReverse = player.getReverse();
 
@@ -339,20 +569,59 @@ struct WavPlayer : Module
 
     // Save slice order (for reordering feature)
     json_t* sliceOrderJ = json_array();
+    std::shared_ptr<const SliceTable> table = sliceTable_.get();
+    if (table)
     {
-      std::lock_guard<std::mutex> lock(sliceMutex_);
-      for (const auto& slice : slices_)
+      for (const auto& slice : table->slices)
       {
         json_array_append_new(sliceOrderJ, json_integer(slice.order));
       }
     }
     json_object_set_new(rootJ, "sliceOrder", sliceOrderJ);
 
+    json_object_set_new(rootJ, "storageMode", json_integer(storageMode_.load()));
+    json_object_set_new(rootJ, "polyVoices", json_integer(polyVoices_.load()));
+    json_object_set_new(rootJ, "sliceMode", json_integer(sliceMode_.load()));
+    json_object_set_new(rootJ, "resampleOnLoad", json_boolean(player.getResampleOnLoad()));
+    json_object_set_new(rootJ, "sincInterpolation", json_boolean(sincInterpolation_.load()));
+
     return rootJ;
   }
 
   void dataFromJson(json_t* rootJ) override
   {
+    // Storage mode must be known before the file is reloaded
+    json_t* storageModeJ = json_object_get(rootJ, "storageMode");
+    if (storageModeJ)
+    {
+      storageMode_.store(clamp((int)json_integer_value(storageModeJ), 0, 2));
+    }
+
+    json_t* polyVoicesJ = json_object_get(rootJ, "polyVoices");
+    if (polyVoicesJ)
+    {
+      polyVoices_.store(clamp((int)json_integer_value(polyVoicesJ), 0, kMaxVoices));
+    }
+
+    // Must be known before the file is reloaded
+    json_t* resampleJ = json_object_get(rootJ, "resampleOnLoad");
+    if (resampleJ)
+    {
+      player.setResampleOnLoad(json_boolean_value(resampleJ));
+    }
+
+    json_t* sincJ = json_object_get(rootJ, "sincInterpolation");
+    if (sincJ)
+    {
+      sincInterpolation_.store(json_boolean_value(sincJ));
+    }
+
+    json_t* sliceModeJ = json_object_get(rootJ, "sliceMode");
+    if (sliceModeJ)
+    {
+      sliceMode_.store(clamp((int)json_integer_value(sliceModeJ), (int)SLICE_EQUAL, (int)SLICE_TRANSIENTS));
+    }
+
     // Load file path
     json_t* filePathJ = json_object_get(rootJ, "filePath");
     if (filePathJ)
@@ -368,15 +637,22 @@ struct WavPlayer : Module
     json_t* sliceOrderJ = json_object_get(rootJ, "sliceOrder");
     if (sliceOrderJ && json_is_array(sliceOrderJ))
     {
-      std::lock_guard<std::mutex> lock(sliceMutex_);
-      size_t numSlices = json_array_size(sliceOrderJ);
-      for (size_t i = 0; i < numSlices && i < slices_.size(); ++i)
+      // Publish a copy of the current table with the saved order applied
+      std::lock_guard<std::mutex> lock(sliceWriteMutex_);
+      std::shared_ptr<const SliceTable> current = sliceTable_.get();
+      if (current)
       {
-        json_t* orderJ = json_array_get(sliceOrderJ, i);
-        if (orderJ)
+        auto table = std::make_shared<SliceTable>(*current);
+        size_t numSlices = json_array_size(sliceOrderJ);
+        for (size_t i = 0; i < numSlices && i < table->slices.size(); ++i)
         {
-          slices_[i].order = json_integer_value(orderJ);
+          json_t* orderJ = json_array_get(sliceOrderJ, i);
+          if (orderJ)
+          {
+            table->slices[i].order = json_integer_value(orderJ);
+          }
         }
+        sliceTable_.publish(std::move(table));
       }
     }
   }
@@ -389,6 +665,14 @@ struct WaveformDisplay : TransparentWidget
   float zoom = 1.0f;
   float scrollPos = 0.0f;
 
+  // Cached waveform outline (NanoVG has no retained paths, so the vertices are
+  // kept and replayed each frame) and the state it was built for
+  std::vector<Vec> pathPoints_;
+  uint64_t cachedGeneration_ = 0;
+  float cachedZoom_ = -1.0f;
+  float cachedScroll_ = -1.0f;
+  Vec cachedSize_;
+
   WaveformDisplay()
   {
     box.size = Vec(300, 100);
@@ -440,13 +724,50 @@ struct WaveformDisplay : TransparentWidget
 
   void drawWaveform(const DrawArgs& args)
   {
-    size_t numSamples = module->player.getNumSamples();
-    if (numSamples == 0)
+    float zoomLevel = std::pow(10.0f, module->params[WavPlayer::ZOOM_PARAM].getValue() * 2.0f);
+    uint64_t generation = module->player.getBufferGeneration();
+
+    // Rebuild the cached outline only when the file, zoom, scroll or size changed
+    if (generation != cachedGeneration_ || zoomLevel != cachedZoom_ || scrollPos != cachedScroll_ ||
+        box.size.x != cachedSize_.x || box.size.y != cachedSize_.y)
+    {
+      cachedGeneration_ = generation;
+      cachedZoom_ = zoomLevel;
+      cachedScroll_ = scrollPos;
+      cachedSize_ = box.size;
+      rebuildWaveformPath(zoomLevel);
+    }
+
+    if (pathPoints_.empty())
       return;
 
-    uint16_t numChannels = module->player.getNumChannels();
-    float zoomLevel = std::pow(10.0f, module->params[WavPlayer::ZOOM_PARAM].getValue() * 2.0f);
-    
+    nvgBeginPath(args.vg);
+    nvgMoveTo(args.vg, pathPoints_[0].x, pathPoints_[0].y);
+    for (size_t i = 1; i < pathPoints_.size(); ++i)
+    {
+      nvgLineTo(args.vg, pathPoints_[i].x, pathPoints_[i].y);
+    }
+
+    nvgStrokeColor(args.vg, nvgRGBA(0, 200, 255, 200));
+    nvgStrokeWidth(args.vg, 1.0f);
+    nvgStroke(args.vg);
+  }
+
+  // Compute the min/max outline for the visible range. Reads O(width) entries
+  // of the peak pyramid; only deep zooms (fewer frames per pixel than one
+  // pyramid block) fall back to the raw samples, except for disk streams whose
+  // samples are only partly buffered.
+  void rebuildWaveformPath(float zoomLevel)
+  {
+    pathPoints_.clear();
+
+    std::shared_ptr<const ShortwavDSP::detail::SampleBuffer> buffer = module->player.getSampleBuffer();
+    if (!buffer)
+      return;
+
+    size_t numSamples = buffer->frames;
+    uint16_t numChannels = buffer->channels;
+
     size_t visibleSamples = static_cast<size_t>(numSamples / zoomLevel);
     size_t startSample = static_cast<size_t>(scrollPos * numSamples);
     size_t endSample = std::min(startSample + visibleSamples, numSamples);
@@ -457,30 +778,43 @@ struct WaveformDisplay : TransparentWidget
     // Downsample for display
     size_t displayPoints = static_cast<size_t>(box.size.x);
     size_t samplesPerPoint = std::max<size_t>(1, (endSample - startSample) / displayPoints);
+    bool usePeaks = !buffer->peaks.empty() &&
+                    (samplesPerPoint >= ShortwavDSP::PeakPyramid::kBaseBlockFrames || buffer->stream);
+
+    pathPoints_.reserve(displayPoints * 2 + 1);
 
-    nvgBeginPath(args.vg);
-    
     for (size_t i = 0; i < displayPoints; ++i)
     {
       size_t sampleStart = startSample + i * samplesPerPoint;
       size_t sampleEnd = std::min(sampleStart + samplesPerPoint, endSample);
-      
+
       if (sampleStart >= numSamples)
         break;
 
       // Find min/max in this range
       float minVal = 0.0f, maxVal = 0.0f;
-      for (size_t s = sampleStart; s < sampleEnd; ++s)
+      if (usePeaks)
       {
-        float val = 0.0f;
-        for (uint16_t c = 0; c < numChannels; ++c)
+        ShortwavDSP::PeakPyramid::Entry peak = buffer->peaks.query(sampleStart, sampleEnd);
+        minVal = std::min(minVal, peak.min);
+        maxVal = std::max(maxVal, peak.max);
+      }
+      else
+      {
+        for (size_t s = sampleStart; s < sampleEnd; ++s)
         {
-          val += module->player.getRawSample(s, c);
+          float val = 0.0f;
+          for (uint16_t c = 0; c < numChannels; ++c)
+          {
+            float sample = 0.0f;
+            buffer->read(s, c, sample);
+            val += sample;
+          }
+          val /= numChannels; // Average channels
+
+          minVal = std::min(minVal, val);
+          maxVal = std::max(maxVal, val);
         }
-        val /= numChannels; // Average channels
-
-        minVal = std::min(minVal, val);
-        maxVal = std::max(maxVal, val);
       }
 
       float x = (float)i / displayPoints * box.size.x;
@@ -489,23 +823,18 @@ struct WaveformDisplay : TransparentWidget
 
       if (i == 0)
       {
-        nvgMoveTo(args.vg, x, (yMin + yMax) * 0.5f);
+        pathPoints_.push_back(Vec(x, (yMin + yMax) * 0.5f));
       }
-      
-      nvgLineTo(args.vg, x, yMin);
-      nvgLineTo(args.vg, x, yMax);
-    }
 
-    nvgStrokeColor(args.vg, nvgRGBA(0, 200, 255, 200));
-    nvgStrokeWidth(args.vg, 1.0f);
-    nvgStroke(args.vg);
+      pathPoints_.push_back(Vec(x, yMin));
+      pathPoints_.push_back(Vec(x, yMax));
+    }
   }
 
   void drawSliceBoundaries(const DrawArgs& args)
   {
-    std::lock_guard<std::mutex> lock(module->sliceMutex_);
-    
-    if (module->slices_.empty())
+    std::shared_ptr<const WavPlayer::SliceTable> table = module->sliceTable_.get();
+    if (!table || table->slices.empty())
       return;
 
     size_t numSamples = module->player.getNumSamples();
@@ -515,7 +844,7 @@ struct WaveformDisplay : TransparentWidget
     nvgStrokeColor(args.vg, nvgRGBA(255, 255, 0, 150));
     nvgStrokeWidth(args.vg, 1.0f);
 
-    for (const auto& slice : module->slices_)
+    for (const auto& slice : table->slices)
     {
       float x = ((float)slice.startSample / numSamples) * box.size.x;
       
@@ -561,5 +890,6 @@ struct WaveformDisplay : TransparentWidget
 struct WavPlayerWidget : ModuleWidget
 {
   WavPlayerWidget(WavPlayer* module);
+  void step() override;
   void appendContextMenu(Menu* menu) override;
 };
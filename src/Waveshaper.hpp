@@ -2,16 +2,24 @@
 
 #include "plugin.hpp"
 #include "dsp/waveshaper.h"
+#include "ControlRate.hpp"
+#include "DspStats.hpp"
 
 // Waveshaper Module
-// - One audio input
-// - One audio output
+// - One polyphonic audio input (up to 16 channels)
+// - One audio output with the input's channel count
 // - Controls for:
 //     * Input gain
 //     * Output gain
 //     * Waveshaper order
 //     * Soft clip vs clamp
 //     * Harmonic mix for a few Chebyshev terms
+// - All channels share one series, shaped four at a time (ChebyshevWaveshaperBank)
+// - Parameters evaluated at control rate, gains/coefficients ramped per sample
+// - Series baked into a polynomial when the harmonic weights change (see
+//   ChebyshevEvalMode), so steady settings cost a short Horner evaluation
+// - Optional anti-aliasing from the context menu: 2x/4x/8x oversampling
+//   and/or antiderivative anti-aliasing (ADAA)
 
 struct Waveshaper : Module
 {
@@ -47,7 +55,26 @@ struct Waveshaper : Module
 
   static constexpr std::size_t MaxOrder = 16u;
 
-  ShortwavDSP::ChebyshevWaveshaper<MaxOrder> waveshaper;
+  static constexpr int kMaxChannels = 16;
+
+  ShortwavDSP::ChebyshevWaveshaperBank<MaxOrder, kMaxChannels> waveshaper;
+  ShortwavDSP::ControlRateDivider controlRate;
+  ShortwavDSP::ControlRateStartup controlRateStartup{controlRate};
+
+  // Panel-exposed harmonic weights (T1..T4)
+  static constexpr int kNumHarmonicParams = 4;
+
+  // Per-sample smoothing of the continuous controls
+  ShortwavDSP::LinearRamp inputGainRamp{1.f};
+  ShortwavDSP::LinearRamp outputGainRamp{1.f};
+  ShortwavDSP::LinearRamp harmonicRamps[kNumHarmonicParams] = {
+      ShortwavDSP::LinearRamp{1.f}, ShortwavDSP::LinearRamp{0.f},
+      ShortwavDSP::LinearRamp{0.f}, ShortwavDSP::LinearRamp{0.f}};
+
+  // Anti-aliasing requested from the menu (UI thread), applied by the audio
+  // thread at the next control-rate block
+  std::atomic<int> oversampling{1}; // 1, 2, 4 or 8
+  std::atomic<bool> adaa{false};
 
   Waveshaper()
   {
@@ -71,9 +98,45 @@ struct Waveshaper : Module
 
     // Initialize default coefficients: T1(x) = x
     waveshaper.resetCoefficientsToLinear();
+
+    // Only T1..T4 are exposed, so the power-basis form is at most a quartic
+    // and is re-expanded only while a harmonic knob is actually moving
+    waveshaper.setEvalMode(ShortwavDSP::ChebyshevEvalMode::Polynomial);
   }
 
   void process(const ProcessArgs &args) override;
+
+  // Patches are restored before the instance is added (see ControlRateStartup)
+  void fromJson(json_t *rootJ) override
+  {
+    controlRateStartup.restoring();
+    Module::fromJson(rootJ);
+  }
+
+  void onAdd() override
+  {
+    controlRateStartup.added();
+  }
+
+  json_t *dataToJson() override
+  {
+    json_t *rootJ = json_object();
+    controlRateToJson(rootJ, controlRate);
+    json_object_set_new(rootJ, "oversampling", json_integer(oversampling.load()));
+    json_object_set_new(rootJ, "adaa", json_boolean(adaa.load()));
+    return rootJ;
+  }
+
+  void dataFromJson(json_t *rootJ) override
+  {
+    controlRateFromJson(rootJ, controlRate);
+    json_t *oversamplingJ = json_object_get(rootJ, "oversampling");
+    if (oversamplingJ)
+      oversampling.store(clamp((int)json_integer_value(oversamplingJ), 1, 8));
+    json_t *adaaJ = json_object_get(rootJ, "adaa");
+    if (adaaJ)
+      adaa.store(json_boolean_value(adaaJ));
+  }
 };
 
 struct WaveshaperWidget : ModuleWidget
@@ -213,5 +276,54 @@ struct WaveshaperWidget : ModuleWidget
       presetItem->preset = i;
       menu->addChild(presetItem);
     }
+
+    struct OversamplingItem : MenuItem
+    {
+      Waveshaper *module;
+      int factor;
+      void onAction(const event::Action &e) override
+      {
+        module->oversampling.store(factor);
+      }
+      void step() override
+      {
+        rightText = (module->oversampling.load() == factor) ? "✔" : "";
+        MenuItem::step();
+      }
+    };
+
+    struct AdaaItem : MenuItem
+    {
+      Waveshaper *module;
+      void onAction(const event::Action &e) override
+      {
+        module->adaa.store(!module->adaa.load());
+      }
+      void step() override
+      {
+        rightText = module->adaa.load() ? "✔" : "";
+        MenuItem::step();
+      }
+    };
+
+    menu->addChild(new MenuEntry);
+    menu->addChild(createMenuLabel("Oversampling"));
+
+    const int factors[] = {1, 2, 4, 8};
+    for (int factor : factors)
+    {
+      std::string label = (factor == 1) ? "Off" : (std::to_string(factor) + "x");
+      OversamplingItem *item = createMenuItem<OversamplingItem>(label);
+      item->module = module;
+      item->factor = factor;
+      menu->addChild(item);
+    }
+
+    AdaaItem *adaaItem = createMenuItem<AdaaItem>("Antiderivative anti-aliasing");
+    adaaItem->module = module;
+    menu->addChild(adaaItem);
+
+    appendControlRateMenu(menu, &module->controlRate);
+    appendDspStatsMenu(menu, "Waveshaper", {{"Waveshaper", &module->waveshaper.getStats(), false}});
   }
 };
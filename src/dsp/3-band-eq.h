@@ -2,9 +2,15 @@
 
 #include <cmath>
 #include <algorithm>
+#include <complex>
 #include <cstddef>
 #include <cstdint>
 
+#include "simd.h"
+#include "control-rate.h"
+#include "fast-math.h"
+#include "instrumentation.h"
+
 /*
  * Three-Band Equalizer
  *
@@ -19,16 +25,23 @@
  *  - Adjustable crossover frequencies (low/mid and mid/high boundaries)
  *  - Independent gain control for each band (-12dB to +12dB)
  *  - Stereo processing support
+ *  - Polyphonic processing (up to 16 channels, 4 per SIMD register)
  *  - Real-time safe (no allocations, no locks)
  *  - Denormal protection
  *  - Sample rate independent
  *
- * Architecture:
+ * Architecture (CrossoverMode::Classic, the default):
  *  - Two 4-pole cascaded single-pole filters (24dB/octave)
  *  - Filter #1: Lowpass (extracts low band)
  *  - Filter #2: Highpass (extracts high band)
  *  - Mid band computed as: input - (low + high)
  *
+ * Architecture (CrossoverMode::LinkwitzRiley):
+ *  - 4th-order Linkwitz-Riley crossovers (two Butterworth biquads each)
+ *  - Low band allpass-compensated, so the bands sum to flat magnitude
+ *  - Every band is a true 24dB/octave split, suitable for per-band outputs
+ *  - Roughly twice the cost of Classic
+ *
  * Frequency Ranges (typical):
  *  - Low band:  0 Hz to lowFreq (80-250 Hz recommended)
  *  - Mid band:  lowFreq to highFreq (1-4 kHz recommended)
@@ -46,6 +59,13 @@
  *  float out = eq.processSample(input);
  *  // or
  *  eq.processBuffer(inL, inR, outL, outR, numSamples);
+ *  // or, one sample frame of a polyphonic cable:
+ *  eq.processPoly(inVoltages, outVoltages, numChannels);
+ *
+ *  // Linkwitz-Riley split, fetching each channel's bands as well:
+ *  eq.setCrossoverMode(CrossoverMode::LinkwitzRiley);
+ *  ThreeBandEQ::BandSplit split;
+ *  eq.processPoly(inVoltages, outVoltages, numChannels, &split);
  */
 
 namespace ShortwavDSP
@@ -71,18 +91,44 @@ namespace ShortwavDSP
       return std::max(minVal, std::min(maxVal, value));
     }
 
+    // dB -> linear gain memo: recomputed (with fastExp2) only when the dB
+    // value differs from the previous call
+    class DbToGainCache
+    {
+    public:
+      float operator()(float dB) noexcept
+      {
+        if (dB != dB_)
+        {
+          dB_ = dB;
+          gain_ = fastExp2(dB * (3.32192809488736f / 20.0f)); // 10^(dB/20)
+        }
+        return gain_;
+      }
+
+    private:
+      float dB_ = 0.0f;
+      float gain_ = 1.0f;
+    };
+
     // Denormal fix constant (very small amount to prevent denormals)
     constexpr float kVSA = 1.0f / 4294967295.0f;
   }
 
+  class ThreeBandEQ;
+
   //------------------------------------------------------------------------------
   // ThreeBandEQ - Single channel state
+  //
+  // T is the lane type: float for one channel, simd::float4 for four channels
+  // processed in lockstep (eight pole states and three delay taps per lane).
   //------------------------------------------------------------------------------
 
-  class ThreeBandEQChannel
+  template <typename T>
+  class BasicThreeBandEQChannel
   {
   public:
-    ThreeBandEQChannel() noexcept
+    BasicThreeBandEQChannel() noexcept
     {
       reset();
     }
@@ -91,52 +137,59 @@ namespace ShortwavDSP
     void reset() noexcept
     {
       // Filter #1 poles (lowpass)
-      f1p0_ = 0.0f;
-      f1p1_ = 0.0f;
-      f1p2_ = 0.0f;
-      f1p3_ = 0.0f;
+      f1p0_ = T(0.0f);
+      f1p1_ = T(0.0f);
+      f1p2_ = T(0.0f);
+      f1p3_ = T(0.0f);
 
       // Filter #2 poles (highpass)
-      f2p0_ = 0.0f;
-      f2p1_ = 0.0f;
-      f2p2_ = 0.0f;
-      f2p3_ = 0.0f;
+      f2p0_ = T(0.0f);
+      f2p1_ = T(0.0f);
+      f2p2_ = T(0.0f);
+      f2p3_ = T(0.0f);
 
       // Sample history buffer (for highpass calculation)
-      sdm1_ = 0.0f;
-      sdm2_ = 0.0f;
-      sdm3_ = 0.0f;
+      sdm1_ = T(0.0f);
+      sdm2_ = T(0.0f);
+      sdm3_ = T(0.0f);
     }
 
     // Process a single sample
     // Returns the equalized output
-    float processSample(float sample, float lf, float hf, float lg, float mg, float hg) noexcept
+    T processSample(T sample, T lf, T hf, T lg, T mg, T hg) noexcept
+    {
+      T lOut, mOut, hOut;
+      return processSample(sample, lf, hf, lg, mg, hg, lOut, mOut, hOut);
+    }
+
+    // As above, also returning the gain-scaled bands (their sum is the output)
+    T processSample(T sample, T lf, T hf, T lg, T mg, T hg, T &lOut, T &mOut, T &hOut) noexcept
     {
       // Filter #1 (lowpass) - 4 cascaded single-pole filters
       // Each stage: y[n] = y[n-1] + lf * (x[n] - y[n-1])
-      f1p0_ += (lf * (sample - f1p0_)) + detail::kVSA;
+      f1p0_ += (lf * (sample - f1p0_)) + T(detail::kVSA);
       f1p1_ += (lf * (f1p0_ - f1p1_));
       f1p2_ += (lf * (f1p1_ - f1p2_));
       f1p3_ += (lf * (f1p2_ - f1p3_));
 
-      const float l = f1p3_;
+      const T l = f1p3_;
 
       // Filter #2 (highpass) - 4 cascaded single-pole filters
       // High component extracted from delayed input minus lowpass
-      f2p0_ += (hf * (sample - f2p0_)) + detail::kVSA;
+      f2p0_ += (hf * (sample - f2p0_)) + T(detail::kVSA);
       f2p1_ += (hf * (f2p0_ - f2p1_));
       f2p2_ += (hf * (f2p1_ - f2p2_));
       f2p3_ += (hf * (f2p2_ - f2p3_));
 
-      const float h = sdm3_ - f2p3_;
+      const T h = sdm3_ - f2p3_;
 
       // Calculate midrange (original signal minus low and high components)
-      const float m = sdm3_ - (h + l);
+      const T m = sdm3_ - (h + l);
 
       // Scale by gains
-      const float lOut = l * lg;
-      const float mOut = m * mg;
-      const float hOut = h * hg;
+      lOut = l * lg;
+      mOut = m * mg;
+      hOut = h * hg;
 
       // Shuffle history buffer (3-sample delay for highpass)
       sdm3_ = sdm2_;
@@ -148,16 +201,194 @@ namespace ShortwavDSP
     }
 
   private:
+    // The stereo buffer kernel packs two float channels into one register
+    friend class ThreeBandEQ;
+
     // Filter #1 state (lowpass)
-    float f1p0_, f1p1_, f1p2_, f1p3_;
+    T f1p0_, f1p1_, f1p2_, f1p3_;
 
     // Filter #2 state (highpass)
-    float f2p0_, f2p1_, f2p2_, f2p3_;
+    T f2p0_, f2p1_, f2p2_, f2p3_;
 
     // Sample delay memory (for highpass calculation)
-    float sdm1_, sdm2_, sdm3_;
+    T sdm1_, sdm2_, sdm3_;
+  };
+
+  // One channel (scalar) and four channels (one SIMD register)
+  using ThreeBandEQChannel = BasicThreeBandEQChannel<float>;
+  using ThreeBandEQChannel4 = BasicThreeBandEQChannel<simd::float4>;
+
+  //------------------------------------------------------------------------------
+  // Crossover topologies
+  //
+  // Classic: the Kellet split above. Cheapest; the low band is a 4-pole
+  //   one-pole cascade and the other bands are differences against a 3-sample
+  //   delay, so they sum to that delay but the mid and high bands leak well
+  //   outside their ranges.
+  // LinkwitzRiley: 4th-order (24 dB/octave) Linkwitz-Riley crossovers, each
+  //   band a true lowpass/bandpass/highpass. The bands sum to an allpass
+  //   (flat magnitude, phase rotating through the crossovers), so they can be
+  //   processed separately and mixed back without comb filtering.
+  //------------------------------------------------------------------------------
+
+  enum class CrossoverMode
+  {
+    Classic,
+    LinkwitzRiley
+  };
+
+  // Transposed direct form II biquad coefficients (a0 normalized to 1)
+  template <typename T>
+  struct BasicBiquadCoefficients
+  {
+    T b0, b1, b2, a1, a2;
+  };
+
+  // The five sections of a Linkwitz-Riley three-band split. Each LR4 filter
+  // is the same Butterworth section twice; highAllpass equals LP^2 + HP^2 of
+  // the high crossover and keeps the low band in phase with mid + high.
+  template <typename T>
+  struct BasicLinkwitzRileyCoefficients
+  {
+    BasicBiquadCoefficients<T> lowLowpass, lowHighpass;
+    BasicBiquadCoefficients<T> highLowpass, highHighpass, highAllpass;
+  };
+
+  using LinkwitzRileyCoefficients = BasicLinkwitzRileyCoefficients<float>;
+
+  namespace detail
+  {
+    // One TDF-II section; s1/s2 are its two state variables
+    template <typename T>
+    inline T biquad(T x, const BasicBiquadCoefficients<T> &c, T &s1, T &s2) noexcept
+    {
+      const T y = c.b0 * x + s1;
+      s1 = c.b1 * x - c.a1 * y + s2;
+      s2 = c.b2 * x - c.a2 * y;
+      return y;
+    }
+
+    // Bilinear Butterworth (Q = 1/sqrt(2)) lowpass and highpass sections for
+    // k = tan(PI * f / fs), plus the allpass LP^2 + HP^2 they sum to (same
+    // poles, numerator reversed)
+    inline void butterworthSections(float k, BasicBiquadCoefficients<float> &lp,
+                                    BasicBiquadCoefficients<float> &hp,
+                                    BasicBiquadCoefficients<float> &ap) noexcept
+    {
+      const float sqrt2 = 1.41421356237309505f;
+      const float kk = k * k;
+      const float norm = 1.0f / (1.0f + sqrt2 * k + kk);
+      const float a1 = 2.0f * (kk - 1.0f) * norm;
+      const float a2 = (1.0f - sqrt2 * k + kk) * norm;
+
+      lp.b0 = kk * norm;
+      lp.b1 = 2.0f * lp.b0;
+      lp.b2 = lp.b0;
+      hp.b0 = norm;
+      hp.b1 = -2.0f * norm;
+      hp.b2 = norm;
+      ap.b0 = a2;
+      ap.b1 = a1;
+      ap.b2 = 1.0f;
+      lp.a1 = hp.a1 = ap.a1 = a1;
+      lp.a2 = hp.a2 = ap.a2 = a2;
+    }
+
+    template <typename T>
+    inline BasicBiquadCoefficients<T> broadcast(const BasicBiquadCoefficients<float> &c) noexcept
+    {
+      BasicBiquadCoefficients<T> v = {T(c.b0), T(c.b1), T(c.b2), T(c.a1), T(c.a2)};
+      return v;
+    }
+
+    template <typename T>
+    inline BasicLinkwitzRileyCoefficients<T> broadcast(const LinkwitzRileyCoefficients &c) noexcept
+    {
+      BasicLinkwitzRileyCoefficients<T> v = {broadcast<T>(c.lowLowpass), broadcast<T>(c.lowHighpass),
+                                             broadcast<T>(c.highLowpass), broadcast<T>(c.highHighpass),
+                                             broadcast<T>(c.highAllpass)};
+      return v;
+    }
+  }
+
+  //------------------------------------------------------------------------------
+  // Linkwitz-Riley channel state
+  //
+  // low  = AP_high(LR_low lowpass(x))
+  // mid  = LR_high lowpass(LR_low highpass(x))
+  // high = LR_high highpass(LR_low highpass(x))
+  //
+  // Nine biquads per channel (two per LR4 filter plus the allpass). T is the
+  // lane type, as for BasicThreeBandEQChannel.
+  //------------------------------------------------------------------------------
+
+  template <typename T>
+  class BasicLinkwitzRileyChannel
+  {
+  public:
+    BasicLinkwitzRileyChannel() noexcept
+    {
+      reset();
+    }
+
+    void reset() noexcept
+    {
+      for (int i = 0; i < kNumSections; ++i)
+      {
+        s1_[i] = T(0.0f);
+        s2_[i] = T(0.0f);
+      }
+    }
+
+    // Process one sample, returning the output and the gain-scaled bands
+    // (their sum is the output)
+    T processSample(T sample, const BasicLinkwitzRileyCoefficients<T> &c, T lg, T mg, T hg,
+                    T &lOut, T &mOut, T &hOut) noexcept
+    {
+      const T x = sample + T(detail::kVSA);
+
+      T l = detail::biquad(x, c.lowLowpass, s1_[kLowLowpass1], s2_[kLowLowpass1]);
+      l = detail::biquad(l, c.lowLowpass, s1_[kLowLowpass2], s2_[kLowLowpass2]);
+      T hp = detail::biquad(x, c.lowHighpass, s1_[kLowHighpass1], s2_[kLowHighpass1]);
+      hp = detail::biquad(hp, c.lowHighpass, s1_[kLowHighpass2], s2_[kLowHighpass2]);
+
+      T m = detail::biquad(hp, c.highLowpass, s1_[kHighLowpass1], s2_[kHighLowpass1]);
+      m = detail::biquad(m, c.highLowpass, s1_[kHighLowpass2], s2_[kHighLowpass2]);
+      T h = detail::biquad(hp, c.highHighpass, s1_[kHighHighpass1], s2_[kHighHighpass1]);
+      h = detail::biquad(h, c.highHighpass, s1_[kHighHighpass2], s2_[kHighHighpass2]);
+      l = detail::biquad(l, c.highAllpass, s1_[kHighAllpass], s2_[kHighAllpass]);
+
+      lOut = l * lg;
+      mOut = m * mg;
+      hOut = h * hg;
+      return lOut + mOut + hOut;
+    }
+
+  private:
+    // The stereo buffer kernel packs two float channels into one register
+    friend class ThreeBandEQ;
+
+    enum Section
+    {
+      kLowLowpass1,
+      kLowLowpass2,
+      kLowHighpass1,
+      kLowHighpass2,
+      kHighLowpass1,
+      kHighLowpass2,
+      kHighHighpass1,
+      kHighHighpass2,
+      kHighAllpass,
+      kNumSections
+    };
+
+    T s1_[kNumSections];
+    T s2_[kNumSections];
   };
 
+  using LinkwitzRileyChannel = BasicLinkwitzRileyChannel<float>;
+  using LinkwitzRileyChannel4 = BasicLinkwitzRileyChannel<simd::float4>;
+
   //------------------------------------------------------------------------------
   // ThreeBandEQ - Main equalizer class
   //------------------------------------------------------------------------------
@@ -165,6 +396,19 @@ namespace ShortwavDSP
   class ThreeBandEQ
   {
   public:
+    // Maximum channel count for the polyphonic paths (matches a Rack poly cable)
+    static constexpr int kMaxPolyChannels = 16;
+    static constexpr int kPolyGroups = kMaxPolyChannels / simd::float4::size;
+
+    // Gain-scaled bands of one polyphonic frame, per channel; for each
+    // channel low + mid + high is the output
+    struct BandSplit
+    {
+      float low[kMaxPolyChannels];
+      float mid[kMaxPolyChannels];
+      float high[kMaxPolyChannels];
+    };
+
     ThreeBandEQ() noexcept
         : sampleRate_(44100.0f),
           lowFreq_(880.0f),
@@ -174,6 +418,7 @@ namespace ShortwavDSP
           highGain_(1.0f)
     {
       updateFilterCoefficients();
+      snapRamps();
     }
 
     //--------------------------------------------------------------------------
@@ -185,29 +430,57 @@ namespace ShortwavDSP
     {
       sampleRate_ = std::max(1.0f, sampleRate);
       updateFilterCoefficients();
+      snapRamps();
+    }
+
+    // Ramp coefficient and gain changes linearly over numSamples processed
+    // frames (0 = apply immediately, the default). Intended for control-rate
+    // callers that update parameters once per block of numSamples.
+    void setParameterRamp(int numSamples) noexcept
+    {
+      rampSamples_ = std::max(0, numSamples);
+    }
+
+    int getParameterRamp() const noexcept { return rampSamples_; }
+
+    // Select the crossover topology (Classic by default). Changing it clears
+    // the filter state, as the two topologies share none.
+    void setCrossoverMode(CrossoverMode mode) noexcept
+    {
+      if (mode == mode_)
+        return;
+      mode_ = mode;
+      updateLinkwitzRileyCoefficients();
+      reset();
     }
 
+    CrossoverMode getCrossoverMode() const noexcept { return mode_; }
+
     // Set low/mid crossover frequency (Hz)
     // Recommended range: 80-250 Hz
     void setLowFreq(float freq) noexcept
     {
-      lowFreq_ = detail::clamp(freq, 20.0f, sampleRate_ * 0.4f);
-      updateFilterCoefficients();
+      setCrossoverFreqs(freq, highFreq_);
     }
 
     // Set mid/high crossover frequency (Hz)
     // Recommended range: 1000-4000 Hz (1-4 kHz)
     void setHighFreq(float freq) noexcept
     {
-      highFreq_ = detail::clamp(freq, lowFreq_ + 100.0f, sampleRate_ * 0.45f);
-      updateFilterCoefficients();
+      setCrossoverFreqs(lowFreq_, freq);
     }
 
-    // Set crossover frequencies in one call
+    // Set crossover frequencies in one call. Like the other setters, this is
+    // a no-op when the (clamped) values are unchanged, so calling it every
+    // block with static knobs costs no transcendental math.
     void setCrossoverFreqs(float lowFreq, float highFreq) noexcept
     {
-      lowFreq_ = detail::clamp(lowFreq, 20.0f, sampleRate_ * 0.4f);
-      highFreq_ = detail::clamp(highFreq, lowFreq_ + 100.0f, sampleRate_ * 0.45f);
+      lowFreq = detail::clamp(lowFreq, 20.0f, sampleRate_ * 0.4f);
+      highFreq = detail::clamp(highFreq, lowFreq + 100.0f, sampleRate_ * 0.45f);
+      if (lowFreq == lowFreq_ && highFreq == highFreq_)
+        return;
+      lowFreq_ = lowFreq;
+      highFreq_ = highFreq;
       updateFilterCoefficients();
     }
 
@@ -216,38 +489,38 @@ namespace ShortwavDSP
     // Range: 0.25 (-12dB) to 4.0 (+12dB) recommended
     void setLowGain(float gain) noexcept
     {
-      lowGain_ = detail::clamp(gain, 0.0f, 10.0f);
+      setBandGain(lowGain_, lowGainRamp_, gain);
     }
 
     // Set mid band gain (linear)
     void setMidGain(float gain) noexcept
     {
-      midGain_ = detail::clamp(gain, 0.0f, 10.0f);
+      setBandGain(midGain_, midGainRamp_, gain);
     }
 
     // Set high band gain (linear)
     void setHighGain(float gain) noexcept
     {
-      highGain_ = detail::clamp(gain, 0.0f, 10.0f);
+      setBandGain(highGain_, highGainRamp_, gain);
     }
 
-    // Set low band gain in dB
+    // Set low band gain in dB (converted only when the value changes)
     // Range: -12dB to +12dB recommended
     void setLowGainDB(float dB) noexcept
     {
-      setLowGain(detail::dBToGain(detail::clamp(dB, -24.0f, 24.0f)));
+      setLowGain(lowDbCache_(detail::clamp(dB, -24.0f, 24.0f)));
     }
 
     // Set mid band gain in dB
     void setMidGainDB(float dB) noexcept
     {
-      setMidGain(detail::dBToGain(detail::clamp(dB, -24.0f, 24.0f)));
+      setMidGain(midDbCache_(detail::clamp(dB, -24.0f, 24.0f)));
     }
 
     // Set high band gain in dB
     void setHighGainDB(float dB) noexcept
     {
-      setHighGain(detail::dBToGain(detail::clamp(dB, -24.0f, 24.0f)));
+      setHighGain(highDbCache_(detail::clamp(dB, -24.0f, 24.0f)));
     }
 
     // Set all gains at once (linear)
@@ -280,6 +553,66 @@ namespace ShortwavDSP
     float getMidGainDB() const noexcept { return detail::gainToDB(midGain_); }
     float getHighGainDB() const noexcept { return detail::gainToDB(highGain_); }
 
+    // Exact magnitude response (linear) at freq Hz of an EQ with the given
+    // settings: both pole cascades, the three-sample delay and the mid band
+    // difference (or the Linkwitz-Riley sections), with the settings clamped
+    // as the setters do. Not for the audio thread (complex math per call);
+    // use it to draw the curve.
+    static float magnitudeResponse(float freq, float sampleRate, float lowFreq, float highFreq,
+                                   float lowGain, float midGain, float highGain,
+                                   CrossoverMode mode = CrossoverMode::Classic) noexcept
+    {
+      sampleRate = std::max(1.0f, sampleRate);
+      lowFreq = detail::clamp(lowFreq, 20.0f, sampleRate * 0.4f);
+      highFreq = detail::clamp(highFreq, lowFreq + 100.0f, sampleRate * 0.45f);
+      lowGain = detail::clamp(lowGain, 0.0f, 10.0f);
+      midGain = detail::clamp(midGain, 0.0f, 10.0f);
+      highGain = detail::clamp(highGain, 0.0f, 10.0f);
+
+      const std::complex<double> z1 = std::polar(1.0, -2.0 * 3.14159265358979323846 * freq / sampleRate);
+      if (mode == CrossoverMode::LinkwitzRiley)
+      {
+        LinkwitzRileyCoefficients c;
+        linkwitzRileyCoefficients(prewarp(lowFreq, sampleRate), prewarp(highFreq, sampleRate), c);
+        auto section = [&z1](const BasicBiquadCoefficients<float> &s) {
+          const std::complex<double> num = static_cast<double>(s.b0) + z1 * (static_cast<double>(s.b1) + z1 * static_cast<double>(s.b2));
+          const std::complex<double> den = 1.0 + z1 * (static_cast<double>(s.a1) + z1 * static_cast<double>(s.a2));
+          return num / den;
+        };
+        const std::complex<double> lowLp = section(c.lowLowpass), lowHp = section(c.lowHighpass);
+        const std::complex<double> highLp = section(c.highLowpass), highHp = section(c.highHighpass);
+        const std::complex<double> response =
+            static_cast<double>(lowGain) * lowLp * lowLp * section(c.highAllpass) +
+            lowHp * lowHp * (static_cast<double>(midGain) * highLp * highLp + static_cast<double>(highGain) * highHp * highHp);
+        return static_cast<float>(std::abs(response));
+      }
+
+      auto cascade = [&z1](float c) {
+        const std::complex<double> stage = static_cast<double>(c) / (1.0 - (1.0 - c) * z1);
+        const std::complex<double> two = stage * stage;
+        return two * two;
+      };
+      const std::complex<double> low = cascade(crossoverCoefficient(lowFreq, sampleRate));
+      const std::complex<double> lowpassHigh = cascade(crossoverCoefficient(highFreq, sampleRate));
+
+      // l = LP(lf), h = z^-3 - LP(hf), m = z^-3 - (h + l) = LP(hf) - LP(lf)
+      const std::complex<double> response =
+          static_cast<double>(lowGain) * low +
+          static_cast<double>(midGain) * (lowpassHigh - low) +
+          static_cast<double>(highGain) * (z1 * z1 * z1 - lowpassHigh);
+      return static_cast<float>(std::abs(response));
+    }
+
+    // Magnitude response of the current settings (ramp targets)
+    float getMagnitudeResponse(float freq) const noexcept
+    {
+      return magnitudeResponse(freq, sampleRate_, lowFreq_, highFreq_, lowGain_, midGain_, highGain_, mode_);
+    }
+
+    // Load counters (empty unless built with SHORTWAV_DSP_INSTRUMENTATION)
+    const DspStats &getStats() const noexcept { return stats_; }
+    DspStats &getStats() noexcept { return stats_; }
+
     //--------------------------------------------------------------------------
     // Reset
     //--------------------------------------------------------------------------
@@ -289,6 +622,15 @@ namespace ShortwavDSP
     {
       leftChannel_.reset();
       rightChannel_.reset();
+      lrLeft_.reset();
+      lrRight_.reset();
+      for (int g = 0; g < kPolyGroups; ++g)
+      {
+        polyLeft_[g].reset();
+        polyRight_[g].reset();
+        polyLRLeft_[g].reset();
+        polyLRRight_[g].reset();
+      }
     }
 
     //--------------------------------------------------------------------------
@@ -298,14 +640,38 @@ namespace ShortwavDSP
     // Process a single mono sample
     float processSample(float sample) noexcept
     {
-      return leftChannel_.processSample(sample, lf_, hf_, lowGain_, midGain_, highGain_);
+      DspStats::Timer timer(stats_, 1);
+      advanceRamps();
+      if (mode_ == CrossoverMode::LinkwitzRiley)
+      {
+        float l, m, h;
+        return lrLeft_.processSample(sample, lrCoeffs_, lowGainRamp_.getValue(), midGainRamp_.getValue(),
+                                     highGainRamp_.getValue(), l, m, h);
+      }
+      return leftChannel_.processSample(sample, lfRamp_.getValue(), hfRamp_.getValue(),
+                                        lowGainRamp_.getValue(), midGainRamp_.getValue(),
+                                        highGainRamp_.getValue());
     }
 
     // Process a single stereo sample pair
     void processStereoSample(float &left, float &right) noexcept
     {
-      left = leftChannel_.processSample(left, lf_, hf_, lowGain_, midGain_, highGain_);
-      right = rightChannel_.processSample(right, lf_, hf_, lowGain_, midGain_, highGain_);
+      DspStats::Timer timer(stats_, 1);
+      advanceRamps();
+      const float lf = lfRamp_.getValue();
+      const float hf = hfRamp_.getValue();
+      const float lg = lowGainRamp_.getValue();
+      const float mg = midGainRamp_.getValue();
+      const float hg = highGainRamp_.getValue();
+      if (mode_ == CrossoverMode::LinkwitzRiley)
+      {
+        float l, m, h;
+        left = lrLeft_.processSample(left, lrCoeffs_, lg, mg, hg, l, m, h);
+        right = lrRight_.processSample(right, lrCoeffs_, lg, mg, hg, l, m, h);
+        return;
+      }
+      left = leftChannel_.processSample(left, lf, hf, lg, mg, hg);
+      right = rightChannel_.processSample(right, lf, hf, lg, mg, hg);
     }
 
     // Process a buffer of mono samples
@@ -317,18 +683,10 @@ namespace ShortwavDSP
       }
     }
 
-    // Process a buffer of interleaved stereo samples
+    // Process a buffer of interleaved stereo samples (in place is fine)
     void processStereoBufferInterleaved(const float *input, float *output, size_t numFrames) noexcept
     {
-      for (size_t i = 0; i < numFrames; ++i)
-      {
-        const size_t idx = i * 2;
-        float left = input[idx];
-        float right = input[idx + 1];
-        processStereoSample(left, right);
-        output[idx] = left;
-        output[idx + 1] = right;
-      }
+      processStereoFrames<2>(input, input + 1, output, output + 1, numFrames);
     }
 
     // Process separate left/right buffers (non-interleaved stereo)
@@ -336,27 +694,419 @@ namespace ShortwavDSP
                              float *outputL, float *outputR,
                              size_t numSamples) noexcept
     {
-      for (size_t i = 0; i < numSamples; ++i)
+      processStereoFrames<1>(inputL, inputR, outputL, outputR, numSamples);
+    }
+
+    //--------------------------------------------------------------------------
+    // Polyphonic processing
+    //
+    // One sample frame of up to kMaxPolyChannels independent channels, four
+    // channels per SIMD register. Channel c of every call is a continuous
+    // signal with its own filter state; all channels share the crossover and
+    // gain settings. The poly state is separate from the mono/stereo state
+    // used by processSample()/processStereoSample().
+    //--------------------------------------------------------------------------
+
+    // Process one frame of numChannels channels (input/output hold numChannels
+    // floats). With split, each channel's bands are written to it as well.
+    void processPoly(const float *input, float *output, int numChannels, BandSplit *split = nullptr) noexcept
+    {
+      DspStats::Timer timer(stats_, 1);
+      advanceRamps();
+      processPolyBank(polyLeft_, polyLRLeft_, input, output, numChannels, nullptr, split);
+    }
+
+    // Process one frame of numChannels channels on both the left and right banks
+    void processPolyStereo(const float *inputL, const float *inputR,
+                           float *outputL, float *outputR,
+                           int numChannels) noexcept
+    {
+      DspStats::Timer timer(stats_, 1);
+      advanceRamps();
+      processPolyBank(polyLeft_, polyLRLeft_, inputL, outputL, numChannels, nullptr, nullptr);
+      processPolyBank(polyRight_, polyLRRight_, inputR, outputR, numChannels, nullptr, nullptr);
+    }
+
+    // As above with band taps; the outputs are unchanged. Any tap may be null.
+    //  - bands[0..2] (low, mid, high): the gain-scaled bands of the frame,
+    //    (left + right) / 2 summed over the channels, for analysis such as a
+    //    spectrum display
+    //  - splitL/splitR: the bands of every channel, e.g. for per-band outputs
+    void processPolyStereo(const float *inputL, const float *inputR,
+                           float *outputL, float *outputR,
+                           int numChannels, float *bands,
+                           BandSplit *splitL = nullptr, BandSplit *splitR = nullptr) noexcept
+    {
+      DspStats::Timer timer(stats_, 1);
+      advanceRamps();
+      if (bands != nullptr)
+        bands[0] = bands[1] = bands[2] = 0.0f;
+      processPolyBank(polyLeft_, polyLRLeft_, inputL, outputL, numChannels, bands, splitL);
+      processPolyBank(polyRight_, polyLRRight_, inputR, outputR, numChannels, bands, splitR);
+    }
+
+  private:
+    // Stereo buffer kernel. The four pole cascades of a stereo pair (left
+    // lowpass, left highpass, right lowpass, right highpass) are independent
+    // and identically shaped, so they run side by side in one float4; only
+    // the three-tap delay and band mix stay scalar. Stride is the distance
+    // between consecutive frames of one channel (2 = interleaved, 1 = split),
+    // which fuses the (de)interleave into the loop. Every lane performs the
+    // same operations as ThreeBandEQChannel::processSample(), so the output
+    // is identical to calling processStereoSample() frame by frame.
+    template <size_t Stride>
+    void processStereoFrames(const float *inL, const float *inR, float *outL, float *outR,
+                             size_t numFrames) noexcept
+    {
+      using simd::float4;
+      DspStats::Timer timer(stats_, numFrames);
+      if (mode_ == CrossoverMode::LinkwitzRiley)
+      {
+        processStereoFramesLR<Stride>(inL, inR, outL, outR, numFrames);
+        return;
+      }
+
+      ThreeBandEQChannel &cl = leftChannel_;
+      ThreeBandEQChannel &cr = rightChannel_;
+      float4 p0(cl.f1p0_, cl.f2p0_, cr.f1p0_, cr.f2p0_);
+      float4 p1(cl.f1p1_, cl.f2p1_, cr.f1p1_, cr.f2p1_);
+      float4 p2(cl.f1p2_, cl.f2p2_, cr.f1p2_, cr.f2p2_);
+      float4 p3(cl.f1p3_, cl.f2p3_, cr.f1p3_, cr.f2p3_);
+      float l1 = cl.sdm1_, l2 = cl.sdm2_, l3 = cl.sdm3_;
+      float r1 = cr.sdm1_, r2 = cr.sdm2_, r3 = cr.sdm3_;
+      const float4 vsa(detail::kVSA);
+
+      // Coefficients are only re-read while a ramp is running
+      float4 coeff(lfRamp_.getValue(), hfRamp_.getValue(), lfRamp_.getValue(), hfRamp_.getValue());
+      float lg = lowGainRamp_.getValue();
+      float mg = midGainRamp_.getValue();
+      float hg = highGainRamp_.getValue();
+
+      for (size_t i = 0; i < numFrames; ++i)
+      {
+        if (ramping_)
+        {
+          advanceRamps();
+          const float lf = lfRamp_.getValue();
+          const float hf = hfRamp_.getValue();
+          coeff = float4(lf, hf, lf, hf);
+          lg = lowGainRamp_.getValue();
+          mg = midGainRamp_.getValue();
+          hg = highGainRamp_.getValue();
+        }
+
+        const float xl = inL[i * Stride];
+        const float xr = inR[i * Stride];
+        const float4 x(xl, xl, xr, xr);
+
+        p0 += (coeff * (x - p0)) + vsa;
+        p1 += (coeff * (p0 - p1));
+        p2 += (coeff * (p1 - p2));
+        p3 += (coeff * (p2 - p3));
+
+        float taps[float4::size];
+        p3.store(taps);
+
+        const float lh = l3 - taps[1];
+        const float lm = l3 - (lh + taps[0]);
+        const float rh = r3 - taps[3];
+        const float rm = r3 - (rh + taps[2]);
+
+        l3 = l2;
+        l2 = l1;
+        l1 = xl;
+        r3 = r2;
+        r2 = r1;
+        r1 = xr;
+
+        outL[i * Stride] = taps[0] * lg + lm * mg + lh * hg;
+        outR[i * Stride] = taps[2] * lg + rm * mg + rh * hg;
+      }
+
+      unpackPair(p0, cl.f1p0_, cl.f2p0_, cr.f1p0_, cr.f2p0_);
+      unpackPair(p1, cl.f1p1_, cl.f2p1_, cr.f1p1_, cr.f2p1_);
+      unpackPair(p2, cl.f1p2_, cl.f2p2_, cr.f1p2_, cr.f2p2_);
+      unpackPair(p3, cl.f1p3_, cl.f2p3_, cr.f1p3_, cr.f2p3_);
+      cl.sdm1_ = l1;
+      cl.sdm2_ = l2;
+      cl.sdm3_ = l3;
+      cr.sdm1_ = r1;
+      cr.sdm2_ = r2;
+      cr.sdm3_ = r3;
+    }
+
+    // Linkwitz-Riley stereo buffer kernel, packed like processStereoFrames():
+    // the first two stages run the low crossover's lowpass and highpass of
+    // both channels side by side (L lowpass, L highpass, R lowpass, R
+    // highpass), the next two the high crossover's lowpass and highpass of
+    // the highpassed signal, and the allpass on the two low bands uses lanes
+    // 0/1. Each lane matches LinkwitzRileyChannel::processSample() exactly.
+    template <size_t Stride>
+    void processStereoFramesLR(const float *inL, const float *inR, float *outL, float *outR,
+                               size_t numFrames) noexcept
+    {
+      using simd::float4;
+      typedef LinkwitzRileyChannel LR;
+
+      LinkwitzRileyChannel &cl = lrLeft_;
+      LinkwitzRileyChannel &cr = lrRight_;
+      const int stage[4][2] = {{LR::kLowLowpass1, LR::kLowHighpass1},
+                               {LR::kLowLowpass2, LR::kLowHighpass2},
+                               {LR::kHighLowpass1, LR::kHighHighpass1},
+                               {LR::kHighLowpass2, LR::kHighHighpass2}};
+      float4 s1[5], s2[5];
+      for (int k = 0; k < 4; ++k)
       {
-        outputL[i] = leftChannel_.processSample(inputL[i], lf_, hf_, lowGain_, midGain_, highGain_);
-        outputR[i] = rightChannel_.processSample(inputR[i], lf_, hf_, lowGain_, midGain_, highGain_);
+        s1[k] = float4(cl.s1_[stage[k][0]], cl.s1_[stage[k][1]], cr.s1_[stage[k][0]], cr.s1_[stage[k][1]]);
+        s2[k] = float4(cl.s2_[stage[k][0]], cl.s2_[stage[k][1]], cr.s2_[stage[k][0]], cr.s2_[stage[k][1]]);
       }
+      s1[4] = float4(cl.s1_[LR::kHighAllpass], cr.s1_[LR::kHighAllpass], 0.0f, 0.0f);
+      s2[4] = float4(cl.s2_[LR::kHighAllpass], cr.s2_[LR::kHighAllpass], 0.0f, 0.0f);
+      const float4 vsa(detail::kVSA);
+
+      // Coefficients are only re-packed while a ramp is running
+      BasicBiquadCoefficients<float4> lowC = packSections(lrCoeffs_.lowLowpass, lrCoeffs_.lowHighpass);
+      BasicBiquadCoefficients<float4> highC = packSections(lrCoeffs_.highLowpass, lrCoeffs_.highHighpass);
+      BasicBiquadCoefficients<float4> allpassC = lrCoeffs4_.highAllpass;
+      float lg = lowGainRamp_.getValue();
+      float mg = midGainRamp_.getValue();
+      float hg = highGainRamp_.getValue();
+
+      for (size_t i = 0; i < numFrames; ++i)
+      {
+        if (ramping_)
+        {
+          advanceRamps();
+          lowC = packSections(lrCoeffs_.lowLowpass, lrCoeffs_.lowHighpass);
+          highC = packSections(lrCoeffs_.highLowpass, lrCoeffs_.highHighpass);
+          allpassC = lrCoeffs4_.highAllpass;
+          lg = lowGainRamp_.getValue();
+          mg = midGainRamp_.getValue();
+          hg = highGainRamp_.getValue();
+        }
+
+        const float xl = inL[i * Stride];
+        const float xr = inR[i * Stride];
+        const float4 x = float4(xl, xl, xr, xr) + vsa;
+
+        float4 y = detail::biquad(x, lowC, s1[0], s2[0]);
+        y = detail::biquad(y, lowC, s1[1], s2[1]);
+        float split[float4::size];
+        y.store(split); // L low, L rest, R low, R rest
+
+        float4 z = detail::biquad(float4(split[1], split[1], split[3], split[3]), highC, s1[2], s2[2]);
+        z = detail::biquad(z, highC, s1[3], s2[3]);
+        const float4 lows = detail::biquad(float4(split[0], split[2], 0.0f, 0.0f), allpassC, s1[4], s2[4]);
+
+        float bands[float4::size], low[float4::size];
+        z.store(bands); // L mid, L high, R mid, R high
+        lows.store(low);
+
+        outL[i * Stride] = low[0] * lg + bands[0] * mg + bands[1] * hg;
+        outR[i * Stride] = low[1] * lg + bands[2] * mg + bands[3] * hg;
+      }
+
+      for (int k = 0; k < 4; ++k)
+      {
+        unpackPair(s1[k], cl.s1_[stage[k][0]], cl.s1_[stage[k][1]], cr.s1_[stage[k][0]], cr.s1_[stage[k][1]]);
+        unpackPair(s2[k], cl.s2_[stage[k][0]], cl.s2_[stage[k][1]], cr.s2_[stage[k][0]], cr.s2_[stage[k][1]]);
+      }
+      float unused0, unused1;
+      unpackPair(s1[4], cl.s1_[LR::kHighAllpass], cr.s1_[LR::kHighAllpass], unused0, unused1);
+      unpackPair(s2[4], cl.s2_[LR::kHighAllpass], cr.s2_[LR::kHighAllpass], unused0, unused1);
+    }
+
+    // Write the four lanes of a packed stereo pole back to the channel states
+    static void unpackPair(simd::float4 v, float &a, float &b, float &c, float &d) noexcept
+    {
+      float t[simd::float4::size];
+      v.store(t);
+      a = t[0];
+      b = t[1];
+      c = t[2];
+      d = t[3];
+    }
+
+    // Lanes (a, b, a, b): two sections for each channel of a stereo pair
+    static BasicBiquadCoefficients<simd::float4> packSections(const BasicBiquadCoefficients<float> &a,
+                                                              const BasicBiquadCoefficients<float> &b) noexcept
+    {
+      using simd::float4;
+      BasicBiquadCoefficients<float4> c = {float4(a.b0, b.b0, a.b0, b.b0), float4(a.b1, b.b1, a.b1, b.b1),
+                                           float4(a.b2, b.b2, a.b2, b.b2), float4(a.a1, b.a1, a.a1, b.a1),
+                                           float4(a.a2, b.a2, a.a2, b.a2)};
+      return c;
+    }
+
+    // Runs the bank of the active crossover mode. With bands, half of each
+    // valid lane's band outputs is added to bands[0..2]; with split, they are
+    // stored per channel.
+    void processPolyBank(ThreeBandEQChannel4 *bank, LinkwitzRileyChannel4 *lrBank, const float *input,
+                         float *output, int numChannels, float *bands, BandSplit *split) noexcept
+    {
+      using simd::float4;
+
+      numChannels = std::max(0, std::min(numChannels, kMaxPolyChannels));
+
+      // Broadcast coefficients once per frame rather than once per group
+      const float4 lg(lowGainRamp_.getValue());
+      const float4 mg(midGainRamp_.getValue());
+      const float4 hg(highGainRamp_.getValue());
+      const bool tap = bands != nullptr || split != nullptr;
+
+      if (mode_ == CrossoverMode::LinkwitzRiley)
+      {
+        for (int c = 0, g = 0; c < numChannels; c += float4::size, ++g)
+        {
+          const int lanes = std::min(float4::size, numChannels - c);
+          const float4 in = float4::loadPartial(input + c, lanes);
+          float4 band[3];
+          lrBank[g].processSample(in, lrCoeffs4_, lg, mg, hg, band[0], band[1], band[2]).storePartial(output + c, lanes);
+          if (tap)
+            tapBands(band, c, lanes, bands, split);
+        }
+        return;
+      }
+
+      const float4 lf(lfRamp_.getValue()), hf(hfRamp_.getValue());
+      for (int c = 0, g = 0; c < numChannels; c += float4::size, ++g)
+      {
+        const int lanes = std::min(float4::size, numChannels - c);
+        const float4 in = float4::loadPartial(input + c, lanes);
+        if (!tap)
+        {
+          bank[g].processSample(in, lf, hf, lg, mg, hg).storePartial(output + c, lanes);
+          continue;
+        }
+
+        float4 band[3];
+        bank[g].processSample(in, lf, hf, lg, mg, hg, band[0], band[1], band[2]).storePartial(output + c, lanes);
+        tapBands(band, c, lanes, bands, split);
+      }
+    }
+
+    // Band taps of one group (channels c .. c + lanes - 1)
+    static void tapBands(const simd::float4 band[3], int c, int lanes, float *bands, BandSplit *split) noexcept
+    {
+      using simd::float4;
+      if (split != nullptr)
+      {
+        band[0].storePartial(split->low + c, lanes);
+        band[1].storePartial(split->mid + c, lanes);
+        band[2].storePartial(split->high + c, lanes);
+      }
+      if (bands != nullptr)
+      {
+        for (int b = 0; b < 3; ++b)
+        {
+          float t[float4::size];
+          (band[b] * float4(0.5f)).store(t);
+          for (int lane = 0; lane < lanes; ++lane)
+            bands[b] += t[lane];
+        }
+      }
+    }
+
+    // One-pole coefficient for a crossover at freq: 2 * sin(PI * freq / sampleRate),
+    // clamped to (0, 2) for stability
+    static float crossoverCoefficient(float freq, float sampleRate) noexcept
+    {
+      const float pi = 3.14159265358979323846f;
+      return detail::clamp(2.0f * detail::fastSin(pi * (freq / sampleRate)), 0.0001f, 1.99f);
+    }
+
+    // Bilinear prewarp for the Linkwitz-Riley sections: tan(PI * freq / sampleRate)
+    static float prewarp(float freq, float sampleRate) noexcept
+    {
+      const float pi = 3.14159265358979323846f;
+      const float w = pi * (freq / sampleRate);
+      return detail::fastSin(w) / detail::fastSin(w + 0.5f * pi);
+    }
+
+    static void linkwitzRileyCoefficients(float lowTan, float highTan, LinkwitzRileyCoefficients &c) noexcept
+    {
+      BasicBiquadCoefficients<float> lowAllpass;
+      detail::butterworthSections(lowTan, c.lowLowpass, c.lowHighpass, lowAllpass);
+      detail::butterworthSections(highTan, c.highLowpass, c.highHighpass, c.highAllpass);
+    }
+
+    // Rebuild the Linkwitz-Riley sections from the (ramped) prewarped frequencies
+    void updateLinkwitzRileyCoefficients() noexcept
+    {
+      linkwitzRileyCoefficients(lowTanRamp_.getValue(), highTanRamp_.getValue(), lrCoeffs_);
+      lrCoeffs4_ = detail::broadcast<simd::float4>(lrCoeffs_);
     }
 
-  private:
     // Update filter coefficients based on current frequencies and sample rate
     void updateFilterCoefficients() noexcept
     {
       // Calculate filter cutoff frequencies using prewarped frequency mapping
       // lf and hf are the normalized cutoff frequencies for single-pole filters
-      // Formula: 2 * sin(PI * (freq / sampleRate))
-      const float pi = 3.14159265358979323846f;
-      lf_ = 2.0f * std::sin(pi * (lowFreq_ / sampleRate_));
-      hf_ = 2.0f * std::sin(pi * (highFreq_ / sampleRate_));
+      lf_ = crossoverCoefficient(lowFreq_, sampleRate_);
+      hf_ = crossoverCoefficient(highFreq_, sampleRate_);
+      lowTan_ = prewarp(lowFreq_, sampleRate_);
+      highTan_ = prewarp(highFreq_, sampleRate_);
+
+      retarget(lfRamp_, lf_);
+      retarget(hfRamp_, hf_);
+      retarget(lowTanRamp_, lowTan_);
+      retarget(highTanRamp_, highTan_);
+      updateLinkwitzRileyCoefficients();
+      stats_.countCoefficientUpdates();
+    }
+
+    // Clamp and apply one band gain, skipping unchanged values
+    void setBandGain(float &gain, LinearRamp &ramp, float value) noexcept
+    {
+      value = detail::clamp(value, 0.0f, 10.0f);
+      if (value == gain)
+        return;
+      gain = value;
+      retarget(ramp, gain);
+    }
 
-      // Clamp to valid range (0, 2) for stability
-      lf_ = detail::clamp(lf_, 0.0001f, 1.99f);
-      hf_ = detail::clamp(hf_, 0.0001f, 1.99f);
+    // Start ramping towards a new target (or jump, if ramping is disabled)
+    void retarget(LinearRamp &ramp, float target) noexcept
+    {
+      ramp.setTarget(target, rampSamples_);
+      ramping_ = ramping_ || ramp.isActive();
+    }
+
+    // Jump all coefficients to their targets
+    void snapRamps() noexcept
+    {
+      lfRamp_.reset(lf_);
+      hfRamp_.reset(hf_);
+      lowTanRamp_.reset(lowTan_);
+      highTanRamp_.reset(highTan_);
+      lowGainRamp_.reset(lowGain_);
+      midGainRamp_.reset(midGain_);
+      highGainRamp_.reset(highGain_);
+      ramping_ = false;
+      updateLinkwitzRileyCoefficients();
+    }
+
+    // Advance coefficient ramps by one frame (no-op when settled)
+    void advanceRamps() noexcept
+    {
+      if (!ramping_)
+        return;
+      lfRamp_.next();
+      hfRamp_.next();
+      lowGainRamp_.next();
+      midGainRamp_.next();
+      highGainRamp_.next();
+      if (lowTanRamp_.isActive() || highTanRamp_.isActive())
+      {
+        lowTanRamp_.next();
+        highTanRamp_.next();
+        // The Classic topology reads its coefficients straight from the ramps
+        if (mode_ == CrossoverMode::LinkwitzRiley)
+          updateLinkwitzRileyCoefficients();
+      }
+      ramping_ = lfRamp_.isActive() || hfRamp_.isActive() || lowTanRamp_.isActive() ||
+                 highTanRamp_.isActive() || lowGainRamp_.isActive() || midGainRamp_.isActive() ||
+                 highGainRamp_.isActive();
     }
 
     // Configuration
@@ -368,14 +1118,45 @@ namespace ShortwavDSP
     float lowGain_;
     float midGain_;
     float highGain_;
+    detail::DbToGainCache lowDbCache_;
+    detail::DbToGainCache midDbCache_;
+    detail::DbToGainCache highDbCache_;
 
     // Filter coefficients (computed from frequencies)
     float lf_; // Lowpass coefficient
     float hf_; // Highpass coefficient
+    float lowTan_;  // Linkwitz-Riley prewarped low crossover
+    float highTan_; // Linkwitz-Riley prewarped high crossover
+    CrossoverMode mode_ = CrossoverMode::Classic;
+
+    // Per-sample smoothed coefficients actually used for processing
+    LinearRamp lfRamp_;
+    LinearRamp hfRamp_;
+    LinearRamp lowTanRamp_;
+    LinearRamp highTanRamp_;
+    LinearRamp lowGainRamp_;
+    LinearRamp midGainRamp_;
+    LinearRamp highGainRamp_;
+    int rampSamples_ = 0;
+    bool ramping_ = false;
 
     // Channel state (stereo)
     ThreeBandEQChannel leftChannel_;
     ThreeBandEQChannel rightChannel_;
+
+    // Channel state (polyphonic, 4 channels per group)
+    ThreeBandEQChannel4 polyLeft_[kPolyGroups];
+    ThreeBandEQChannel4 polyRight_[kPolyGroups];
+
+    // Linkwitz-Riley sections (scalar, and broadcast for the poly banks) and state
+    LinkwitzRileyCoefficients lrCoeffs_;
+    BasicLinkwitzRileyCoefficients<simd::float4> lrCoeffs4_;
+    LinkwitzRileyChannel lrLeft_;
+    LinkwitzRileyChannel lrRight_;
+    LinkwitzRileyChannel4 polyLRLeft_[kPolyGroups];
+    LinkwitzRileyChannel4 polyLRRight_[kPolyGroups];
+
+    DspStats stats_;
   };
 
 } // namespace ShortwavDSP
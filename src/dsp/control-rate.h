@@ -0,0 +1,194 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+
+/*
+ * Control-rate helpers
+ *
+ * Shared building blocks for evaluating parameters once per block of N samples
+ * instead of once per sample, while keeping the audio path click-free:
+ *
+ *  - ControlRateDivider: tells the caller when a new control block starts and
+ *    how long it is. The length is latched at the start of each block, so the
+ *    division can be changed from another thread at any time.
+ *  - LinearRamp: per-sample linear interpolation from the current value to a
+ *    new target over a given number of samples.
+ *  - ControlRateStartup: picks a module instance's first division, so
+ *    patches saved before control-rate blocks existed keep every-sample
+ *    evaluation while new instances get kDefaultDivision.
+ *
+ * Typical use in a Rack module (zero added latency):
+ *
+ *  if (controlRate.tick())
+ *  {
+ *    // Decode params/CV, run the expensive coefficient math once
+ *    filter.setParameterRamp(controlRate.getBlockSize());
+ *    filter.setCutoff(cutoffHz);
+ *  }
+ *  out = filter.processSample(in); // coefficients ramp per sample
+ *
+ * Generators without an audio input can instead render the whole block with
+ * their processBuffer() entry point when tick() returns true.
+ *
+ * Real-time safe: no allocations, no locks.
+ */
+
+namespace ShortwavDSP
+{
+
+  //------------------------------------------------------------------------------
+  // LinearRamp - per-sample linear parameter smoothing
+  //------------------------------------------------------------------------------
+
+  class LinearRamp
+  {
+  public:
+    LinearRamp() noexcept = default;
+
+    explicit LinearRamp(float value) noexcept
+    {
+      reset(value);
+    }
+
+    // Jump to value immediately (no ramp)
+    void reset(float value) noexcept
+    {
+      value_ = value;
+      target_ = value;
+      step_ = 0.0f;
+      remaining_ = 0;
+    }
+
+    // Ramp from the current value to target over numSteps calls to next().
+    // numSteps <= 0 jumps immediately.
+    void setTarget(float target, int numSteps) noexcept
+    {
+      target_ = target;
+      if (numSteps <= 0)
+      {
+        value_ = target;
+        step_ = 0.0f;
+        remaining_ = 0;
+        return;
+      }
+      step_ = (target - value_) / static_cast<float>(numSteps);
+      remaining_ = numSteps;
+    }
+
+    // Advance one sample and return the new value.
+    // The final step lands exactly on the target.
+    float next() noexcept
+    {
+      if (remaining_ > 0)
+      {
+        if (--remaining_ == 0)
+          value_ = target_;
+        else
+          value_ += step_;
+      }
+      return value_;
+    }
+
+    float getValue() const noexcept { return value_; }
+    float getTarget() const noexcept { return target_; }
+    bool isActive() const noexcept { return remaining_ > 0; }
+
+  private:
+    float value_ = 0.0f;
+    float target_ = 0.0f;
+    float step_ = 0.0f;
+    int remaining_ = 0;
+  };
+
+  //------------------------------------------------------------------------------
+  // ControlRateDivider - block boundaries for control-rate evaluation
+  //------------------------------------------------------------------------------
+
+  class ControlRateDivider
+  {
+  public:
+    static constexpr int kMaxDivision = 256;
+    static constexpr int kDefaultDivision = 16;
+
+    ControlRateDivider() noexcept = default;
+
+    // Set the block length in samples (1 = every sample). Clamped to [1, kMaxDivision].
+    // Safe to call from the UI thread; takes effect at the next block boundary.
+    void setDivision(int division) noexcept
+    {
+      division_.store(std::max(1, std::min(division, kMaxDivision)), std::memory_order_relaxed);
+    }
+
+    int getDivision() const noexcept
+    {
+      return division_.load(std::memory_order_relaxed);
+    }
+
+    // Force the next tick() to start a new block
+    void reset() noexcept
+    {
+      counter_ = 0;
+    }
+
+    // Call once per sample. Returns true on the first sample of each block
+    // (including the very first call after construction or reset()).
+    bool tick() noexcept
+    {
+      const bool blockStart = (counter_ == 0);
+      if (blockStart)
+        blockSize_ = getDivision();
+      if (++counter_ >= blockSize_)
+        counter_ = 0;
+      return blockStart;
+    }
+
+    // Length of the current block, latched when it started (1..kMaxDivision)
+    int getBlockSize() const noexcept { return blockSize_; }
+
+  private:
+    std::atomic<int> division_{kDefaultDivision};
+    int blockSize_ = kDefaultDivision;
+    int counter_ = 0;
+  };
+
+  //------------------------------------------------------------------------------
+  // ControlRateStartup - first division of a module instance
+  //------------------------------------------------------------------------------
+  //
+  // Hosts restore a patch into a new instance before adding it, and may skip
+  // the saved-data callback entirely when the patch has no module data (as
+  // patches from before control-rate blocks often do). So the divider starts
+  // at every sample, restoring() marks an instance that comes from a patch,
+  // and added() moves only the others to kDefaultDivision.
+
+  class ControlRateStartup
+  {
+  public:
+    static constexpr int kLegacyDivision = 1;
+
+    explicit ControlRateStartup(ControlRateDivider &divider) noexcept
+        : divider_(divider)
+    {
+      divider_.setDivision(kLegacyDivision);
+    }
+
+    // The instance is being restored from a patch; call before its saved
+    // data (if any) is applied
+    void restoring() noexcept { restoring_ = true; }
+
+    // The host has added the instance: fresh ones get the default division,
+    // restored ones keep what their patch set (or kLegacyDivision)
+    void added() noexcept
+    {
+      if (!restoring_)
+        divider_.setDivision(ControlRateDivider::kDefaultDivision);
+    }
+
+  private:
+    ControlRateDivider &divider_;
+    bool restoring_ = false;
+  };
+
+} // namespace ShortwavDSP
@@ -0,0 +1,304 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <utility>
+
+#include "simd.h"
+
+/*
+ * Polyphase halfband decimators (and interpolators) for internal oversampling
+ *
+ *  - HalfbandDecimator: one 2:1 stage. A linear-phase halfband FIR has every
+ *    other tap equal to zero, so the polyphase form costs kSideTaps
+ *    multiply-adds per output sample (one branch is a pure delay).
+ *  - Decimator: cascade of up to three halfband stages for 2x/4x/8x.
+ *  - HalfbandInterpolator / Interpolator: the matching 1:2 stage and cascade,
+ *    for processors that also need their input at the oversampled rate
+ *    (filters, waveshapers). Same cost per input sample, same response.
+ *
+ * All are templates on the lane type (float, or simd::float4 to process
+ * four voices at once); the unprefixed names are the float versions.
+ *
+ * Coefficients are a Blackman-windowed sinc designed once at construction.
+ * With kSideTaps = 10 (39 taps) each stage is flat to 0.45 fs(out) (-1.3 dB),
+ * about -40 dB at 0.6 fs(out) and below -75 dB from 0.7 fs(out) upward, so the
+ * residual aliases land in the top of the audio band. Each stage adds
+ * (kLength - 1) / 4 output samples of latency (9.5), negligible for an oscillator.
+ * An interpolator stage adds kSideTaps input samples (10).
+ *
+ * Usage:
+ *  Decimator dec;
+ *  dec.setFactor(4);
+ *  float in[4] = {...};          // 4 samples rendered at 4x rate
+ *  float out = dec.process(in);  // 1 sample at the base rate
+ *
+ *  Interpolator up;
+ *  up.setFactor(4);
+ *  up.process(x, in);            // 4 samples at 4x rate from 1 input sample
+ *
+ * Real-time safe: no allocations, no locks.
+ */
+
+namespace ShortwavDSP
+{
+
+  namespace detail
+  {
+    // Side taps of a (4 * sideTaps - 1)-tap Blackman-windowed halfband FIR,
+    // nearest to the centre first, scaled so that centre (0.5) + 2 * sum = 1.
+    inline void designHalfband(float *coeffs, int sideTaps) noexcept
+    {
+      const int length = 4 * sideTaps - 1;
+      const double pi = 3.14159265358979323846;
+      const double span = static_cast<double>(length + 1);
+      double sum = 0.0;
+      for (int k = 0; k < sideTaps; ++k)
+      {
+        const double n = static_cast<double>(2 * k + 1);
+        const double x = 0.5 * pi * n;
+        const double sinc = std::sin(x) / x;
+        const double m = n + static_cast<double>(length / 2) + 1.0; // Window index in (0, span)
+        const double window = 0.42 - 0.5 * std::cos(2.0 * pi * m / span) + 0.08 * std::cos(4.0 * pi * m / span);
+        coeffs[k] = static_cast<float>(0.5 * sinc * window);
+        sum += coeffs[k];
+      }
+
+      // Unity DC gain: centre tap (0.5) plus both sides must sum to 1
+      const float scale = static_cast<float>(0.25 / sum);
+      for (int k = 0; k < sideTaps; ++k)
+        coeffs[k] *= scale;
+    }
+  } // namespace detail
+
+  //------------------------------------------------------------------------------
+  // HalfbandDecimator - 2:1 polyphase halfband FIR
+  //------------------------------------------------------------------------------
+
+  template <typename T>
+  class BasicHalfbandDecimator
+  {
+  public:
+    static constexpr int kSideTaps = 10;                // Non-zero taps on each side of the centre
+    static constexpr int kLength = 4 * kSideTaps - 1;  // Full FIR length (odd)
+
+    BasicHalfbandDecimator() noexcept
+    {
+      design();
+      reset();
+    }
+
+    void reset() noexcept
+    {
+      for (int i = 0; i < 2 * kLength; ++i)
+        history_[i] = T(0.0f);
+      pos_ = 0;
+    }
+
+    // Consume two input samples (x0 first) and return one output sample.
+    T process(T x0, T x1) noexcept
+    {
+      push(x0);
+      push(x1);
+
+      // Window of the newest kLength inputs, oldest first
+      const T *w = history_ + pos_;
+      constexpr int c = kLength / 2;
+      T acc = T(0.5f) * w[c];
+      for (int k = 0; k < kSideTaps; ++k)
+      {
+        const int offset = 2 * k + 1;
+        acc += T(coeffs_[k]) * (w[c - offset] + w[c + offset]);
+      }
+      return acc;
+    }
+
+  private:
+    float coeffs_[kSideTaps];
+    T history_[2 * kLength]; // Each sample stored twice so the window never wraps
+    int pos_ = 0;
+
+    void push(T x) noexcept
+    {
+      history_[pos_] = x;
+      history_[pos_ + kLength] = x;
+      if (++pos_ == kLength)
+        pos_ = 0;
+    }
+
+    void design() noexcept
+    {
+      detail::designHalfband(coeffs_, kSideTaps);
+    }
+  };
+
+  using HalfbandDecimator = BasicHalfbandDecimator<float>;
+
+  //------------------------------------------------------------------------------
+  // Decimator - 1x/2x/4x/8x cascade
+  //------------------------------------------------------------------------------
+
+  template <typename T>
+  class BasicDecimator
+  {
+  public:
+    static constexpr int kMaxFactor = 8;
+
+    BasicDecimator() noexcept = default;
+
+    // Set the oversampling factor (1, 2, 4 or 8; other values round down to
+    // the nearest supported one). Resets the filter state on change.
+    void setFactor(int factor) noexcept
+    {
+      int stages = 0;
+      while (stages < 3 && (2 << stages) <= factor)
+        ++stages;
+      if (stages != numStages_)
+      {
+        numStages_ = stages;
+        reset();
+      }
+    }
+
+    int getFactor() const noexcept { return 1 << numStages_; }
+
+    void reset() noexcept
+    {
+      for (BasicHalfbandDecimator<T> &stage : stages_)
+        stage.reset();
+    }
+
+    // Reduce getFactor() consecutive input samples to one output sample.
+    // The input buffer is used as scratch space.
+    T process(T *in) noexcept
+    {
+      int n = getFactor();
+      for (int s = 0; s < numStages_; ++s)
+      {
+        n /= 2;
+        for (int i = 0; i < n; ++i)
+          in[i] = stages_[s].process(in[2 * i], in[2 * i + 1]);
+      }
+      return in[0];
+    }
+
+  private:
+    BasicHalfbandDecimator<T> stages_[3];
+    int numStages_ = 0;
+  };
+
+  using Decimator = BasicDecimator<float>;
+
+  //------------------------------------------------------------------------------
+  // HalfbandInterpolator - 1:2 polyphase halfband FIR
+  //------------------------------------------------------------------------------
+
+  template <typename T>
+  class BasicHalfbandInterpolator
+  {
+  public:
+    static constexpr int kSideTaps = BasicHalfbandDecimator<T>::kSideTaps;
+
+    BasicHalfbandInterpolator() noexcept
+    {
+      detail::designHalfband(coeffs_, kSideTaps);
+      reset();
+    }
+
+    void reset() noexcept
+    {
+      for (int i = 0; i < 4 * kSideTaps; ++i)
+        history_[i] = T(0.0f);
+      pos_ = 0;
+    }
+
+    // Consume one input sample and write two output samples (y0 first).
+    void process(T x, T &y0, T &y1) noexcept
+    {
+      history_[pos_] = x;
+      history_[pos_ + 2 * kSideTaps] = x;
+      if (++pos_ == 2 * kSideTaps)
+        pos_ = 0;
+
+      // Window of the newest 2 * kSideTaps inputs, oldest first. The even
+      // output phase is the centre tap alone (a pure delay); the odd phase
+      // sits halfway between the two middle inputs. Zero-stuffing halves the
+      // signal, hence the factor 2 on the side taps.
+      const T *w = history_ + pos_;
+      T acc = T(coeffs_[0]) * (w[kSideTaps - 1] + w[kSideTaps]);
+      for (int k = 1; k < kSideTaps; ++k)
+        acc += T(coeffs_[k]) * (w[kSideTaps - 1 - k] + w[kSideTaps + k]);
+      y0 = w[kSideTaps - 1];
+      y1 = T(2.0f) * acc;
+    }
+
+  private:
+    float coeffs_[kSideTaps];
+    T history_[4 * kSideTaps]; // Each sample stored twice so the window never wraps
+    int pos_ = 0;
+  };
+
+  using HalfbandInterpolator = BasicHalfbandInterpolator<float>;
+
+  //------------------------------------------------------------------------------
+  // Interpolator - 1x/2x/4x/8x cascade
+  //------------------------------------------------------------------------------
+
+  template <typename T>
+  class BasicInterpolator
+  {
+  public:
+    static constexpr int kMaxFactor = 8;
+
+    BasicInterpolator() noexcept = default;
+
+    // Set the oversampling factor (1, 2, 4 or 8; other values round down to
+    // the nearest supported one). Resets the filter state on change.
+    void setFactor(int factor) noexcept
+    {
+      int stages = 0;
+      while (stages < 3 && (2 << stages) <= factor)
+        ++stages;
+      if (stages != numStages_)
+      {
+        numStages_ = stages;
+        reset();
+      }
+    }
+
+    int getFactor() const noexcept { return 1 << numStages_; }
+
+    void reset() noexcept
+    {
+      for (BasicHalfbandInterpolator<T> &stage : stages_)
+        stage.reset();
+    }
+
+    // Expand one input sample into getFactor() output samples (oldest first).
+    void process(T x, T *out) noexcept
+    {
+      T scratch[kMaxFactor];
+      T *src = scratch;
+      T *dst = out;
+      // Ping-pong between out and scratch so the last stage lands in out
+      if (numStages_ % 2 == 0)
+        std::swap(src, dst);
+      src[0] = x;
+      int n = 1;
+      for (int s = 0; s < numStages_; ++s)
+      {
+        for (int i = 0; i < n; ++i)
+          stages_[s].process(src[i], dst[2 * i], dst[2 * i + 1]);
+        n *= 2;
+        std::swap(src, dst);
+      }
+    }
+
+  private:
+    BasicHalfbandInterpolator<T> stages_[3];
+    int numStages_ = 0;
+  };
+
+  using Interpolator = BasicInterpolator<float>;
+
+} // namespace ShortwavDSP
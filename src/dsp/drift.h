@@ -1,6 +1,13 @@
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "fast-math.h"
+#include "simd.h"
+#include "instrumentation.h"
 
 /*
  * Drift Generator
@@ -27,6 +34,10 @@
  *      * setRateHz()     : characteristic drift rate / time constant
  *      * reset()
  *      * next()          : per-sample drift value
+ *      * processBuffer() : block of consecutive drift values
+ *      * setDecimation() : optional control-rate mode (see below)
+ * - DriftGeneratorBank: up to 16 independent generators with shared settings,
+ *   advanced four at a time on simd::float4 (see below).
  * - Numerically robust:
  *      * Avoid denormals via tiny noise injection and clamping.
  *      * Stable coefficient mapping for typical audio rates.
@@ -53,6 +64,14 @@
  *        as semitones, cents, or as a dimensionless modulation amount
  *        elsewhere in the signal chain.
  *
+ * Decimated mode:
+ * - setDecimation(K) advances the filter state once every K samples (with
+ *   coefficients derived for sampleRate / K, so the drift character is
+ *   unchanged) and linearly interpolates between consecutive control points.
+ *   The output stays continuous and deterministic for a given seed, lags by
+ *   one control period and costs about one add per sample in between. It is
+ *   a different (equally valid) sequence than K = 1, the default.
+ *
  * Threading:
  * - Setters are plain stores and may be called from a control thread
  *   between blocks. For fully sample-accurate automation, wrap this
@@ -62,10 +81,17 @@
 namespace ShortwavDSP
 {
 
+  class DriftGeneratorBank;
+
   class DriftGenerator
   {
+    friend class DriftGeneratorBank; // Shares the coefficient derivation
+
   public:
-    DriftGenerator() = default;
+    DriftGenerator() noexcept
+    {
+      updateCoeffs();
+    }
 
     // Initialize or update the sample rate.
     // Must be called before next() is used in production code.
@@ -89,14 +115,42 @@ namespace ShortwavDSP
     // Interpreted as an approximate lowpass corner / "how quickly can the drift
     // move". Very small values yield extremely slow drift. Values are clamped
     // to a safe minimum to avoid numerical issues.
+    // Returns early when the rate is unchanged, so it can be called every
+    // control block at no cost.
     inline void setRateHz(float rateHz) noexcept
     {
       if (rateHz <= 0.0f)
         rateHz = kMinRateHz;
+      if (rateHz == rateHz_)
+        return;
       rateHz_ = rateHz;
       updateCoeffs();
     }
 
+    static constexpr int kMaxDecimation = 256;
+
+    // Advance the state every `factor` samples and interpolate in between
+    // (1 = every sample, the default; clamped to 1..kMaxDecimation).
+    // Continues from the current output without a jump.
+    inline void setDecimation(int factor) noexcept
+    {
+      factor = (factor < 1) ? 1 : (factor > kMaxDecimation ? kMaxDecimation : factor);
+      if (factor == decimation_)
+        return;
+      decimation_ = factor;
+      countdown_ = 0;
+      updateCoeffs();
+    }
+
+    inline int getDecimation() const noexcept
+    {
+      return decimation_;
+    }
+
+    // Load counters (empty unless built with SHORTWAV_DSP_INSTRUMENTATION)
+    inline const DspStats &getStats() const noexcept { return stats_; }
+    inline DspStats &getStats() noexcept { return stats_; }
+
     // Reset internal state to a deterministic baseline.
     // initialDrift is the starting output drift before depth scaling.
     inline void reset(float initialDrift = 0.0f) noexcept
@@ -107,6 +161,9 @@ namespace ShortwavDSP
       // Keep rngState_ as-is to preserve reproducibility across resets
       // if the caller manages it externally.
       denormPhase_ = 0u;
+      value_ = initialDrift * depth_;
+      increment_ = 0.0f;
+      countdown_ = 0;
     }
 
     // Optionally seed the internal RNG for deterministic behavior across runs.
@@ -121,6 +178,37 @@ namespace ShortwavDSP
     //
     // Real-time safe: no allocations, no branches with locks, constant-time.
     inline float next() noexcept
+    {
+      DspStats::Timer timer(stats_, 1);
+      if (decimation_ == 1)
+      {
+        value_ = advance();
+        return value_;
+      }
+
+      // Decimated: ramp from the last output to the next control point
+      if (countdown_ == 0)
+      {
+        increment_ = (advance() - value_) * (1.0f / static_cast<float>(decimation_));
+        countdown_ = decimation_;
+      }
+      --countdown_;
+      value_ += increment_;
+      return value_;
+    }
+
+    // Generate numSamples consecutive drift samples into output.
+    // Equivalent to calling next() numSamples times.
+    inline void processBuffer(float *output, size_t numSamples) noexcept
+    {
+      for (size_t i = 0; i < numSamples; ++i)
+        output[i] = next();
+    }
+
+  private:
+    // One step of the drift process (one sample, or one control point in
+    // decimated mode).
+    inline float advance() noexcept
     {
       // Fail-safe: if sampleRate_ wasn't set, use defaults.
       if (sampleRate_ <= 0.0f)
@@ -151,6 +239,7 @@ namespace ShortwavDSP
       // Denormal guard:
       // Inject very small toggling DC when amplitude is extremely low to keep
       // subnormals from accumulating on some platforms.
+      stats_.countDenormalFlushes(out, kDenormThreshold);
       if (std::fabs(out) < kDenormThreshold)
       {
         // Simple deterministic +/- epsilon pattern; no branching on RNG.
@@ -168,7 +257,6 @@ namespace ShortwavDSP
       return out;
     }
 
-  private:
     //-------------------------------------------------------------------------
     // Internal configuration
     //-------------------------------------------------------------------------
@@ -204,6 +292,15 @@ namespace ShortwavDSP
     // Small state for denorm guard toggling.
     unsigned int denormPhase_ = 0u;
 
+    // Decimated mode: last output, per-sample ramp and samples left until
+    // the next control point.
+    int decimation_ = 1;
+    int countdown_ = 0;
+    float value_ = 0.0f;
+    float increment_ = 0.0f;
+
+    DspStats stats_;
+
     //-------------------------------------------------------------------------
     // Helpers
     //-------------------------------------------------------------------------
@@ -225,9 +322,9 @@ namespace ShortwavDSP
       // so that rateHz approximates the -3 dB frequency of the underlying
       // first-order lowpass. Cascading two identical one-poles then yields
       // a gentle, 2-pole low-frequency rolloff which fits the drift behavior.
-      const float dt = 1.0f / sampleRate_;
+      const float dt = static_cast<float>(decimation_) / sampleRate_;
       const float omega = 2.0f * 3.14159265359f * r;
-      const float pole = std::exp(-omega * dt);
+      const float pole = detail::fastExp(-omega * dt);
 
       a1_ = pole;
 
@@ -239,18 +336,28 @@ namespace ShortwavDSP
       //
       // We invert this approximately so that sigma of x2_ is O(1) for nominal
       // parameters, then let the public 'depth' control handle actual range.
-      const float oneMinusPole = 1.0f - pole;
+      // In decimated mode the level is set from the per-sample pole, then the
+      // excitation is rescaled for the longer step: the variance of x2_ goes
+      // as sigma_e^2 / (1 - pole)^3, so this keeps the same drift level.
+      const float samplePole = (decimation_ == 1) ? pole : detail::fastExp(-omega / sampleRate_);
+      const float oneMinusPole = 1.0f - samplePole;
       const float targetSigma = 0.5f; // arbitrary but musical pre-depth wander
       if (oneMinusPole > 0.0f)
       {
         const float sigma_e = targetSigma * oneMinusPole * oneMinusPole;
         // White source in [-1,1] has variance 1/3; include that in scale.
         excitationScale_ = sigma_e * std::sqrt(3.0f);
+        if (decimation_ > 1)
+        {
+          const float ratio = (1.0f - pole) / oneMinusPole;
+          excitationScale_ *= ratio * std::sqrt(ratio);
+        }
       }
       else
       {
         excitationScale_ = 0.0f;
       }
+      stats_.countCoefficientUpdates();
     }
 
     // Deterministic, cheap RNG in [-1, 1].
@@ -264,4 +371,225 @@ namespace ShortwavDSP
     }
   };
 
-} // namespace ShortwavDSP
\ No newline at end of file
+  //------------------------------------------------------------------------------
+  // DriftGeneratorBank - up to 16 generators, four per SIMD register
+  //------------------------------------------------------------------------------
+  //
+  // One DriftGenerator per channel, each with its own seed and state, sharing
+  // rate, depth and decimation. The coefficients are derived once per
+  // parameter change (not per channel) and the filter cascade, LCG and
+  // denormal guard run on simd::float4 / simd::uint4. A channel seeded like a
+  // DriftGenerator produces the same output sample for sample.
+  //
+  // Usage:
+  //  bank.setSampleRate(sr);
+  //  bank.seed(baseSeed);               // channel c: channelSeed(baseSeed, c)
+  //  bank.setRateHz(rate);              // cheap when unchanged
+  //  bank.setDepth(depth);
+  //  bank.processFrame(out, channels);  // once per sample
+
+  class DriftGeneratorBank
+  {
+  public:
+    static constexpr int kMaxChannels = 16;
+    static constexpr int kGroups = kMaxChannels / simd::float4::size;
+    static constexpr int kMaxDecimation = DriftGenerator::kMaxDecimation;
+
+    DriftGeneratorBank() noexcept
+    {
+      seed(0x1234567u);
+      reset();
+    }
+
+    inline void setSampleRate(float sampleRate) noexcept
+    {
+      coeffs_.setSampleRate(sampleRate);
+    }
+
+    // Shared drift rate in Hz (same mapping as DriftGenerator::setRateHz).
+    // Coefficients are only recomputed when the value changes.
+    inline void setRateHz(float rateHz) noexcept
+    {
+      coeffs_.setRateHz(rateHz);
+    }
+
+    // Shared output depth.
+    inline void setDepth(float depth) noexcept
+    {
+      coeffs_.setDepth(depth);
+    }
+
+    // Shared decimation (see DriftGenerator::setDecimation). All channels
+    // reach their control points together.
+    inline void setDecimation(int factor) noexcept
+    {
+      const int before = coeffs_.getDecimation();
+      coeffs_.setDecimation(factor);
+      if (coeffs_.getDecimation() != before)
+        countdown_ = 0;
+    }
+
+    inline int getDecimation() const noexcept
+    {
+      return coeffs_.getDecimation();
+    }
+
+    // Load counters, kept in the shared coefficient holder (which counts the
+    // coefficient updates)
+    inline const DspStats &getStats() const noexcept { return coeffs_.stats_; }
+    inline DspStats &getStats() noexcept { return coeffs_.stats_; }
+
+    // Reset every channel's state (as DriftGenerator::reset). Seeds are kept.
+    inline void reset(float initialDrift = 0.0f) noexcept
+    {
+      const simd::float4 x(initialDrift);
+      const simd::float4 value(initialDrift * coeffs_.depth_);
+      for (int g = 0; g < kGroups; ++g)
+      {
+        x1_[g] = x;
+        x2_[g] = x;
+        value_[g] = value;
+        increment_[g] = simd::float4(0.0f);
+        denorm_[g] = simd::float4(-DriftGenerator::kDenormNoise);
+      }
+      countdown_ = 0;
+    }
+
+    // Seed channel c with channelSeed(baseSeed, c) (channel 0 gets baseSeed).
+    inline void seed(uint32_t baseSeed) noexcept
+    {
+      for (int c = 0; c < kMaxChannels; ++c)
+        seeds_[c] = generatorSeed(channelSeed(baseSeed, c));
+      loadSeeds();
+    }
+
+    // Seed one channel exactly as DriftGenerator::seed would.
+    inline void seedChannel(int channel, uint32_t seedValue) noexcept
+    {
+      if (channel < 0 || channel >= kMaxChannels)
+        return;
+      // Keep the other lanes' generators where they are
+      for (int g = 0; g < kGroups; ++g)
+        rng_[g].store(seeds_ + g * simd::float4::size);
+      seeds_[channel] = generatorSeed(seedValue);
+      loadSeeds();
+    }
+
+    // Distinct, well-spread seeds per channel (golden-ratio increments, as
+    // RandomLFOBank).
+    static inline uint32_t channelSeed(uint32_t baseSeed, int channel) noexcept
+    {
+      return baseSeed + static_cast<uint32_t>(channel) * 0x9E3779B9u;
+    }
+
+    // Generate the next drift sample of channels [0, numChannels) into out.
+    // Channels at or above numChannels do not advance, except for the unused
+    // lanes of the last active group.
+    inline void processFrame(float *out, int numChannels = kMaxChannels) noexcept
+    {
+      DspStats::Timer timer(coeffs_.stats_, 1);
+      numChannels = std::max(0, std::min(numChannels, kMaxChannels));
+      const int decimation = coeffs_.getDecimation();
+      const int groups = (numChannels + simd::float4::size - 1) / simd::float4::size;
+
+      if (decimation == 1)
+      {
+        for (int g = 0; g < groups; ++g)
+          value_[g] = advance(g);
+      }
+      else
+      {
+        // Decimated: ramp from the last output to the next control point
+        if (countdown_ == 0)
+        {
+          const simd::float4 scale(1.0f / static_cast<float>(decimation));
+          for (int g = 0; g < groups; ++g)
+            increment_[g] = (advance(g) - value_[g]) * scale;
+          countdown_ = decimation;
+        }
+        --countdown_;
+        for (int g = 0; g < groups; ++g)
+          value_[g] += increment_[g];
+      }
+
+      for (int g = 0; g < groups; ++g)
+      {
+        const int c = g * simd::float4::size;
+        value_[g].storePartial(out + c, numChannels - c);
+      }
+    }
+
+    // Render numSamples frames into planar buffers: output[c] receives
+    // numSamples samples of channel c.
+    inline void processBuffer(float *const *output, size_t numSamples, int numChannels = kMaxChannels) noexcept
+    {
+      numChannels = std::max(0, std::min(numChannels, kMaxChannels));
+      float frame[kMaxChannels];
+      for (size_t i = 0; i < numSamples; ++i)
+      {
+        processFrame(frame, numChannels);
+        for (int c = 0; c < numChannels; ++c)
+          output[c][i] = frame[c];
+      }
+    }
+
+  private:
+    // Holds the shared settings and derived coefficients (a1_, excitationScale_)
+    DriftGenerator coeffs_;
+    int countdown_ = 0;
+    uint32_t seeds_[kMaxChannels]; // Staging for rng_ (seed / seedChannel)
+
+    // State, four channels per register
+    simd::float4 x1_[kGroups];
+    simd::float4 x2_[kGroups];
+    simd::float4 value_[kGroups];
+    simd::float4 increment_[kGroups];
+    simd::float4 denorm_[kGroups]; // Next denormal guard offset (sign toggles)
+    simd::uint4 rng_[kGroups];
+
+    static inline uint32_t generatorSeed(uint32_t seedValue) noexcept
+    {
+      return (seedValue == 0u) ? 0x1234567u : seedValue;
+    }
+
+    inline void loadSeeds() noexcept
+    {
+      for (int g = 0; g < kGroups; ++g)
+        rng_[g] = simd::uint4::load(seeds_ + g * simd::float4::size);
+    }
+
+    // One DriftGenerator::advance() step for the four channels of group g
+    inline simd::float4 advance(int g) noexcept
+    {
+      using simd::float4;
+
+      // LCG and excitation, as nextRandomBipolar()
+      rng_[g] = rng_[g] * simd::uint4(1664525u) + simd::uint4(1013904223u);
+      const float4 unit = simd::toFloatSigned((rng_[g] >> 8) & simd::uint4(0x00FFFFFFu)) *
+                          float4(1.0f / static_cast<float>(0x01000000u));
+      const float4 excitation = (unit * float4(2.0f) - float4(1.0f)) * float4(coeffs_.excitationScale_);
+
+      // Two cascaded one-pole filters
+      const float4 pole(coeffs_.a1_);
+      x1_[g] = pole * x1_[g] + excitation;
+      x2_[g] = simd::clamp(pole * x2_[g] + x1_[g],
+                           float4(-DriftGenerator::kStateClamp), float4(DriftGenerator::kStateClamp));
+
+      float4 out = x2_[g] * float4(coeffs_.depth_);
+
+      // Denormal guard for lanes with |out| below the threshold
+      const float4 tiny = float4(DriftGenerator::kDenormThreshold) > simd::max(out, -out);
+      if (simd::movemask(tiny) != 0)
+      {
+        coeffs_.stats_.countDenormalFlushes(out, DriftGenerator::kDenormThreshold);
+        denorm_[g] = simd::ifelse(tiny, -denorm_[g], denorm_[g]);
+        const float4 d = simd::ifelse(tiny, denorm_[g], float4(0.0f));
+        x1_[g] += d;
+        x2_[g] += d;
+        out = simd::ifelse(tiny, float4(0.0f), out);
+      }
+      return out;
+    }
+  };
+
+} // namespace ShortwavDSP
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+/*
+ * Fast transcendental approximations for coefficient updates
+ *
+ * Polynomial replacements for the libm calls made when a parameter moves
+ * (cutoff -> 2 sin(pi f / fs), rate -> exp(-w dt), dB -> gain). Both are
+ * accurate to a few float ulps over the ranges coefficient code uses, so
+ * switching to them does not change a filter's response measurably, but they
+ * cost a handful of multiply-adds instead of a library call.
+ *
+ *  - fastSin(x):  range-reduced to [-pi/2, pi/2] first; absolute error
+ *                 below 2e-7 for |x| <= 2 pi (slowly growing beyond).
+ *  - fastExp2(x): relative error below 2e-7 for x in [-126, 127]; returns 0
+ *                 below and saturates above that range.
+ *  - fastExp(x):  fastExp2(x * log2(e)).
+ *
+ * Real-time safe: no allocations, no locks, no table lookups.
+ */
+
+namespace ShortwavDSP
+{
+
+  namespace detail
+  {
+    inline float fastSin(float x) noexcept
+    {
+      constexpr float kPi = 3.14159265358979323846f;
+      constexpr float kTwoPi = 2.0f * kPi;
+      constexpr float kHalfPi = 0.5f * kPi;
+
+      // Reduce to [-pi, pi], then fold onto [-pi/2, pi/2] where the odd
+      // Taylor polynomial below is accurate to float precision
+      x -= kTwoPi * std::floor(x * (1.0f / kTwoPi) + 0.5f);
+      if (x > kHalfPi)
+        x = kPi - x;
+      else if (x < -kHalfPi)
+        x = -kPi - x;
+
+      const float x2 = x * x;
+      float p = -2.50521084e-8f;       // -1/11!
+      p = p * x2 + 2.75573192e-6f;     // 1/9!
+      p = p * x2 - 1.98412698e-4f;     // -1/7!
+      p = p * x2 + 8.33333333e-3f;     // 1/5!
+      p = p * x2 - 1.66666667e-1f;     // -1/3!
+      return x + x * x2 * p;
+    }
+
+    inline float fastExp2(float x) noexcept
+    {
+      if (!(x >= -126.0f))
+        return 0.0f; // Also maps NaN to 0
+      if (x > 127.0f)
+        x = 127.0f;
+
+      // 2^x = 2^n * 2^f with n integer and f in [-0.5, 0.5]
+      const float n = std::floor(x + 0.5f);
+      const float f = x - n;
+
+      // Taylor series of e^(f ln 2), degree 6
+      const float t = f * 0.693147180559945f;
+      float p = 1.38888889e-3f;  // 1/6!
+      p = p * t + 8.33333333e-3f; // 1/5!
+      p = p * t + 4.16666667e-2f; // 1/4!
+      p = p * t + 1.66666667e-1f; // 1/3!
+      p = p * t + 0.5f;
+      p = p * t + 1.0f;
+      p = p * t + 1.0f;
+
+      // Scale by 2^n through the exponent bits
+      const uint32_t bits = static_cast<uint32_t>(static_cast<int32_t>(n) + 127) << 23;
+      float scale;
+      std::memcpy(&scale, &bits, sizeof(scale));
+      return p * scale;
+    }
+
+    inline float fastExp(float x) noexcept
+    {
+      return fastExp2(x * 1.44269504088896f);
+    }
+  } // namespace detail
+
+} // namespace ShortwavDSP
@@ -5,6 +5,11 @@
 #include <algorithm>
 #include <limits>
 
+#include "control-rate.h"
+#include "decimator.h"
+#include "instrumentation.h"
+#include "simd.h"
+
 /*
  * AM Formant Synthesis Oscillator
  *
@@ -37,11 +42,23 @@
  * - Call reset() to reset phase accumulators and internal state.
  * - Call processSample() each sample to get the next audio value.
  * - Call processBuffer() for block-based processing (more efficient for large blocks).
+ * - Call setOversampling(2/4/8) to render internally at a higher rate and
+ *   decimate with a polyphase halfband cascade (see decimator.h). This removes
+ *   most of the aliasing at high formant/carrier ratios without raising the
+ *   host sample rate.
+ *
+ * FormantOscillatorBank renders up to 16 independent voices with the same
+ * algorithm, four voices per SIMD register (see simd.h), sharing one table.
+ *
+ * Phases are 32-bit integer accumulators (2^32 = one carrier period), so
+ * wrapping is free and the double-carrier harmonics h0 * phase wrap exactly
+ * through integer multiplication instead of std::fmod.
  *
  * Threading:
  * - Setters are plain stores and safe to call from a control thread between blocks.
  * - For sample-accurate automation, interpolate parameters externally and call
- *   setters per-sample or per-small-block as needed.
+ *   setters per-sample or per-small-block as needed, or use setParameterRamp()
+ *   to have carrier/formant frequency changes ramped internally per sample.
  */
 
 namespace ShortwavDSP
@@ -55,10 +72,13 @@ namespace ShortwavDSP
     static constexpr int kTableSize = 256 + 1; // +1 so table wraps cleanly
     static constexpr int kMaxWidthIndex = 64;  // Number of different formant widths
 
+    // Upper bound for formant/carrier (keeps the harmonic index in uint32).
+    static constexpr float kMaxHarmonic = 1.0e6f;
+
     FormantOscillator()
     {
-      // Initialize formant table on construction (one-time cost).
-      initFormantTable();
+      // Shared table: built by the first instance, reused by all others.
+      formantTable_ = getFormantTable();
       setSampleRate(44100.0f);
       reset();
     }
@@ -75,23 +95,62 @@ namespace ShortwavDSP
     // Reset phase accumulators and DC blocker state.
     inline void reset() noexcept
     {
-      carrierPhase_ = 0.0f;
+      carrierPhase_ = 0;
       dcBlockerX1_ = 0.0f;
       dcBlockerY1_ = 0.0f;
+      decimator_.reset();
+    }
+
+    // Internal oversampling factor: 1 (off), 2, 4 or 8. Other values round
+    // down to the nearest supported factor. Cost scales with the factor.
+    inline void setOversampling(int factor) noexcept
+    {
+      decimator_.setFactor(factor);
+    }
+
+    inline int getOversampling() const noexcept
+    {
+      return decimator_.getFactor();
+    }
+
+    // Ramp carrier/formant frequency changes linearly over the next numSamples
+    // generated samples (0 = apply immediately, the default).
+    // Intended for control-rate callers that update parameters once per block.
+    inline void setParameterRamp(int numSamples) noexcept
+    {
+      rampSamples_ = std::max(0, numSamples);
     }
 
     // Set carrier (fundamental) frequency in Hz.
     // This is the base pitch of the oscillator.
     inline void setCarrierFreq(float freqHz) noexcept
     {
-      carrierFreqHz_ = std::max(freqHz, 0.0f);
+      carrierRamp_.setTarget(std::max(freqHz, 0.0f), rampSamples_);
+      if (carrierRamp_.isActive())
+        ramping_ = true;
+      else
+        carrierFreqHz_ = carrierRamp_.getValue();
     }
 
     // Set formant center frequency in Hz.
     // This determines the spectral resonance peak.
     inline void setFormantFreq(float freqHz) noexcept
     {
-      formantFreqHz_ = std::max(freqHz, 0.0f);
+      formantRamp_.setTarget(std::max(freqHz, 0.0f), rampSamples_);
+      if (formantRamp_.isActive())
+        ramping_ = true;
+      else
+        formantFreqHz_ = formantRamp_.getValue();
+    }
+
+    // Process-wide formant wavetable (kTableSize * kMaxWidthIndex floats,
+    // layout table[phase + width * kTableSize]). Built once on first use;
+    // initialisation is thread-safe and the table is never written again, so
+    // any number of instances or voices can read it concurrently.
+    static const float *getFormantTable() noexcept
+    {
+      static const FormantTable table;
+      return table.data;
     }
 
     // Set formant width/bandwidth parameter (0..1).
@@ -109,39 +168,64 @@ namespace ShortwavDSP
       outputGain_ = std::max(gain, 0.0f);
     }
 
+    // Load counters (empty unless built with SHORTWAV_DSP_INSTRUMENTATION).
+    // The per-sample phase/harmonic math is not cached, so no coefficient
+    // updates are counted.
+    inline const DspStats &getStats() const noexcept { return stats_; }
+    inline DspStats &getStats() noexcept { return stats_; }
+
     // Generate next audio sample.
     // This is real-time safe and intended for per-sample use in an audio callback.
     float processSample() noexcept
     {
+      DspStats::Timer timer(stats_, 1);
+
+      // Advance frequency ramps (only while a parameter change is in flight).
+      if (ramping_)
+      {
+        carrierFreqHz_ = carrierRamp_.next();
+        formantFreqHz_ = formantRamp_.next();
+        ramping_ = carrierRamp_.isActive() || formantRamp_.isActive();
+      }
+
       if (sampleRate_ <= 0.0f || carrierFreqHz_ <= 0.0f)
       {
         return 0.0f;
       }
 
-      // Advance carrier phase [-1, 1] normalized.
-      const float phaseIncrement = 2.0f * carrierFreqHz_ / sampleRate_;
-      carrierPhase_ += phaseIncrement;
-
-      // Wrap phase to [-1, 1].
-      while (carrierPhase_ >= 1.0f)
-        carrierPhase_ -= 2.0f;
-      while (carrierPhase_ < -1.0f)
-        carrierPhase_ += 2.0f;
+      // Per-sample constants, shared by all oversampled sub-steps.
+      const int factor = decimator_.getFactor();
+      const uint32_t phaseIncrement = phaseIncrementFor(carrierFreqHz_ / (sampleRate_ * static_cast<float>(factor)));
 
       // Compute formant width index for table lookup.
       // Width parameter (0..1) maps to [0, kMaxWidthIndex-1].
       const float widthIndexFloat = formantWidth_ * static_cast<float>(kMaxWidthIndex - 1);
+      float widthFrac;
+      const float *formantRow = selectFormantRows(widthIndexFloat, widthFrac);
 
       // Compute harmonic ratio for double-carrier pitch shifting.
       // formantFreqHz / carrierFreqHz gives the harmonic number.
       const float harmonicRatio = (carrierFreqHz_ > 0.001f) ? (formantFreqHz_ / carrierFreqHz_) : 1.0f;
+      const float h0 = std::floor(std::min(harmonicRatio, kMaxHarmonic));
+      const float hFrac = std::min(harmonicRatio, kMaxHarmonic) - h0;
+      const uint32_t harmonic = static_cast<uint32_t>(h0);
 
-      // Lookup formant waveform and apply double-carrier modulation.
-      const float formantValue = lookupFormant(carrierPhase_, widthIndexFloat);
-      const float carrierValue = doubleCarrier(harmonicRatio, carrierPhase_);
-
-      // Amplitude modulation: formant * carrier.
-      float output = formantValue * carrierValue;
+      float output;
+      if (factor == 1)
+      {
+        carrierPhase_ += phaseIncrement;
+        output = renderPhase(carrierPhase_, formantRow, widthFrac, harmonic, hFrac);
+      }
+      else
+      {
+        float oversampled[Decimator::kMaxFactor];
+        for (int i = 0; i < factor; ++i)
+        {
+          carrierPhase_ += phaseIncrement;
+          oversampled[i] = renderPhase(carrierPhase_, formantRow, widthFrac, harmonic, hFrac);
+        }
+        output = decimator_.process(oversampled);
+      }
 
       // The formant function can produce values with substantial DC and amplitude,
       // so normalize to a reasonable range before applying gain.
@@ -156,6 +240,7 @@ namespace ShortwavDSP
       output = dcBlocker(output);
 
       // Denormal guard.
+      stats_.countDenormalFlushes(output, 1e-30f);
       if (std::fabs(output) < 1e-30f)
         output = 0.0f;
 
@@ -185,15 +270,28 @@ namespace ShortwavDSP
     float formantWidth_ = 0.3f;     // Medium Q
     float outputGain_ = 1.0f;
 
-    float carrierPhase_ = 0.0f; // Normalized to [-1, 1]
+    // Per-sample smoothing of frequency changes (see setParameterRamp()).
+    LinearRamp carrierRamp_{110.0f};
+    LinearRamp formantRamp_{800.0f};
+    int rampSamples_ = 0;
+    bool ramping_ = false;
+
+    // Carrier phase: the full uint32 range is one period; read as int32 it
+    // maps to the normalized phase [-1, 1).
+    uint32_t carrierPhase_ = 0;
+
+    // Polyphase decimator for internal oversampling (factor 1 = bypass).
+    Decimator decimator_;
 
     // DC blocker state (first-order highpass).
     float dcBlockerX1_ = 0.0f;
     float dcBlockerY1_ = 0.0f;
 
-    // Formant wavetable [phase_index][width_index].
-    // Stored as flat array: table[phase + width * kTableSize].
-    float formantTable_[kTableSize * kMaxWidthIndex];
+    // Formant wavetable [phase_index][width_index], shared by all instances
+    // (see getFormantTable()). Flat layout: table[phase + width * kTableSize].
+    const float *formantTable_ = nullptr;
+
+    DspStats stats_;
 
     // Clamp to [0, 1].
     static inline float clamp01(float x) noexcept
@@ -254,28 +352,58 @@ namespace ShortwavDSP
       return a;
     }
 
-    // Initialize the formant wavetable.
-    // Called once in the constructor.
-    void initFormantTable() noexcept
+    // Read-only formant wavetable, cache-line aligned.
+    struct FormantTable
     {
-      const float phaseCoef = 2.0f / static_cast<float>(kTableSize - 1);
+      alignas(64) float data[kTableSize * kMaxWidthIndex];
 
-      for (int widthIdx = 0; widthIdx < kMaxWidthIndex; ++widthIdx)
+      FormantTable() noexcept
       {
-        for (int phaseIdx = 0; phaseIdx < kTableSize; ++phaseIdx)
+        const float phaseCoef = 2.0f / static_cast<float>(kTableSize - 1);
+
+        for (int widthIdx = 0; widthIdx < kMaxWidthIndex; ++widthIdx)
         {
-          const float phase = -1.0f + static_cast<float>(phaseIdx) * phaseCoef;
-          const float widthValue = static_cast<float>(widthIdx);
-          const int tableIndex = phaseIdx + widthIdx * kTableSize;
-          formantTable_[tableIndex] = formantFunction(phase, widthValue);
+          for (int phaseIdx = 0; phaseIdx < kTableSize; ++phaseIdx)
+          {
+            const float phase = -1.0f + static_cast<float>(phaseIdx) * phaseCoef;
+            const float widthValue = static_cast<float>(widthIdx);
+            const int tableIndex = phaseIdx + widthIdx * kTableSize;
+            data[tableIndex] = formantFunction(phase, widthValue);
+          }
         }
       }
+    };
+
+    // Phase increment for a frequency given in cycles per (oversampled) sample.
+    // Converted through 64 bits so that rates above 1 still wrap correctly.
+    static inline uint32_t phaseIncrementFor(float cyclesPerSample) noexcept
+    {
+      const double inc = static_cast<double>(cyclesPerSample) * 4294967296.0;
+      return static_cast<uint32_t>(static_cast<uint64_t>(std::min(inc, 9.0e18)));
     }
 
-    // Lookup formant waveform with bilinear interpolation.
-    // phase: normalized phase in [-1, 1]
+    // Integer phase to normalized phase in [-1, 1).
+    static inline float phaseToFloat(uint32_t phase) noexcept
+    {
+      return static_cast<float>(static_cast<int32_t>(phase)) * (1.0f / 2147483648.0f);
+    }
+
+    // One formant * carrier product at the given carrier phase.
+    float renderPhase(uint32_t phase, const float *formantRow, float widthFrac, uint32_t harmonic,
+                      float hFrac) const noexcept
+    {
+      // Lookup formant waveform and apply double-carrier modulation.
+      const float formantValue = lookupFormant(phase, formantRow, widthFrac);
+      const float carrierValue = doubleCarrier(harmonic, hFrac, phase);
+
+      // Amplitude modulation: formant * carrier.
+      return formantValue * carrierValue;
+    }
+
+    // Select the pair of table rows bracketing a width index.
     // widthIndexFloat: formant width index as float (0..kMaxWidthIndex-1)
-    float lookupFormant(float phase, float widthIndexFloat) const noexcept
+    // Returns the lower row; the upper row follows it at +kTableSize.
+    const float *selectFormantRows(float widthIndexFloat, float &widthFrac) const noexcept
     {
       // Clamp width index to valid range.
       if (widthIndexFloat < 0.0f)
@@ -283,45 +411,45 @@ namespace ShortwavDSP
       if (widthIndexFloat > static_cast<float>(kMaxWidthIndex - 2))
         widthIndexFloat = static_cast<float>(kMaxWidthIndex - 2);
 
-      // Normalize phase to [0, kTableSize-1].
-      const float phaseNorm = (phase + 1.0f) * 0.5f * static_cast<float>(kTableSize - 1);
-      const int phaseIdx = static_cast<int>(phaseNorm);
-      const float phaseFrac = phaseNorm - static_cast<float>(phaseIdx);
-
       // Integer and fractional parts of width.
       const int widthIdx = static_cast<int>(widthIndexFloat);
-      const float widthFrac = widthIndexFloat - static_cast<float>(widthIdx);
+      widthFrac = widthIndexFloat - static_cast<float>(widthIdx);
+      return formantTable_ + widthIdx * kTableSize;
+    }
+
+    // Lookup formant waveform with bilinear interpolation.
+    // phase: integer carrier phase (see carrierPhase_)
+    // row/widthFrac: from selectFormantRows()
+    float lookupFormant(uint32_t phase, const float *row, float widthFrac) const noexcept
+    {
+      // Offset so phase -1 maps to table index 0; the top 8 bits select one
+      // of the kTableSize - 1 intervals, the low 24 bits interpolate.
+      static_assert(kTableSize - 1 == 256, "phase indexing assumes a 256-interval table");
+      const uint32_t tablePhase = phase + 0x80000000u;
+      const int phaseIdx = static_cast<int>(tablePhase >> 24);
+      const float phaseFrac = static_cast<float>(tablePhase & 0x00FFFFFFu) * (1.0f / 16777216.0f);
 
       // Four corners for bilinear interpolation.
-      const int i00 = phaseIdx + widthIdx * kTableSize;
-      const int i10 = i00 + kTableSize;
+      const float *r0 = row + phaseIdx;
+      const float *r1 = r0 + kTableSize;
 
       // Bilinear interpolation.
-      const float v00 = formantTable_[i00];
-      const float v01 = formantTable_[i00 + 1];
-      const float v10 = formantTable_[i10];
-      const float v11 = formantTable_[i10 + 1];
-
-      const float v0 = v00 + phaseFrac * (v01 - v00);
-      const float v1 = v10 + phaseFrac * (v11 - v10);
+      const float v0 = r0[0] + phaseFrac * (r0[1] - r0[0]);
+      const float v1 = r1[0] + phaseFrac * (r1[1] - r1[0]);
 
       return v0 + widthFrac * (v1 - v0);
     }
 
     // Double carrier with crossfading to preserve harmonicity.
     // Implements the "cosine-phased carriers" trick to avoid phase interference.
-    // harmonicRatio: formantFreqHz / carrierFreqHz
-    // phase: carrier phase in [-1, 1]
-    float doubleCarrier(float harmonicRatio, float phase) const noexcept
+    // harmonic/hFrac: integer and fractional parts of formantFreqHz / carrierFreqHz
+    // phase: integer carrier phase
+    float doubleCarrier(uint32_t harmonic, float hFrac, uint32_t phase) const noexcept
     {
-      // Integer and fractional harmonic number.
-      const float h0 = std::floor(harmonicRatio);
-      const float hFrac = harmonicRatio - h0;
-
-      // Two carrier phases at harmonics h0 and h0+1.
-      // Apply modulo to wrap into [-1, 1].
-      float phi0 = std::fmod(phase * h0 + 1.0f + 1000.0f, 2.0f) - 1.0f;
-      float phi1 = std::fmod(phase * (h0 + 1.0f) + 1.0f + 1000.0f, 2.0f) - 1.0f;
+      // Two carrier phases at harmonics h0 and h0+1. Integer multiplication
+      // wraps modulo one period, which is exactly the [-1, 1] phase wrap.
+      const float phi0 = phaseToFloat(phase * harmonic);
+      const float phi1 = phaseToFloat(phase * (harmonic + 1u));
 
       // Cosine carriers.
       const float carrier0 = fastCos(phi0);
@@ -344,4 +472,315 @@ namespace ShortwavDSP
     }
   };
 
+  //------------------------------------------------------------------------------
+  // FormantOscillatorBank - up to 16 voices, four per SIMD register
+  //------------------------------------------------------------------------------
+  //
+  // Same algorithm and output as FormantOscillator, per voice: carrier phase
+  // accumulation, the bilinear formant lookup (the table reads are the only
+  // per-lane step), the double-carrier crossfade, decimation and DC blocking
+  // all run on simd::float4 / simd::uint4. Carriers are limited to below
+  // Nyquist of the oversampled rate (always the case for audio pitches).
+  //
+  // Usage (per control block):
+  //  bank.setParameterRamp(blockSize);
+  //  for (int v = 0; v < voices; ++v)
+  //    bank.setVoice(v, carrierHz[v], formantHz[v], width[v]);
+  //  bank.processSample(out, voices); // once per sample
+
+  class FormantOscillatorBank
+  {
+  public:
+    static constexpr int kMaxVoices = 16;
+    static constexpr int kGroups = kMaxVoices / simd::float4::size;
+
+    FormantOscillatorBank() noexcept
+    {
+      table_ = FormantOscillator::getFormantTable();
+      for (int v = 0; v < kMaxVoices; ++v)
+      {
+        carrier_[v] = carrierTarget_[v] = 110.0f;
+        formant_[v] = formantTarget_[v] = 800.0f;
+        carrierStep_[v] = formantStep_[v] = 0.0f;
+        width_[v] = 0.3f;
+      }
+      setSampleRate(44100.0f);
+      reset();
+    }
+
+    void setSampleRate(float sampleRate) noexcept
+    {
+      if (sampleRate <= 1.0f)
+        sampleRate = 44100.0f;
+      sampleRate_ = sampleRate;
+      dirty_ = true;
+    }
+
+    // Reset all voices' phases, decimators and DC blockers.
+    void reset() noexcept
+    {
+      for (int g = 0; g < kGroups; ++g)
+      {
+        phase_[g] = simd::uint4(0u);
+        dcX1_[g] = dcY1_[g] = simd::float4(0.0f);
+        decimator_[g].reset();
+      }
+    }
+
+    // Internal oversampling factor for all voices (1, 2, 4 or 8).
+    void setOversampling(int factor) noexcept
+    {
+      for (int g = 0; g < kGroups; ++g)
+        decimator_[g].setFactor(factor);
+      dirty_ = true;
+    }
+
+    int getOversampling() const noexcept
+    {
+      return decimator_[0].getFactor();
+    }
+
+    // Ramp carrier/formant changes from the next setVoice() calls over
+    // numSamples samples (0 = immediate, the default).
+    void setParameterRamp(int numSamples) noexcept
+    {
+      rampSamples_ = std::max(0, numSamples);
+    }
+
+    // Set one voice's parameters (same ranges as FormantOscillator).
+    void setVoice(int voice, float carrierHz, float formantHz, float width) noexcept
+    {
+      if (voice < 0 || voice >= kMaxVoices)
+        return;
+
+      carrierTarget_[voice] = std::max(carrierHz, 0.0f);
+      formantTarget_[voice] = std::max(formantHz, 0.0f);
+      width_[voice] = std::min(std::max(width, 0.0f), 1.0f);
+      dirty_ = true;
+
+      if (rampSamples_ > 0)
+      {
+        const float inv = 1.0f / static_cast<float>(rampSamples_);
+        carrierStep_[voice] = (carrierTarget_[voice] - carrier_[voice]) * inv;
+        formantStep_[voice] = (formantTarget_[voice] - formant_[voice]) * inv;
+        rampRemaining_ = rampSamples_;
+      }
+      else
+      {
+        carrier_[voice] = carrierTarget_[voice];
+        formant_[voice] = formantTarget_[voice];
+        carrierStep_[voice] = formantStep_[voice] = 0.0f;
+      }
+    }
+
+    // Output gain shared by all voices.
+    void setOutputGain(float gain) noexcept
+    {
+      outputGain_ = std::max(gain, 0.0f);
+    }
+
+    // Load counters (a coefficient update is one updateDerived() pass).
+    const DspStats &getStats() const noexcept { return stats_; }
+    DspStats &getStats() noexcept { return stats_; }
+
+    // Render one sample for voices [0, numVoices) into out[0..numVoices).
+    void processSample(float *out, int numVoices) noexcept
+    {
+      using simd::float4;
+      using simd::uint4;
+      DspStats::Timer timer(stats_, 1);
+
+      numVoices = std::max(0, std::min(numVoices, kMaxVoices));
+      const int groups = (numVoices + float4::size - 1) / float4::size;
+
+      advanceRamps();
+      if (dirty_)
+        updateDerived();
+
+      const int factor = decimator_[0].getFactor();
+      const float4 zero(0.0f);
+      const float4 norm(0.2f), gain(outputGain_);
+      const float4 R(0.9993f);
+
+      for (int g = 0; g < groups; ++g)
+      {
+        const int base = g * float4::size;
+        const Derived &d = derived_[g];
+
+        float4 oversampled[Decimator::kMaxFactor];
+        uint4 phase = phase_[g];
+        for (int k = 0; k < factor; ++k)
+        {
+          phase += d.increment; // Zero on silent lanes
+          oversampled[k] = renderPhase(phase, d);
+        }
+        phase_[g] = phase;
+
+        float4 y = (factor == 1) ? oversampled[0] : decimator_[g].process(oversampled);
+        y = y * norm * gain; // Same normalisation as the scalar oscillator
+
+        // DC blocking filter (first-order highpass), frozen on silent lanes
+        const float4 dc = y - dcX1_[g] + R * dcY1_[g];
+        dcX1_[g] = ifelse(d.active, y, dcX1_[g]);
+        dcY1_[g] = ifelse(d.active, dc, dcY1_[g]);
+
+        ifelse(d.active, dc, zero).storePartial(out + base, std::min(float4::size, numVoices - base));
+      }
+    }
+
+  private:
+    float sampleRate_ = 44100.0f;
+    float outputGain_ = 1.0f;
+    const float *table_ = nullptr;
+
+    // Per-voice parameters, grouped four at a time for vector loads
+    float carrier_[kMaxVoices];
+    float formant_[kMaxVoices];
+    float carrierTarget_[kMaxVoices];
+    float formantTarget_[kMaxVoices];
+    float carrierStep_[kMaxVoices];
+    float formantStep_[kMaxVoices];
+    float width_[kMaxVoices];
+    int rampSamples_ = 0;
+    int rampRemaining_ = 0;
+
+    // Per-group values derived from the parameters; rebuilt only when a
+    // parameter changed or a ramp is running (see updateDerived()).
+    struct Derived
+    {
+      simd::uint4 increment;            // Phase increment per oversampled sample
+      simd::uint4 harmonic, harmonic1;  // Double-carrier harmonics h0, h0 + 1
+      simd::float4 hFrac;               // Carrier crossfade
+      simd::float4 widthFrac;           // Table row interpolation
+      simd::float4 active;              // Lanes with a non-zero carrier
+      int32_t rowOffset[simd::float4::size];
+    };
+    Derived derived_[kGroups];
+    bool dirty_ = true;
+
+    // Per-group voice state
+    simd::uint4 phase_[kGroups];
+    simd::float4 dcX1_[kGroups];
+    simd::float4 dcY1_[kGroups];
+    BasicDecimator<simd::float4> decimator_[kGroups];
+    DspStats stats_;
+
+    // Recompute per-group derived values from the per-voice parameters.
+    void updateDerived() noexcept
+    {
+      using simd::float4;
+      using simd::uint4;
+
+      const float4 rate(sampleRate_ * static_cast<float>(decimator_[0].getFactor()));
+      const float4 maxCycles(0.49999f);
+      const float4 minCarrier(0.001f);
+      const float4 maxHarmonic(FormantOscillator::kMaxHarmonic);
+      const float widthScale = static_cast<float>(FormantOscillator::kMaxWidthIndex - 1);
+
+      for (int g = 0; g < kGroups; ++g)
+      {
+        const int base = g * float4::size;
+        Derived &d = derived_[g];
+        const float4 carrier = float4::load(carrier_ + base);
+        const float4 formant = float4::load(formant_ + base);
+
+        d.active = carrier > float4(0.0f);
+
+        // Phase increment: cycles per oversampled sample, scaled to 2^32
+        const float4 cycles = simd::min(carrier / rate, maxCycles);
+        d.increment = truncateToUint(cycles * float4(4294967296.0f));
+
+        // Harmonic split, identical to the scalar oscillator
+        const float4 ratio = simd::min(ifelse(carrier > minCarrier, formant / carrier, float4(1.0f)), maxHarmonic);
+        d.harmonic = truncateToUint(ratio);
+        d.harmonic1 = d.harmonic + uint4(1u);
+        d.hFrac = ratio - toFloatSigned(d.harmonic);
+
+        // Per-voice table rows
+        float widthFracs[float4::size];
+        for (int i = 0; i < float4::size; ++i)
+        {
+          float w = width_[base + i] * widthScale;
+          w = std::min(w, static_cast<float>(FormantOscillator::kMaxWidthIndex - 2));
+          const int row = static_cast<int>(w);
+          d.rowOffset[i] = row * FormantOscillator::kTableSize;
+          widthFracs[i] = w - static_cast<float>(row);
+        }
+        d.widthFrac = float4::load(widthFracs);
+      }
+      dirty_ = false;
+      stats_.countCoefficientUpdates();
+    }
+
+    // Advance carrier/formant ramps; the final step lands on the target.
+    void advanceRamps() noexcept
+    {
+      if (rampRemaining_ <= 0)
+        return;
+
+      dirty_ = true;
+
+      const bool last = (--rampRemaining_ == 0);
+      for (int v = 0; v < kMaxVoices; ++v)
+      {
+        if (last)
+        {
+          carrier_[v] = carrierTarget_[v];
+          formant_[v] = formantTarget_[v];
+          carrierStep_[v] = formantStep_[v] = 0.0f;
+        }
+        else
+        {
+          carrier_[v] += carrierStep_[v];
+          formant_[v] += formantStep_[v];
+        }
+      }
+    }
+
+    // fastCos(pi * x) for x in [-1, 1], four lanes (see FormantOscillator).
+    static simd::float4 fastCos(simd::float4 x) noexcept
+    {
+      const simd::float4 x2 = x * x;
+      return simd::float4(1.0f) + x2 * (simd::float4(-4.0f) + simd::float4(2.0f) * x2);
+    }
+
+    // One formant * carrier product per lane at the given phases.
+    simd::float4 renderPhase(simd::uint4 phase, const Derived &d) const noexcept
+    {
+      using simd::float4;
+      using simd::uint4;
+
+      // Table position: top 8 bits select the interval, low 24 bits interpolate
+      const uint4 tablePhase = phase + uint4(0x80000000u);
+      const float4 phaseFrac = toFloatSigned(tablePhase & uint4(0x00FFFFFFu)) * float4(1.0f / 16777216.0f);
+      uint32_t idx[float4::size];
+      (tablePhase >> 24).store(idx);
+
+      // Gather the four bilinear corners (the only per-lane step)
+      float c00[float4::size], c01[float4::size], c10[float4::size], c11[float4::size];
+      for (int i = 0; i < float4::size; ++i)
+      {
+        const float *r0 = table_ + d.rowOffset[i] + idx[i];
+        const float *r1 = r0 + FormantOscillator::kTableSize;
+        c00[i] = r0[0];
+        c01[i] = r0[1];
+        c10[i] = r1[0];
+        c11[i] = r1[1];
+      }
+      const float4 v00 = float4::load(c00), v01 = float4::load(c01);
+      const float4 v10 = float4::load(c10), v11 = float4::load(c11);
+      const float4 v0 = v00 + phaseFrac * (v01 - v00);
+      const float4 v1 = v10 + phaseFrac * (v11 - v10);
+      const float4 formantValue = v0 + d.widthFrac * (v1 - v0);
+
+      // Double carrier: integer multiply wraps the harmonic phases exactly
+      const float4 scale(1.0f / 2147483648.0f);
+      const float4 carrier0 = fastCos(toFloatSigned(phase * d.harmonic) * scale);
+      const float4 carrier1 = fastCos(toFloatSigned(phase * d.harmonic1) * scale);
+      const float4 carrierValue = carrier0 + d.hFrac * (carrier1 - carrier0);
+
+      return formantValue * carrierValue;
+    }
+  };
+
 } // namespace ShortwavDSP
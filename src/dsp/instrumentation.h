@@ -0,0 +1,223 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "simd.h"
+
+/*
+ * DspStats - optional per-instance load counters for the DSP classes
+ *
+ * Compiled in only when SHORTWAV_DSP_INSTRUMENTATION is defined to 1 (e.g.
+ * FLAGS += -DSHORTWAV_DSP_INSTRUMENTATION=1 in the Makefile). Otherwise
+ * DspStats is an empty class whose methods are empty inlines, so
+ * instrumented code compiles to exactly what it was without it.
+ *
+ * Counters (all since construction or the last reset()):
+ *  - calls / samples / cycles: time spent in the process*() entry points,
+ *    from the CPU time-stamp counter on x86 (steady_clock nanoseconds
+ *    elsewhere; see cycleUnit())
+ *  - coefficientUpdates: recomputations of derived coefficients (setters
+ *    return early when a value is unchanged; this counts the ones that did not)
+ *  - denormalFlushes: nonzero values flushed to zero by a denormal guard
+ *  - underruns, tiers[]: WavPlayer only (stream ring misses, frames rendered
+ *    per InterpolationQuality)
+ *
+ * Each counter is a relaxed std::atomic with a single writer (the audio
+ * thread), so other threads can take a snapshot() or reset() at any time
+ * without locks. Enabled counting costs two counter reads per timed call
+ * plus a few uncontended atomic adds; it is meant for profiling builds.
+ *
+ * Usage:
+ *  void processBuffer(const float* in, float* out, size_t n) noexcept
+ *  {
+ *    DspStats::Timer timer(stats_, n);
+ *    ...
+ *  }
+ *  DspStatsSnapshot s = filter.getStats().snapshot();
+ *  float load = s.cyclesPerSample();
+ */
+
+#ifndef SHORTWAV_DSP_INSTRUMENTATION
+#define SHORTWAV_DSP_INSTRUMENTATION 0
+#endif
+
+#if SHORTWAV_DSP_INSTRUMENTATION
+#include <atomic>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define SHORTWAV_DSP_HAS_TSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define SHORTWAV_DSP_HAS_TSC 1
+#else
+#include <chrono>
+#endif
+#endif
+
+namespace ShortwavDSP
+{
+
+  /// Plain copy of a DspStats instance at one point in time.
+  struct DspStatsSnapshot
+  {
+    static constexpr int kMaxTiers = 4;
+
+    uint64_t calls = 0;
+    uint64_t samples = 0;
+    uint64_t cycles = 0;
+    uint64_t coefficientUpdates = 0;
+    uint64_t denormalFlushes = 0;
+    uint64_t underruns = 0;
+    uint64_t tiers[kMaxTiers] = {};
+
+    /// Mean cost of one processed sample frame (0 before the first call).
+    double cyclesPerSample() const noexcept
+    {
+      return samples > 0 ? static_cast<double>(cycles) / static_cast<double>(samples) : 0.0;
+    }
+  };
+
+  class DspStats
+  {
+  public:
+    static constexpr bool kEnabled = SHORTWAV_DSP_INSTRUMENTATION != 0;
+    static constexpr int kMaxTiers = DspStatsSnapshot::kMaxTiers;
+
+#if SHORTWAV_DSP_INSTRUMENTATION
+#if defined(SHORTWAV_DSP_HAS_TSC)
+    static const char *cycleUnit() noexcept { return "cycles"; }
+
+    static uint64_t readCounter() noexcept { return __rdtsc(); }
+#else
+    static const char *cycleUnit() noexcept { return "ns"; }
+
+    static uint64_t readCounter() noexcept
+    {
+      return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                       std::chrono::steady_clock::now().time_since_epoch())
+                                       .count());
+    }
+#endif
+
+    /// Times its scope as one call processing numSamples sample frames.
+    class Timer
+    {
+    public:
+      Timer(DspStats &stats, size_t numSamples) noexcept
+          : stats_(stats), samples_(numSamples), start_(readCounter()) {}
+
+      ~Timer() { stats_.addCall(samples_, readCounter() - start_); }
+
+      Timer(const Timer &) = delete;
+      Timer &operator=(const Timer &) = delete;
+
+    private:
+      DspStats &stats_;
+      size_t samples_;
+      uint64_t start_;
+    };
+
+    DspStats() noexcept = default;
+
+    // Copies take the current counts (the DSP classes stay copyable)
+    DspStats(const DspStats &other) noexcept { assign(other.snapshot()); }
+    DspStats &operator=(const DspStats &other) noexcept
+    {
+      assign(other.snapshot());
+      return *this;
+    }
+
+    void addCall(size_t numSamples, uint64_t cycles) noexcept
+    {
+      add(calls_, 1);
+      add(samples_, numSamples);
+      add(cycles_, cycles);
+    }
+
+    void countCoefficientUpdates(uint64_t count = 1) noexcept { add(coefficientUpdates_, count); }
+    void countUnderruns(uint64_t count = 1) noexcept { add(underruns_, count); }
+
+    void countTier(int tier, uint64_t frames) noexcept
+    {
+      if (tier >= 0 && tier < kMaxTiers)
+        add(tiers_[tier], frames);
+    }
+
+    /// Count the lanes a |x| < threshold guard is about to flush (exact
+    /// zeros are silence, not denormal hits, and are not counted).
+    void countDenormalFlushes(float x, float threshold) noexcept
+    {
+      if (x != 0.0f && std::fabs(x) < threshold)
+        add(denormalFlushes_, 1);
+    }
+
+    void countDenormalFlushes(simd::float4 x, float threshold) noexcept
+    {
+      for (int i = 0; i < simd::float4::size; ++i)
+        countDenormalFlushes(x[i], threshold);
+    }
+
+    DspStatsSnapshot snapshot() const noexcept
+    {
+      DspStatsSnapshot s;
+      s.calls = calls_.load(std::memory_order_relaxed);
+      s.samples = samples_.load(std::memory_order_relaxed);
+      s.cycles = cycles_.load(std::memory_order_relaxed);
+      s.coefficientUpdates = coefficientUpdates_.load(std::memory_order_relaxed);
+      s.denormalFlushes = denormalFlushes_.load(std::memory_order_relaxed);
+      s.underruns = underruns_.load(std::memory_order_relaxed);
+      for (int t = 0; t < kMaxTiers; ++t)
+        s.tiers[t] = tiers_[t].load(std::memory_order_relaxed);
+      return s;
+    }
+
+    void reset() noexcept { assign(DspStatsSnapshot()); }
+
+  private:
+    static void add(std::atomic<uint64_t> &counter, uint64_t n) noexcept
+    {
+      counter.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    void assign(const DspStatsSnapshot &s) noexcept
+    {
+      calls_.store(s.calls, std::memory_order_relaxed);
+      samples_.store(s.samples, std::memory_order_relaxed);
+      cycles_.store(s.cycles, std::memory_order_relaxed);
+      coefficientUpdates_.store(s.coefficientUpdates, std::memory_order_relaxed);
+      denormalFlushes_.store(s.denormalFlushes, std::memory_order_relaxed);
+      underruns_.store(s.underruns, std::memory_order_relaxed);
+      for (int t = 0; t < kMaxTiers; ++t)
+        tiers_[t].store(s.tiers[t], std::memory_order_relaxed);
+    }
+
+    std::atomic<uint64_t> calls_{0};
+    std::atomic<uint64_t> samples_{0};
+    std::atomic<uint64_t> cycles_{0};
+    std::atomic<uint64_t> coefficientUpdates_{0};
+    std::atomic<uint64_t> denormalFlushes_{0};
+    std::atomic<uint64_t> underruns_{0};
+    std::atomic<uint64_t> tiers_[kMaxTiers] = {};
+#else
+    static const char *cycleUnit() noexcept { return "cycles"; }
+
+    class Timer
+    {
+    public:
+      Timer(DspStats &, size_t) noexcept {}
+    };
+
+    void addCall(size_t, uint64_t) noexcept {}
+    void countCoefficientUpdates(uint64_t = 1) noexcept {}
+    void countUnderruns(uint64_t = 1) noexcept {}
+    void countTier(int, uint64_t) noexcept {}
+    void countDenormalFlushes(float, float) noexcept {}
+    void countDenormalFlushes(simd::float4, float) noexcept {}
+    DspStatsSnapshot snapshot() const noexcept { return DspStatsSnapshot(); }
+    void reset() noexcept {}
+#endif
+  };
+
+} // namespace ShortwavDSP
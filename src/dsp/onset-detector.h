@@ -0,0 +1,217 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+/*
+ * OnsetDetector - offline transient detection for auto-slicing
+ *
+ * Runs on a loader thread, fed with the decoded chunks of one sequential pass
+ * over the file (WavPlayer shares this pass with the PeakPyramid build, so
+ * the file is read only once). The channels are averaged to mono.
+ *
+ * Detection function: energy of the first difference of the signal per hop of
+ * kHopFrames frames. Differentiating tilts the spectrum towards the highs,
+ * where attacks carry most of their energy, so the result behaves like a
+ * cheap high-frequency-content flux. An onset is a hop whose log-energy rise
+ * over the previous hop
+ *  - is a local maximum within +-kPeakRadius hops,
+ *  - exceeds the mean rise around it by kThreshold (natural-log units), and
+ *  - starts from a hop that is not below the noise floor (kFloorDb under the
+ *    loudest hop of the file),
+ * with at least kMinSpacingSeconds between onsets (the stronger one wins).
+ *
+ * Each onset also carries a start frame aligned to the last zero crossing of
+ * the mono mix before the attack (searched up to kAlignHops hops back), so a
+ * slice started there does not click. Zero crossings are recorded during the
+ * same pass; nothing is re-read afterwards.
+ *
+ * Usage:
+ *  OnsetDetector detector;
+ *  detector.begin(numFrames, numChannels, sampleRate);
+ *  detector.process(chunk, count);     // consecutive interleaved chunks
+ *  std::vector<OnsetDetector::Onset> onsets = detector.finish();
+ *
+ * Memory: about 12 bytes per hop (~0.05 B/frame) during analysis.
+ */
+
+namespace ShortwavDSP
+{
+
+  class OnsetDetector
+  {
+  public:
+    static constexpr size_t kHopFrames = 256;
+    static constexpr int kPeakRadius = 3;
+    static constexpr int kMeanRadius = 8;
+    static constexpr float kThreshold = 0.7f;
+    static constexpr float kFloorDb = -50.0f;
+    static constexpr float kMinSpacingSeconds = 0.05f;
+    static constexpr int kAlignHops = 4;
+
+    struct Onset
+    {
+      size_t frame = 0;      // Zero-crossing-aligned start of the attack
+      float strength = 0.0f; // Log-energy rise above the local mean (larger = sharper)
+    };
+
+    OnsetDetector() = default;
+
+    /// Start a new analysis. Previous results are discarded.
+    void begin(size_t numFrames, uint16_t numChannels, uint32_t sampleRate)
+    {
+      numFrames_ = numFrames;
+      channels_ = std::max<uint16_t>(1, numChannels);
+      sampleRate_ = std::max<uint32_t>(1, sampleRate);
+      energy_.clear();
+      crossings_.clear();
+      failed_ = false;
+      try
+      {
+        const size_t hops = (numFrames + kHopFrames - 1) / kHopFrames;
+        energy_.reserve(hops);
+        crossings_.reserve(hops);
+      }
+      catch (const std::bad_alloc &)
+      {
+        failed_ = true;
+      }
+      frame_ = 0;
+      hopEnergy_ = 0.0;
+      hopCrossing_ = kNoCrossing;
+      previous_ = 0.0f;
+    }
+
+    /// Analyse the next count interleaved frames.
+    void process(const float *interleaved, size_t count)
+    {
+      if (failed_)
+        return;
+
+      const float scale = 1.0f / static_cast<float>(channels_);
+      for (size_t f = 0; f < count; ++f)
+      {
+        float x = 0.0f;
+        for (uint16_t c = 0; c < channels_; ++c)
+          x += interleaved[f * channels_ + c];
+        x *= scale;
+
+        const float d = x - previous_;
+        hopEnergy_ += static_cast<double>(d) * d;
+        if ((x >= 0.0f) != (previous_ >= 0.0f))
+          hopCrossing_ = static_cast<uint32_t>(frame_ % kHopFrames);
+        previous_ = x;
+
+        if (++frame_ % kHopFrames == 0)
+          endHop();
+      }
+    }
+
+    /// Finish the analysis and return the onsets in file order.
+    /// Returns an empty list if the analysis ran out of memory.
+    std::vector<Onset> finish()
+    {
+      std::vector<Onset> onsets;
+      if (failed_)
+        return onsets;
+      if (frame_ % kHopFrames != 0)
+        endHop();
+
+      const int hops = static_cast<int>(energy_.size());
+      if (hops < 2)
+        return onsets;
+
+      // Log-energy rise per hop, and the noise floor
+      std::vector<float> rise(hops, 0.0f);
+      std::vector<float> logEnergy(hops);
+      float loudest = -1e30f;
+      for (int h = 0; h < hops; ++h)
+      {
+        logEnergy[h] = std::log(energy_[h] + 1e-12f);
+        loudest = std::max(loudest, logEnergy[h]);
+      }
+      for (int h = 1; h < hops; ++h)
+        rise[h] = std::max(0.0f, logEnergy[h] - logEnergy[h - 1]);
+      const float floor = loudest + kFloorDb * (std::log(10.0f) / 10.0f);
+
+      const int minSpacing = std::max(1, static_cast<int>(std::ceil(kMinSpacingSeconds * sampleRate_ / kHopFrames)));
+      int lastHop = -minSpacing;
+      for (int h = 1; h < hops; ++h)
+      {
+        if (rise[h] <= 0.0f || logEnergy[h] < floor)
+          continue;
+
+        bool isPeak = true;
+        for (int k = std::max(1, h - kPeakRadius); k <= std::min(hops - 1, h + kPeakRadius) && isPeak; ++k)
+          isPeak = (k == h) || (k < h ? rise[k] < rise[h] : rise[k] <= rise[h]);
+        if (!isPeak)
+          continue;
+
+        double sum = 0.0;
+        int n = 0;
+        for (int k = std::max(1, h - kMeanRadius); k <= std::min(hops - 1, h + kMeanRadius); ++k, ++n)
+          sum += rise[k];
+        const float strength = rise[h] - static_cast<float>(sum / n);
+        if (strength < kThreshold)
+          continue;
+
+        Onset onset;
+        onset.frame = alignedStart(h);
+        onset.strength = strength;
+        if (h - lastHop < minSpacing && !onsets.empty())
+        {
+          // Too close to the previous onset: keep the stronger of the two
+          if (strength > onsets.back().strength)
+          {
+            onsets.back() = onset;
+            lastHop = h;
+          }
+          continue;
+        }
+        onsets.push_back(onset);
+        lastHop = h;
+      }
+      return onsets;
+    }
+
+  private:
+    static constexpr uint32_t kNoCrossing = 0xFFFFFFFFu;
+
+    void endHop()
+    {
+      energy_.push_back(static_cast<float>(hopEnergy_));
+      crossings_.push_back(hopCrossing_);
+      hopEnergy_ = 0.0;
+      hopCrossing_ = kNoCrossing;
+    }
+
+    // Last zero crossing before hop h, or the start of hop h if none is close
+    size_t alignedStart(int h) const noexcept
+    {
+      for (int k = h - 1; k >= std::max(0, h - kAlignHops); --k)
+      {
+        if (crossings_[k] != kNoCrossing)
+          return static_cast<size_t>(k) * kHopFrames + crossings_[k];
+      }
+      return std::min(static_cast<size_t>(h) * kHopFrames, numFrames_);
+    }
+
+    size_t numFrames_ = 0;
+    uint16_t channels_ = 1;
+    uint32_t sampleRate_ = 44100;
+    bool failed_ = false;
+
+    std::vector<float> energy_;       // First-difference energy per hop
+    std::vector<uint32_t> crossings_; // Offset of the last zero crossing in each hop
+
+    size_t frame_ = 0;
+    double hopEnergy_ = 0.0;
+    uint32_t hopCrossing_ = kNoCrossing;
+    float previous_ = 0.0f;
+  };
+
+} // namespace ShortwavDSP
@@ -0,0 +1,229 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+/*
+ * PeakPyramid - multi-resolution min/max/RMS summary of an audio file
+ *
+ * Built once, off the audio thread, when a file is loaded. Level 0 holds one
+ * entry per kBaseBlockFrames frames (channels averaged to mono); each level
+ * above halves the entry count. Any frame range is then summarised from
+ * O(log n) entries, so a waveform display reads O(width) entries per redraw
+ * at every zoom level instead of touching every sample.
+ *
+ * Ranges are resolved to whole base blocks: query() rounds the start down
+ * and the end up to a multiple of kBaseBlockFrames.
+ *
+ * Memory: about 2 * 12 / kBaseBlockFrames bytes per frame (~0.4 B/frame).
+ *
+ * Usage:
+ *  PeakPyramid peaks;
+ *  peaks.build(numFrames, numChannels, [&](size_t first, size_t count, float* out) {
+ *    return readInterleaved(first, count, out); // count * numChannels floats
+ *  });
+ *  PeakPyramid::Entry e = peaks.query(start, end);
+ */
+
+namespace ShortwavDSP
+{
+
+  class PeakPyramid
+  {
+  public:
+    static constexpr size_t kBaseBlockFrames = 64;
+
+    struct Entry
+    {
+      float min = 0.0f;
+      float max = 0.0f;
+      float rms = 0.0f;
+    };
+
+    PeakPyramid() = default;
+
+    /// Build from a reader that decodes `count` interleaved frames starting at
+    /// `first` into `out` and returns false on failure.
+    /// @return false if allocation or a read failed (the pyramid is left empty)
+    template <typename ReadFn>
+    bool build(size_t numFrames, uint16_t numChannels, ReadFn &&read)
+    {
+      clear();
+      if (numFrames == 0 || numChannels == 0)
+        return true;
+
+      constexpr size_t kChunkFrames = kBaseBlockFrames * 64;
+      std::vector<float> chunk;
+      try
+      {
+        chunk.resize(kChunkFrames * numChannels);
+        levels_.emplace_back();
+        levels_[0].reserve((numFrames + kBaseBlockFrames - 1) / kBaseBlockFrames);
+      }
+      catch (const std::bad_alloc &)
+      {
+        clear();
+        return false;
+      }
+
+      const float channelScale = 1.0f / static_cast<float>(numChannels);
+      for (size_t first = 0; first < numFrames; first += kChunkFrames)
+      {
+        const size_t count = std::min(kChunkFrames, numFrames - first);
+        if (!read(first, count, chunk.data()))
+        {
+          clear();
+          return false;
+        }
+
+        for (size_t block = 0; block < count; block += kBaseBlockFrames)
+        {
+          const size_t blockEnd = std::min(block + kBaseBlockFrames, count);
+          Entry e;
+          e.min = e.max = mixFrame(chunk.data() + block * numChannels, numChannels, channelScale);
+          double sumSquares = 0.0;
+          for (size_t f = block; f < blockEnd; ++f)
+          {
+            const float v = mixFrame(chunk.data() + f * numChannels, numChannels, channelScale);
+            e.min = std::min(e.min, v);
+            e.max = std::max(e.max, v);
+            sumSquares += static_cast<double>(v) * v;
+          }
+          e.rms = static_cast<float>(std::sqrt(sumSquares / static_cast<double>(blockEnd - block)));
+          levels_[0].push_back(e);
+        }
+      }
+
+      numFrames_ = numFrames;
+
+      // Coarser levels: each entry merges two children of the level below
+      try
+      {
+        while (levels_.back().size() > 1)
+        {
+          const size_t level = levels_.size() - 1;
+          const std::vector<Entry> &below = levels_[level];
+          std::vector<Entry> above((below.size() + 1) / 2);
+          for (size_t i = 0; i < above.size(); ++i)
+          {
+            Accumulator acc;
+            acc.add(below[2 * i], entryFrames(level, 2 * i));
+            if (2 * i + 1 < below.size())
+              acc.add(below[2 * i + 1], entryFrames(level, 2 * i + 1));
+            above[i] = acc.result();
+          }
+          levels_.push_back(std::move(above));
+        }
+      }
+      catch (const std::bad_alloc &)
+      {
+        clear();
+        return false;
+      }
+
+      return true;
+    }
+
+    void clear() noexcept
+    {
+      levels_.clear();
+      numFrames_ = 0;
+    }
+
+    bool empty() const noexcept { return levels_.empty(); }
+    size_t getNumFrames() const noexcept { return numFrames_; }
+    size_t getNumLevels() const noexcept { return levels_.size(); }
+
+    /// Frames covered by one entry of the given level.
+    static size_t getBlockFrames(size_t level) noexcept { return kBaseBlockFrames << level; }
+
+    /// Entries of one level (level < getNumLevels()).
+    const std::vector<Entry> &getLevel(size_t level) const noexcept { return levels_[level]; }
+
+    /// Min, max and RMS over frames [start, end), widened to whole base blocks.
+    /// Returns a zero entry for an empty pyramid or range.
+    Entry query(size_t start, size_t end) const noexcept
+    {
+      end = std::min(end, numFrames_);
+      if (empty() || start >= end)
+        return Entry();
+
+      // Bottom-up segment walk over base block indices [lo, hi)
+      size_t lo = start / kBaseBlockFrames;
+      size_t hi = (end + kBaseBlockFrames - 1) / kBaseBlockFrames;
+      Accumulator acc;
+      for (size_t level = 0; lo < hi; ++level)
+      {
+        if (level + 1 == levels_.size())
+        {
+          for (size_t i = lo; i < hi; ++i)
+            acc.add(levels_[level][i], entryFrames(level, i));
+          break;
+        }
+        if (lo & 1)
+        {
+          acc.add(levels_[level][lo], entryFrames(level, lo));
+          ++lo;
+        }
+        if (hi & 1)
+        {
+          --hi;
+          acc.add(levels_[level][hi], entryFrames(level, hi));
+        }
+        lo >>= 1;
+        hi >>= 1;
+      }
+      return acc.result();
+    }
+
+  private:
+    struct Accumulator
+    {
+      float min = 0.0f;
+      float max = 0.0f;
+      double sumSquares = 0.0;
+      size_t frames = 0;
+
+      void add(const Entry &e, size_t n) noexcept
+      {
+        min = (frames == 0) ? e.min : std::min(min, e.min);
+        max = (frames == 0) ? e.max : std::max(max, e.max);
+        sumSquares += static_cast<double>(e.rms) * e.rms * static_cast<double>(n);
+        frames += n;
+      }
+
+      Entry result() const noexcept
+      {
+        Entry e;
+        e.min = min;
+        e.max = max;
+        e.rms = frames > 0 ? static_cast<float>(std::sqrt(sumSquares / static_cast<double>(frames))) : 0.0f;
+        return e;
+      }
+    };
+
+    static float mixFrame(const float *frame, uint16_t channels, float scale) noexcept
+    {
+      float sum = 0.0f;
+      for (uint16_t c = 0; c < channels; ++c)
+        sum += frame[c];
+      return sum * scale;
+    }
+
+    // Frames actually covered by entry i of a level (the last one may be short)
+    size_t entryFrames(size_t level, size_t i) const noexcept
+    {
+      const size_t blockFrames = getBlockFrames(level);
+      const size_t first = i * blockFrames;
+      return std::min(blockFrames, numFrames_ - first);
+    }
+
+    std::vector<std::vector<Entry>> levels_;
+    size_t numFrames_ = 0;
+  };
+
+} // namespace ShortwavDSP
@@ -1,10 +1,14 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <cmath>
 #include <algorithm>
 #include <limits>
 
+#include "simd.h"
+#include "instrumentation.h"
+
 /*
  * Smooth Random LFO Generator
  *
@@ -33,12 +37,83 @@
  *               transitions can be; higher values = smoother / more correlated.
  *     - bipolar: output in [-1, 1] when true, [0, 1] when false.
  * - Call reset() to reset phase and output.
- * - Call processSample() each sample to get the next LFO value.
+ * - Call processSample() each sample to get the next LFO value, or
+ *   processBuffer() to render a block (e.g. once per control-rate block).
+ * - Optionally call setDecimation(K) to advance the generator once every K
+ *   samples (coefficients derived for sampleRate / K) and linearly
+ *   interpolate in between: continuous, deterministic, one control period of
+ *   lag and about one add per sample. A different sequence than K = 1.
+ *
+ * RandomLFOBank runs up to 16 independent generators (own seed, rate, depth
+ * and smoothness) in struct-of-arrays form, four per SIMD register, with the
+ * same per-channel output as RandomLFO.
  */
 
 namespace ShortwavDSP
 {
 
+  namespace detail
+  {
+    // Phase increment per sample for a target rate (0 = hold the target).
+    inline float randomLfoStep(float sampleRate, float rateHz)
+    {
+      if (sampleRate <= 0.f || rateHz <= 0.f)
+        return 0.f;
+      // How fast we move phase from 0 -> 1 for each random step.
+      return rateHz / sampleRate;
+    }
+
+    // Map smoothness to second-order system coefficients.
+    //
+    // We loosely base this on the idea of a damped spring:
+    //   a ~= (2*pi*f_c)^2
+    //   b ~= 2*zeta*(2*pi*f_c)
+    //
+    // where f_c is tied to the LFO step rate and smooth is mapped to damping / cutoff.
+    inline void randomLfoSpring(float sampleRate, float rateHz, float smooth, float &a, float &b)
+    {
+      if (sampleRate <= 0.f)
+      {
+        a = 0.f;
+        b = 0.f;
+        return;
+      }
+
+      // Base frequency related to how quickly we want to track new random values.
+      // Ensure a minimal non-zero frequency for stability.
+      const float minHz = 0.05f;
+      const float effectiveRate = std::max(rateHz, minHz);
+
+      // Map smoothness to a normalized factor that influences bandwidth.
+      const float smoothClamped = std::min(std::max(smooth, 0.f), 1.f);
+
+      // Higher smooth => lower cutoff => smaller a.
+      // Lower smooth => higher cutoff => larger a.
+      const float baseOmega = 2.f * 3.14159265359f * effectiveRate;
+      const float maxScale = 1.0f;
+      const float minScale = 0.05f;
+      const float scale = minScale + (maxScale - minScale) * (1.f - smoothClamped);
+      const float omega = baseOmega * scale / sampleRate;
+
+      // Stiffness and damping in discrete time (small omega).
+      a = omega * omega;
+
+      // Damping factor:
+      // smooth near 1 => more damping; smooth near 0 => lighter damping.
+      const float minDamp = 0.2f;
+      const float maxDamp = 1.2f;
+      const float damp = minDamp + (maxDamp - minDamp) * smoothClamped;
+
+      b = 2.f * damp * omega;
+    }
+
+    // Seeds are remapped like RandomLFO::seed (0 would be a weak LCG start).
+    inline uint32_t randomLfoSeed(uint32_t seedValue)
+    {
+      return (seedValue == 0) ? 0x1234567u : seedValue;
+    }
+  } // namespace detail
+
   class RandomLFO
   {
   public:
@@ -60,6 +135,9 @@ namespace ShortwavDSP
       v_ = 0.f;
       target_ = x_;
       phase_ = 0.f;
+      value_ = (bipolar_ ? x_ * 2.f - 1.f : x_) * depth_;
+      increment_ = 0.f;
+      countdown_ = 0;
       updateFilterCoeffs();
     }
 
@@ -95,19 +173,71 @@ namespace ShortwavDSP
       bipolar_ = bipolar;
     }
 
+    static constexpr int kMaxDecimation = 256;
+
+    // Advance the generator every `factor` samples and interpolate in between
+    // (1 = every sample, the default; clamped to 1..kMaxDecimation).
+    // Continues from the current output without a jump.
+    void setDecimation(int factor)
+    {
+      factor = std::min(std::max(factor, 1), kMaxDecimation);
+      if (factor == decimation_)
+        return;
+      decimation_ = factor;
+      countdown_ = 0;
+      updateStepRate();
+    }
+
+    int getDecimation() const
+    {
+      return decimation_;
+    }
+
+    // Load counters (empty unless built with SHORTWAV_DSP_INSTRUMENTATION)
+    const DspStats &getStats() const { return stats_; }
+    DspStats &getStats() { return stats_; }
+
     // Optionally seed the internal RNG for deterministic behavior.
     void seed(uint32_t seedValue)
     {
-      if (seedValue == 0)
-      {
-        seedValue = 0x1234567u;
-      }
-      rngState_ = seedValue;
+      rngState_ = detail::randomLfoSeed(seedValue);
     }
 
     // Generate next LFO sample.
     // This is real-time safe and intended for per-sample use in an audio callback.
     float processSample()
+    {
+      DspStats::Timer timer(stats_, 1);
+      if (decimation_ == 1)
+      {
+        value_ = advance();
+        return value_;
+      }
+
+      // Decimated: ramp from the last output to the next control point
+      if (countdown_ == 0)
+      {
+        increment_ = (advance() - value_) * (1.f / static_cast<float>(decimation_));
+        countdown_ = decimation_;
+      }
+      --countdown_;
+      value_ += increment_;
+      return value_;
+    }
+
+    // Generate numSamples consecutive LFO samples into output.
+    // Equivalent to calling processSample() numSamples times.
+    void processBuffer(float *output, size_t numSamples)
+    {
+      for (size_t i = 0; i < numSamples; ++i)
+      {
+        output[i] = processSample();
+      }
+    }
+
+  private:
+    // One generator step (one sample, or one control point when decimated).
+    float advance()
     {
       if (sampleRate_ <= 0.f)
       {
@@ -164,7 +294,6 @@ namespace ShortwavDSP
       return out;
     }
 
-  private:
     float sampleRate_ = 44100.f;
     float rateHz_ = 1.0f; // average rate of new random targets
     float depth_ = 1.0f;
@@ -188,6 +317,15 @@ namespace ShortwavDSP
     float a_ = 0.f; // stiffness
     float b_ = 0.f; // damping
 
+    // Decimated mode: last output, per-sample ramp and samples left until
+    // the next control point.
+    int decimation_ = 1;
+    int countdown_ = 0;
+    float value_ = 0.f;
+    float increment_ = 0.f;
+
+    DspStats stats_;
+
     static float clamp01(float x)
     {
       if (x < 0.f)
@@ -207,70 +345,259 @@ namespace ShortwavDSP
       return scaled;
     }
 
+    // Rate at which advance() runs
+    float stepRate() const
+    {
+      return (decimation_ == 1) ? sampleRate_ : sampleRate_ / static_cast<float>(decimation_);
+    }
+
     void updateStepRate()
     {
-      if (sampleRate_ <= 0.f)
-      {
-        stepPerSample_ = 0.f;
-        return;
-      }
-      if (rateHz_ <= 0.f)
+      stepPerSample_ = detail::randomLfoStep(stepRate(), rateHz_);
+      updateFilterCoeffs();
+    }
+
+    void updateFilterCoeffs()
+    {
+      detail::randomLfoSpring(stepRate(), rateHz_, smooth_, a_, b_);
+      stats_.countCoefficientUpdates();
+    }
+  };
+
+  //------------------------------------------------------------------------------
+  // RandomLFOBank - up to 16 generators, four per SIMD register
+  //------------------------------------------------------------------------------
+  //
+  // Each channel is a RandomLFO with its own seed, rate, depth and smoothness;
+  // polarity is shared. Phase, target, position, velocity and LCG state live
+  // in struct-of-arrays form and every update step runs on simd::float4 /
+  // simd::uint4, so a whole 16-channel frame costs about four scalar
+  // generators. Coefficients are recomputed only for channels whose settings
+  // actually change. A channel seeded like a RandomLFO produces the same
+  // output sample for sample.
+  //
+  // Usage (per control block):
+  //  bank.setSampleRate(sr);
+  //  bank.seed(baseSeed);                  // channel c: channelSeed(baseSeed, c)
+  //  for (int c = 0; c < channels; ++c)
+  //    bank.setChannel(c, rateHz[c], depth[c], smooth[c]);
+  //  bank.processFrame(out, channels);      // once per sample
+
+  class RandomLFOBank
+  {
+  public:
+    static constexpr int kMaxChannels = 16;
+    static constexpr int kGroups = kMaxChannels / simd::float4::size;
+
+    RandomLFOBank()
+    {
+      for (int c = 0; c < kMaxChannels; ++c)
       {
-        // If rate is zero or negative, effectively never change target.
-        stepPerSample_ = 0.f;
+        rateHz_[c] = 1.0f;
+        depth_[c] = 1.0f;
+        smooth_[c] = 0.75f;
       }
-      else
+      seed(0x1234567u);
+      setSampleRate(44100.f);
+      reset();
+    }
+
+    // Initialize with a given sample rate (recomputes every channel).
+    void setSampleRate(float sampleRate)
+    {
+      sampleRate_ = (sampleRate > 1.f) ? sampleRate : 44100.f;
+      for (int c = 0; c < kMaxChannels; ++c)
+        updateChannel(c);
+      syncGroups();
+    }
+
+    // Reset every channel: phase is reset, current and target values are set
+    // to `initial` (clamped to [0, 1]).
+    void reset(float initial = 0.f)
+    {
+      const simd::float4 x(std::min(std::max(initial, 0.f), 1.f));
+      for (int g = 0; g < kGroups; ++g)
       {
-        // How fast we move phase_ from 0 -> 1 for each random step.
-        const float stepsPerSecond = rateHz_;
-        stepPerSample_ = stepsPerSecond / sampleRate_;
+        x_[g] = x;
+        target_[g] = x;
+        v_[g] = simd::float4(0.f);
+        phase_[g] = simd::float4(0.f);
       }
+    }
 
-      updateFilterCoeffs();
+    // Seed channel c with channelSeed(baseSeed, c) (channel 0 gets baseSeed).
+    void seed(uint32_t baseSeed)
+    {
+      for (int c = 0; c < kMaxChannels; ++c)
+        seeds_[c] = detail::randomLfoSeed(channelSeed(baseSeed, c));
+      loadSeeds();
     }
 
-    // Map smoothness to second-order system coefficients.
-    //
-    // We loosely base this on the idea of a damped spring:
-    //   a ~= (2*pi*f_c)^2
-    //   b ~= 2*zeta*(2*pi*f_c)
-    //
-    // where f_c is tied to the LFO step rate and smooth is mapped to damping / cutoff.
-    void updateFilterCoeffs()
+    // Seed one channel exactly as RandomLFO::seed would.
+    void seedChannel(int channel, uint32_t seedValue)
     {
-      if (sampleRate_ <= 0.f)
-      {
-        a_ = 0.f;
-        b_ = 0.f;
+      if (channel < 0 || channel >= kMaxChannels)
         return;
-      }
+      // Keep the other lanes' generators where they are
+      for (int g = 0; g < kGroups; ++g)
+        rng_[g].store(seeds_ + g * simd::float4::size);
+      seeds_[channel] = detail::randomLfoSeed(seedValue);
+      loadSeeds();
+    }
 
-      // Base frequency related to how quickly we want to track new random values.
-      // Ensure a minimal non-zero frequency for stability.
-      const float minHz = 0.05f;
-      const float effectiveRate = std::max(rateHz_, minHz);
+    // Distinct, well-spread seeds per channel (golden-ratio increments).
+    static uint32_t channelSeed(uint32_t baseSeed, int channel)
+    {
+      return baseSeed + static_cast<uint32_t>(channel) * 0x9E3779B9u;
+    }
 
-      // Map smoothness to a normalized factor that influences bandwidth.
-      const float smoothClamped = clamp01(smooth_);
+    // Per-channel settings (same ranges as RandomLFO). Only channels whose
+    // values change are recomputed.
+    void setChannel(int channel, float rateHz, float depth, float smooth)
+    {
+      if (channel < 0 || channel >= kMaxChannels)
+        return;
+      rateHz = std::max(rateHz, 0.f);
+      depth = std::max(0.f, depth);
+      smooth = std::min(std::max(smooth, 0.f), 1.f);
+      if (rateHz == rateHz_[channel] && depth == depth_[channel] && smooth == smooth_[channel])
+        return;
+      rateHz_[channel] = rateHz;
+      depth_[channel] = depth;
+      smooth_[channel] = smooth;
+      updateChannel(channel);
+      dirty_ = true;
+    }
 
-      // Higher smooth => lower cutoff => smaller a.
-      // Lower smooth => higher cutoff => larger a.
-      const float baseOmega = 2.f * 3.14159265359f * effectiveRate;
-      const float maxScale = 1.0f;
-      const float minScale = 0.05f;
-      const float scale = minScale + (maxScale - minScale) * (1.f - smoothClamped);
-      const float omega = baseOmega * scale / sampleRate_;
+    // Same settings for every channel.
+    void setAll(float rateHz, float depth, float smooth)
+    {
+      for (int c = 0; c < kMaxChannels; ++c)
+        setChannel(c, rateHz, depth, smooth);
+    }
 
-      // Stiffness and damping in discrete time (small omega).
-      a_ = omega * omega;
+    // Set whether the outputs are bipolar [-1, 1] or unipolar [0, 1].
+    void setBipolar(bool bipolar)
+    {
+      bipolar_ = bipolar;
+    }
 
-      // Damping factor:
-      // smooth near 1 => more damping; smooth near 0 => lighter damping.
-      const float minDamp = 0.2f;
-      const float maxDamp = 1.2f;
-      const float damp = minDamp + (maxDamp - minDamp) * smoothClamped;
+    // Load counters (empty unless built with SHORTWAV_DSP_INSTRUMENTATION)
+    const DspStats &getStats() const { return stats_; }
+    DspStats &getStats() { return stats_; }
+
+    // Generate the next sample of channels [0, numChannels) into out.
+    // Channels at or above numChannels do not advance, except for the unused
+    // lanes of the last active group.
+    void processFrame(float *out, int numChannels = kMaxChannels)
+    {
+      using simd::float4;
+      using simd::uint4;
+      DspStats::Timer timer(stats_, 1);
+
+      if (dirty_)
+        syncGroups();
+
+      numChannels = std::max(0, std::min(numChannels, kMaxChannels));
+      const float4 one(1.f);
+      const float4 zero(0.f);
+      const float4 two(2.f);
+      const float4 xMin(-0.1f);
+      const float4 xMax(1.1f);
+      const uint4 lcgMul(1664525u);
+      const uint4 lcgAdd(1013904223u);
+      const uint4 mantissa(0x00FFFFFFu);
+      const float4 toUnit(1.f / static_cast<float>(0x01000000u));
+
+      for (int c = 0, g = 0; c < numChannels; c += float4::size, ++g)
+      {
+        // Time to jump to a new random target? (lanes with phase >= 1)
+        const float4 phase = phase_[g] + step_[g];
+        const float4 hold = one > phase;
+        phase_[g] = simd::ifelse(hold, phase, phase - one);
+        if (simd::movemask(hold) != 0xF)
+        {
+          // Rare (at most rate / sampleRate per sample): draw for those lanes
+          rng_[g] = simd::ifelse(hold, rng_[g], rng_[g] * lcgMul + lcgAdd);
+          const float4 fresh = simd::toFloatSigned(rng_[g] & mantissa) * toUnit;
+          target_[g] = simd::ifelse(hold, target_[g], fresh);
+        }
+
+        // Second-order system tracking the target (see RandomLFO)
+        const float4 error = target_[g] - x_[g];
+        v_[g] += (a_[g] * error - b_[g] * v_[g]);
+        x_[g] = simd::clamp(x_[g] + v_[g], xMin, xMax);
+
+        const float4 shaped = bipolar_ ? x_[g] * two - one : simd::clamp(x_[g], zero, one);
+        (shaped * gain_[g]).storePartial(out + c, numChannels - c);
+      }
+    }
 
-      b_ = 2.f * damp * omega;
+    // Render numSamples frames into planar buffers: output[c] receives
+    // numSamples samples of channel c.
+    void processBuffer(float *const *output, size_t numSamples, int numChannels = kMaxChannels)
+    {
+      numChannels = std::max(0, std::min(numChannels, kMaxChannels));
+      float frame[kMaxChannels];
+      for (size_t i = 0; i < numSamples; ++i)
+      {
+        processFrame(frame, numChannels);
+        for (int c = 0; c < numChannels; ++c)
+          output[c][i] = frame[c];
+      }
+    }
+
+  private:
+    float sampleRate_ = 44100.f;
+    bool bipolar_ = true;
+    bool dirty_ = false; // Per-channel coefficients newer than the groups
+
+    // Per-channel settings and derived coefficients (scalar side)
+    float rateHz_[kMaxChannels];
+    float depth_[kMaxChannels];
+    float smooth_[kMaxChannels];
+    float channelStep_[kMaxChannels];
+    float channelA_[kMaxChannels];
+    float channelB_[kMaxChannels];
+    uint32_t seeds_[kMaxChannels]; // Staging for rng_ (seed / seedChannel)
+
+    // Coefficients and state, four channels per register
+    simd::float4 step_[kGroups];
+    simd::float4 a_[kGroups];
+    simd::float4 b_[kGroups];
+    simd::float4 gain_[kGroups]; // Depth
+    simd::float4 phase_[kGroups];
+    simd::float4 target_[kGroups];
+    simd::float4 x_[kGroups];
+    simd::float4 v_[kGroups];
+    simd::uint4 rng_[kGroups];
+
+    DspStats stats_;
+
+    void updateChannel(int c)
+    {
+      channelStep_[c] = detail::randomLfoStep(sampleRate_, rateHz_[c]);
+      detail::randomLfoSpring(sampleRate_, rateHz_[c], smooth_[c], channelA_[c], channelB_[c]);
+      stats_.countCoefficientUpdates();
+    }
+
+    void syncGroups()
+    {
+      for (int g = 0; g < kGroups; ++g)
+      {
+        const int c = g * simd::float4::size;
+        step_[g] = simd::float4::load(channelStep_ + c);
+        a_[g] = simd::float4::load(channelA_ + c);
+        b_[g] = simd::float4::load(channelB_ + c);
+        gain_[g] = simd::float4::load(depth_ + c);
+      }
+      dirty_ = false;
+    }
+
+    void loadSeeds()
+    {
+      for (int g = 0; g < kGroups; ++g)
+        rng_[g] = simd::uint4::load(seeds_ + g * simd::float4::size);
     }
   };
 
@@ -0,0 +1,433 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/*
+ * Portable 4-lane SIMD float type
+ *
+ * Small, header-only wrapper used by the polyphonic DSP paths in this
+ * directory. Four voices are packed into one register so each filter/oscillator
+ * update runs once per group of four channels instead of once per channel.
+ *
+ * Backends (selected at compile time):
+ *  - SSE2 on x86/x86-64
+ *  - NEON on ARM (AArch64 / ARMv7 with NEON)
+ *  - Plain scalar arrays everywhere else
+ *
+ * The DSP headers are intentionally independent of the Rack SDK, so this type
+ * mirrors the small subset of rack::simd::float_4 that the kernels need.
+ *
+ * uint4 holds four 32-bit unsigned lanes for wrapping integer phase
+ * accumulators and random generators (add, low-half multiply, shift, mask,
+ * conversions, masked select).
+ *
+ * Usage:
+ *  using ShortwavDSP::simd::float4;
+ *  float4 x = float4::load(in);      // 4 unaligned floats
+ *  float4 y = x * 0.5f + float4(1.0f);
+ *  y.store(out);
+ */
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#if defined(__SSE4_1__)
+#include <smmintrin.h>
+#endif
+#define SHORTWAV_DSP_SIMD_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define SHORTWAV_DSP_SIMD_NEON 1
+#endif
+
+namespace ShortwavDSP
+{
+  namespace simd
+  {
+
+    struct float4
+    {
+      static constexpr int size = 4;
+
+#if defined(SHORTWAV_DSP_SIMD_SSE2)
+      __m128 v;
+
+      float4() noexcept : v(_mm_setzero_ps()) {}
+      float4(float x) noexcept : v(_mm_set1_ps(x)) {}
+      float4(float a, float b, float c, float d) noexcept : v(_mm_setr_ps(a, b, c, d)) {}
+      explicit float4(__m128 x) noexcept : v(x) {}
+
+      static float4 load(const float *p) noexcept { return float4(_mm_loadu_ps(p)); }
+      void store(float *p) const noexcept { _mm_storeu_ps(p, v); }
+#elif defined(SHORTWAV_DSP_SIMD_NEON)
+      float32x4_t v;
+
+      float4() noexcept : v(vdupq_n_f32(0.0f)) {}
+      float4(float x) noexcept : v(vdupq_n_f32(x)) {}
+      float4(float a, float b, float c, float d) noexcept
+      {
+        const float tmp[4] = {a, b, c, d};
+        v = vld1q_f32(tmp);
+      }
+      explicit float4(float32x4_t x) noexcept : v(x) {}
+
+      static float4 load(const float *p) noexcept { return float4(vld1q_f32(p)); }
+      void store(float *p) const noexcept { vst1q_f32(p, v); }
+#else
+      float v[4];
+
+      float4() noexcept : v{0.0f, 0.0f, 0.0f, 0.0f} {}
+      float4(float x) noexcept : v{x, x, x, x} {}
+      float4(float a, float b, float c, float d) noexcept : v{a, b, c, d} {}
+
+      static float4 load(const float *p) noexcept { return float4(p[0], p[1], p[2], p[3]); }
+      void store(float *p) const noexcept
+      {
+        p[0] = v[0];
+        p[1] = v[1];
+        p[2] = v[2];
+        p[3] = v[3];
+      }
+#endif
+
+      // Load the first n (0..4) lanes from p; remaining lanes are zero.
+      // Never reads past p[n - 1], so it is safe on short channel buffers.
+      static float4 loadPartial(const float *p, int n) noexcept
+      {
+        if (n >= size)
+          return load(p);
+        float tmp[size] = {0.0f, 0.0f, 0.0f, 0.0f};
+        for (int i = 0; i < n; ++i)
+          tmp[i] = p[i];
+        return load(tmp);
+      }
+
+      // Store the first n (0..4) lanes to p.
+      void storePartial(float *p, int n) const noexcept
+      {
+        if (n >= size)
+        {
+          store(p);
+          return;
+        }
+        float tmp[size];
+        store(tmp);
+        for (int i = 0; i < n; ++i)
+          p[i] = tmp[i];
+      }
+
+      // Lane read (slow path, intended for tests and debugging)
+      float operator[](int i) const noexcept
+      {
+        float tmp[size];
+        store(tmp);
+        return tmp[i & 3];
+      }
+    };
+
+    //--------------------------------------------------------------------------
+    // Arithmetic
+    //--------------------------------------------------------------------------
+
+#if defined(SHORTWAV_DSP_SIMD_SSE2)
+    inline float4 operator+(float4 a, float4 b) noexcept { return float4(_mm_add_ps(a.v, b.v)); }
+    inline float4 operator-(float4 a, float4 b) noexcept { return float4(_mm_sub_ps(a.v, b.v)); }
+    inline float4 operator*(float4 a, float4 b) noexcept { return float4(_mm_mul_ps(a.v, b.v)); }
+    inline float4 operator/(float4 a, float4 b) noexcept { return float4(_mm_div_ps(a.v, b.v)); }
+    inline float4 operator-(float4 a) noexcept { return float4(_mm_sub_ps(_mm_setzero_ps(), a.v)); }
+    inline float4 min(float4 a, float4 b) noexcept { return float4(_mm_min_ps(a.v, b.v)); }
+    inline float4 max(float4 a, float4 b) noexcept { return float4(_mm_max_ps(a.v, b.v)); }
+#elif defined(SHORTWAV_DSP_SIMD_NEON)
+    inline float4 operator+(float4 a, float4 b) noexcept { return float4(vaddq_f32(a.v, b.v)); }
+    inline float4 operator-(float4 a, float4 b) noexcept { return float4(vsubq_f32(a.v, b.v)); }
+    inline float4 operator*(float4 a, float4 b) noexcept { return float4(vmulq_f32(a.v, b.v)); }
+    inline float4 operator-(float4 a) noexcept { return float4(vnegq_f32(a.v)); }
+    inline float4 min(float4 a, float4 b) noexcept { return float4(vminq_f32(a.v, b.v)); }
+    inline float4 max(float4 a, float4 b) noexcept { return float4(vmaxq_f32(a.v, b.v)); }
+    inline float4 operator/(float4 a, float4 b) noexcept
+    {
+#if defined(__aarch64__)
+      return float4(vdivq_f32(a.v, b.v));
+#else
+      float ta[4], tb[4];
+      a.store(ta);
+      b.store(tb);
+      return float4(ta[0] / tb[0], ta[1] / tb[1], ta[2] / tb[2], ta[3] / tb[3]);
+#endif
+    }
+#else
+    inline float4 operator+(float4 a, float4 b) noexcept
+    {
+      return float4(a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]);
+    }
+    inline float4 operator-(float4 a, float4 b) noexcept
+    {
+      return float4(a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3]);
+    }
+    inline float4 operator*(float4 a, float4 b) noexcept
+    {
+      return float4(a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]);
+    }
+    inline float4 operator/(float4 a, float4 b) noexcept
+    {
+      return float4(a.v[0] / b.v[0], a.v[1] / b.v[1], a.v[2] / b.v[2], a.v[3] / b.v[3]);
+    }
+    inline float4 operator-(float4 a) noexcept
+    {
+      return float4(-a.v[0], -a.v[1], -a.v[2], -a.v[3]);
+    }
+    inline float4 min(float4 a, float4 b) noexcept
+    {
+      return float4(a.v[0] < b.v[0] ? a.v[0] : b.v[0], a.v[1] < b.v[1] ? a.v[1] : b.v[1],
+                    a.v[2] < b.v[2] ? a.v[2] : b.v[2], a.v[3] < b.v[3] ? a.v[3] : b.v[3]);
+    }
+    inline float4 max(float4 a, float4 b) noexcept
+    {
+      return float4(a.v[0] > b.v[0] ? a.v[0] : b.v[0], a.v[1] > b.v[1] ? a.v[1] : b.v[1],
+                    a.v[2] > b.v[2] ? a.v[2] : b.v[2], a.v[3] > b.v[3] ? a.v[3] : b.v[3]);
+    }
+#endif
+
+    inline float4 &operator+=(float4 &a, float4 b) noexcept { return a = a + b; }
+    inline float4 &operator-=(float4 &a, float4 b) noexcept { return a = a - b; }
+    inline float4 &operator*=(float4 &a, float4 b) noexcept { return a = a * b; }
+    inline float4 &operator/=(float4 &a, float4 b) noexcept { return a = a / b; }
+
+    inline float4 clamp(float4 x, float4 lo, float4 hi) noexcept
+    {
+      return min(max(x, lo), hi);
+    }
+
+    // Sum of the four lanes, as (a0 + a1) + (a2 + a3), for dot products
+    inline float horizontalSum(float4 a) noexcept
+    {
+#if defined(SHORTWAV_DSP_SIMD_SSE2)
+      const __m128 swapped = _mm_shuffle_ps(a.v, a.v, _MM_SHUFFLE(2, 3, 0, 1));
+      const __m128 pairs = _mm_add_ps(a.v, swapped); // [a0+a1, a1+a0, a2+a3, a3+a2]
+      return _mm_cvtss_f32(_mm_add_ss(pairs, _mm_movehl_ps(swapped, pairs)));
+#else
+      float tmp[4];
+      a.store(tmp);
+      return (tmp[0] + tmp[1]) + (tmp[2] + tmp[3]);
+#endif
+    }
+
+    //--------------------------------------------------------------------------
+    // Comparison masks and selection
+    //--------------------------------------------------------------------------
+    //
+    // Comparisons return a float4 whose lanes are all-ones (true) or zero;
+    // ifelse() picks per lane, like rack::simd::ifelse, and movemask() packs
+    // the lanes into bits for whole-register branches.
+
+#if defined(SHORTWAV_DSP_SIMD_SSE2)
+    inline float4 operator>(float4 a, float4 b) noexcept { return float4(_mm_cmpgt_ps(a.v, b.v)); }
+    inline float4 ifelse(float4 mask, float4 a, float4 b) noexcept
+    {
+      return float4(_mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v)));
+    }
+    // One bit per lane (lane 0 = bit 0), set where the mask lane is true
+    inline int movemask(float4 mask) noexcept { return _mm_movemask_ps(mask.v); }
+#elif defined(SHORTWAV_DSP_SIMD_NEON)
+    inline float4 operator>(float4 a, float4 b) noexcept { return float4(vreinterpretq_f32_u32(vcgtq_f32(a.v, b.v))); }
+    inline float4 ifelse(float4 mask, float4 a, float4 b) noexcept
+    {
+      return float4(vbslq_f32(vreinterpretq_u32_f32(mask.v), a.v, b.v));
+    }
+    inline int movemask(float4 mask) noexcept
+    {
+      const uint32x4_t bits = vshrq_n_u32(vreinterpretq_u32_f32(mask.v), 31);
+      return static_cast<int>(vgetq_lane_u32(bits, 0) | (vgetq_lane_u32(bits, 1) << 1) |
+                              (vgetq_lane_u32(bits, 2) << 2) | (vgetq_lane_u32(bits, 3) << 3));
+    }
+#else
+    inline float4 operator>(float4 a, float4 b) noexcept
+    {
+      float4 r;
+      for (int i = 0; i < 4; ++i)
+      {
+        const uint32_t bits = (a.v[i] > b.v[i]) ? 0xFFFFFFFFu : 0u;
+        std::memcpy(&r.v[i], &bits, sizeof(bits));
+      }
+      return r;
+    }
+    inline float4 ifelse(float4 mask, float4 a, float4 b) noexcept
+    {
+      float4 r;
+      for (int i = 0; i < 4; ++i)
+      {
+        uint32_t m;
+        std::memcpy(&m, &mask.v[i], sizeof(m));
+        r.v[i] = m ? a.v[i] : b.v[i];
+      }
+      return r;
+    }
+    inline int movemask(float4 mask) noexcept
+    {
+      int bits = 0;
+      for (int i = 0; i < 4; ++i)
+      {
+        uint32_t m;
+        std::memcpy(&m, &mask.v[i], sizeof(m));
+        bits |= static_cast<int>(m >> 31) << i;
+      }
+      return bits;
+    }
+#endif
+
+    //--------------------------------------------------------------------------
+    // uint4 - four wrapping 32-bit unsigned lanes
+    //--------------------------------------------------------------------------
+
+    struct uint4
+    {
+      static constexpr int size = 4;
+
+#if defined(SHORTWAV_DSP_SIMD_SSE2)
+      __m128i v;
+
+      uint4() noexcept : v(_mm_setzero_si128()) {}
+      uint4(uint32_t x) noexcept : v(_mm_set1_epi32(static_cast<int>(x))) {}
+      explicit uint4(__m128i x) noexcept : v(x) {}
+
+      static uint4 load(const uint32_t *p) noexcept { return uint4(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p))); }
+      void store(uint32_t *p) const noexcept { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v); }
+#elif defined(SHORTWAV_DSP_SIMD_NEON)
+      uint32x4_t v;
+
+      uint4() noexcept : v(vdupq_n_u32(0)) {}
+      uint4(uint32_t x) noexcept : v(vdupq_n_u32(x)) {}
+      explicit uint4(uint32x4_t x) noexcept : v(x) {}
+
+      static uint4 load(const uint32_t *p) noexcept { return uint4(vld1q_u32(p)); }
+      void store(uint32_t *p) const noexcept { vst1q_u32(p, v); }
+#else
+      uint32_t v[4];
+
+      uint4() noexcept : v{0, 0, 0, 0} {}
+      uint4(uint32_t x) noexcept : v{x, x, x, x} {}
+
+      static uint4 load(const uint32_t *p) noexcept
+      {
+        uint4 r;
+        for (int i = 0; i < 4; ++i)
+          r.v[i] = p[i];
+        return r;
+      }
+      void store(uint32_t *p) const noexcept
+      {
+        for (int i = 0; i < 4; ++i)
+          p[i] = v[i];
+      }
+#endif
+
+      // Lane read (slow path, intended for tests and debugging)
+      uint32_t operator[](int i) const noexcept
+      {
+        uint32_t tmp[size];
+        store(tmp);
+        return tmp[i & 3];
+      }
+    };
+
+#if defined(SHORTWAV_DSP_SIMD_SSE2)
+    inline uint4 operator+(uint4 a, uint4 b) noexcept { return uint4(_mm_add_epi32(a.v, b.v)); }
+    inline uint4 operator&(uint4 a, uint4 b) noexcept { return uint4(_mm_and_si128(a.v, b.v)); }
+    inline uint4 operator>>(uint4 a, int n) noexcept { return uint4(_mm_srli_epi32(a.v, n)); }
+    inline uint4 operator*(uint4 a, uint4 b) noexcept
+    {
+#if defined(__SSE4_1__)
+      return uint4(_mm_mullo_epi32(a.v, b.v));
+#else
+      // Low 32 bits of each product from two 32x32->64 multiplies (lanes 0/2 and 1/3)
+      const __m128i even = _mm_mul_epu32(a.v, b.v);
+      const __m128i odd = _mm_mul_epu32(_mm_srli_si128(a.v, 4), _mm_srli_si128(b.v, 4));
+      return uint4(_mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                                      _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0))));
+#endif
+    }
+    // Lanes reinterpreted as int32 and converted to float
+    inline float4 toFloatSigned(uint4 a) noexcept { return float4(_mm_cvtepi32_ps(a.v)); }
+    // Truncate non-negative floats below 2^31 to integers
+    inline uint4 truncateToUint(float4 a) noexcept { return uint4(_mm_cvttps_epi32(a.v)); }
+#elif defined(SHORTWAV_DSP_SIMD_NEON)
+    inline uint4 operator+(uint4 a, uint4 b) noexcept { return uint4(vaddq_u32(a.v, b.v)); }
+    inline uint4 operator&(uint4 a, uint4 b) noexcept { return uint4(vandq_u32(a.v, b.v)); }
+    inline uint4 operator>>(uint4 a, int n) noexcept { return uint4(vshlq_u32(a.v, vdupq_n_s32(-n))); }
+    inline uint4 operator*(uint4 a, uint4 b) noexcept { return uint4(vmulq_u32(a.v, b.v)); }
+    inline float4 toFloatSigned(uint4 a) noexcept { return float4(vcvtq_f32_s32(vreinterpretq_s32_u32(a.v))); }
+    inline uint4 truncateToUint(float4 a) noexcept { return uint4(vcvtq_u32_f32(a.v)); }
+#else
+    inline uint4 operator+(uint4 a, uint4 b) noexcept
+    {
+      uint4 r;
+      for (int i = 0; i < 4; ++i)
+        r.v[i] = a.v[i] + b.v[i];
+      return r;
+    }
+    inline uint4 operator&(uint4 a, uint4 b) noexcept
+    {
+      uint4 r;
+      for (int i = 0; i < 4; ++i)
+        r.v[i] = a.v[i] & b.v[i];
+      return r;
+    }
+    inline uint4 operator>>(uint4 a, int n) noexcept
+    {
+      uint4 r;
+      for (int i = 0; i < 4; ++i)
+        r.v[i] = a.v[i] >> n;
+      return r;
+    }
+    inline uint4 operator*(uint4 a, uint4 b) noexcept
+    {
+      uint4 r;
+      for (int i = 0; i < 4; ++i)
+        r.v[i] = a.v[i] * b.v[i];
+      return r;
+    }
+    inline float4 toFloatSigned(uint4 a) noexcept
+    {
+      return float4(static_cast<float>(static_cast<int32_t>(a.v[0])), static_cast<float>(static_cast<int32_t>(a.v[1])),
+                    static_cast<float>(static_cast<int32_t>(a.v[2])), static_cast<float>(static_cast<int32_t>(a.v[3])));
+    }
+    inline uint4 truncateToUint(float4 a) noexcept
+    {
+      uint4 r;
+      for (int i = 0; i < 4; ++i)
+        r.v[i] = static_cast<uint32_t>(a.v[i]);
+      return r;
+    }
+#endif
+
+    inline uint4 &operator+=(uint4 &a, uint4 b) noexcept { return a = a + b; }
+
+    // Per-lane select of integer lanes by a float4 comparison mask
+#if defined(SHORTWAV_DSP_SIMD_SSE2)
+    inline uint4 ifelse(float4 mask, uint4 a, uint4 b) noexcept
+    {
+      const __m128i m = _mm_castps_si128(mask.v);
+      return uint4(_mm_or_si128(_mm_and_si128(m, a.v), _mm_andnot_si128(m, b.v)));
+    }
+#elif defined(SHORTWAV_DSP_SIMD_NEON)
+    inline uint4 ifelse(float4 mask, uint4 a, uint4 b) noexcept
+    {
+      return uint4(vbslq_u32(vreinterpretq_u32_f32(mask.v), a.v, b.v));
+    }
+#else
+    inline uint4 ifelse(float4 mask, uint4 a, uint4 b) noexcept
+    {
+      uint4 r;
+      for (int i = 0; i < 4; ++i)
+      {
+        uint32_t m;
+        std::memcpy(&m, &mask.v[i], sizeof(m));
+        r.v[i] = m ? a.v[i] : b.v[i];
+      }
+      return r;
+    }
+#endif
+
+  } // namespace simd
+} // namespace ShortwavDSP
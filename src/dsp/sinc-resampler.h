@@ -0,0 +1,176 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+/*
+ * Windowed-sinc sample rate conversion for whole buffers
+ *
+ * Converts interleaved float audio between two arbitrary rates with a
+ * Kaiser-windowed sinc of kZeroCrossings zero crossings per side. The kernel
+ * is tabulated once at kResolution points per zero crossing and linearly
+ * interpolated between table points, which is the usual polyphase scheme
+ * with a continuous phase.
+ *
+ * Downsampling lowers the cutoff to kPassband of the output Nyquist and
+ * stretches the kernel by the same factor, so content that would alias is
+ * removed (about 80 dB stopband with the default window) instead of folded.
+ * Upsampling uses the kernel unchanged at kPassband of the input Nyquist.
+ *
+ * Offline use only (loader threads): cost is about 2 * kZeroCrossings /
+ * min(1, outRate / inRate) multiply-adds per output sample and channel.
+ *
+ * Usage:
+ *  std::vector<float> out;
+ *  bool ok = resampleSinc(in, numFrames, numChannels, 96000.0, 44100.0, out);
+ */
+
+namespace ShortwavDSP
+{
+
+  namespace detail
+  {
+    // Zeroth-order modified Bessel function of the first kind (power series)
+    inline double besselI0(double x) noexcept
+    {
+      const double q = 0.25 * x * x;
+      double term = 1.0;
+      double sum = 1.0;
+      for (int k = 1; k < 64 && term > sum * 1e-17; ++k)
+      {
+        term *= q / (static_cast<double>(k) * k);
+        sum += term;
+      }
+      return sum;
+    }
+  } // namespace detail
+
+  class SincKernel
+  {
+  public:
+    static constexpr int kZeroCrossings = 16;
+    static constexpr int kResolution = 512;
+    static constexpr double kBeta = 9.0;    // Kaiser window shape (~80 dB stopband)
+    static constexpr double kPassband = 0.95; // Cutoff as a fraction of Nyquist
+
+    SincKernel()
+    {
+      constexpr double kPi = 3.14159265358979323846;
+      const int size = kZeroCrossings * kResolution;
+      table_.resize(size + 2, 0.0f); // Zero guard points for the interpolation
+      const double norm = 1.0 / detail::besselI0(kBeta);
+      for (int i = 0; i <= size; ++i)
+      {
+        const double x = static_cast<double>(i) / kResolution;
+        const double r = x / kZeroCrossings;
+        const double sinc = (i == 0) ? 1.0 : std::sin(kPi * x) / (kPi * x);
+        const double window = detail::besselI0(kBeta * std::sqrt(std::max(0.0, 1.0 - r * r))) * norm;
+        table_[i] = static_cast<float>(sinc * window);
+      }
+    }
+
+    /// Kernel value at x zero crossings from the centre (0 outside the window).
+    float operator()(double x) const noexcept
+    {
+      const double a = std::fabs(x) * kResolution;
+      if (!(a < static_cast<double>(kZeroCrossings * kResolution)))
+        return 0.0f;
+      const size_t i = static_cast<size_t>(a);
+      const float frac = static_cast<float>(a - static_cast<double>(i));
+      return table_[i] + frac * (table_[i + 1] - table_[i]);
+    }
+
+    /// Shared immutable instance (built on first use, thread-safe).
+    static const SincKernel &shared()
+    {
+      static const SincKernel kernel;
+      return kernel;
+    }
+
+  private:
+    std::vector<float> table_;
+  };
+
+  /// Output frames between calls to a resampleSinc() progress callback.
+  static constexpr size_t kResampleProgressFrames = 4096;
+
+  /// Convert numFrames interleaved frames from inRate to outRate into out
+  /// (resized to ceil(numFrames * outRate / inRate) frames). Samples outside
+  /// the input are treated as silence. progress(fraction) is called every
+  /// kResampleProgressFrames output frames; returning false abandons the
+  /// conversion.
+  /// @return false if allocation failed or progress cancelled (out is left empty)
+  template <typename Progress>
+  bool resampleSinc(const float *in, size_t numFrames, uint16_t numChannels,
+                    double inRate, double outRate, std::vector<float> &out, Progress &&progress)
+  {
+    out.clear();
+    if (numFrames == 0 || numChannels == 0 || !(inRate > 0.0) || !(outRate > 0.0))
+      return true;
+
+    const double ratio = outRate / inRate;
+    const double step = inRate / outRate;
+    const double cutoff = std::min(1.0, ratio) * SincKernel::kPassband;
+    const double halfWidth = SincKernel::kZeroCrossings / cutoff;
+    const size_t outFrames = static_cast<size_t>(std::ceil(static_cast<double>(numFrames) * ratio));
+    const SincKernel &kernel = SincKernel::shared();
+
+    std::vector<float> weights;
+    try
+    {
+      out.resize(outFrames * numChannels);
+      weights.resize(static_cast<size_t>(2.0 * halfWidth) + 2);
+    }
+    catch (const std::bad_alloc &)
+    {
+      out.clear();
+      out.shrink_to_fit();
+      return false;
+    }
+
+    const float gain = static_cast<float>(cutoff);
+    const std::ptrdiff_t last = static_cast<std::ptrdiff_t>(numFrames) - 1;
+    for (size_t m = 0; m < outFrames; ++m)
+    {
+      if (m % kResampleProgressFrames == 0 &&
+          !progress(static_cast<float>(m) / static_cast<float>(outFrames)))
+      {
+        out.clear();
+        out.shrink_to_fit();
+        return false;
+      }
+
+      const double t = static_cast<double>(m) * step;
+      const std::ptrdiff_t first = std::max<std::ptrdiff_t>(0, static_cast<std::ptrdiff_t>(std::ceil(t - halfWidth)));
+      const std::ptrdiff_t end = std::min<std::ptrdiff_t>(last, static_cast<std::ptrdiff_t>(std::floor(t + halfWidth)));
+
+      // The taps are shared by all channels of the frame
+      const size_t taps = end >= first ? static_cast<size_t>(end - first + 1) : 0;
+      for (size_t k = 0; k < taps; ++k)
+        weights[k] = gain * kernel((t - static_cast<double>(first + static_cast<std::ptrdiff_t>(k))) * cutoff);
+
+      for (uint16_t c = 0; c < numChannels; ++c)
+      {
+        const float *src = in + static_cast<size_t>(first) * numChannels + c;
+        float acc = 0.0f;
+        for (size_t k = 0; k < taps; ++k)
+          acc += weights[k] * src[k * numChannels];
+        out[m * numChannels + c] = acc;
+      }
+    }
+    return true;
+  }
+
+  /// resampleSinc() without progress reporting.
+  /// @return false if allocation failed (out is left empty)
+  inline bool resampleSinc(const float *in, size_t numFrames, uint16_t numChannels,
+                           double inRate, double outRate, std::vector<float> &out)
+  {
+    return resampleSinc(in, numFrames, numChannels, inRate, outRate, out, [](float) { return true; });
+  }
+
+} // namespace ShortwavDSP
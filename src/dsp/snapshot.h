@@ -0,0 +1,109 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/*
+ * SnapshotPublisher - lock-free hand-off of immutable data to the audio thread
+ *
+ * Non-audio threads build a new T completely, then publish() it with one
+ * atomic pointer swap. The audio thread picks up the latest snapshot with
+ * acquire(), which never locks or allocates; the pointer stays valid until
+ * its next acquire() call. Replaced snapshots are retired and freed by later
+ * publish() or collect() calls (never on the audio thread) once the audio
+ * thread has moved past them.
+ *
+ * This is the buffer publication scheme of WavPlayer (one hazard pointer for
+ * the single audio-thread reader), for small tables such as slice lists.
+ *
+ * Usage:
+ *  SnapshotPublisher<Table> table;
+ *  table.publish(std::make_shared<Table>(...));  // UI/loader thread
+ *  const Table* t = table.acquire();             // audio thread, per block
+ *  std::shared_ptr<const Table> s = table.get(); // other readers
+ *  table.collect();                              // UI thread, e.g. per frame
+ *
+ * Threading: any number of publishing/get() threads, one acquire() thread.
+ */
+
+namespace ShortwavDSP
+{
+
+  template <typename T>
+  class SnapshotPublisher
+  {
+  public:
+    SnapshotPublisher() = default;
+    SnapshotPublisher(const SnapshotPublisher &) = delete;
+    SnapshotPublisher &operator=(const SnapshotPublisher &) = delete;
+
+    /// Replace the published snapshot (non-audio threads; may be null).
+    void publish(std::shared_ptr<const T> snapshot)
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      published_.store(snapshot.get(), std::memory_order_seq_cst);
+      if (current_)
+        retired_.push_back(std::move(current_));
+      current_ = std::move(snapshot);
+      reclaim();
+    }
+
+    /// Shared reference to the published snapshot, for non-audio readers.
+    std::shared_ptr<const T> get() const
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return current_;
+    }
+
+    /// Latest snapshot for the audio thread (null before the first publish).
+    /// A single atomic load when nothing changed. On a change the hazard
+    /// pointer is set first and re-validated against the published pointer,
+    /// so a concurrent reclaim either sees the hazard or the old snapshot is
+    /// never dereferenced again.
+    const T *acquire() noexcept
+    {
+      const T *latest = published_.load(std::memory_order_acquire);
+      if (latest != active_)
+      {
+        do
+        {
+          active_ = latest;
+          hazard_.store(active_, std::memory_order_seq_cst);
+          latest = published_.load(std::memory_order_seq_cst);
+        } while (latest != active_);
+      }
+      return active_;
+    }
+
+    /// Free retired snapshots the audio thread no longer uses.
+    /// @return Number of snapshots still waiting for the audio thread
+    size_t collect()
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return reclaim();
+    }
+
+  private:
+    // Caller holds mutex_
+    size_t reclaim() noexcept
+    {
+      const T *inUse = hazard_.load(std::memory_order_seq_cst);
+      retired_.erase(std::remove_if(retired_.begin(), retired_.end(),
+                                    [inUse](const std::shared_ptr<const T> &s) { return s.get() != inUse; }),
+                     retired_.end());
+      return retired_.size();
+    }
+
+    std::shared_ptr<const T> current_;
+    std::vector<std::shared_ptr<const T>> retired_;
+    std::atomic<const T *> published_{nullptr};
+    std::atomic<const T *> hazard_{nullptr};
+    const T *active_ = nullptr; // Audio thread only
+    mutable std::mutex mutex_;
+  };
+
+} // namespace ShortwavDSP
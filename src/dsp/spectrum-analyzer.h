@@ -0,0 +1,387 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "snapshot.h"
+
+/*
+ * BandAnalyzer - audio-to-GUI band levels and spectrum
+ *
+ * The audio thread push()es one frame of band outputs (low, mid, high) per
+ * sample into a lock-free single-producer/single-consumer ring. A frame that
+ * does not fit is dropped (getDroppedFrames()), never waited for.
+ *
+ * A worker thread calls update(), which drains the ring and, every kHop new
+ * frames, computes
+ *  - the spectrum of the band sum (the EQ output): a kFftSize-point
+ *    Hann-windowed FFT reduced to numPoints log-spaced display points (the
+ *    loudest bin per point, a full-scale sine reads 0 dB; points narrower
+ *    than a bin interpolate between bins)
+ *  - per-band peak, held peak and RMS over the hop, in dB
+ * and publishes them as one immutable Analysis snapshot. The GUI thread only
+ * get()s the latest snapshot; it has new work only when the sequence number
+ * changes, and then O(numPoints) of it.
+ *
+ * Usage:
+ *  BandAnalyzer analyzer(20.f, 20000.f, 200);
+ *  analyzer.setSampleRate(sr);  // any thread
+ *  analyzer.push(bands);        // audio thread, float[3] per frame
+ *  analyzer.update();           // worker thread, e.g. every 10 ms
+ *  std::shared_ptr<const BandAnalyzer::Analysis> a = analyzer.get(); // GUI
+ */
+
+namespace ShortwavDSP
+{
+
+  //------------------------------------------------------------------------------
+  // Fft - in-place radix-2 complex FFT (non-audio threads)
+  //------------------------------------------------------------------------------
+
+  class Fft
+  {
+  public:
+    /// size must be a power of two
+    explicit Fft(size_t size) : size_(size), reversed_(size), twiddles_(size / 2)
+    {
+      int bits = 0;
+      while ((size_t(1) << bits) < size_)
+        ++bits;
+      for (size_t i = 0; i < size_; ++i)
+      {
+        size_t r = 0;
+        for (int b = 0; b < bits; ++b)
+          r |= ((i >> b) & 1u) << (bits - 1 - b);
+        reversed_[i] = static_cast<uint32_t>(r);
+      }
+      const double kPi = 3.14159265358979323846;
+      for (size_t k = 0; k < size_ / 2; ++k)
+      {
+        const double phase = -2.0 * kPi * static_cast<double>(k) / static_cast<double>(size_);
+        twiddles_[k] = std::complex<float>(static_cast<float>(std::cos(phase)), static_cast<float>(std::sin(phase)));
+      }
+    }
+
+    size_t size() const noexcept { return size_; }
+
+    /// X[k] = sum x[n] exp(-2 pi i k n / size), in place
+    void forward(std::complex<float> *data) const noexcept
+    {
+      for (size_t i = 0; i < size_; ++i)
+      {
+        if (i < reversed_[i])
+          std::swap(data[i], data[reversed_[i]]);
+      }
+      for (size_t len = 2; len <= size_; len <<= 1)
+      {
+        const size_t half = len / 2;
+        const size_t step = size_ / len;
+        for (size_t i = 0; i < size_; i += len)
+        {
+          for (size_t k = 0; k < half; ++k)
+          {
+            const std::complex<float> u = data[i + k];
+            const std::complex<float> v = data[i + k + half] * twiddles_[k * step];
+            data[i + k] = u + v;
+            data[i + k + half] = u - v;
+          }
+        }
+      }
+    }
+
+  private:
+    size_t size_;
+    std::vector<uint32_t> reversed_;
+    std::vector<std::complex<float>> twiddles_; // exp(-2 pi i k / size), k < size / 2
+  };
+
+  //------------------------------------------------------------------------------
+  // FrameRing - lock-free SPSC ring of fixed-width float frames
+  //------------------------------------------------------------------------------
+
+  template <size_t Width>
+  class FrameRing
+  {
+  public:
+    /// Capacity is minFrames rounded up to a power of two (allocated here)
+    explicit FrameRing(size_t minFrames)
+    {
+      capacity_ = 1;
+      while (capacity_ < minFrames)
+        capacity_ <<= 1;
+      data_.assign(capacity_ * Width, 0.0f);
+    }
+
+    FrameRing(const FrameRing &) = delete;
+    FrameRing &operator=(const FrameRing &) = delete;
+
+    size_t capacity() const noexcept { return capacity_; }
+
+    /// Producer: append one frame (Width floats). @return false if full
+    bool push(const float *frame) noexcept
+    {
+      const size_t write = write_.load(std::memory_order_relaxed);
+      if (write - read_.load(std::memory_order_acquire) >= capacity_)
+        return false;
+      std::copy(frame, frame + Width, &data_[(write & (capacity_ - 1)) * Width]);
+      write_.store(write + 1, std::memory_order_release);
+      return true;
+    }
+
+    /// Consumer: move up to maxFrames frames to out. @return frames moved
+    size_t pop(float *out, size_t maxFrames) noexcept
+    {
+      const size_t read = read_.load(std::memory_order_relaxed);
+      const size_t available = write_.load(std::memory_order_acquire) - read;
+      const size_t count = available < maxFrames ? available : maxFrames;
+      for (size_t i = 0; i < count; ++i)
+      {
+        const float *frame = &data_[((read + i) & (capacity_ - 1)) * Width];
+        std::copy(frame, frame + Width, out + i * Width);
+      }
+      read_.store(read + count, std::memory_order_release);
+      return count;
+    }
+
+  private:
+    std::vector<float> data_;
+    size_t capacity_;
+    std::atomic<size_t> write_{0};
+    std::atomic<size_t> read_{0};
+  };
+
+  //------------------------------------------------------------------------------
+  // BandAnalyzer
+  //------------------------------------------------------------------------------
+
+  class BandAnalyzer
+  {
+  public:
+    static constexpr int kBands = 3;
+    static constexpr size_t kFftSize = 4096;
+    static constexpr size_t kHop = 1024;
+    static constexpr float kFloorDB = -120.0f;
+    static constexpr float kPeakHoldSeconds = 1.5f;
+    static constexpr float kFallDB = 3.0f; // Spectrum release per hop
+
+    struct Analysis
+    {
+      uint64_t sequence = 0;
+      float sampleRate = 0.0f;
+      std::vector<float> spectrumDB; // Display points, log-spaced minFreq..maxFreq
+      float peakDB[kBands];          // Band peaks over the last hop
+      float holdDB[kBands];          // Peaks held for kPeakHoldSeconds
+      float rmsDB[kBands];           // Band RMS over the last hop
+    };
+
+    BandAnalyzer(float minFreq, float maxFreq, int numPoints)
+        : ring_(4 * kFftSize), fft_(kFftSize), minFreq_(minFreq), maxFreq_(maxFreq),
+          numPoints_(std::max(2, numPoints)), history_(kFftSize, 0.0f), window_(kFftSize),
+          spectrum_(kFftSize), chunk_(kHop * kBands), smoothedDB_(numPoints_, kFloorDB)
+    {
+      const double kPi = 3.14159265358979323846;
+      for (size_t i = 0; i < kFftSize; ++i)
+        window_[i] = static_cast<float>(0.5 - 0.5 * std::cos(2.0 * kPi * static_cast<double>(i) / kFftSize));
+      for (int b = 0; b < kBands; ++b)
+      {
+        holdDB_[b] = kFloorDB;
+        holdFrames_[b] = 0;
+      }
+      resetHop();
+    }
+
+    BandAnalyzer(const BandAnalyzer &) = delete;
+    BandAnalyzer &operator=(const BandAnalyzer &) = delete;
+
+    /// Rate of the pushed frames (any thread; picked up at the next analysis)
+    void setSampleRate(float sampleRate) noexcept
+    {
+      sampleRate_.store(std::max(1.0f, sampleRate), std::memory_order_relaxed);
+    }
+
+    /// Audio thread: one frame of kBands band samples. Never blocks; a full
+    /// ring (no update() for ~4 FFT lengths) drops the frame.
+    bool push(const float *bands) noexcept
+    {
+      if (ring_.push(bands))
+        return true;
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+
+    uint64_t getDroppedFrames() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+
+    /// Worker thread: drain the ring; publishes one Analysis per kHop frames.
+    /// @return true if a new Analysis was published
+    bool update()
+    {
+      bool published = false;
+      size_t count;
+      while ((count = ring_.pop(chunk_.data(), kHop)) > 0)
+      {
+        for (size_t i = 0; i < count; ++i)
+        {
+          const float *frame = &chunk_[i * kBands];
+          float sum = 0.0f;
+          for (int b = 0; b < kBands; ++b)
+          {
+            const float x = frame[b];
+            sum += x;
+            hopPeak_[b] = std::max(hopPeak_[b], std::fabs(x));
+            hopSquares_[b] += static_cast<double>(x) * x;
+          }
+          history_[historyPos_] = sum;
+          historyPos_ = (historyPos_ + 1) & (kFftSize - 1);
+          if (++hopFrames_ == kHop)
+          {
+            analyze();
+            published = true;
+          }
+        }
+      }
+      return published;
+    }
+
+    /// Latest analysis (null before the first one)
+    std::shared_ptr<const Analysis> get() const { return published_.get(); }
+
+    int getNumPoints() const noexcept { return numPoints_; }
+
+    /// Frequency of display point i
+    float pointFrequency(int i) const noexcept
+    {
+      const float t = static_cast<float>(i) / static_cast<float>(numPoints_ - 1);
+      return minFreq_ * std::pow(maxFreq_ / minFreq_, t);
+    }
+
+  private:
+    // Bins covered by one display point; first > last means interpolate at bin
+    struct PointBins
+    {
+      int first;
+      int last;
+      float bin;
+    };
+
+    void resetHop() noexcept
+    {
+      hopFrames_ = 0;
+      for (int b = 0; b < kBands; ++b)
+      {
+        hopPeak_[b] = 0.0f;
+        hopSquares_[b] = 0.0;
+      }
+    }
+
+    void mapPoints(float sampleRate)
+    {
+      pointsRate_ = sampleRate;
+      points_.resize(numPoints_);
+      const float binsPerHz = static_cast<float>(kFftSize) / sampleRate;
+      const int maxBin = static_cast<int>(kFftSize / 2);
+      const float ratio = std::pow(maxFreq_ / minFreq_, 0.5f / static_cast<float>(numPoints_ - 1));
+      for (int i = 0; i < numPoints_; ++i)
+      {
+        const float f = pointFrequency(i);
+        PointBins &p = points_[i];
+        p.bin = f * binsPerHz;
+        p.first = std::max(1, static_cast<int>(std::ceil(f / ratio * binsPerHz)));
+        p.last = std::min(maxBin, static_cast<int>(std::floor(f * ratio * binsPerHz)));
+      }
+    }
+
+    static float toDB(float amplitude) noexcept
+    {
+      return amplitude > 1e-6f ? 20.0f * std::log10(amplitude) : kFloorDB;
+    }
+
+    void analyze()
+    {
+      const float sampleRate = sampleRate_.load(std::memory_order_relaxed);
+      if (sampleRate != pointsRate_)
+        mapPoints(sampleRate);
+
+      // Oldest sample first
+      for (size_t i = 0; i < kFftSize; ++i)
+        spectrum_[i] = std::complex<float>(window_[i] * history_[(historyPos_ + i) & (kFftSize - 1)], 0.0f);
+      fft_.forward(spectrum_.data());
+
+      // Hann window sum is kFftSize / 2: a full-scale sine has |X| = kFftSize / 4
+      const float scale = 4.0f / static_cast<float>(kFftSize);
+      const size_t nyquist = kFftSize / 2;
+      auto magnitude = [this, scale](size_t k) { return std::abs(spectrum_[k]) * scale; };
+
+      std::shared_ptr<Analysis> a = std::make_shared<Analysis>();
+      a->sequence = ++sequence_;
+      a->sampleRate = sampleRate;
+      a->spectrumDB.resize(numPoints_);
+      for (int i = 0; i < numPoints_; ++i)
+      {
+        const PointBins &p = points_[i];
+        float level = 0.0f;
+        if (p.first <= p.last)
+        {
+          for (int k = p.first; k <= p.last; ++k)
+            level = std::max(level, magnitude(static_cast<size_t>(k)));
+        }
+        else if (p.bin < static_cast<float>(nyquist))
+        {
+          const size_t k = static_cast<size_t>(p.bin);
+          const float frac = p.bin - static_cast<float>(k);
+          level = magnitude(k) + frac * (magnitude(std::min(k + 1, nyquist)) - magnitude(k));
+        }
+        smoothedDB_[i] = std::max(toDB(level), smoothedDB_[i] - kFallDB);
+        a->spectrumDB[i] = smoothedDB_[i];
+      }
+
+      const int holdFrames = static_cast<int>(kPeakHoldSeconds * sampleRate);
+      for (int b = 0; b < kBands; ++b)
+      {
+        const float peak = toDB(hopPeak_[b]);
+        holdFrames_[b] -= static_cast<int>(kHop);
+        if (peak >= holdDB_[b] || holdFrames_[b] <= 0)
+        {
+          holdDB_[b] = peak;
+          holdFrames_[b] = holdFrames;
+        }
+        a->peakDB[b] = peak;
+        a->holdDB[b] = holdDB_[b];
+        a->rmsDB[b] = toDB(static_cast<float>(std::sqrt(hopSquares_[b] / static_cast<double>(kHop))));
+      }
+      resetHop();
+      published_.publish(std::move(a));
+    }
+
+    FrameRing<kBands> ring_;
+    std::atomic<float> sampleRate_{44100.0f};
+    std::atomic<uint64_t> dropped_{0};
+    SnapshotPublisher<Analysis> published_;
+
+    // Worker thread state
+    Fft fft_;
+    float minFreq_;
+    float maxFreq_;
+    int numPoints_;
+    float pointsRate_ = 0.0f;
+    std::vector<PointBins> points_;
+    std::vector<float> history_; // Last kFftSize band sums (circular)
+    size_t historyPos_ = 0;      // Oldest sample
+    std::vector<float> window_;
+    std::vector<std::complex<float>> spectrum_;
+    std::vector<float> chunk_;
+    std::vector<float> smoothedDB_;
+    size_t hopFrames_ = 0;
+    float hopPeak_[kBands];
+    double hopSquares_[kBands];
+    float holdDB_[kBands];
+    int holdFrames_[kBands];
+    uint64_t sequence_ = 0;
+  };
+
+} // namespace ShortwavDSP
@@ -12,6 +12,31 @@
 #include <string>
 #include <vector>
 
+#include "instrumentation.h"
+#include "onset-detector.h"
+#include "peak-pyramid.h"
+#include "sinc-interpolator.h"
+#include "sinc-resampler.h"
+#include "simd.h"
+#include "worker-pool.h"
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#define SHORTWAV_DSP_HAS_MMAP 1
+#elif defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define SHORTWAV_DSP_HAS_MMAP 1
+#endif
+
 /*
  * WAV File Player with Pitch/Speed Control
  *
@@ -21,6 +46,8 @@
  * - Independent pitch and speed manipulation via high-quality resampling
  * - Full audio reversal capabilities
  * - Memory-efficient streaming for large files
+ * - Optional memory-mapped storage (zero-copy, lazy sample conversion)
+ * - Optional windowed-sinc conversion of resident files to the engine rate
  * - Thread-safe methods for concurrent playback
  *
  * Design principles:
@@ -45,14 +72,25 @@
  *   // or for buffers:
  *   player.processBuffer(output, numSamples);
  *
+ * Storage modes:
+ *   player.loadFile(path);                                 // Resident: decode to float
+ *   player.loadFile(path, WavStorageMode::MemoryMapped);   // Map file, convert on read
+ *   player.loadFile(path, WavStorageMode::Streaming);      // Disk streaming, then call
+ *   player.serviceStream();                                // ...periodically off the audio thread
+ *
  * Threading:
  * - loadFile() / unload() are blocking and should be called from a non-audio thread
+ * - A load builds an immutable SampleBuffer off-thread and publishes it with one
+ *   atomic pointer swap; playback does not need to be stopped first
+ * - Replaced buffers are freed by later loads, serviceStream() or collectRetired(),
+ *   never on the audio thread
  * - All playback control methods (play/pause/stop/seek) are thread-safe
  * - Parameter setters are thread-safe (use atomic operations)
  * - processSample/processBuffer are lock-free and real-time safe
  *
  * Algorithm References:
  * - Cubic interpolation: https://www.musicdsp.org/en/latest/Other/49-cubic-interpollation.html
+ * - Windowed-sinc interpolation: J. O. Smith, "Digital Audio Resampling" (bandlimited interpolation)
  * - Time-stretching concepts from phase vocoder literature
  */
 
@@ -185,229 +223,238 @@ namespace ShortwavDSP
       return y0 + t * (y1 - y0);
     }
 
-  } // namespace detail
-
-  //------------------------------------------------------------------------------
-  // Interpolation quality settings
-  //------------------------------------------------------------------------------
-
-  enum class InterpolationQuality
-  {
-    None,    ///< Nearest-neighbor (lowest quality, fastest)
-    Linear,  ///< Linear interpolation (good balance)
-    Cubic    ///< Cubic/Hermite interpolation (highest quality)
-  };
-
-  //------------------------------------------------------------------------------
-  // Playback state
-  //------------------------------------------------------------------------------
-
-  enum class PlaybackState
-  {
-    Stopped,
-    Playing,
-    Paused
-  };
-
-  //------------------------------------------------------------------------------
-  // Loop mode settings
-  //------------------------------------------------------------------------------
-
-  enum class LoopMode
-  {
-    Off,        ///< Play once and stop
-    Forward,    ///< Loop from start to end
-    PingPong    ///< Alternate forward and backward
-  };
-
-  //------------------------------------------------------------------------------
-  // WavPlayer - Main player class
-  //------------------------------------------------------------------------------
-
-  class WavPlayer
-  {
-  public:
-    //--------------------------------------------------------------------------
-    // Construction / Destruction
-    //--------------------------------------------------------------------------
-
-    WavPlayer() noexcept
-        : fileSampleRate_(44100),
-          numChannels_(1),
-          numSamples_(0),
-          bitsPerSample_(16),
-          outputSampleRate_(44100.0f),
-          speed_(1.0f),
-          pitch_(1.0f),
-          volume_(1.0f),
-          playbackPosition_(0.0),
-          state_(PlaybackState::Stopped),
-          loopMode_(LoopMode::Off),
-          reverse_(false),
-          pingPongDirection_(1),
-          interpolation_(InterpolationQuality::Cubic)
+    // Native sample layouts that can be read in place (memory-mapped storage)
+    enum class PcmFormat : uint8_t
     {
-    }
-
-    ~WavPlayer() = default;
-
-    // Non-copyable (owns file data)
-    WavPlayer(const WavPlayer&) = delete;
-    WavPlayer& operator=(const WavPlayer&) = delete;
+      UInt8,
+      Int16,
+      Int24,
+      Int32,
+      Float32
+    };
 
-    // Move semantics
-    WavPlayer(WavPlayer&& other) noexcept
+    // Layout for a sample depth; false (format untouched) for anything the
+    // decoders cannot read, e.g. 12-bit PCM or 64-bit float
+    inline bool pcmFormatFor(uint16_t bits, bool isFloat, PcmFormat& format) noexcept
     {
-      std::lock_guard<std::mutex> lock(other.mutex_);
-      audioData_ = std::move(other.audioData_);
-      filePath_ = std::move(other.filePath_);
-      outputSampleRate_.store(other.outputSampleRate_.load());
-      speed_.store(other.speed_.load());
-      pitch_.store(other.pitch_.load());
-      volume_.store(other.volume_.load());
-      playbackPosition_.store(other.playbackPosition_.load());
-      state_.store(other.state_.load());
-      loopMode_.store(other.loopMode_.load());
-      reverse_.store(other.reverse_.load());
-      pingPongDirection_.store(other.pingPongDirection_.load());
-      interpolation_.store(other.interpolation_.load());
-      fileSampleRate_ = other.fileSampleRate_;
-      numChannels_ = other.numChannels_;
-      numSamples_ = other.numSamples_;
-      bitsPerSample_ = other.bitsPerSample_;
+      if (isFloat)
+      {
+        if (bits != 32)
+          return false;
+        format = PcmFormat::Float32;
+        return true;
+      }
+
+      switch (bits)
+      {
+      case 8:
+        format = PcmFormat::UInt8;
+        return true;
+      case 16:
+        format = PcmFormat::Int16;
+        return true;
+      case 24:
+        format = PcmFormat::Int24;
+        return true;
+      case 32:
+        format = PcmFormat::Int32;
+        return true;
+      default:
+        return false;
+      }
     }
 
-    WavPlayer& operator=(WavPlayer&& other) noexcept
+    // Decode one sample from its native little-endian layout.
+    // Uses memcpy so unaligned data chunks are handled safely.
+    inline float decodePcmSample(const uint8_t* bytes, PcmFormat format) noexcept
     {
-      if (this != &other)
+      switch (format)
       {
-        std::lock_guard<std::mutex> lockThis(mutex_);
-        std::lock_guard<std::mutex> lockOther(other.mutex_);
-        audioData_ = std::move(other.audioData_);
-        filePath_ = std::move(other.filePath_);
-        outputSampleRate_.store(other.outputSampleRate_.load());
-        speed_.store(other.speed_.load());
-        pitch_.store(other.pitch_.load());
-        volume_.store(other.volume_.load());
-        playbackPosition_.store(other.playbackPosition_.load());
-        state_.store(other.state_.load());
-        loopMode_.store(other.loopMode_.load());
-        reverse_.store(other.reverse_.load());
-        pingPongDirection_.store(other.pingPongDirection_.load());
-        interpolation_.store(other.interpolation_.load());
-        fileSampleRate_ = other.fileSampleRate_;
-        numChannels_ = other.numChannels_;
-        numSamples_ = other.numSamples_;
-        bitsPerSample_ = other.bitsPerSample_;
+      case PcmFormat::UInt8:
+        return uint8ToFloat(bytes[0]);
+      case PcmFormat::Int16:
+      {
+        int16_t value;
+        std::memcpy(&value, bytes, 2);
+        return int16ToFloat(value);
+      }
+      case PcmFormat::Int24:
+        return int24ToFloat(bytes);
+      case PcmFormat::Int32:
+      {
+        int32_t value;
+        std::memcpy(&value, bytes, 4);
+        return int32ToFloat(value);
+      }
+      case PcmFormat::Float32:
+      default:
+      {
+        float value;
+        std::memcpy(&value, bytes, 4);
+        return value;
+      }
       }
-      return *this;
     }
 
-    //--------------------------------------------------------------------------
-    // File I/O
-    //--------------------------------------------------------------------------
-
-    /// Load a WAV file from the filesystem.
-    /// This method is thread-safe but blocking - do not call from audio thread.
-    ///
-    /// @param path Path to the WAV file
-    /// @return WavError::None on success, error code otherwise
-    WavError loadFile(const char* path)
+    // Decode count consecutive samples of one layout into floats. Produces
+    // exactly what decodePcmSample does per sample (every scale is a power of
+    // two, so multiplying by its inverse is exact). On SSE2, 8/16/32-bit
+    // integers are widened and converted 8 or 4 at a time; 24-bit samples are
+    // assembled with shifts (SSE2 has no byte shuffle) and converted 4 at a time.
+    inline void decodePcmBlock(const uint8_t* in, float* out, size_t count, PcmFormat format) noexcept
     {
-      if (path == nullptr || path[0] == '\0')
+      size_t i = 0;
+      switch (format)
       {
-        return WavError::InvalidParameter;
+      case PcmFormat::UInt8:
+      {
+#if defined(SHORTWAV_DSP_SIMD_SSE2)
+        const __m128i zero = _mm_setzero_si128();
+        const __m128 bias = _mm_set1_ps(128.0f);
+        const __m128 scale = _mm_set1_ps(1.0f / 128.0f);
+        for (; i + 16 <= count; i += 16)
+        {
+          const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+          const __m128i lo = _mm_unpacklo_epi8(x, zero);
+          const __m128i hi = _mm_unpackhi_epi8(x, zero);
+          const __m128i words[4] = {_mm_unpacklo_epi16(lo, zero), _mm_unpackhi_epi16(lo, zero),
+                                    _mm_unpacklo_epi16(hi, zero), _mm_unpackhi_epi16(hi, zero)};
+          for (int k = 0; k < 4; ++k)
+            _mm_storeu_ps(out + i + 4 * k, _mm_mul_ps(_mm_sub_ps(_mm_cvtepi32_ps(words[k]), bias), scale));
+        }
+#endif
+        for (; i < count; ++i)
+          out[i] = uint8ToFloat(in[i]);
+        break;
       }
-
-      std::lock_guard<std::mutex> lock(mutex_);
-
-      // Open file
-      FILE* file = std::fopen(path, "rb");
-      if (file == nullptr)
+      case PcmFormat::Int16:
       {
-        return WavError::FileNotFound;
+#if defined(SHORTWAV_DSP_SIMD_SSE2)
+        const __m128 scale = _mm_set1_ps(1.0f / 32768.0f);
+        for (; i + 8 <= count; i += 8)
+        {
+          const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 2 * i));
+          // Sample in the high half of each 32-bit lane, then sign-extend
+          const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);
+          const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16);
+          _mm_storeu_ps(out + i, _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+          _mm_storeu_ps(out + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+        }
+#endif
+        for (; i < count; ++i)
+          out[i] = decodePcmSample(in + 2 * i, PcmFormat::Int16);
+        break;
       }
-
-      // Use RAII for file cleanup
-      struct FileGuard
+      case PcmFormat::Int24:
       {
-        FILE* f;
-        ~FileGuard() { if (f) std::fclose(f); }
-      } guard{file};
+#if defined(SHORTWAV_DSP_SIMD_SSE2)
+        const __m128 scale = _mm_set1_ps(1.0f / 8388608.0f);
+        for (; i + 4 <= count; i += 4)
+        {
+          int32_t v[4];
+          for (int k = 0; k < 4; ++k)
+          {
+            const uint8_t* b = in + 3 * (i + k);
+            const uint32_t word = (static_cast<uint32_t>(b[0]) << 8) | (static_cast<uint32_t>(b[1]) << 16) |
+                                  (static_cast<uint32_t>(b[2]) << 24);
+            v[k] = static_cast<int32_t>(word);
+          }
+          const __m128i x = _mm_srai_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(v)), 8);
+          _mm_storeu_ps(out + i, _mm_mul_ps(_mm_cvtepi32_ps(x), scale));
+        }
+#endif
+        for (; i < count; ++i)
+          out[i] = int24ToFloat(in + 3 * i);
+        break;
+      }
+      case PcmFormat::Int32:
+      {
+#if defined(SHORTWAV_DSP_SIMD_SSE2)
+        const __m128 scale = _mm_set1_ps(1.0f / 2147483648.0f);
+        for (; i + 4 <= count; i += 4)
+        {
+          const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 4 * i));
+          _mm_storeu_ps(out + i, _mm_mul_ps(_mm_cvtepi32_ps(x), scale));
+        }
+#endif
+        for (; i < count; ++i)
+          out[i] = decodePcmSample(in + 4 * i, PcmFormat::Int32);
+        break;
+      }
+      case PcmFormat::Float32:
+      default:
+        if (count > 0) // memcpy needs valid pointers even for zero bytes
+          std::memcpy(out, in, count * sizeof(float));
+        break;
+      }
+    }
 
-      // Read and validate RIFF header
-      detail::RiffHeader riffHeader;
-      if (std::fread(&riffHeader, sizeof(riffHeader), 1, file) != 1)
+    // Result of walking the RIFF chunk list
+    struct WavFormatInfo
+    {
+      FmtChunk fmt;
+      size_t dataOffset; // Byte offset of the first sample frame
+      size_t dataSize;   // Size of the data chunk in bytes (as declared)
+    };
+
+    // Locate the fmt and data chunks in an in-memory RIFF/WAVE image.
+    // Only the header is touched, so this is cheap on mapped files.
+    inline WavError parseWavHeader(const uint8_t* data, size_t size, WavFormatInfo& info) noexcept
+    {
+      if (data == nullptr || size < sizeof(RiffHeader) + 8)
       {
-        return WavError::InvalidFormat;
+        return WavError::InvalidParameter;
       }
 
-      if (!detail::memEqual4(riffHeader.chunkId, "RIFF") ||
-          !detail::memEqual4(riffHeader.format, "WAVE"))
+      RiffHeader riffHeader;
+      std::memcpy(&riffHeader, data, sizeof(riffHeader));
+      if (!memEqual4(riffHeader.chunkId, "RIFF") || !memEqual4(riffHeader.format, "WAVE"))
       {
         return WavError::InvalidFormat;
       }
 
-      // Parse chunks to find fmt and data
-      detail::FmtChunk fmtChunk{};
+      size_t offset = sizeof(riffHeader);
       bool foundFmt = false;
       bool foundData = false;
-      uint32_t dataSize = 0;
-      long dataOffset = 0;
+      info = WavFormatInfo{};
 
-      while (!foundFmt || !foundData)
+      while (offset + 8 <= size && (!foundFmt || !foundData))
       {
         char chunkId[4];
         uint32_t chunkSize;
 
-        if (std::fread(chunkId, 4, 1, file) != 1 ||
-            std::fread(&chunkSize, 4, 1, file) != 1)
-        {
-          if (foundFmt && foundData)
-            break;
-          return WavError::CorruptedData;
-        }
+        std::memcpy(chunkId, data + offset, 4);
+        offset += 4;
+        std::memcpy(&chunkSize, data + offset, 4);
+        offset += 4;
 
-        if (detail::memEqual4(chunkId, "fmt "))
+        if (memEqual4(chunkId, "fmt "))
         {
-          // Read format chunk
-          if (chunkSize < 16)
-          {
-            return WavError::InvalidFormat;
-          }
-
-          // Read the basic format info (16 bytes)
-          if (std::fread(&fmtChunk.audioFormat, 2, 1, file) != 1 ||
-              std::fread(&fmtChunk.numChannels, 2, 1, file) != 1 ||
-              std::fread(&fmtChunk.sampleRate, 4, 1, file) != 1 ||
-              std::fread(&fmtChunk.byteRate, 4, 1, file) != 1 ||
-              std::fread(&fmtChunk.blockAlign, 2, 1, file) != 1 ||
-              std::fread(&fmtChunk.bitsPerSample, 2, 1, file) != 1)
+          if (offset + 16 > size)
           {
-            return WavError::ReadError;
+            return WavError::CorruptedData;
           }
 
-          // Skip any extra format bytes
-          if (chunkSize > 16)
-          {
-            std::fseek(file, static_cast<long>(chunkSize - 16), SEEK_CUR);
-          }
+          std::memcpy(&info.fmt.audioFormat, data + offset, 2);
+          std::memcpy(&info.fmt.numChannels, data + offset + 2, 2);
+          std::memcpy(&info.fmt.sampleRate, data + offset + 4, 4);
+          std::memcpy(&info.fmt.byteRate, data + offset + 8, 4);
+          std::memcpy(&info.fmt.blockAlign, data + offset + 12, 2);
+          std::memcpy(&info.fmt.bitsPerSample, data + offset + 14, 2);
 
+          offset += chunkSize + (chunkSize & 1);
           foundFmt = true;
         }
-        else if (detail::memEqual4(chunkId, "data"))
+        else if (memEqual4(chunkId, "data"))
         {
-          dataSize = chunkSize;
-          dataOffset = std::ftell(file);
+          info.dataSize = chunkSize;
+          info.dataOffset = offset;
           foundData = true;
-          // Don't skip past data chunk - we'll read it below
           break;
         }
         else
         {
-          // Skip unknown chunk (ensure even alignment)
-          uint32_t skipSize = chunkSize + (chunkSize & 1);
-          std::fseek(file, static_cast<long>(skipSize), SEEK_CUR);
+          offset += chunkSize + (chunkSize & 1);
         }
       }
 
@@ -416,98 +463,1399 @@ namespace ShortwavDSP
         return WavError::InvalidFormat;
       }
 
-      // Validate format
-      if (fmtChunk.audioFormat != detail::kWavFormatPCM &&
-          fmtChunk.audioFormat != detail::kWavFormatIEEEFloat)
+      return WavError::None;
+    }
+
+    //--------------------------------------------------------------------------
+    // MappedFile - read-only memory mapping of a whole file (RAII)
+    //--------------------------------------------------------------------------
+
+    class MappedFile
+    {
+    public:
+      MappedFile() noexcept = default;
+      ~MappedFile() { close(); }
+
+      MappedFile(const MappedFile&) = delete;
+      MappedFile& operator=(const MappedFile&) = delete;
+
+      MappedFile(MappedFile&& other) noexcept
+          : data_(other.data_), size_(other.size_)
+      {
+        other.data_ = nullptr;
+        other.size_ = 0;
+      }
+
+      MappedFile& operator=(MappedFile&& other) noexcept
       {
-        // Check for extensible format with PCM/float subformat
-        if (fmtChunk.audioFormat != detail::kWavFormatExtensible)
+        if (this != &other)
         {
-          return WavError::UnsupportedFormat;
+          close();
+          data_ = other.data_;
+          size_ = other.size_;
+          other.data_ = nullptr;
+          other.size_ = 0;
         }
+        return *this;
       }
 
-      if (fmtChunk.numChannels == 0 || fmtChunk.numChannels > 2)
+      /// True when this platform supports memory mapping.
+      static constexpr bool isSupported() noexcept
       {
-        return WavError::UnsupportedFormat;
+#if defined(SHORTWAV_DSP_HAS_MMAP)
+        return true;
+#else
+        return false;
+#endif
       }
 
-      if (fmtChunk.bitsPerSample != 8 && fmtChunk.bitsPerSample != 16 &&
-          fmtChunk.bitsPerSample != 24 && fmtChunk.bitsPerSample != 32)
+      /// Map the whole file read-only. Returns false if it cannot be opened or mapped.
+      bool open(const char* path) noexcept
       {
-        return WavError::UnsupportedFormat;
-      }
+        close();
+        if (path == nullptr)
+          return false;
+
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+          return false;
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+        {
+          CloseHandle(file);
+          return false;
+        }
 
-      // Calculate number of samples
-      const uint32_t bytesPerSample = fmtChunk.bitsPerSample / 8;
-      const uint32_t bytesPerFrame = bytesPerSample * fmtChunk.numChannels;
-      const size_t numFrames = dataSize / bytesPerFrame;
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr)
+          return false;
+
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping); // The view keeps the mapping alive
+        if (view == nullptr)
+          return false;
+
+        data_ = static_cast<const uint8_t*>(view);
+        size_ = static_cast<size_t>(fileSize.QuadPart);
+        return true;
+#elif defined(SHORTWAV_DSP_HAS_MMAP)
+        const int fd = ::open(path, O_RDONLY);
+        if (fd < 0)
+          return false;
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || st.st_size <= 0)
+        {
+          ::close(fd);
+          return false;
+        }
 
-      if (numFrames == 0)
-      {
-        return WavError::CorruptedData;
+        const size_t length = static_cast<size_t>(st.st_size);
+        void* view = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd); // The mapping stays valid after the descriptor is closed
+        if (view == MAP_FAILED)
+          return false;
+
+        data_ = static_cast<const uint8_t*>(view);
+        size_ = length;
+        return true;
+#else
+        return false;
+#endif
       }
 
-      // Allocate audio buffer (convert to float, interleaved)
-      std::vector<float> newData;
-      try
-      {
-        newData.resize(numFrames * fmtChunk.numChannels);
-      }
-      catch (const std::bad_alloc&)
+      /// Unmap the file (no-op if nothing is mapped).
+      void close() noexcept
       {
-        return WavError::OutOfMemory;
+        if (data_ == nullptr)
+          return;
+#if defined(_WIN32)
+        UnmapViewOfFile(data_);
+#elif defined(SHORTWAV_DSP_HAS_MMAP)
+        ::munmap(const_cast<uint8_t*>(data_), size_);
+#endif
+        data_ = nullptr;
+        size_ = 0;
       }
 
-      // Seek to data start
-      std::fseek(file, dataOffset, SEEK_SET);
+      const uint8_t* data() const noexcept { return data_; }
+      size_t size() const noexcept { return size_; }
+      bool isOpen() const noexcept { return data_ != nullptr; }
 
-      // Read and convert samples
-      WavError readResult = readAndConvertSamples(
-          file, newData.data(), numFrames,
-          fmtChunk.numChannels, fmtChunk.bitsPerSample,
-          fmtChunk.audioFormat == detail::kWavFormatIEEEFloat);
+    private:
+      const uint8_t* data_ = nullptr;
+      size_t size_ = 0;
+    };
 
-      if (readResult != WavError::None)
+    // Format rules shared by the file loaders (PCM, float or extensible; 1-2 channels)
+    inline WavError validateFileFormat(const FmtChunk& fmt) noexcept
+    {
+      if (fmt.audioFormat != kWavFormatPCM &&
+          fmt.audioFormat != kWavFormatIEEEFloat &&
+          fmt.audioFormat != kWavFormatExtensible)
       {
-        return readResult;
+        return WavError::UnsupportedFormat;
       }
 
-      // Store file info
-      audioData_ = std::move(newData);
-      filePath_ = path;
-      fileSampleRate_ = fmtChunk.sampleRate;
-      numChannels_ = fmtChunk.numChannels;
-      numSamples_ = numFrames;
-      bitsPerSample_ = fmtChunk.bitsPerSample;
-
-      // Reset playback position
-      playbackPosition_.store(0.0);
-      state_.store(PlaybackState::Stopped);
-      pingPongDirection_.store(1);
-
-      return WavError::None;
-    }
+      if (fmt.numChannels == 0 || fmt.numChannels > 2)
+      {
+        return WavError::UnsupportedFormat;
+      }
 
-    /// Load WAV data from a memory buffer.
-    /// @param data Pointer to WAV file data in memory
-    /// @param size Size of the data buffer in bytes
+      PcmFormat format;
+      if (!pcmFormatFor(fmt.bitsPerSample, fmt.audioFormat == kWavFormatIEEEFloat, format))
+      {
+        return WavError::UnsupportedFormat;
+      }
+
+      return WavError::None;
+    }
+
+    // 64-bit safe absolute seek (long is 32-bit on Windows)
+    inline bool fileSeek(FILE* file, uint64_t offset) noexcept
+    {
+#if defined(_WIN32)
+      return _fseeki64(file, static_cast<__int64>(offset), SEEK_SET) == 0;
+#else
+      return fseeko(file, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+    }
+
+    //--------------------------------------------------------------------------
+    // FrameRing - lock-free sliding window of decoded frames (streaming mode)
+    //--------------------------------------------------------------------------
+    //
+    // Holds the contiguous file range [begin, end) in a power-of-two ring
+    // indexed by frame number. One producer (the stream reader) slides the
+    // window; any number of readers may look frames up concurrently.
+    //
+    // Protocol (seqlock style, no locks):
+    //  - Producer shrinks the window (publishes the new begin/end) *before*
+    //    overwriting a slot, and grows it only *after* the slot is written.
+    //  - Readers check the window, read the slot, then re-check the window.
+    //    A frame that was evicted mid-read fails the second check (miss).
+
+    class FrameRing
+    {
+    public:
+      bool allocate(size_t minFrames, uint16_t channels)
+      {
+        size_t frames = 1;
+        while (frames < minFrames)
+          frames <<= 1;
+
+        try
+        {
+          slots_.reset(new std::atomic<float>[frames * channels]);
+        }
+        catch (const std::bad_alloc&)
+        {
+          return false;
+        }
+
+        capacity_ = frames;
+        mask_ = frames - 1;
+        channels_ = channels;
+        begin_.store(0, std::memory_order_relaxed);
+        end_.store(0, std::memory_order_relaxed);
+        return true;
+      }
+
+      size_t capacity() const noexcept { return capacity_; }
+
+      // Reader side ---------------------------------------------------------
+
+      bool read(int64_t frame, size_t channel, float& out) const noexcept
+      {
+        const int64_t b = begin_.load(std::memory_order_acquire);
+        const int64_t e = end_.load(std::memory_order_acquire);
+        if (frame < b || frame >= e)
+          return false;
+
+        out = slot(frame, channel).load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return frame >= begin_.load(std::memory_order_relaxed) &&
+               frame < end_.load(std::memory_order_relaxed);
+      }
+
+      // Producer side -------------------------------------------------------
+
+      int64_t begin() const noexcept { return begin_.load(std::memory_order_relaxed); }
+      int64_t end() const noexcept { return end_.load(std::memory_order_relaxed); }
+
+      // Empty the window and restart it at anchor
+      void reset(int64_t anchor) noexcept
+      {
+        end_.store(begin(), std::memory_order_release);
+        begin_.store(anchor, std::memory_order_release);
+        end_.store(anchor, std::memory_order_release);
+      }
+
+      // Evict frames before newBegin / from newEnd on, ahead of overwriting them
+      void retireFront(int64_t newBegin) noexcept
+      {
+        begin_.store(newBegin, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+      }
+
+      void retireBack(int64_t newEnd) noexcept
+      {
+        end_.store(newEnd, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+      }
+
+      void write(int64_t frame, size_t channel, float value) noexcept
+      {
+        slot(frame, channel).store(value, std::memory_order_relaxed);
+      }
+
+      // Make freshly written frames visible
+      void publishBegin(int64_t newBegin) noexcept { begin_.store(newBegin, std::memory_order_release); }
+      void publishEnd(int64_t newEnd) noexcept { end_.store(newEnd, std::memory_order_release); }
+
+    private:
+      std::atomic<float>& slot(int64_t frame, size_t channel) const noexcept
+      {
+        return slots_[(static_cast<size_t>(frame) & mask_) * channels_ + channel];
+      }
+
+      std::unique_ptr<std::atomic<float>[]> slots_;
+      size_t capacity_ = 0;
+      size_t mask_ = 0;
+      size_t channels_ = 1;
+      std::atomic<int64_t> begin_{0};
+      std::atomic<int64_t> end_{0};
+    };
+
+    //--------------------------------------------------------------------------
+    // WavStream - file handle, preload caches and ring for streaming playback
+    //--------------------------------------------------------------------------
+
+    struct WavStream
+    {
+      FILE* file = nullptr;
+      uint64_t dataOffset = 0;
+      size_t numFrames = 0;
+      uint16_t channels = 1;
+      PcmFormat format = PcmFormat::Int16;
+      size_t bytesPerSample = 2;
+
+      // Resident copies of the first/last frames so loop wraps, stops and
+      // full-file triggers never wait for the reader
+      std::vector<float> head;
+      std::vector<float> tail;
+      size_t headFrames = 0;
+      size_t tailStart = 0;
+
+      FrameRing ring;
+      std::vector<uint8_t> staging;
+      size_t stagingFrames = 0;
+
+      WavStream() = default;
+      WavStream(const WavStream&) = delete;
+      WavStream& operator=(const WavStream&) = delete;
+
+      ~WavStream()
+      {
+        if (file != nullptr)
+          std::fclose(file);
+      }
+
+      // Read count frames starting at first into the staging buffer
+      bool readRaw(size_t first, size_t count) noexcept
+      {
+        const size_t bytesPerFrame = bytesPerSample * channels;
+        const size_t bytes = count * bytesPerFrame;
+        return fileSeek(file, dataOffset + static_cast<uint64_t>(first) * bytesPerFrame) &&
+               std::fread(staging.data(), 1, bytes, file) == bytes;
+      }
+
+      // Decode frames [first, first + count) into an interleaved float buffer
+      bool decodeTo(float* out, size_t first, size_t count) noexcept
+      {
+        while (count > 0)
+        {
+          const size_t chunk = std::min(count, stagingFrames);
+          if (!readRaw(first, chunk))
+            return false;
+          decodePcmBlock(staging.data(), out, chunk * channels, format);
+          out += chunk * channels;
+          first += chunk;
+          count -= chunk;
+        }
+        return true;
+      }
+
+      // Decode frames [first, first + count) straight into the ring slots
+      bool decodeToRing(int64_t first, size_t count) noexcept
+      {
+        if (!readRaw(static_cast<size_t>(first), count))
+          return false;
+        for (size_t f = 0; f < count; ++f)
+          for (size_t c = 0; c < channels; ++c)
+            ring.write(first + static_cast<int64_t>(f), c,
+                       decodePcmSample(staging.data() + (f * channels + c) * bytesPerSample, format));
+        return true;
+      }
+
+      // Slide the ring window towards pos in the given direction (+1 / -1).
+      // Returns the number of frames decoded. Single producer only.
+      size_t fill(double pos, int direction) noexcept
+      {
+        const int64_t n = static_cast<int64_t>(numFrames);
+        const int64_t cap = static_cast<int64_t>(ring.capacity());
+        const int64_t back = cap / 8; // History kept behind the play head
+        const int64_t p = std::max<int64_t>(0, std::min<int64_t>(n - 1, static_cast<int64_t>(pos)));
+        const int64_t slack = static_cast<int64_t>(stagingFrames);
+
+        int64_t b = ring.begin();
+        int64_t e = ring.end();
+
+        // Seek, loop wrap or long stall: restart the window at the play head
+        if (p < b - slack || p > e + slack)
+        {
+          const int64_t anchor = (direction >= 0) ? std::max<int64_t>(0, p - back)
+                                                  : std::min<int64_t>(n, p + back + 1);
+          ring.reset(anchor);
+          b = e = anchor;
+        }
+
+        size_t decoded = 0;
+
+        if (direction >= 0)
+        {
+          const int64_t target = std::min<int64_t>(n, std::max<int64_t>(b, p - back) + cap);
+          while (e < target)
+          {
+            const int64_t chunk = std::min<int64_t>(target - e, slack);
+            const int64_t newEnd = e + chunk;
+            if (newEnd - b > cap)
+            {
+              b = newEnd - cap;
+              ring.retireFront(b);
+            }
+            if (!decodeToRing(e, static_cast<size_t>(chunk)))
+              break;
+            ring.publishEnd(newEnd);
+            e = newEnd;
+            decoded += static_cast<size_t>(chunk);
+          }
+        }
+        else
+        {
+          const int64_t target = std::max<int64_t>(0, std::min<int64_t>(e, p + back + 1) - cap);
+          while (b > target)
+          {
+            const int64_t chunk = std::min<int64_t>(b - target, slack);
+            const int64_t newBegin = b - chunk;
+            if (e - newBegin > cap)
+            {
+              e = newBegin + cap;
+              ring.retireBack(e);
+            }
+            if (!decodeToRing(newBegin, static_cast<size_t>(chunk)))
+              break;
+            ring.publishBegin(newBegin);
+            b = newBegin;
+            decoded += static_cast<size_t>(chunk);
+          }
+        }
+
+        return decoded;
+      }
+
+      // Look up a frame: preload caches first, then the ring
+      bool read(size_t frame, size_t channel, float& out) const noexcept
+      {
+        if (frame < headFrames)
+        {
+          out = head[frame * channels + channel];
+          return true;
+        }
+        if (frame >= tailStart)
+        {
+          out = tail[(frame - tailStart) * channels + channel];
+          return true;
+        }
+        return ring.read(static_cast<int64_t>(frame), channel, out);
+      }
+    };
+
+  } // namespace detail
+
+  //------------------------------------------------------------------------------
+  // Interpolation quality settings
+  //------------------------------------------------------------------------------
+
+  enum class InterpolationQuality
+  {
+    None,    ///< Nearest-neighbor (lowest quality, fastest)
+    Linear,  ///< Linear interpolation (good balance)
+    Cubic,   ///< Cubic/Hermite interpolation
+    Sinc     ///< 16-tap windowed sinc (highest quality, see sinc-interpolator.h)
+  };
+
+  //------------------------------------------------------------------------------
+  // Playback state
+  //------------------------------------------------------------------------------
+
+  enum class PlaybackState
+  {
+    Stopped,
+    Playing,
+    Paused
+  };
+
+  //------------------------------------------------------------------------------
+  // Loop mode settings
+  //------------------------------------------------------------------------------
+
+  enum class LoopMode
+  {
+    Off,        ///< Play once and stop
+    Forward,    ///< Loop from start to end
+    PingPong    ///< Alternate forward and backward
+  };
+
+  //------------------------------------------------------------------------------
+  // Sample storage mode
+  //------------------------------------------------------------------------------
+
+  enum class WavStorageMode
+  {
+    Resident,     ///< Decode the whole file to float in RAM (default)
+    MemoryMapped, ///< Map the file and convert samples lazily on read (zero-copy)
+    Streaming     ///< Read from disk into a prefetch ring (see WavPlayer::serviceStream)
+  };
+
+  namespace detail
+  {
+    //--------------------------------------------------------------------------
+    // SampleBuffer - immutable snapshot of a loaded file
+    //--------------------------------------------------------------------------
+    //
+    // Built completely by a loader thread, then handed to the audio thread
+    // with one atomic pointer swap (see WavPlayer). Exactly one storage form
+    // is populated. Only the streaming ring's contents change after publishing.
+
+    struct SampleBuffer
+    {
+      // Resident: decoded float, interleaved channels
+      std::vector<float> samples;
+
+      // Resident, converted to the engine rate on load: the decoded samples at
+      // the file's own rate, so a later rate change converts from the source
+      // instead of from an already converted copy
+      std::shared_ptr<const std::vector<float>> sourceSamples;
+
+      // MemoryMapped: native PCM inside the mapping
+      MappedFile mapping;
+      const uint8_t* pcm = nullptr;
+      PcmFormat format = PcmFormat::Float32;
+      size_t bytesPerSample = 4;
+
+      // Streaming: file handle, preload caches and prefetch ring
+      std::unique_ptr<WavStream> stream;
+
+      // Min/max/RMS summary for waveform displays
+      PeakPyramid peaks;
+
+      // Detected transients in file order, for auto-slicing
+      std::vector<OnsetDetector::Onset> onsets;
+
+      // File information (sampleRate and frames describe the stored data,
+      // fileSampleRate the file itself)
+      std::string path;
+      uint32_t sampleRate = 44100;
+      uint32_t fileSampleRate = 44100;
+      uint16_t channels = 1;
+      size_t frames = 0;
+      uint16_t bitsPerSample = 16;
+
+      WavStorageMode mode() const noexcept
+      {
+        if (stream)
+          return WavStorageMode::Streaming;
+        return pcm != nullptr ? WavStorageMode::MemoryMapped : WavStorageMode::Resident;
+      }
+
+      /// Read one sample (frame < frames, channel < channels).
+      /// Returns false only when a streamed frame is not buffered yet.
+      bool read(size_t frame, size_t channel, float& out) const noexcept
+      {
+        if (stream)
+          return stream->read(frame, channel, out);
+
+        const size_t index = frame * channels + channel;
+        out = (pcm != nullptr) ? decodePcmSample(pcm + index * bytesPerSample, format)
+                               : samples[index];
+        return true;
+      }
+    };
+
+  } // namespace detail
+
+  //------------------------------------------------------------------------------
+  // WavPlayer - Main player class
+  //------------------------------------------------------------------------------
+
+  class WavPlayer
+  {
+  public:
+    //--------------------------------------------------------------------------
+    // Construction / Destruction
+    //--------------------------------------------------------------------------
+
+    WavPlayer() noexcept
+        : fileSampleRate_(44100),
+          numChannels_(1),
+          numSamples_(0),
+          bitsPerSample_(16),
+          outputSampleRate_(44100.0f),
+          speed_(1.0f),
+          pitch_(1.0f),
+          volume_(1.0f),
+          playbackPosition_(0.0),
+          state_(PlaybackState::Stopped),
+          loopMode_(LoopMode::Off),
+          reverse_(false),
+          pingPongDirection_(1),
+          interpolation_(InterpolationQuality::Cubic)
+    {
+      SincInterpolator::shared(); // Build the sinc tables here, not on the audio thread
+    }
+
+    ~WavPlayer() = default;
+
+    // Non-copyable (owns file data)
+    WavPlayer(const WavPlayer&) = delete;
+    WavPlayer& operator=(const WavPlayer&) = delete;
+
+    // Move semantics (not safe while another thread is processing either player)
+    WavPlayer(WavPlayer&& other) noexcept
+    {
+      std::lock_guard<std::mutex> lock(other.mutex_);
+      moveFrom(other);
+    }
+
+    WavPlayer& operator=(WavPlayer&& other) noexcept
+    {
+      if (this != &other)
+      {
+        std::lock_guard<std::mutex> lockThis(mutex_);
+        std::lock_guard<std::mutex> lockOther(other.mutex_);
+        moveFrom(other);
+      }
+      return *this;
+    }
+
+    //--------------------------------------------------------------------------
+    // File I/O
+    //--------------------------------------------------------------------------
+    //
+    // Every loader builds a complete, immutable SampleBuffer without holding
+    // any lock, then publishes it with one atomic pointer swap. The audio
+    // thread picks the new buffer up at its next block; the replaced buffer is
+    // freed later by collectRetired() (or the next load/unload), never on the
+    // audio thread. Playback does not need to be stopped before reloading.
+
+    /// Load a WAV file from the filesystem.
+    /// This method is thread-safe but blocking - do not call from audio thread.
+    ///
+    /// In MemoryMapped mode sample data stays in the file's native layout and is
+    /// converted on read; the load only makes one read pass to build the peak
+    /// pyramid, and the mapped pages remain evictable. Falls back to Resident
+    /// on platforms without memory mapping.
+    ///
+    /// With setResampleOnLoad(true), Resident loads whose rate differs from
+    /// the output rate are converted with a windowed-sinc filter (see
+    /// sinc-resampler.h) before publishing, so unity-speed playback reads the
+    /// samples without interpolating. getNumSamples() then counts frames at
+    /// the output rate; getFileSampleRate() still reports the file's rate.
+    ///
+    /// Every mode builds SampleBuffer::peaks (see peak-pyramid.h) and
+    /// SampleBuffer::onsets (see onset-detector.h) in the same read pass
+    /// before the buffer is published.
+    ///
+    /// In Streaming mode the file stays open and frames are decoded into a
+    /// fixed-size prefetch ring by serviceStream(), which the caller must run
+    /// periodically on a background thread.
+    ///
+    /// @param path Path to the WAV file
+    /// @param mode Sample storage mode
     /// @return WavError::None on success, error code otherwise
-    WavError loadFromMemory(const uint8_t* data, size_t size)
+    WavError loadFile(const char* path, WavStorageMode mode = WavStorageMode::Resident)
     {
-      if (data == nullptr || size < sizeof(detail::RiffHeader) + 8)
+      if (path == nullptr || path[0] == '\0')
       {
         return WavError::InvalidParameter;
       }
 
+      loadProgress_.store(0.0f);
+      LoadProgressDone progressDone{loadProgress_};
+
+      if (mode == WavStorageMode::MemoryMapped && detail::MappedFile::isSupported())
+      {
+        return loadFileMapped(path);
+      }
+
+      if (mode == WavStorageMode::Streaming)
+      {
+        return loadFileStreaming(path);
+      }
+
+      // Open file
+      FILE* file = std::fopen(path, "rb");
+      if (file == nullptr)
+      {
+        return WavError::FileNotFound;
+      }
+
+      // Use RAII for file cleanup
+      struct FileGuard
+      {
+        FILE* f;
+        ~FileGuard() { if (f) std::fclose(f); }
+      } guard{file};
+
+      detail::WavFormatInfo info;
+      const WavError headerResult = readWavHeader(file, info);
+      if (headerResult != WavError::None)
+      {
+        return headerResult;
+      }
+
+      const detail::FmtChunk& fmtChunk = info.fmt;
+      const size_t dataSize = info.dataSize;
+
+      // Calculate number of samples
+      const uint32_t bytesPerSample = fmtChunk.bitsPerSample / 8;
+      const uint32_t bytesPerFrame = bytesPerSample * fmtChunk.numChannels;
+      const size_t numFrames = dataSize / bytesPerFrame;
+
+      if (numFrames == 0)
+      {
+        return WavError::CorruptedData;
+      }
+
+      // Allocate audio buffer (convert to float, interleaved)
+      std::shared_ptr<detail::SampleBuffer> buffer;
+      try
+      {
+        buffer = std::make_shared<detail::SampleBuffer>();
+        buffer->samples.resize(numFrames * fmtChunk.numChannels);
+      }
+      catch (const std::bad_alloc&)
+      {
+        return WavError::OutOfMemory;
+      }
+
+      // Read and convert samples
+      WavError readResult = readAndConvertSamples(
+          path, file, info.dataOffset, buffer->samples.data(), numFrames,
+          fmtChunk.numChannels, fmtChunk.bitsPerSample,
+          fmtChunk.audioFormat == detail::kWavFormatIEEEFloat);
+
+      if (readResult != WavError::None)
+      {
+        return readResult;
+      }
+
+      // Store file info
+      buffer->path = path;
+      setBufferFormat(*buffer, fmtChunk, numFrames);
+      const WavError convertResult = convertToOutputRate(*buffer);
+      if (convertResult != WavError::None)
+      {
+        return convertResult;
+      }
+      if (buffer->sourceSamples)
+      {
+        advanceLoadProgress(kRateProgressEnd);
+      }
+      const WavError peaksResult = buildPeaks(*buffer, true);
+      if (peaksResult != WavError::None)
+      {
+        return peaksResult;
+      }
+      publish(std::move(buffer));
+
+      return WavError::None;
+    }
+
+    /// Load WAV data from a memory buffer.
+    /// @param data Pointer to WAV file data in memory
+    /// @param size Size of the data buffer in bytes
+    /// @return WavError::None on success, error code otherwise
+    WavError loadFromMemory(const uint8_t* data, size_t size)
+    {
+      if (data == nullptr || size < sizeof(detail::RiffHeader) + 8)
+      {
+        return WavError::InvalidParameter;
+      }
+
+      loadProgress_.store(0.0f);
+      LoadProgressDone progressDone{loadProgress_};
+
+      detail::WavFormatInfo info;
+      const WavError parseResult = detail::parseWavHeader(data, size, info);
+      if (parseResult != WavError::None)
+      {
+        return parseResult;
+      }
+
+      const detail::FmtChunk& fmtChunk = info.fmt;
+      const size_t dataSize = info.dataSize;
+      const size_t dataOffset = info.dataOffset;
+
+      // Validate format (same rules as the file loaders)
+      const WavError formatResult = detail::validateFileFormat(fmtChunk);
+      if (formatResult != WavError::None)
+      {
+        return formatResult;
+      }
+
+      // Calculate frames
+      const uint32_t bytesPerSample = fmtChunk.bitsPerSample / 8;
+      const uint32_t bytesPerFrame = bytesPerSample * fmtChunk.numChannels;
+      const size_t numFrames = dataSize / bytesPerFrame;
+
+      if (numFrames == 0 || dataOffset + dataSize > size)
+      {
+        return WavError::CorruptedData;
+      }
+
+      // Allocate and convert
+      std::shared_ptr<detail::SampleBuffer> buffer;
+      try
+      {
+        buffer = std::make_shared<detail::SampleBuffer>();
+        buffer->samples.resize(numFrames * fmtChunk.numChannels);
+      }
+      catch (const std::bad_alloc&)
+      {
+        return WavError::OutOfMemory;
+      }
+
+      // Convert samples from memory
+      WavError convertResult = convertSamplesFromMemory(
+          data + dataOffset, buffer->samples.data(), numFrames,
+          fmtChunk.numChannels, fmtChunk.bitsPerSample,
+          fmtChunk.audioFormat == detail::kWavFormatIEEEFloat);
+
+      if (convertResult != WavError::None)
+      {
+        return convertResult;
+      }
+
+      // Store file info
+      setBufferFormat(*buffer, fmtChunk, numFrames);
+      const WavError rateResult = convertToOutputRate(*buffer);
+      if (rateResult != WavError::None)
+      {
+        return rateResult;
+      }
+      if (buffer->sourceSamples)
+      {
+        advanceLoadProgress(kRateProgressEnd);
+      }
+      const WavError peaksResult = buildPeaks(*buffer, true);
+      if (peaksResult != WavError::None)
+      {
+        return peaksResult;
+      }
+      publish(std::move(buffer));
+
+      return WavError::None;
+    }
+
+    /// Unload the current file. Its memory is released once the audio thread
+    /// has let go of it (see collectRetired()).
+    void unload()
+    {
+      publish(nullptr);
+    }
+
+    /// Convert Resident loads to the output sample rate (applies to the next
+    /// load and to resampleToOutputRate()).
+    void setResampleOnLoad(bool enabled) noexcept { resampleOnLoad_.store(enabled); }
+    bool getResampleOnLoad() const noexcept { return resampleOnLoad_.load(); }
+
+    /// Make rate conversions in progress, and any started later, give up with
+    /// WavError::InvalidState. For teardown: call before joining a thread that
+    /// may be inside loadFile() or resampleToOutputRate() so it returns early.
+    void abortConversions() noexcept { abortConversions_.store(true); }
+
+    /// Redo the load-time rate conversion after setSampleRate() changed the
+    /// output rate. Converts from the file's own samples and publishes the
+    /// result like a load, except that playback continues at the same point
+    /// in time (pool voices are stopped). No-op unless resampling is enabled,
+    /// the file is Resident and its stored rate differs from the output rate.
+    /// Blocking (about as long as the original conversion); call from a
+    /// background thread, never from the audio thread. Nothing is published
+    /// if abortConversions() is called meanwhile. Reports through
+    /// getLoadProgress() like a load (conversion, then the peak/onset pass).
+    WavError resampleToOutputRate()
+    {
+      std::lock_guard<std::mutex> convert(convertMutex_);
+      std::shared_ptr<const detail::SampleBuffer> current = getSampleBuffer();
+      if (!current || current->mode() != WavStorageMode::Resident || !resampleOnLoad_.load() ||
+          current->sampleRate == targetSampleRate())
+      {
+        return WavError::None;
+      }
+      loadProgress_.store(0.0f);
+      LoadProgressDone progressDone{loadProgress_};
+
+      std::shared_ptr<detail::SampleBuffer> buffer;
+      try
+      {
+        buffer = std::make_shared<detail::SampleBuffer>();
+        buffer->path = current->path;
+        buffer->channels = current->channels;
+        buffer->bitsPerSample = current->bitsPerSample;
+        buffer->sampleRate = buffer->fileSampleRate = current->fileSampleRate;
+        if (current->sourceSamples)
+        {
+          buffer->samples = *current->sourceSamples;
+        }
+        else
+        {
+          buffer->samples = current->samples;
+        }
+        buffer->frames = buffer->samples.size() / buffer->channels;
+      }
+      catch (const std::bad_alloc&)
+      {
+        return WavError::OutOfMemory;
+      }
+
+      const WavError convertResult = convertToOutputRate(*buffer);
+      if (convertResult != WavError::None)
+      {
+        return convertResult;
+      }
+      advanceLoadProgress(kRateProgressEnd);
+      const WavError peaksResult = buildPeaks(*buffer, true);
+      if (peaksResult != WavError::None)
+      {
+        return peaksResult;
+      }
+
+      const double timeScale = static_cast<double>(buffer->sampleRate) / static_cast<double>(current->sampleRate);
+      publishConverted(std::move(buffer), current.get(), timeScale);
+      return WavError::None;
+    }
+
+    /// Progress of the load or resampleToOutputRate() running on another
+    /// thread, 0..1 (1 when neither is running). Decoding, rate conversion and
+    /// the peak/onset pass each advance it as they go; it never moves
+    /// backwards within a load or conversion.
+    float getLoadProgress() const noexcept { return loadProgress_.load(std::memory_order_relaxed); }
+
+    /// Check if a file is currently loaded.
+    bool isLoaded() const noexcept
+    {
+      return published_.load(std::memory_order_acquire) != nullptr;
+    }
+
+    /// Get the storage mode of the loaded data.
+    WavStorageMode getStorageMode() const noexcept
+    {
+      return storageMode_.load();
+    }
+
+    /// Free replaced buffers the audio thread no longer uses.
+    /// Call from a non-audio thread (UI or loader), e.g. once per UI frame.
+    /// @return Number of buffers still waiting for the audio thread
+    size_t collectRetired()
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return reclaimRetired();
+    }
+
+    /// Shared reference to the published buffer, for bulk readers on non-audio
+    /// threads (the buffer stays valid while the reference is held).
+    std::shared_ptr<const detail::SampleBuffer> getSampleBuffer() const
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return current_;
+    }
+
+    /// Changes whenever a buffer is published (load or unload). Lock-free, so
+    /// UI code can poll it every frame and only refetch getSampleBuffer() and
+    /// rebuild cached drawing data when it moves.
+    uint64_t getBufferGeneration() const noexcept
+    {
+      return generation_.load(std::memory_order_acquire);
+    }
+
+    //--------------------------------------------------------------------------
+    // Streaming (WavStorageMode::Streaming)
+    //--------------------------------------------------------------------------
+
+    static constexpr size_t kDefaultStreamBufferFrames = 1 << 16;
+    static constexpr size_t kDefaultStreamPreloadFrames = 1 << 13;
+
+    /// Set the prefetch ring size in frames (rounded up to a power of two).
+    /// Applies to the next Streaming load.
+    void setStreamBufferFrames(size_t frames) noexcept
+    {
+      streamBufferFrames_.store(std::max<size_t>(frames, 256));
+    }
+
+    /// Set how many frames at each end of the file are kept resident, so loop
+    /// wraps and restarts never wait for the disk. Applies to the next Streaming load.
+    void setStreamPreloadFrames(size_t frames) noexcept
+    {
+      streamPreloadFrames_.store(frames);
+    }
+
+    size_t getStreamBufferFrames() const noexcept { return streamBufferFrames_.load(); }
+    size_t getStreamPreloadFrames() const noexcept { return streamPreloadFrames_.load(); }
+
+    /// True if the current file is being streamed from disk.
+    bool isStreaming() const noexcept
+    {
+      return isLoaded() && storageMode_.load() == WavStorageMode::Streaming;
+    }
+
+    /// Refill the prefetch ring ahead of the play head, following the current
+    /// direction (reverse, ping-pong) and jumping with seeks and loop wraps.
+    /// Call periodically from a non-audio thread (every few milliseconds, more
+    /// often at high playback rates). Blocking file I/O; never call from audio thread.
+    /// Also frees retired buffers, like collectRetired().
+    /// @return Number of frames decoded (0 if nothing to do or not streaming)
+    size_t serviceStream()
+    {
+      std::shared_ptr<const detail::SampleBuffer> buffer;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        reclaimRetired();
+        buffer = current_;
+      }
+      if (!buffer || !buffer->stream)
+        return 0;
+
+      // File I/O runs outside mutex_ so loads and UI readers never wait on it;
+      // streamMutex_ keeps the ring single-producer
+      std::lock_guard<std::mutex> producer(streamMutex_);
+      int direction = reverse_.load() ? -1 : 1;
+      if (loopMode_.load() == LoopMode::PingPong)
+        direction *= pingPongDirection_.load();
+
+      return buffer->stream->fill(playbackPosition_.load(), direction);
+    }
+
+    /// Number of output samples replaced by silence because the ring had not
+    /// caught up with the play head yet.
+    uint64_t getStreamUnderruns() const noexcept
+    {
+      return streamUnderruns_.load(std::memory_order_relaxed);
+    }
+
+    void resetStreamUnderruns() noexcept
+    {
+      streamUnderruns_.store(0, std::memory_order_relaxed);
+    }
+
+    /// Load counters (empty unless built with SHORTWAV_DSP_INSTRUMENTATION).
+    /// Besides the timings, counts stream underruns and the frames rendered
+    /// per InterpolationQuality (tiers[]).
+    const DspStats& getStats() const noexcept { return stats_; }
+    DspStats& getStats() noexcept { return stats_; }
+
+    //--------------------------------------------------------------------------
+    // Playback Control (Thread-safe)
+    //--------------------------------------------------------------------------
+
+    /// Start or resume playback.
+    void play() noexcept
+    {
+      if (isLoaded())
+      {
+        state_.store(PlaybackState::Playing);
+      }
+    }
+
+    /// Pause playback (maintains position).
+    void pause() noexcept
+    {
+      state_.store(PlaybackState::Paused);
+    }
+
+    /// Stop playback and reset position to start.
+    void stop() noexcept
+    {
+      state_.store(PlaybackState::Stopped);
+      playbackPosition_.store(reverse_.load() ? static_cast<double>(numSamples_ - 1) : 0.0);
+      pingPongDirection_.store(reverse_.load() ? -1 : 1);
+    }
+
+    /// Seek to a specific position (0.0 = start, 1.0 = end).
+    void seek(float normalizedPosition) noexcept
+    {
+      if (numSamples_ > 0)
+      {
+        const float clamped = detail::wavClamp(normalizedPosition, 0.0f, 1.0f);
+        playbackPosition_.store(clamped * static_cast<double>(numSamples_ - 1));
+      }
+    }
+
+    /// Seek to a specific sample position.
+    void seekToSample(size_t sampleIndex) noexcept
+    {
+      if (numSamples_ > 0)
+      {
+        playbackPosition_.store(static_cast<double>(std::min(sampleIndex, numSamples_ - 1)));
+      }
+    }
+
+    /// Get current playback state.
+    PlaybackState getState() const noexcept
+    {
+      return state_.load();
+    }
+
+    /// Check if currently playing.
+    bool isPlaying() const noexcept
+    {
+      return state_.load() == PlaybackState::Playing;
+    }
+
+    /// Get current playback position (0.0 to 1.0).
+    float getPlaybackPosition() const noexcept
+    {
+      if (numSamples_ == 0)
+        return 0.0f;
+      return static_cast<float>(playbackPosition_.load() / static_cast<double>(numSamples_ - 1));
+    }
+
+    /// Get current playback position in samples.
+    double getPlaybackPositionSamples() const noexcept
+    {
+      return playbackPosition_.load();
+    }
+
+    //--------------------------------------------------------------------------
+    // Parameter Setters (Thread-safe, atomic)
+    //--------------------------------------------------------------------------
+
+    /// Set the output sample rate (host sample rate).
+    void setSampleRate(float sampleRate) noexcept
+    {
+      outputSampleRate_.store(std::max(1.0f, sampleRate));
+    }
+
+    /// Set playback speed (1.0 = normal, 0.5 = half speed, 2.0 = double).
+    /// Speed affects both tempo and duration, not pitch when combined with pitch.
+    void setSpeed(float speed) noexcept
+    {
+      speed_.store(detail::wavClamp(speed, 0.01f, 100.0f));
+    }
+
+    /// Set pitch ratio (1.0 = original, 0.5 = octave down, 2.0 = octave up).
+    /// Pitch affects playback rate but is combined with speed for final rate.
+    void setPitch(float pitch) noexcept
+    {
+      pitch_.store(detail::wavClamp(pitch, 0.01f, 100.0f));
+    }
+
+    /// Set playback volume (0.0 = silence, 1.0 = unity).
+    void setVolume(float volume) noexcept
+    {
+      volume_.store(detail::wavClamp(volume, 0.0f, 10.0f));
+    }
+
+    /// Set reverse playback mode.
+    void setReverse(bool reverse) noexcept
+    {
+      const bool wasReverse = reverse_.load();
+      reverse_.store(reverse);
+
+      // If changing direction while stopped, reset position
+      if (wasReverse != reverse && state_.load() == PlaybackState::Stopped)
+      {
+        playbackPosition_.store(reverse ? static_cast<double>(numSamples_ - 1) : 0.0);
+        pingPongDirection_.store(reverse ? -1 : 1);
+      }
+    }
+
+    /// Set loop mode.
+    void setLoopMode(LoopMode mode) noexcept
+    {
+      loopMode_.store(mode);
+    }
+
+    /// Set interpolation quality.
+    void setInterpolationQuality(InterpolationQuality quality) noexcept
+    {
+      interpolation_.store(quality);
+    }
+
+    //--------------------------------------------------------------------------
+    // Parameter Getters
+    //--------------------------------------------------------------------------
+
+    float getSampleRate() const noexcept { return outputSampleRate_.load(); }
+    float getSpeed() const noexcept { return speed_.load(); }
+    float getPitch() const noexcept { return pitch_.load(); }
+    float getVolume() const noexcept { return volume_.load(); }
+    bool getReverse() const noexcept { return reverse_.load(); }
+    LoopMode getLoopMode() const noexcept { return loopMode_.load(); }
+    InterpolationQuality getInterpolationQuality() const noexcept { return interpolation_.load(); }
+
+    //--------------------------------------------------------------------------
+    // File Information Getters
+    //--------------------------------------------------------------------------
+
+    uint32_t getFileSampleRate() const noexcept { return fileSampleRate_.load(); }
+    uint16_t getNumChannels() const noexcept { return numChannels_.load(); }
+    size_t getNumSamples() const noexcept { return numSamples_.load(); }
+    uint16_t getBitsPerSample() const noexcept { return bitsPerSample_.load(); }
+
+    /// Get total duration in seconds.
+    float getDurationSeconds() const noexcept
+    {
+      const uint32_t rate = dataSampleRate_.load();
+      const size_t frames = numSamples_.load();
+      if (rate == 0 || frames == 0)
+        return 0.0f;
+      return static_cast<float>(frames) / static_cast<float>(rate);
+    }
+
+    /// Get the file path (empty if loaded from memory).
+    std::string getFilePath() const
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return current_ ? current_->path : std::string();
+    }
+
+    //--------------------------------------------------------------------------
+    // Audio Processing (Real-time safe, lock-free)
+    //--------------------------------------------------------------------------
+
+    /// Process and return a single mono sample.
+    /// For stereo files, channels are mixed to mono.
+    /// This is real-time safe and lock-free.
+    float processSample() noexcept
+    {
+      float sample;
+      renderBlock<true>(acquireBuffer(), &sample, nullptr, 1, 1);
+      return sample;
+    }
+
+    /// Process and return a stereo sample pair.
+    /// For mono files, the same sample is returned for both channels.
+    void processSampleStereo(float& left, float& right) noexcept
+    {
+      renderBlock<false>(acquireBuffer(), &left, &right, 1, 1);
+    }
+
+    /// Process a buffer of mono samples.
+    void processBuffer(float* output, size_t numSamples) noexcept
+    {
+      if (output == nullptr)
+        return;
+
+      renderBlock<true>(acquireBuffer(), output, nullptr, 1, numSamples);
+    }
+
+    /// Process a buffer of stereo samples (interleaved L/R).
+    /// Parameter changes made by other threads take effect at the next call.
+    void processBufferStereo(float* output, size_t numFrames) noexcept
+    {
+      if (output == nullptr)
+        return;
+
+      renderBlock<false>(acquireBuffer(), output, output + 1, 2, numFrames);
+    }
+
+    /// Process stereo buffers (separate L/R).
+    void processBufferStereoSplit(float* left, float* right, size_t numFrames) noexcept
+    {
+      if (left == nullptr || right == nullptr)
+        return;
+
+      renderBlock<false>(acquireBuffer(), left, right, 1, numFrames);
+    }
+
+    //--------------------------------------------------------------------------
+    // Polyphonic voices (audio thread only)
+    //
+    // A pool of up to kMaxVoices extra playheads that all read the loaded
+    // buffer, for layering and retriggering slices without cutting off the
+    // previous one. Voices share the speed/pitch/volume/loop/reverse/quality
+    // settings with the main playhead, but each plays its own region of the
+    // file and the main playhead is unaffected. Voice state is plain data
+    // owned by the audio thread: no extra buffers, locks or atomics. Loading
+    // a different buffer silences all voices.
+    //
+    // Streamed files only buffer around the main playhead, so voices elsewhere
+    // in the file count as stream underruns; use Resident or MemoryMapped
+    // storage for polyphonic playback.
+    //--------------------------------------------------------------------------
+
+    static constexpr int kMaxVoices = 16;
+
+    /// Set the number of voices in use (1..kMaxVoices). Voices beyond the
+    /// limit are stopped.
+    void setVoiceCount(int count) noexcept
+    {
+      voiceCount_ = std::max(1, std::min(count, kMaxVoices));
+      for (int v = voiceCount_; v < kMaxVoices; ++v)
+        voices_[v].head.playing = false;
+    }
+
+    int getVoiceCount() const noexcept { return voiceCount_; }
+
+    /// Start a voice on frames [startFrame, endFrame), from the end when
+    /// reverse is set. Takes a free voice, or steals the oldest one.
+    /// tag is an arbitrary key for releaseVoices() (e.g. a trigger channel).
+    /// @return The voice index, or -1 if no file is loaded
+    int triggerVoice(size_t startFrame, size_t endFrame, int tag = 0) noexcept
+    {
+      const detail::SampleBuffer* buf = acquireVoiceBuffer();
+      if (buf == nullptr || buf->frames == 0)
+        return -1;
+
+      const size_t start = std::min(startFrame, buf->frames - 1);
+      const size_t end = std::max(start + 1, std::min(endFrame, buf->frames));
+
+      int voice = 0;
+      for (int v = 0; v < voiceCount_; ++v)
+      {
+        if (!voices_[v].head.playing)
+        {
+          voice = v;
+          break;
+        }
+        if (voices_[v].age < voices_[voice].age)
+          voice = v;
+      }
+
+      Voice& target = voices_[voice];
+      target.head.start = static_cast<double>(start);
+      target.head.end = static_cast<double>(end);
+      target.head.position = reverse_.load() ? static_cast<double>(end - 1) : static_cast<double>(start);
+      target.head.direction = 1;
+      target.head.playing = true;
+      target.tag = tag;
+      target.age = ++voiceClock_;
+      return voice;
+    }
+
+    /// Stop every voice started with this tag.
+    void releaseVoices(int tag) noexcept
+    {
+      for (Voice& voice : voices_)
+      {
+        if (voice.tag == tag)
+          voice.head.playing = false;
+      }
+    }
+
+    /// Stop all voices.
+    void stopVoices() noexcept
+    {
+      for (Voice& voice : voices_)
+        voice.head.playing = false;
+    }
+
+    bool isVoiceActive(int voice) const noexcept
+    {
+      return voice >= 0 && voice < voiceCount_ && voices_[voice].head.playing;
+    }
+
+    int getActiveVoiceCount() const noexcept
+    {
+      int count = 0;
+      for (int v = 0; v < voiceCount_; ++v)
+        count += voices_[v].head.playing ? 1 : 0;
+      return count;
+    }
+
+    /// Render one frame of every voice: voice v goes to left[v]/right[v]
+    /// (getVoiceCount() entries each; idle voices write 0).
+    void processVoicesStereo(float* left, float* right) noexcept
+    {
+      DspStats::Timer timer(stats_, 1);
+      const detail::SampleBuffer* buf = acquireVoiceBuffer();
+      if (buf == nullptr)
+      {
+        for (int v = 0; v < voiceCount_; ++v)
+          left[v] = right[v] = 0.0f;
+        return;
+      }
+
+      // One parameter snapshot for the whole pool
+      const RenderParams params = snapshotParams(*buf);
+      for (int v = 0; v < voiceCount_; ++v)
+      {
+        Voice& voice = voices_[v];
+        if (voice.head.playing)
+          renderPlayhead<false>(*buf, params, voice.head, left + v, right + v, 1, 1);
+        else
+          left[v] = right[v] = 0.0f;
+      }
+    }
+
+    //--------------------------------------------------------------------------
+    // Direct sample access (for advanced use cases)
+    //--------------------------------------------------------------------------
+
+    /// Get a raw sample from the loaded data (non-audio threads).
+    /// For many reads, hold getSampleBuffer() and read from it directly.
+    /// @param frameIndex Sample frame index (0 to numSamples-1)
+    /// @param channel Channel index (0 for mono/left, 1 for right in stereo)
+    /// @return Sample value, or 0.0f if out of bounds (or not buffered when streaming)
+    float getRawSample(size_t frameIndex, size_t channel = 0) const noexcept
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!current_ || frameIndex >= current_->frames || channel >= current_->channels)
+      {
+        return 0.0f;
+      }
+      float value = 0.0f;
+      return current_->read(frameIndex, channel, value) ? value : 0.0f;
+    }
+
+    /// Get read-only access to the decoded float buffer.
+    /// Returns nullptr in MemoryMapped/Streaming mode (use getRawSample instead).
+    /// Valid until the next load or unload.
+    const float* getAudioData() const noexcept
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return current_ ? current_->samples.data() : nullptr;
+    }
+
+    /// Get the size of the decoded float buffer (0 in MemoryMapped/Streaming mode).
+    size_t getAudioDataSize() const noexcept
+    {
       std::lock_guard<std::mutex> lock(mutex_);
+      return current_ ? current_->samples.size() : 0;
+    }
 
-      size_t offset = 0;
+  private:
+    //--------------------------------------------------------------------------
+    // Internal helper methods
+    //--------------------------------------------------------------------------
 
-      // Read RIFF header
+    /// Walk the RIFF chunks of an open file up to the start of the data chunk
+    /// and validate the format. Leaves the file positioned at the first frame.
+    static WavError readWavHeader(FILE* file, detail::WavFormatInfo& info)
+    {
+      // Read and validate RIFF header
       detail::RiffHeader riffHeader;
-      std::memcpy(&riffHeader, data + offset, sizeof(riffHeader));
-      offset += sizeof(riffHeader);
+      if (std::fread(&riffHeader, sizeof(riffHeader), 1, file) != 1)
+      {
+        return WavError::InvalidFormat;
+      }
 
       if (!detail::memEqual4(riffHeader.chunkId, "RIFF") ||
           !detail::memEqual4(riffHeader.format, "WAVE"))
@@ -515,50 +1863,65 @@ namespace ShortwavDSP
         return WavError::InvalidFormat;
       }
 
-      // Parse chunks
-      detail::FmtChunk fmtChunk{};
+      // Parse chunks to find fmt and data
+      info = detail::WavFormatInfo{};
+      detail::FmtChunk& fmtChunk = info.fmt;
       bool foundFmt = false;
       bool foundData = false;
-      uint32_t dataSize = 0;
-      size_t dataOffset = 0;
 
-      while (offset + 8 <= size && (!foundFmt || !foundData))
+      while (!foundFmt || !foundData)
       {
         char chunkId[4];
         uint32_t chunkSize;
 
-        std::memcpy(chunkId, data + offset, 4);
-        offset += 4;
-        std::memcpy(&chunkSize, data + offset, 4);
-        offset += 4;
+        if (std::fread(chunkId, 4, 1, file) != 1 ||
+            std::fread(&chunkSize, 4, 1, file) != 1)
+        {
+          if (foundFmt && foundData)
+            break;
+          return WavError::CorruptedData;
+        }
 
         if (detail::memEqual4(chunkId, "fmt "))
         {
-          if (offset + 16 > size)
+          // Read format chunk
+          if (chunkSize < 16)
           {
-            return WavError::CorruptedData;
+            return WavError::InvalidFormat;
+          }
+
+          // Read the basic format info (16 bytes)
+          if (std::fread(&fmtChunk.audioFormat, 2, 1, file) != 1 ||
+              std::fread(&fmtChunk.numChannels, 2, 1, file) != 1 ||
+              std::fread(&fmtChunk.sampleRate, 4, 1, file) != 1 ||
+              std::fread(&fmtChunk.byteRate, 4, 1, file) != 1 ||
+              std::fread(&fmtChunk.blockAlign, 2, 1, file) != 1 ||
+              std::fread(&fmtChunk.bitsPerSample, 2, 1, file) != 1)
+          {
+            return WavError::ReadError;
           }
 
-          std::memcpy(&fmtChunk.audioFormat, data + offset, 2);
-          std::memcpy(&fmtChunk.numChannels, data + offset + 2, 2);
-          std::memcpy(&fmtChunk.sampleRate, data + offset + 4, 4);
-          std::memcpy(&fmtChunk.byteRate, data + offset + 8, 4);
-          std::memcpy(&fmtChunk.blockAlign, data + offset + 12, 2);
-          std::memcpy(&fmtChunk.bitsPerSample, data + offset + 14, 2);
+          // Skip any extra format bytes
+          if (chunkSize > 16)
+          {
+            std::fseek(file, static_cast<long>(chunkSize - 16), SEEK_CUR);
+          }
 
-          offset += chunkSize + (chunkSize & 1);
           foundFmt = true;
         }
         else if (detail::memEqual4(chunkId, "data"))
         {
-          dataSize = chunkSize;
-          dataOffset = offset;
+          info.dataSize = chunkSize;
+          info.dataOffset = static_cast<size_t>(std::ftell(file));
           foundData = true;
+          // Don't skip past data chunk - we'll read it below
           break;
         }
         else
         {
-          offset += chunkSize + (chunkSize & 1);
+          // Skip unknown chunk (ensure even alignment)
+          uint32_t skipSize = chunkSize + (chunkSize & 1);
+          std::fseek(file, static_cast<long>(skipSize), SEEK_CUR);
         }
       }
 
@@ -567,651 +1930,1065 @@ namespace ShortwavDSP
         return WavError::InvalidFormat;
       }
 
-      // Validate format
-      if (fmtChunk.audioFormat != detail::kWavFormatPCM &&
-          fmtChunk.audioFormat != detail::kWavFormatIEEEFloat)
+      return detail::validateFileFormat(fmtChunk);
+    }
+
+    /// Map a file and point a new buffer at its data chunk.
+    WavError loadFileMapped(const char* path)
+    {
+      std::shared_ptr<detail::SampleBuffer> buffer;
+      try
       {
-        return WavError::UnsupportedFormat;
+        buffer = std::make_shared<detail::SampleBuffer>();
       }
-
-      if (fmtChunk.numChannels == 0 || fmtChunk.numChannels > 2)
+      catch (const std::bad_alloc&)
       {
-        return WavError::UnsupportedFormat;
+        return WavError::OutOfMemory;
       }
 
-      // Calculate frames
-      const uint32_t bytesPerSample = fmtChunk.bitsPerSample / 8;
-      const uint32_t bytesPerFrame = bytesPerSample * fmtChunk.numChannels;
-      const size_t numFrames = dataSize / bytesPerFrame;
-
-      if (numFrames == 0 || dataOffset + dataSize > size)
+      detail::MappedFile& mapping = buffer->mapping;
+      if (!mapping.open(path))
       {
-        return WavError::CorruptedData;
+        return WavError::FileNotFound;
       }
 
-      // Allocate and convert
-      std::vector<float> newData;
-      try
+      detail::WavFormatInfo info;
+      const WavError parseResult = detail::parseWavHeader(mapping.data(), mapping.size(), info);
+      if (parseResult != WavError::None)
       {
-        newData.resize(numFrames * fmtChunk.numChannels);
+        return parseResult == WavError::InvalidParameter ? WavError::InvalidFormat : parseResult;
       }
-      catch (const std::bad_alloc&)
+
+      const detail::FmtChunk& fmt = info.fmt;
+      const WavError formatResult = detail::validateFileFormat(fmt);
+      if (formatResult != WavError::None)
       {
-        return WavError::OutOfMemory;
+        return formatResult;
       }
 
-      // Convert samples from memory
-      WavError convertResult = convertSamplesFromMemory(
-          data + dataOffset, newData.data(), numFrames,
-          fmtChunk.numChannels, fmtChunk.bitsPerSample,
-          fmtChunk.audioFormat == detail::kWavFormatIEEEFloat);
+      const size_t bytesPerSample = fmt.bitsPerSample / 8;
+      const size_t bytesPerFrame = bytesPerSample * fmt.numChannels;
+      const size_t numFrames = info.dataSize / bytesPerFrame;
 
-      if (convertResult != WavError::None)
+      if (numFrames == 0 || info.dataOffset + numFrames * bytesPerFrame > mapping.size())
       {
-        return convertResult;
+        return WavError::CorruptedData;
       }
 
-      // Store file info
-      audioData_ = std::move(newData);
-      filePath_.clear();
-      fileSampleRate_ = fmtChunk.sampleRate;
-      numChannels_ = fmtChunk.numChannels;
-      numSamples_ = numFrames;
-      bitsPerSample_ = fmtChunk.bitsPerSample;
-
-      playbackPosition_.store(0.0);
-      state_.store(PlaybackState::Stopped);
-      pingPongDirection_.store(1);
+      buffer->pcm = mapping.data() + info.dataOffset;
+      if (!detail::pcmFormatFor(fmt.bitsPerSample, fmt.audioFormat == detail::kWavFormatIEEEFloat, buffer->format))
+      {
+        return WavError::UnsupportedFormat;
+      }
+      buffer->bytesPerSample = bytesPerSample;
+      buffer->path = path;
+      setBufferFormat(*buffer, fmt, numFrames);
+      const WavError peaksResult = buildPeaks(*buffer, true);
+      if (peaksResult != WavError::None)
+      {
+        return peaksResult;
+      }
+      publish(std::move(buffer));
 
       return WavError::None;
     }
 
-    /// Unload the current file and free memory.
-    void unload()
-    {
-      std::lock_guard<std::mutex> lock(mutex_);
-      audioData_.clear();
-      audioData_.shrink_to_fit();
-      filePath_.clear();
-      numSamples_ = 0;
-      numChannels_ = 1;
-      playbackPosition_.store(0.0);
-      state_.store(PlaybackState::Stopped);
-    }
-
-    /// Check if a file is currently loaded.
-    bool isLoaded() const noexcept
-    {
-      return numSamples_ > 0 && !audioData_.empty();
-    }
-
-    //--------------------------------------------------------------------------
-    // Playback Control (Thread-safe)
-    //--------------------------------------------------------------------------
-
-    /// Start or resume playback.
-    void play() noexcept
+    /// Open a file for disk streaming: parse the header, load the preload
+    /// caches and prime the ring from the start.
+    WavError loadFileStreaming(const char* path)
     {
-      if (isLoaded())
+      std::shared_ptr<detail::SampleBuffer> buffer;
+      try
       {
-        state_.store(PlaybackState::Playing);
+        buffer = std::make_shared<detail::SampleBuffer>();
+        buffer->stream.reset(new detail::WavStream());
+      }
+      catch (const std::bad_alloc&)
+      {
+        return WavError::OutOfMemory;
       }
-    }
-
-    /// Pause playback (maintains position).
-    void pause() noexcept
-    {
-      state_.store(PlaybackState::Paused);
-    }
-
-    /// Stop playback and reset position to start.
-    void stop() noexcept
-    {
-      state_.store(PlaybackState::Stopped);
-      playbackPosition_.store(reverse_.load() ? static_cast<double>(numSamples_ - 1) : 0.0);
-      pingPongDirection_.store(reverse_.load() ? -1 : 1);
-    }
 
-    /// Seek to a specific position (0.0 = start, 1.0 = end).
-    void seek(float normalizedPosition) noexcept
-    {
-      if (numSamples_ > 0)
+      detail::WavStream* stream = buffer->stream.get();
+      stream->file = std::fopen(path, "rb");
+      if (stream->file == nullptr)
       {
-        const float clamped = detail::wavClamp(normalizedPosition, 0.0f, 1.0f);
-        playbackPosition_.store(clamped * static_cast<double>(numSamples_ - 1));
+        return WavError::FileNotFound;
       }
-    }
 
-    /// Seek to a specific sample position.
-    void seekToSample(size_t sampleIndex) noexcept
-    {
-      if (numSamples_ > 0)
+      detail::WavFormatInfo info;
+      const WavError headerResult = readWavHeader(stream->file, info);
+      if (headerResult != WavError::None)
       {
-        playbackPosition_.store(static_cast<double>(std::min(sampleIndex, numSamples_ - 1)));
+        return headerResult;
       }
-    }
 
-    /// Get current playback state.
-    PlaybackState getState() const noexcept
-    {
-      return state_.load();
-    }
+      const detail::FmtChunk& fmt = info.fmt;
+      stream->dataOffset = info.dataOffset;
+      stream->channels = fmt.numChannels;
+      stream->bytesPerSample = fmt.bitsPerSample / 8;
+      if (!detail::pcmFormatFor(fmt.bitsPerSample, fmt.audioFormat == detail::kWavFormatIEEEFloat, stream->format))
+      {
+        return WavError::UnsupportedFormat;
+      }
+      stream->numFrames = info.dataSize / (stream->bytesPerSample * fmt.numChannels);
 
-    /// Check if currently playing.
-    bool isPlaying() const noexcept
-    {
-      return state_.load() == PlaybackState::Playing;
-    }
+      if (stream->numFrames == 0)
+      {
+        return WavError::CorruptedData;
+      }
 
-    /// Get current playback position (0.0 to 1.0).
-    float getPlaybackPosition() const noexcept
-    {
-      if (numSamples_ == 0)
-        return 0.0f;
-      return static_cast<float>(playbackPosition_.load() / static_cast<double>(numSamples_ - 1));
-    }
+      const size_t n = stream->numFrames;
+      const size_t ringFrames = streamBufferFrames_.load();
+      const size_t preload = std::min(streamPreloadFrames_.load(), n / 2);
+      stream->headFrames = preload;
+      stream->tailStart = n - preload;
 
-    /// Get current playback position in samples.
-    double getPlaybackPositionSamples() const noexcept
-    {
-      return playbackPosition_.load();
-    }
+      constexpr size_t kStagingFrames = 4096;
+      stream->stagingFrames = std::min(kStagingFrames, ringFrames / 4);
+      try
+      {
+        stream->staging.resize(stream->stagingFrames * stream->bytesPerSample * stream->channels);
+        stream->head.resize(preload * stream->channels);
+        stream->tail.resize(preload * stream->channels);
+      }
+      catch (const std::bad_alloc&)
+      {
+        return WavError::OutOfMemory;
+      }
 
-    //--------------------------------------------------------------------------
-    // Parameter Setters (Thread-safe, atomic)
-    //--------------------------------------------------------------------------
+      if (!stream->ring.allocate(ringFrames, stream->channels))
+      {
+        return WavError::OutOfMemory;
+      }
 
-    /// Set the output sample rate (host sample rate).
-    void setSampleRate(float sampleRate) noexcept
-    {
-      outputSampleRate_.store(std::max(1.0f, sampleRate));
-    }
+      if (!stream->decodeTo(stream->head.data(), 0, preload) ||
+          !stream->decodeTo(stream->tail.data(), stream->tailStart, preload))
+      {
+        return WavError::ReadError;
+      }
 
-    /// Set playback speed (1.0 = normal, 0.5 = half speed, 2.0 = double).
-    /// Speed affects both tempo and duration, not pitch when combined with pitch.
-    void setSpeed(float speed) noexcept
-    {
-      speed_.store(detail::wavClamp(speed, 0.01f, 100.0f));
-    }
+      stream->fill(0.0, 1);
 
-    /// Set pitch ratio (1.0 = original, 0.5 = octave down, 2.0 = octave up).
-    /// Pitch affects playback rate but is combined with speed for final rate.
-    void setPitch(float pitch) noexcept
-    {
-      pitch_.store(detail::wavClamp(pitch, 0.01f, 100.0f));
-    }
+      buffer->path = path;
+      setBufferFormat(*buffer, fmt, n);
+      const WavError peaksResult = buildPeaks(*buffer, true);
+      if (peaksResult != WavError::None)
+      {
+        return peaksResult;
+      }
+      publish(std::move(buffer));
 
-    /// Set playback volume (0.0 = silence, 1.0 = unity).
-    void setVolume(float volume) noexcept
-    {
-      volume_.store(detail::wavClamp(volume, 0.0f, 10.0f));
+      return WavError::None;
     }
 
-    /// Set reverse playback mode.
-    void setReverse(bool reverse) noexcept
+    /// Summarise a filled buffer into its peak pyramid and onset list (one
+    /// sequential pass; the onset detector sees each chunk the pyramid reads).
+    /// With reportProgress the pass takes the load progress from where the
+    /// earlier stages left it to 1.
+    WavError buildPeaks(detail::SampleBuffer& buffer, bool reportProgress)
     {
-      const bool wasReverse = reverse_.load();
-      reverse_.store(reverse);
-
-      // If changing direction while stopped, reset position
-      if (wasReverse != reverse && state_.load() == PlaybackState::Stopped)
+      const uint16_t channels = buffer.channels;
+      const size_t frames = buffer.frames;
+      const float progressFrom = loadProgress_.load(std::memory_order_relaxed);
+      OnsetDetector detector;
+      detector.begin(frames, channels, buffer.sampleRate);
+      auto finishChunk = [&](const float* out, size_t first, size_t count) {
+        detector.process(out, count);
+        if (reportProgress)
+          advanceLoadProgress(progressFrom + (1.0f - progressFrom) * static_cast<float>(first + count) /
+                                                 static_cast<float>(frames));
+      };
+
+      bool ok;
+      if (buffer.stream)
       {
-        playbackPosition_.store(reverse ? static_cast<double>(numSamples_ - 1) : 0.0);
-        pingPongDirection_.store(reverse ? -1 : 1);
+        detail::WavStream& stream = *buffer.stream;
+        ok = buffer.peaks.build(frames, channels, [&stream, &finishChunk](size_t first, size_t count, float* out) {
+          if (!stream.decodeTo(out, first, count))
+            return false;
+          finishChunk(out, first, count);
+          return true;
+        });
+        if (!ok)
+          return WavError::ReadError;
+      }
+      else
+      {
+        ok = buffer.peaks.build(frames, channels, [&buffer, &finishChunk, channels](size_t first, size_t count, float* out) {
+          if (buffer.pcm != nullptr)
+          {
+            detail::decodePcmBlock(buffer.pcm + first * channels * buffer.bytesPerSample, out, count * channels,
+                                   buffer.format);
+          }
+          else
+          {
+            std::memcpy(out, buffer.samples.data() + first * channels, count * channels * sizeof(float));
+          }
+          finishChunk(out, first, count);
+          return true;
+        });
+        if (!ok)
+          return WavError::OutOfMemory;
       }
-    }
-
-    /// Set loop mode.
-    void setLoopMode(LoopMode mode) noexcept
-    {
-      loopMode_.store(mode);
-    }
 
-    /// Set interpolation quality.
-    void setInterpolationQuality(InterpolationQuality quality) noexcept
-    {
-      interpolation_.store(quality);
+      try
+      {
+        buffer.onsets = detector.finish();
+      }
+      catch (const std::bad_alloc&)
+      {
+        buffer.onsets.clear(); // Auto-slicing falls back to equal slices
+      }
+      return WavError::None;
     }
 
-    //--------------------------------------------------------------------------
-    // Parameter Getters
-    //--------------------------------------------------------------------------
+    // Resident decode: data chunks from kParallelDecodeBytes up are split into
+    // kDecodeChunkBytes tasks for a few threads (smaller ones decode inline)
+    static constexpr size_t kParallelDecodeBytes = size_t(8) << 20;
+    static constexpr size_t kDecodeChunkBytes = size_t(1) << 20;
 
-    float getSampleRate() const noexcept { return outputSampleRate_.load(); }
-    float getSpeed() const noexcept { return speed_.load(); }
-    float getPitch() const noexcept { return pitch_.load(); }
-    float getVolume() const noexcept { return volume_.load(); }
-    bool getReverse() const noexcept { return reverse_.load(); }
-    LoopMode getLoopMode() const noexcept { return loopMode_.load(); }
-    InterpolationQuality getInterpolationQuality() const noexcept { return interpolation_.load(); }
+    // Load progress at the end of the decode and rate conversion stages; the
+    // peak/onset pass covers the rest
+    static constexpr float kDecodeProgressEnd = 0.6f;
+    static constexpr float kRateProgressEnd = 0.75f;
 
-    //--------------------------------------------------------------------------
-    // File Information Getters
-    //--------------------------------------------------------------------------
+    /// Raise the load progress to value (no-op if it is already past it; the
+    /// decode threads report out of order).
+    void advanceLoadProgress(float value) noexcept
+    {
+      float current = loadProgress_.load(std::memory_order_relaxed);
+      while (value > current && !loadProgress_.compare_exchange_weak(current, value, std::memory_order_relaxed))
+      {
+      }
+    }
 
-    uint32_t getFileSampleRate() const noexcept { return fileSampleRate_; }
-    uint16_t getNumChannels() const noexcept { return numChannels_; }
-    size_t getNumSamples() const noexcept { return numSamples_; }
-    uint16_t getBitsPerSample() const noexcept { return bitsPerSample_; }
+    // Marks the load finished (progress 1) however the loader returns
+    struct LoadProgressDone
+    {
+      std::atomic<float>& progress;
+      ~LoadProgressDone() { progress.store(1.0f); }
+    };
 
-    /// Get total duration in seconds.
-    float getDurationSeconds() const noexcept
+    /// Copy the format fields every loader shares into a new buffer.
+    static void setBufferFormat(detail::SampleBuffer& buffer, const detail::FmtChunk& fmt, size_t numFrames) noexcept
     {
-      if (fileSampleRate_ == 0 || numSamples_ == 0)
-        return 0.0f;
-      return static_cast<float>(numSamples_) / static_cast<float>(fileSampleRate_);
+      buffer.sampleRate = fmt.sampleRate;
+      buffer.fileSampleRate = fmt.sampleRate;
+      buffer.channels = fmt.numChannels;
+      buffer.frames = numFrames;
+      buffer.bitsPerSample = fmt.bitsPerSample;
     }
 
-    /// Get the file path (empty if loaded from memory).
-    const std::string& getFilePath() const noexcept { return filePath_; }
+    /// Output rate as a whole number of Hz (engine rates are integers).
+    uint32_t targetSampleRate() const noexcept
+    {
+      return static_cast<uint32_t>(std::lround(outputSampleRate_.load()));
+    }
+
+    /// Convert a filled Resident buffer to the output rate if enabled and
+    /// needed, keeping the decoded samples as SampleBuffer::sourceSamples. A
+    /// buffer at its file's rate that already matches is left unchanged. The
+    /// load progress advances from where it stands to kRateProgressEnd.
+    WavError convertToOutputRate(detail::SampleBuffer& buffer)
+    {
+      const uint32_t target = targetSampleRate();
+      if (!resampleOnLoad_.load() || buffer.sampleRate == target)
+      {
+        return WavError::None;
+      }
+
+      try
+      {
+        const float progressFrom = loadProgress_.load(std::memory_order_relaxed);
+        std::vector<float> converted;
+        if (!resampleSinc(buffer.samples.data(), buffer.frames, buffer.channels,
+                          static_cast<double>(buffer.sampleRate), static_cast<double>(target), converted,
+                          [this, progressFrom](float done) {
+                            advanceLoadProgress(progressFrom + (kRateProgressEnd - progressFrom) * done);
+                            return !abortConversions_.load(std::memory_order_relaxed);
+                          }))
+        {
+          return abortConversions_.load() ? WavError::InvalidState : WavError::OutOfMemory;
+        }
+        buffer.sourceSamples = std::make_shared<const std::vector<float>>(std::move(buffer.samples));
+        buffer.samples = std::move(converted);
+      }
+      catch (const std::bad_alloc&)
+      {
+        return WavError::OutOfMemory;
+      }
+      buffer.sampleRate = target;
+      buffer.frames = buffer.samples.size() / buffer.channels;
+      return WavError::None;
+    }
 
     //--------------------------------------------------------------------------
-    // Audio Processing (Real-time safe, lock-free)
+    // Buffer publication (lock-free handoff to the audio thread)
     //--------------------------------------------------------------------------
-
-    /// Process and return a single mono sample.
-    /// For stereo files, channels are mixed to mono.
-    /// This is real-time safe and lock-free.
-    float processSample() noexcept
+    //
+    // published_ is the latest buffer. The audio thread copies it into active_
+    // at the start of each block and advertises it in hazard_ (a single-reader
+    // hazard pointer). Replaced buffers move to retired_ and are only released
+    // once hazard_ no longer points at them, so the audio thread never frees
+    // memory and never sees a dangling pointer.
+
+    /// Make buffer (or nullptr to unload) the current one and reset playback.
+    void publish(std::shared_ptr<detail::SampleBuffer> buffer)
     {
-      if (!isLoaded() || state_.load() != PlaybackState::Playing)
+      std::lock_guard<std::mutex> lock(mutex_);
+
+      if (buffer)
       {
-        return 0.0f;
+        fileSampleRate_.store(buffer->fileSampleRate);
+        dataSampleRate_.store(buffer->sampleRate);
+        numChannels_.store(buffer->channels);
+        numSamples_.store(buffer->frames);
+        bitsPerSample_.store(buffer->bitsPerSample);
+        storageMode_.store(buffer->mode());
+      }
+      else
+      {
+        numSamples_.store(0);
+        numChannels_.store(1);
+        storageMode_.store(WavStorageMode::Resident);
       }
 
-      const float sample = readInterpolatedSample();
+      playbackPosition_.store(0.0);
+      state_.store(PlaybackState::Stopped);
+      pingPongDirection_.store(1);
+      streamUnderruns_.store(0, std::memory_order_relaxed);
 
-      // Advance playback position
-      advancePosition();
+      published_.store(buffer.get(), std::memory_order_seq_cst);
+      generation_.fetch_add(1, std::memory_order_release);
+      if (current_)
+      {
+        retired_.push_back(std::move(current_));
+      }
+      current_ = std::move(buffer);
 
-      return sample * volume_.load();
+      reclaimRetired();
     }
 
-    /// Process and return a stereo sample pair.
-    /// For mono files, the same sample is returned for both channels.
-    void processSampleStereo(float& left, float& right) noexcept
+    /// Replace expected with a rate-converted copy of it, keeping the transport
+    /// running: the position is rescaled by timeScale (new rate / old rate).
+    /// Dropped if a load or unload replaced expected in the meantime.
+    void publishConverted(std::shared_ptr<detail::SampleBuffer> buffer, const detail::SampleBuffer* expected,
+                          double timeScale)
     {
-      if (!isLoaded() || state_.load() != PlaybackState::Playing)
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (current_.get() != expected)
       {
-        left = right = 0.0f;
         return;
       }
 
-      readInterpolatedSampleStereo(left, right);
+      dataSampleRate_.store(buffer->sampleRate);
+      numSamples_.store(buffer->frames);
+      const double maxPos = static_cast<double>(buffer->frames - 1);
+      playbackPosition_.store(std::min(playbackPosition_.load() * timeScale, maxPos));
 
-      const float vol = volume_.load();
-      left *= vol;
-      right *= vol;
+      published_.store(buffer.get(), std::memory_order_seq_cst);
+      generation_.fetch_add(1, std::memory_order_release);
+      retired_.push_back(std::move(current_));
+      current_ = std::move(buffer);
 
-      advancePosition();
+      reclaimRetired();
     }
 
-    /// Process a buffer of mono samples.
-    void processBuffer(float* output, size_t numSamples) noexcept
+    /// Release retired buffers not held by the audio thread (caller holds mutex_).
+    size_t reclaimRetired() noexcept
     {
-      if (output == nullptr)
-        return;
+      const detail::SampleBuffer* inUse = hazard_.load(std::memory_order_seq_cst);
+      retired_.erase(std::remove_if(retired_.begin(), retired_.end(),
+                                    [inUse](const std::shared_ptr<const detail::SampleBuffer>& b) {
+                                      return b.get() != inUse;
+                                    }),
+                     retired_.end());
+      return retired_.size();
+    }
 
-      for (size_t i = 0; i < numSamples; ++i)
+    /// Pick up the latest published buffer (audio thread, once per block).
+    /// A single atomic load when nothing changed. On a change the hazard
+    /// pointer is set first and then re-validated against published_, so a
+    /// concurrent reclaimRetired() either sees the hazard or the buffer is
+    /// never dereferenced.
+    const detail::SampleBuffer* acquireBuffer() noexcept
+    {
+      const detail::SampleBuffer* latest = published_.load(std::memory_order_acquire);
+      if (latest != active_)
       {
-        output[i] = processSample();
+        do
+        {
+          active_ = latest;
+          hazard_.store(active_, std::memory_order_seq_cst);
+          latest = published_.load(std::memory_order_seq_cst);
+        } while (latest != active_);
       }
+      return active_;
     }
 
-    /// Process a buffer of stereo samples (interleaved L/R).
-    void processBufferStereo(float* output, size_t numFrames) noexcept
+    /// Take over all state of another player (both mutexes held by caller).
+    void moveFrom(WavPlayer& other) noexcept
     {
-      if (output == nullptr)
-        return;
+      outputSampleRate_.store(other.outputSampleRate_.load());
+      speed_.store(other.speed_.load());
+      pitch_.store(other.pitch_.load());
+      volume_.store(other.volume_.load());
+      playbackPosition_.store(other.playbackPosition_.load());
+      state_.store(other.state_.load());
+      loopMode_.store(other.loopMode_.load());
+      reverse_.store(other.reverse_.load());
+      pingPongDirection_.store(other.pingPongDirection_.load());
+      interpolation_.store(other.interpolation_.load());
+      fileSampleRate_.store(other.fileSampleRate_.load());
+      dataSampleRate_.store(other.dataSampleRate_.load());
+      resampleOnLoad_.store(other.resampleOnLoad_.load());
+      numChannels_.store(other.numChannels_.load());
+      numSamples_.store(other.numSamples_.load());
+      bitsPerSample_.store(other.bitsPerSample_.load());
+      storageMode_.store(other.storageMode_.load());
+      streamBufferFrames_.store(other.streamBufferFrames_.load());
+      streamPreloadFrames_.store(other.streamPreloadFrames_.load());
+      streamUnderruns_.store(other.streamUnderruns_.load());
+      stats_ = other.stats_;
+
+      // Our own buffers are still owned here, so they can simply be dropped
+      current_ = std::move(other.current_);
+      retired_ = std::move(other.retired_);
+      published_.store(other.published_.load());
+      hazard_.store(other.hazard_.load());
+      active_ = other.active_;
+
+      other.current_.reset();
+      other.retired_.clear();
+      other.published_.store(nullptr);
+      other.hazard_.store(nullptr);
+      other.active_ = nullptr;
+      other.numSamples_.store(0);
+      other.storageMode_.store(WavStorageMode::Resident);
+    }
 
-      for (size_t i = 0; i < numFrames; ++i)
+    /// Read and convert the data chunk of an open file into a float buffer.
+    /// Files of kParallelDecodeBytes or more are cut into chunks of
+    /// kDecodeChunkBytes that a few threads read and convert at once (see
+    /// worker-pool.h); each extra thread reads through its own handle on
+    /// path, so no thread waits on another's seek.
+    WavError readAndConvertSamples(const char* path, FILE* file, uint64_t dataOffset, float* output,
+                                   size_t numFrames, uint16_t channels, uint16_t bits, bool isFloat)
+    {
+      detail::PcmFormat format;
+      if (!detail::pcmFormatFor(bits, isFloat, format))
       {
-        processSampleStereo(output[i * 2], output[i * 2 + 1]);
+        return WavError::UnsupportedFormat;
       }
+      const size_t bytesPerFrame = static_cast<size_t>(bits / 8) * channels;
+      const size_t chunkFrames = std::max<size_t>(1, kDecodeChunkBytes / bytesPerFrame);
+      const size_t numChunks = (numFrames + chunkFrames - 1) / chunkFrames;
+      const unsigned threads = numFrames * bytesPerFrame >= kParallelDecodeBytes ? defaultThreadCount() : 1;
+
+      struct FileCloser
+      {
+        void operator()(FILE* f) const noexcept { std::fclose(f); }
+      };
+
+      // One reader per thread: the first borrows the caller's handle
+      struct ChunkReader
+      {
+        WavPlayer* player;
+        FILE* file;
+        std::unique_ptr<FILE, FileCloser> owned;
+        std::vector<uint8_t> staging;
+        uint64_t dataOffset;
+        float* output;
+        size_t numFrames, chunkFrames, numChunks, bytesPerFrame;
+        uint16_t channels;
+        detail::PcmFormat format;
+        std::atomic<size_t>* done;
+
+        bool operator()(size_t chunk)
+        {
+          if (file == nullptr)
+            return false;
+          const size_t first = chunk * chunkFrames;
+          const size_t count = std::min(chunkFrames, numFrames - first);
+          const size_t bytes = count * bytesPerFrame;
+          if (!detail::fileSeek(file, dataOffset + static_cast<uint64_t>(first) * bytesPerFrame) ||
+              std::fread(staging.data(), 1, bytes, file) != bytes)
+            return false;
+          detail::decodePcmBlock(staging.data(), output + first * channels, count * channels, format);
+          player->advanceLoadProgress(kDecodeProgressEnd * static_cast<float>(done->fetch_add(1) + 1) /
+                                      static_cast<float>(numChunks));
+          return true;
+        }
+      };
+
+      std::atomic<bool> callerFileTaken{false};
+      std::atomic<size_t> done{0};
+      const bool ok = parallelFor(numChunks, threads, [&]() {
+        ChunkReader reader{this, nullptr, nullptr, {}, dataOffset, output, numFrames, chunkFrames,
+                           numChunks, bytesPerFrame, channels, format, &done};
+        if (!callerFileTaken.exchange(true))
+        {
+          reader.file = file;
+        }
+        else
+        {
+          reader.owned.reset(std::fopen(path, "rb"));
+          reader.file = reader.owned.get();
+        }
+        reader.staging.resize(std::min(chunkFrames, numFrames) * bytesPerFrame);
+        return reader;
+      });
+
+      // A read failed, or a helper could not open the file
+      return ok ? WavError::None : WavError::ReadError;
     }
 
-    /// Process stereo buffers (separate L/R).
-    void processBufferStereoSplit(float* left, float* right, size_t numFrames) noexcept
+    /// Convert the data chunk of an in-memory file into a float buffer
+    /// (in parallel from kParallelDecodeBytes, like readAndConvertSamples()).
+    WavError convertSamplesFromMemory(const uint8_t* data, float* output, size_t numFrames,
+                                       uint16_t channels, uint16_t bits, bool isFloat)
     {
-      if (left == nullptr || right == nullptr)
-        return;
-
-      for (size_t i = 0; i < numFrames; ++i)
+      detail::PcmFormat format;
+      if (!detail::pcmFormatFor(bits, isFloat, format))
       {
-        processSampleStereo(left[i], right[i]);
+        return WavError::UnsupportedFormat;
       }
+      const size_t bytesPerSample = bits / 8;
+      const size_t bytesPerFrame = bytesPerSample * channels;
+      const size_t chunkFrames = std::max<size_t>(1, kDecodeChunkBytes / bytesPerFrame);
+      const size_t numChunks = (numFrames + chunkFrames - 1) / chunkFrames;
+      const unsigned threads = numFrames * bytesPerFrame >= kParallelDecodeBytes ? defaultThreadCount() : 1;
+
+      std::atomic<size_t> done{0};
+      parallelFor(numChunks, threads, [&]() {
+        return [&](size_t chunk) {
+          const size_t first = chunk * chunkFrames;
+          const size_t count = std::min(chunkFrames, numFrames - first);
+          detail::decodePcmBlock(data + first * bytesPerFrame, output + first * channels, count * channels, format);
+          advanceLoadProgress(kDecodeProgressEnd * static_cast<float>(done.fetch_add(1) + 1) /
+                              static_cast<float>(numChunks));
+          return true;
+        };
+      });
+
+      return WavError::None;
     }
 
     //--------------------------------------------------------------------------
-    // Direct sample access (for advanced use cases)
+    // Block rendering (audio thread)
+    //
+    // Every render call, including the single-sample ones, goes through
+    // renderBlock(). Parameters are read from their atomics once per block and
+    // the playhead is kept in locals until the block is done. For resident
+    // buffers the block is cut into spans that provably stay clear of the file
+    // edges and of any loop/end boundary; those run a tight interpolation loop
+    // straight over the float data. The frame that reaches a boundary, and
+    // every frame of a mapped or streamed buffer, takes the checked path. Both
+    // paths compute exactly what frame-by-frame rendering does.
     //--------------------------------------------------------------------------
 
-    /// Get a raw sample from the loaded data.
-    /// @param frameIndex Sample frame index (0 to numSamples-1)
-    /// @param channel Channel index (0 for mono/left, 1 for right in stereo)
-    /// @return Sample value, or 0.0f if out of bounds
-    float getRawSample(size_t frameIndex, size_t channel = 0) const noexcept
+    /// Playback parameters snapshotted once per block.
+    struct RenderParams
     {
-      if (frameIndex >= numSamples_ || channel >= numChannels_)
-      {
-        return 0.0f;
-      }
-      return audioData_[frameIndex * numChannels_ + channel];
-    }
+      double delta; ///< Position increment per frame (reverse applied, ping-pong direction not)
+      float volume;
+      LoopMode loop;
+      bool reverse;
+      InterpolationQuality quality;
+    };
 
-    /// Get read-only access to the audio data buffer.
-    const float* getAudioData() const noexcept
+    /// Playhead state, kept local while a block renders.
+    struct Playhead
     {
-      return audioData_.data();
-    }
+      double position;
+      int direction; ///< Ping-pong direction (+1/-1)
+      bool playing;
+      double start;  ///< Playback region [start, end) in frames; the whole
+      double end;    ///< file for the main playhead, a slice for a voice
+    };
 
-    /// Get the size of the audio data buffer in floats.
-    size_t getAudioDataSize() const noexcept
+    /// One polyphonic playhead (audio thread only).
+    struct Voice
     {
-      return audioData_.size();
-    }
-
-  private:
-    //--------------------------------------------------------------------------
-    // Internal helper methods
-    //--------------------------------------------------------------------------
+      Playhead head{0.0, 1, false, 0.0, 0.0};
+      int tag = -1;      ///< Caller's key, see releaseVoices()
+      uint64_t age = 0;  ///< Trigger order, for stealing the oldest voice
+    };
 
-    /// Read and convert samples from file to float buffer.
-    WavError readAndConvertSamples(FILE* file, float* output, size_t numFrames,
-                                    uint16_t channels, uint16_t bits, bool isFloat)
+    /// Render numFrames frames from buf. Left/right samples go to outL/outR
+    /// with the given stride; with MixToMono, the mono mix goes to outL and
+    /// outR is unused.
+    template <bool MixToMono>
+    void renderBlock(const detail::SampleBuffer* buf, float* outL, float* outR,
+                     size_t stride, size_t numFrames) noexcept
     {
-      const size_t bytesPerSample = bits / 8;
-      const size_t bytesPerFrame = bytesPerSample * channels;
-
-      // Use a reasonably sized temporary buffer for reading
-      constexpr size_t kReadBufferFrames = 4096;
-      std::vector<uint8_t> readBuffer;
-      try
+      DspStats::Timer timer(stats_, numFrames);
+      if (buf == nullptr || state_.load() != PlaybackState::Playing)
       {
-        readBuffer.resize(kReadBufferFrames * bytesPerFrame);
+        writeSilence<MixToMono>(outL, outR, stride, numFrames);
+        return;
       }
-      catch (const std::bad_alloc&)
+
+      const RenderParams params = snapshotParams(*buf);
+      const double startPosition = playbackPosition_.load();
+      const int startDirection = pingPongDirection_.load();
+      Playhead head{startPosition, startDirection, true, 0.0, static_cast<double>(buf->frames)};
+      renderPlayhead<MixToMono>(*buf, params, head, outL, outR, stride, numFrames);
+
+      // Publish the playhead, unless another thread moved it (seek/stop)
+      // while the block was rendering: that position wins
+      double expected = startPosition;
+      if (playbackPosition_.compare_exchange_strong(expected, head.position))
       {
-        return WavError::OutOfMemory;
+        if (head.direction != startDirection)
+          pingPongDirection_.store(head.direction);
+        if (!head.playing)
+          state_.store(PlaybackState::Stopped);
       }
+    }
 
-      size_t framesRead = 0;
-      while (framesRead < numFrames)
+    /// Current buffer for the voice pool; voices started on a previous buffer
+    /// are stopped, their regions no longer apply.
+    const detail::SampleBuffer* acquireVoiceBuffer() noexcept
+    {
+      const detail::SampleBuffer* buf = acquireBuffer();
+      if (buf != voiceBuffer_)
       {
-        const size_t framesToRead = std::min(kReadBufferFrames, numFrames - framesRead);
-        const size_t bytesToRead = framesToRead * bytesPerFrame;
+        stopVoices();
+        voiceBuffer_ = buf;
+      }
+      return buf;
+    }
+
+    /// Render numFrames frames of one playhead; frames after a one-shot ends
+    /// are silent.
+    template <bool MixToMono>
+    void renderPlayhead(const detail::SampleBuffer& buf, const RenderParams& params, Playhead& head,
+                        float* outL, float* outR, size_t stride, size_t numFrames) noexcept
+    {
+      const bool direct = buf.mode() == WavStorageMode::Resident;
 
-        if (std::fread(readBuffer.data(), 1, bytesToRead, file) != bytesToRead)
+      size_t i = 0;
+      while (i < numFrames && head.playing)
+      {
+        const size_t span = direct ? boundaryFreeSpan(buf, params, head, numFrames - i) : 0;
+        if (span > 0)
         {
-          return WavError::ReadError;
+          renderSpan<MixToMono>(buf, params, head, outL + i * stride,
+                                MixToMono ? nullptr : outR + i * stride, stride, span);
+          i += span;
         }
-
-        // Convert samples
-        for (size_t f = 0; f < framesToRead; ++f)
+        else
         {
-          for (uint16_t c = 0; c < channels; ++c)
-          {
-            const size_t byteOffset = (f * channels + c) * bytesPerSample;
-            const size_t outIndex = (framesRead + f) * channels + c;
-
-            if (isFloat && bits == 32)
-            {
-              float value;
-              std::memcpy(&value, readBuffer.data() + byteOffset, 4);
-              output[outIndex] = value;
-            }
-            else
-            {
-              output[outIndex] = convertSample(readBuffer.data() + byteOffset, bits);
-            }
-          }
+          float* right = MixToMono ? nullptr : outR + i * stride;
+          renderFrameChecked<MixToMono>(buf, params, head, outL[i * stride], right);
+          ++i;
         }
-
-        framesRead += framesToRead;
       }
+      stats_.countTier(static_cast<int>(params.quality), i);
 
-      return WavError::None;
+      // A one-shot that reached its end is silent for the rest of the block
+      writeSilence<MixToMono>(outL + i * stride, MixToMono ? nullptr : outR + i * stride,
+                              stride, numFrames - i);
     }
 
-    /// Convert samples from memory buffer.
-    WavError convertSamplesFromMemory(const uint8_t* data, float* output, size_t numFrames,
-                                       uint16_t channels, uint16_t bits, bool isFloat)
+    template <bool MixToMono>
+    static void writeSilence(float* outL, float* outR, size_t stride, size_t numFrames) noexcept
     {
-      const size_t bytesPerSample = bits / 8;
-
-      for (size_t f = 0; f < numFrames; ++f)
+      for (size_t i = 0; i < numFrames; ++i)
       {
-        for (uint16_t c = 0; c < channels; ++c)
-        {
-          const size_t byteOffset = (f * channels + c) * bytesPerSample;
-          const size_t outIndex = f * channels + c;
-
-          if (isFloat && bits == 32)
-          {
-            float value;
-            std::memcpy(&value, data + byteOffset, 4);
-            output[outIndex] = value;
-          }
-          else
-          {
-            output[outIndex] = convertSample(data + byteOffset, bits);
-          }
-        }
+        outL[i * stride] = 0.0f;
+        if (!MixToMono)
+          outR[i * stride] = 0.0f;
       }
+    }
 
-      return WavError::None;
+    /// Read all playback parameters for one block.
+    RenderParams snapshotParams(const detail::SampleBuffer& buf) const noexcept
+    {
+      RenderParams params;
+      params.reverse = reverse_.load();
+      params.delta = static_cast<double>(getEffectivePlaybackRate(buf));
+      if (params.reverse)
+        params.delta = -params.delta;
+      params.volume = volume_.load();
+      params.loop = loopMode_.load();
+      params.quality = interpolation_.load();
+      return params;
     }
 
-    /// Convert a single sample from raw bytes to float.
-    static float convertSample(const uint8_t* bytes, uint16_t bits) noexcept
+    /// Number of frames (at most maxFrames) that can be rendered from head
+    /// without clamping an interpolation tap or crossing a loop/end boundary.
+    /// Conservative by one frame, so accumulated rounding can never overshoot.
+    static size_t boundaryFreeSpan(const detail::SampleBuffer& buf, const RenderParams& params,
+                                   const Playhead& head, size_t maxFrames) noexcept
     {
-      switch (bits)
+      // Valid positions: taps idx-7..idx+8 (sinc), idx-1..idx+2 (cubic),
+      // idx..idx+1 (linear) or idx must lie inside the file, and no position
+      // may leave the region or reach its last frame, where ping-pong reflects
+      const double frames = static_cast<double>(buf.frames);
+      double before = 0.0, after = 1.0;
+      if (params.quality == InterpolationQuality::Cubic)
       {
-      case 8:
-        return detail::uint8ToFloat(bytes[0]);
-      case 16:
+        before = 1.0;
+        after = 2.0;
+      }
+      else if (params.quality == InterpolationQuality::Sinc)
       {
-        int16_t value;
-        std::memcpy(&value, bytes, 2);
-        return detail::int16ToFloat(value);
+        before = SincInterpolator::kTapsBefore;
+        after = SincInterpolator::kTapsAfter;
       }
-      case 24:
-        return detail::int24ToFloat(bytes);
-      case 32:
+      const double lo = std::max(before, head.start);
+      const double hi = std::min(frames - after, head.end - 1.0);
+      const double pos = head.position;
+      if (!(pos >= lo && pos < hi))
+        return 0;
+
+      const double delta = (params.loop == LoopMode::PingPong) ? params.delta * head.direction : params.delta;
+      double steps;
+      if (delta > 0.0)
+        steps = std::floor((hi - pos) / delta) - 1.0;
+      else if (delta < 0.0)
+        steps = std::floor((pos - lo) / -delta) - 1.0;
+      else
+        steps = static_cast<double>(maxFrames);
+
+      if (!(steps > 0.0))
+        return 0;
+      return steps >= static_cast<double>(maxFrames) ? maxFrames : static_cast<size_t>(steps);
+    }
+
+    /// Tight loop over a boundary-free span of a resident buffer.
+    template <bool MixToMono>
+    static void renderSpan(const detail::SampleBuffer& buf, const RenderParams& params, Playhead& head,
+                           float* outL, float* outR, size_t stride, size_t numFrames) noexcept
+    {
+      // Unit speed from a whole frame (e.g. a file converted to the output
+      // rate): every fraction is 0, where every interpolation tier returns
+      // the sample itself, so copy the frames
+      if (std::fabs(params.delta) == 1.0 && head.position == std::floor(head.position))
       {
-        int32_t value;
-        std::memcpy(&value, bytes, 4);
-        return detail::int32ToFloat(value);
+        renderSpanDirect<MixToMono, InterpolationQuality::None>(buf, params, head, outL, outR, stride, numFrames);
+        return;
       }
+
+      switch (params.quality)
+      {
+      case InterpolationQuality::None:
+        renderSpanDirect<MixToMono, InterpolationQuality::None>(buf, params, head, outL, outR, stride, numFrames);
+        break;
+      case InterpolationQuality::Linear:
+        renderSpanDirect<MixToMono, InterpolationQuality::Linear>(buf, params, head, outL, outR, stride, numFrames);
+        break;
+      case InterpolationQuality::Sinc:
+        renderSpanDirect<MixToMono, InterpolationQuality::Sinc>(buf, params, head, outL, outR, stride, numFrames);
+        break;
       default:
-        return 0.0f;
+        renderSpanDirect<MixToMono, InterpolationQuality::Cubic>(buf, params, head, outL, outR, stride, numFrames);
+        break;
       }
     }
 
-    /// Calculate the effective playback rate considering pitch, speed, and sample rate conversion.
-    float getEffectivePlaybackRate() const noexcept
+    /// Interpolate channel data at p (channels apart). Sinc: mono data only.
+    template <InterpolationQuality Quality>
+    static float interpolateDirect(const float* p, size_t channels, float frac) noexcept
     {
-      const float outRate = outputSampleRate_.load();
-      const float fileRate = static_cast<float>(fileSampleRate_);
-      const float rateRatio = (outRate > 0.0f) ? (fileRate / outRate) : 1.0f;
-      return rateRatio * speed_.load() * pitch_.load();
+      if (Quality == InterpolationQuality::None)
+        return p[0];
+      if (Quality == InterpolationQuality::Linear)
+        return detail::linearInterpolate(p[0], p[channels], frac);
+      if (Quality == InterpolationQuality::Sinc)
+        return SincInterpolator::shared().mono(p, frac);
+      return detail::cubicInterpolate(p[-static_cast<std::ptrdiff_t>(channels)], p[0],
+                                      p[channels], p[2 * channels], frac);
+    }
+
+    template <bool MixToMono, InterpolationQuality Quality>
+    static void renderSpanDirect(const detail::SampleBuffer& buf, const RenderParams& params, Playhead& head,
+                                 float* outL, float* outR, size_t stride, size_t numFrames) noexcept
+    {
+      const float* data = buf.samples.data();
+      const size_t channels = buf.channels;
+      const bool mono = channels == 1;
+      const double delta = (params.loop == LoopMode::PingPong) ? params.delta * head.direction : params.delta;
+      const float vol = params.volume;
+      const SincInterpolator& sinc = SincInterpolator::shared();
+      double pos = head.position;
+
+      for (size_t i = 0; i < numFrames; ++i)
+      {
+        const size_t idx = static_cast<size_t>(pos);
+        const float frac = static_cast<float>(pos - static_cast<double>(idx));
+        const float* p = data + idx * channels;
+
+        if (mono)
+        {
+          const float left = interpolateDirect<Quality>(p, channels, frac);
+          outL[i * stride] = left * vol;
+          if (!MixToMono)
+            outR[i * stride] = left * vol;
+        }
+        else
+        {
+          // Sinc reads both channels of each frame in one dot product
+          float left, right;
+          if (Quality == InterpolationQuality::Sinc)
+          {
+            sinc.stereo(p, frac, left, right);
+          }
+          else
+          {
+            left = interpolateDirect<Quality>(p, channels, frac);
+            right = interpolateDirect<Quality>(p + 1, channels, frac);
+          }
+          if (MixToMono)
+          {
+            outL[i * stride] = ((left + right) * 0.5f) * vol;
+          }
+          else
+          {
+            outL[i * stride] = left * vol;
+            outR[i * stride] = right * vol;
+          }
+        }
+        pos += delta;
+      }
+
+      head.position = pos;
     }
 
-    /// Read an interpolated mono sample at the current position.
-    float readInterpolatedSample() noexcept
+    /// Render one frame with clamped taps, boundary handling and stream-miss
+    /// detection. outR is ignored with MixToMono.
+    template <bool MixToMono>
+    void renderFrameChecked(const detail::SampleBuffer& buf, const RenderParams& params, Playhead& head,
+                            float& outL, float* outR) noexcept
     {
-      const double pos = playbackPosition_.load();
+      const double pos = head.position;
       const size_t idx = static_cast<size_t>(pos);
       const float frac = static_cast<float>(pos - static_cast<double>(idx));
 
-      if (numChannels_ == 1)
+      streamMiss_ = false;
+      float left, right;
+      if (buf.channels == 1)
       {
-        return interpolateMono(idx, frac);
+        left = right = interpolateMono(buf, idx, frac, params.quality);
       }
       else
       {
-        // Mix stereo to mono
-        float left, right;
-        interpolateStereo(idx, frac, left, right);
-        return (left + right) * 0.5f;
+        interpolateStereo(buf, idx, frac, params.quality, left, right);
       }
-    }
 
-    /// Read interpolated stereo samples at the current position.
-    void readInterpolatedSampleStereo(float& left, float& right) noexcept
-    {
-      const double pos = playbackPosition_.load();
-      const size_t idx = static_cast<size_t>(pos);
-      const float frac = static_cast<float>(pos - static_cast<double>(idx));
+      head.playing = stepPosition(params, head);
+
+      if (streamMiss_)
+      {
+        // Ring underrun: keep time, output silence
+        streamUnderruns_.fetch_add(1, std::memory_order_relaxed);
+        stats_.countUnderruns();
+        left = right = 0.0f;
+      }
 
-      if (numChannels_ == 1)
+      if (MixToMono)
       {
-        // Duplicate mono to stereo
-        left = right = interpolateMono(idx, frac);
+        outL = (buf.channels == 1 ? left : (left + right) * 0.5f) * params.volume;
       }
       else
       {
-        interpolateStereo(idx, frac, left, right);
+        outL = left * params.volume;
+        *outR = right * params.volume;
       }
     }
 
-    /// Interpolate a mono sample.
-    float interpolateMono(size_t idx, float frac) const noexcept
+    /// Calculate the effective playback rate considering pitch, speed, and sample rate conversion.
+    float getEffectivePlaybackRate(const detail::SampleBuffer& buf) const noexcept
     {
-      const InterpolationQuality quality = interpolation_.load();
+      const float outRate = outputSampleRate_.load();
+      const float fileRate = static_cast<float>(buf.sampleRate);
+      const float rateRatio = (outRate > 0.0f) ? (fileRate / outRate) : 1.0f;
+      return rateRatio * speed_.load() * pitch_.load();
+    }
 
+    /// Interpolate a mono sample.
+    float interpolateMono(const detail::SampleBuffer& buf, size_t idx, float frac,
+                          InterpolationQuality quality) const noexcept
+    {
       if (quality == InterpolationQuality::None)
       {
-        return getSampleSafe(idx, 0);
+        return getSampleSafe(buf, idx, 0);
       }
       else if (quality == InterpolationQuality::Linear)
       {
-        const float y0 = getSampleSafe(idx, 0);
-        const float y1 = getSampleSafe(idx + 1, 0);
+        const float y0 = getSampleSafe(buf, idx, 0);
+        const float y1 = getSampleSafe(buf, idx + 1, 0);
         return detail::linearInterpolate(y0, y1, frac);
       }
+      else if (quality == InterpolationQuality::Sinc)
+      {
+        float taps[SincInterpolator::kTaps];
+        for (int k = 0; k < SincInterpolator::kTaps; ++k)
+          taps[k] = getSampleSafe(buf, tapIndex(idx, k - SincInterpolator::kTapsBefore), 0);
+        return SincInterpolator::shared().mono(taps + SincInterpolator::kTapsBefore, frac);
+      }
       else // Cubic
       {
-        const float y0 = getSampleSafe(idx > 0 ? idx - 1 : 0, 0);
-        const float y1 = getSampleSafe(idx, 0);
-        const float y2 = getSampleSafe(idx + 1, 0);
-        const float y3 = getSampleSafe(idx + 2, 0);
+        const float y0 = getSampleSafe(buf, idx > 0 ? idx - 1 : 0, 0);
+        const float y1 = getSampleSafe(buf, idx, 0);
+        const float y2 = getSampleSafe(buf, idx + 1, 0);
+        const float y3 = getSampleSafe(buf, idx + 2, 0);
         return detail::cubicInterpolate(y0, y1, y2, y3, frac);
       }
     }
 
     /// Interpolate stereo samples.
-    void interpolateStereo(size_t idx, float frac, float& left, float& right) const noexcept
+    void interpolateStereo(const detail::SampleBuffer& buf, size_t idx, float frac,
+                           InterpolationQuality quality, float& left, float& right) const noexcept
     {
-      const InterpolationQuality quality = interpolation_.load();
-
       if (quality == InterpolationQuality::None)
       {
-        left = getSampleSafe(idx, 0);
-        right = getSampleSafe(idx, 1);
+        left = getSampleSafe(buf, idx, 0);
+        right = getSampleSafe(buf, idx, 1);
       }
       else if (quality == InterpolationQuality::Linear)
       {
-        left = detail::linearInterpolate(getSampleSafe(idx, 0), getSampleSafe(idx + 1, 0), frac);
-        right = detail::linearInterpolate(getSampleSafe(idx, 1), getSampleSafe(idx + 1, 1), frac);
+        left = detail::linearInterpolate(getSampleSafe(buf, idx, 0), getSampleSafe(buf, idx + 1, 0), frac);
+        right = detail::linearInterpolate(getSampleSafe(buf, idx, 1), getSampleSafe(buf, idx + 1, 1), frac);
+      }
+      else if (quality == InterpolationQuality::Sinc)
+      {
+        float taps[2 * SincInterpolator::kTaps];
+        for (int k = 0; k < SincInterpolator::kTaps; ++k)
+        {
+          const size_t tap = tapIndex(idx, k - SincInterpolator::kTapsBefore);
+          taps[2 * k] = getSampleSafe(buf, tap, 0);
+          taps[2 * k + 1] = getSampleSafe(buf, tap, 1);
+        }
+        SincInterpolator::shared().stereo(taps + 2 * SincInterpolator::kTapsBefore, frac, left, right);
       }
       else // Cubic
       {
         const size_t i0 = idx > 0 ? idx - 1 : 0;
         left = detail::cubicInterpolate(
-            getSampleSafe(i0, 0), getSampleSafe(idx, 0),
-            getSampleSafe(idx + 1, 0), getSampleSafe(idx + 2, 0), frac);
+            getSampleSafe(buf, i0, 0), getSampleSafe(buf, idx, 0),
+            getSampleSafe(buf, idx + 1, 0), getSampleSafe(buf, idx + 2, 0), frac);
         right = detail::cubicInterpolate(
-            getSampleSafe(i0, 1), getSampleSafe(idx, 1),
-            getSampleSafe(idx + 1, 1), getSampleSafe(idx + 2, 1), frac);
+            getSampleSafe(buf, i0, 1), getSampleSafe(buf, idx, 1),
+            getSampleSafe(buf, idx + 1, 1), getSampleSafe(buf, idx + 2, 1), frac);
       }
     }
 
+    /// Frame idx + offset, clamped at frame 0 (getSampleSafe clamps the end).
+    static size_t tapIndex(size_t idx, int offset) noexcept
+    {
+      if (offset < 0 && idx < static_cast<size_t>(-offset))
+        return 0;
+      return idx + offset;
+    }
+
     /// Get a sample with bounds checking.
-    float getSampleSafe(size_t frameIdx, size_t channel) const noexcept
+    float getSampleSafe(const detail::SampleBuffer& buf, size_t frameIdx, size_t channel) const noexcept
     {
-      if (frameIdx >= numSamples_)
+      if (frameIdx >= buf.frames)
       {
-        frameIdx = numSamples_ - 1;
+        frameIdx = buf.frames - 1;
       }
-      return audioData_[frameIdx * numChannels_ + channel];
+      float value;
+      if (buf.read(frameIdx, channel, value))
+        return value;
+      streamMiss_ = true;
+      return 0.0f;
     }
 
-    /// Advance playback position based on speed/pitch/direction.
-    void advancePosition() noexcept
+    /// Advance the playhead by one frame and apply loop/end handling.
+    /// Returns false when a one-shot ran off either end.
+    static bool stepPosition(const RenderParams& params, Playhead& head) noexcept
     {
-      const float rate = getEffectivePlaybackRate();
-      const LoopMode loop = loopMode_.load();
-      const bool rev = reverse_.load();
-      int direction = pingPongDirection_.load();
-
-      // Apply direction
-      double delta = static_cast<double>(rate);
-      if (rev)
+      double delta = params.delta;
+      if (params.loop == LoopMode::PingPong)
       {
-        delta = -delta;
-      }
-      if (loop == LoopMode::PingPong)
-      {
-        delta *= direction;
+        delta *= head.direction;
       }
 
-      double pos = playbackPosition_.load() + delta;
+      double pos = head.position + delta;
+      bool playing = true;
 
-      // Handle boundaries
-      if (loop == LoopMode::Off)
+      // Handle boundaries of the playback region
+      const double start = head.start;
+      const double end = head.end;
+      if (params.loop == LoopMode::Off)
       {
-        if (pos < 0.0 || pos >= static_cast<double>(numSamples_))
+        if (pos < start || pos >= end)
         {
-          state_.store(PlaybackState::Stopped);
-          pos = detail::wavClamp(static_cast<float>(pos), 0.0f, static_cast<float>(numSamples_ - 1));
+          playing = false;
+          pos = detail::wavClamp(static_cast<float>(pos), static_cast<float>(start), static_cast<float>(end - 1.0));
         }
       }
-      else if (loop == LoopMode::Forward)
+      else if (params.loop == LoopMode::Forward)
       {
-        const double len = static_cast<double>(numSamples_);
-        if (rev)
+        const double len = end - start;
+        if (params.reverse)
         {
-          while (pos < 0.0)
+          while (pos < start)
             pos += len;
         }
         else
         {
-          while (pos >= len)
+          while (pos >= end)
             pos -= len;
         }
       }
-      else if (loop == LoopMode::PingPong)
+      else if (params.loop == LoopMode::PingPong)
       {
-        const double maxPos = static_cast<double>(numSamples_ - 1);
-        if (pos < 0.0)
+        const double maxPos = end - 1.0;
+        if (pos < start)
         {
-          pos = -pos;
-          pingPongDirection_.store(-direction);
+          pos = start + (start - pos);
+          head.direction = -head.direction;
         }
         else if (pos > maxPos)
         {
           pos = maxPos - (pos - maxPos);
-          pingPongDirection_.store(-direction);
+          head.direction = -head.direction;
         }
       }
 
-      playbackPosition_.store(pos);
+      head.position = pos;
+      return playing;
     }
 
     //--------------------------------------------------------------------------
     // Member variables
     //--------------------------------------------------------------------------
 
-    // Audio data (float, interleaved channels)
-    std::vector<float> audioData_;
-
-    // File information
-    std::string filePath_;
-    uint32_t fileSampleRate_;
-    uint16_t numChannels_;
-    size_t numSamples_;
-    uint16_t bitsPerSample_;
+    // Loaded file: current_ is owned by the loader side, published_ is the
+    // lock-free view of it for the audio thread (see "Buffer publication")
+    std::shared_ptr<const detail::SampleBuffer> current_;
+    std::vector<std::shared_ptr<const detail::SampleBuffer>> retired_;
+    std::atomic<const detail::SampleBuffer*> published_{nullptr};
+    std::atomic<const detail::SampleBuffer*> hazard_{nullptr};
+    std::atomic<uint64_t> generation_{0}; // Bumped on every publish
+    const detail::SampleBuffer* active_ = nullptr; // Audio thread only
+
+    // Polyphonic voice pool (audio thread only)
+    Voice voices_[kMaxVoices];
+    int voiceCount_ = kMaxVoices;
+    uint64_t voiceClock_ = 0;
+    const detail::SampleBuffer* voiceBuffer_ = nullptr;
+
+    // Disk stream settings and diagnostics
+    std::atomic<size_t> streamBufferFrames_{kDefaultStreamBufferFrames};
+    std::atomic<size_t> streamPreloadFrames_{kDefaultStreamPreloadFrames};
+    std::atomic<uint64_t> streamUnderruns_{0};
+    mutable bool streamMiss_ = false; // Set by getSampleSafe on a ring miss (audio thread)
+
+    DspStats stats_;
+
+    // Copy of the current buffer's format for lock-free getters
+    std::atomic<uint32_t> fileSampleRate_;
+    std::atomic<uint32_t> dataSampleRate_{44100}; // Rate of the stored frames
+    std::atomic<uint16_t> numChannels_;
+    std::atomic<size_t> numSamples_;
+    std::atomic<uint16_t> bitsPerSample_;
+    std::atomic<WavStorageMode> storageMode_{WavStorageMode::Resident};
 
     // Playback parameters (atomic for thread-safe access)
     std::atomic<float> outputSampleRate_;
@@ -1227,6 +3004,11 @@ namespace ShortwavDSP
 
     // Mutex for file operations (not used in audio path)
     mutable std::mutex mutex_;
+    std::mutex streamMutex_; // Serialises serviceStream() callers
+    std::mutex convertMutex_; // Serialises resampleToOutputRate() callers
+    std::atomic<bool> resampleOnLoad_{false};
+    std::atomic<float> loadProgress_{1.0f};
+    std::atomic<bool> abortConversions_{false};
   };
 
   //------------------------------------------------------------------------------
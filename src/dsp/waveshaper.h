@@ -5,6 +5,10 @@
 #include <cstddef>
 #include <cstdint>
 #include <cmath>
+#include <utility>
+
+#include "decimator.h"
+#include "instrumentation.h"
 
 /*
  * Chebyshev Waveshaper
@@ -39,6 +43,19 @@
  *    numerically stable for the moderate orders typically used in audio
  *    waveshaping (e.g., N <= 16..32).
  *
+ *  - Evaluation modes (see ChebyshevEvalMode): the recurrence above runs
+ *    every sample by default. Polynomial and Table modes instead bake the
+ *    series once whenever the order or a coefficient actually changes (setters
+ *    compare against the stored value), after which each sample costs a short
+ *    Horner evaluation or one table lookup plus a cubic.
+ *
+ *  - Aliasing: T_n of a tone at f puts energy at n * f, which folds back
+ *    below Nyquist for all but low orders or low notes. Two optional,
+ *    combinable remedies: halfband 2x/4x/8x oversampling around the series,
+ *    and first-order antiderivative anti-aliasing (ADAA) using the
+ *    closed-form integral of the Chebyshev series (itself a Chebyshev series
+ *    of one degree higher).
+ *
  *  - Input domain:
  *      * For harmonic interpretation, Chebyshev polynomials assume x in [-1, 1].
  *      * We soft-limit/clamp input to [-1, 1] before evaluating T_n(x).
@@ -199,6 +216,30 @@ namespace ShortwavDSP
     }
   };
 
+  //------------------------------------------------------------------------------
+  // Evaluation strategies for ChebyshevWaveshaper
+  //------------------------------------------------------------------------------
+  //
+  //  - Recurrence: forward T_n recurrence every sample, O(order). Reference
+  //    path with no setup cost (the default).
+  //  - Polynomial: the series is re-expanded into power-basis coefficients
+  //    (in double, O(degree^2)) when it changes, then evaluated with Horner's
+  //    rule. The cost follows the highest non-zero term, not the order.
+  //    Float rounding grows with the power coefficients (about 2^(n-1) for
+  //    T_n), so prefer Table when terms above ~T10 are non-zero.
+  //  - Table: the transfer curve on [-1, 1] is baked into kTableSegments cubic
+  //    Hermite segments (exact values and slopes at the knots). Each sample is
+  //    one lookup and a cubic whatever the order; a re-bake costs about
+  //    kTableSegments * order operations, so change coefficients at block rate.
+  //------------------------------------------------------------------------------
+
+  enum class ChebyshevEvalMode
+  {
+    Recurrence,
+    Polynomial,
+    Table
+  };
+
   //------------------------------------------------------------------------------
   // Chebyshev Waveshaper
   //------------------------------------------------------------------------------
@@ -215,6 +256,17 @@ namespace ShortwavDSP
   //        Overall linear output gain applied after the Chebyshev series.
   //   - setUseSoftClipForInput(bool):
   //        Choose between hard clamp or soft saturation for input domain control.
+  //   - setEvalMode(mode):
+  //        Recurrence (default), Polynomial or Table (see ChebyshevEvalMode).
+  //   - setOversampling(factor):
+  //        1 (default), 2, 4 or 8 times internal oversampling.
+  //   - setAntiderivativeAntialiasing(bool):
+  //        First-order ADAA on the series (off by default).
+  //   - reset():
+  //        Clear oversampling filters and ADAA history.
+  //   - prepare():
+  //        Re-bake the Polynomial/Table form now if the series changed;
+  //        otherwise done lazily by the next processSample().
   //   - processSample(x):
   //        Apply Chebyshev waveshaping to a single sample.
   //   - processBuffer(in, out, numSamples):
@@ -228,22 +280,32 @@ namespace ShortwavDSP
   //     wrap access in your existing parameter / smoothing system.
   //------------------------------------------------------------------------------
 
+  template <std::size_t MaxOrder, int NumChannels>
+  class ChebyshevWaveshaperBank;
+
   template <std::size_t MaxOrder = 16u>
   class ChebyshevWaveshaper
   {
+    // The SIMD bank shares this instance's series and baked forms
+    template <std::size_t, int>
+    friend class ChebyshevWaveshaperBank;
+
   public:
+    // Cubic segments of the Table mode transfer curve.
+    static constexpr std::size_t kTableSegments = 512u;
+
     ChebyshevWaveshaper() = default;
 
     // Set the active order (degree) N for the polynomial series.
     // Valid range: 1..MaxOrder. Values < 1 disable shaping (bypass-like).
     inline void setOrder(std::size_t order) noexcept
     {
-      if (order < 1)
-        activeOrder_ = 0;
-      else if (order > MaxOrder)
-        activeOrder_ = MaxOrder;
-      else
-        activeOrder_ = order;
+      const std::size_t clamped = (order > MaxOrder) ? MaxOrder : order;
+      if (clamped != activeOrder_)
+      {
+        activeOrder_ = clamped;
+        dirty_ = true;
+      }
     }
 
     inline std::size_t getOrder() const noexcept
@@ -255,9 +317,10 @@ namespace ShortwavDSP
     // n == 0 is DC term, typically 0 for purely AC / harmonic use.
     inline void setCoefficient(std::size_t n, float value) noexcept
     {
-      if (n > MaxOrder)
+      if (n > MaxOrder || coeffs_[n] == value)
         return;
       coeffs_[n] = value;
+      dirty_ = true;
     }
 
     // Bulk-set first `count` coefficients from an array.
@@ -270,7 +333,11 @@ namespace ShortwavDSP
       const std::size_t limit = (count <= (MaxOrder + 1)) ? count : (MaxOrder + 1);
       for (std::size_t i = 0; i < limit; ++i)
       {
-        coeffs_[i] = values[i];
+        if (coeffs_[i] != values[i])
+        {
+          coeffs_[i] = values[i];
+          dirty_ = true;
+        }
       }
     }
 
@@ -281,6 +348,7 @@ namespace ShortwavDSP
       for (std::size_t i = 0; i <= MaxOrder; ++i)
         coeffs_[i] = 0.0f;
       coeffs_[1] = 1.0f;
+      dirty_ = true;
     }
 
     // Set global output gain applied after Chebyshev series.
@@ -307,40 +375,123 @@ namespace ShortwavDSP
       return useSoftClipInput_;
     }
 
-    // Process a single sample through the Chebyshev waveshaper.
-    inline float processSample(float in) const noexcept
+    // Select how the series is evaluated (see ChebyshevEvalMode).
+    inline void setEvalMode(ChebyshevEvalMode mode) noexcept
     {
-      if (activeOrder_ == 0)
+      if (mode != mode_)
       {
-        // Effectively bypass if no active order set.
-        return in;
+        mode_ = mode;
+        dirty_ = true;
       }
+    }
 
-      float x = useSoftClipInput_
-                    ? detail::softClipToUnit(in)
-                    : detail::clampToUnit(in);
+    inline ChebyshevEvalMode getEvalMode() const noexcept
+    {
+      return mode_;
+    }
+
+    // Internal oversampling factor (1, 2, 4 or 8; other values round down).
+    // The series runs at the higher rate between halfband interpolation and
+    // decimation stages (see decimator.h), adding about 20 samples of
+    // latency at 2x. Resets the filter state on change.
+    inline void setOversampling(int factor) noexcept
+    {
+      upsampler_.setFactor(factor);
+      downsampler_.setFactor(factor);
+    }
 
-      const float y = evaluator_.evaluateSeries(coeffs_.data(),
-                                                activeOrder_,
-                                                x);
+    inline int getOversampling() const noexcept
+    {
+      return downsampler_.getFactor();
+    }
 
-      float out = y * outputGain_;
+    // First-order antiderivative anti-aliasing: each output is the mean of
+    // the curve between consecutive (mapped) inputs, computed from the
+    // closed-form integral of the Chebyshev series. Adds half a sample of
+    // delay and a gentle high-frequency roll-off. Combines with oversampling.
+    inline void setAntiderivativeAntialiasing(bool enabled) noexcept
+    {
+      if (enabled != adaa_)
+      {
+        adaa_ = enabled;
+        dirty_ = true;
+      }
+    }
 
-      // Avoid propagating potential denorms (extremely unlikely here, but cheap).
-      if (std::abs(out) < 1.0e-30f)
-        out = 0.0f;
+    inline bool getAntiderivativeAntialiasing() const noexcept
+    {
+      return adaa_;
+    }
 
-      return out;
+    // Load counters (empty unless built with SHORTWAV_DSP_INSTRUMENTATION).
+    // A coefficient update is one re-bake in prepare().
+    const DspStats &getStats() const noexcept { return stats_; }
+    DspStats &getStats() noexcept { return stats_; }
+
+    // Clear the oversampling filters and the ADAA input history.
+    inline void reset() noexcept
+    {
+      upsampler_.reset();
+      downsampler_.reset();
+      prevX_ = 0.0;
+      prevF_ = evaluateAntiderivative(0.0);
+    }
+
+    // True if the next evaluation has to re-bake the series (Polynomial or
+    // Table form, or the ADAA antiderivative).
+    inline bool needsPrepare() const noexcept
+    {
+      return dirty_ && (mode_ != ChebyshevEvalMode::Recurrence || adaa_);
+    }
+
+    // Re-bake the Polynomial/Table form (and the antiderivative when ADAA is
+    // on) if the order or coefficients changed since the last bake. Cheap
+    // no-op otherwise.
+    inline void prepare() noexcept
+    {
+      if (!needsPrepare())
+        return;
+      if (mode_ == ChebyshevEvalMode::Polynomial)
+        bakePolynomial();
+      else if (mode_ == ChebyshevEvalMode::Table)
+        bakeTable();
+      if (adaa_)
+        bakeAntiderivative();
+      dirty_ = false;
+      stats_.countCoefficientUpdates();
+    }
+
+    // Process a single sample through the Chebyshev waveshaper.
+    inline float processSample(float in) noexcept
+    {
+      DspStats::Timer timer(stats_, 1);
+      if (activeOrder_ == 0)
+      {
+        // Effectively bypass if no active order set.
+        return in;
+      }
+
+      prepare();
+      switch (mode_)
+      {
+      case ChebyshevEvalMode::Polynomial:
+        return render<ChebyshevEvalMode::Polynomial>(in);
+      case ChebyshevEvalMode::Table:
+        return render<ChebyshevEvalMode::Table>(in);
+      default:
+        return render<ChebyshevEvalMode::Recurrence>(in);
+      }
     }
 
     // Process a buffer of samples. Supports in-place processing (in == out).
     inline void processBuffer(const float *in,
                               float *out,
-                              std::size_t numSamples) const noexcept
+                              std::size_t numSamples) noexcept
     {
       if (!in || !out || numSamples == 0)
         return;
 
+      DspStats::Timer timer(stats_, numSamples);
       if (activeOrder_ == 0)
       {
         // Copy input to output without change if effectively bypassed.
@@ -352,13 +503,244 @@ namespace ShortwavDSP
         return;
       }
 
-      for (std::size_t i = 0; i < numSamples; ++i)
+      // Bake once, then run a loop specialised for the mode
+      prepare();
+      switch (mode_)
       {
-        out[i] = processSample(in[i]);
+      case ChebyshevEvalMode::Polynomial:
+        renderBuffer<ChebyshevEvalMode::Polynomial>(in, out, numSamples);
+        break;
+      case ChebyshevEvalMode::Table:
+        renderBuffer<ChebyshevEvalMode::Table>(in, out, numSamples);
+        break;
+      default:
+        renderBuffer<ChebyshevEvalMode::Recurrence>(in, out, numSamples);
+        break;
       }
     }
 
   private:
+    // ADAA falls back to the curve at the midpoint below this input step,
+    // where the divided difference of the antiderivative loses precision.
+    static constexpr double kAdaaMinStep = 1.0e-5;
+
+    // One base-rate sample: interpolate, shape every sub-sample, decimate
+    // (the baked forms must be up to date).
+    template <ChebyshevEvalMode Mode>
+    inline float render(float in) noexcept
+    {
+      const int factor = downsampler_.getFactor();
+      if (factor == 1)
+        return shape<Mode>(in);
+
+      float sub[Decimator::kMaxFactor];
+      upsampler_.process(in, sub);
+      for (int i = 0; i < factor; ++i)
+        sub[i] = shape<Mode>(sub[i]);
+      return downsampler_.process(sub);
+    }
+
+    template <ChebyshevEvalMode Mode>
+    void renderBuffer(const float *in, float *out, std::size_t numSamples) noexcept
+    {
+      for (std::size_t i = 0; i < numSamples; ++i)
+        out[i] = render<Mode>(in[i]);
+    }
+
+    // Input mapping, series (or its ADAA form), output gain and denormal
+    // guard for one sample at the processing rate.
+    template <ChebyshevEvalMode Mode>
+    inline float shape(float in) noexcept
+    {
+      float x = useSoftClipInput_
+                    ? detail::softClipToUnit(in)
+                    : detail::clampToUnit(in);
+
+      float y = adaa_ ? evaluateAntialiased<Mode>(x) : evaluate<Mode>(x);
+
+      float out = y * outputGain_;
+
+      // Avoid propagating potential denorms (extremely unlikely here, but cheap).
+      stats_.countDenormalFlushes(out, 1.0e-30f);
+      if (std::abs(out) < 1.0e-30f)
+        out = 0.0f;
+
+      return out;
+    }
+
+    template <ChebyshevEvalMode Mode>
+    inline float evaluate(float x) const noexcept
+    {
+      if (Mode == ChebyshevEvalMode::Polynomial)
+        return evaluatePolynomial(x);
+      if (Mode == ChebyshevEvalMode::Table)
+        return evaluateTable(x);
+      return evaluator_.evaluateSeries(coeffs_.data(), activeOrder_, x);
+    }
+
+    // (F(x) - F(x1)) / (x - x1), the mean of f over the last input step
+    template <ChebyshevEvalMode Mode>
+    inline float evaluateAntialiased(float x) noexcept
+    {
+      const double xd = static_cast<double>(x);
+      const double fx = evaluateAntiderivative(xd);
+      const double dx = xd - prevX_;
+      float y;
+      if (std::abs(dx) > kAdaaMinStep)
+        y = static_cast<float>((fx - prevF_) / dx);
+      else
+        y = evaluate<Mode>(static_cast<float>(0.5 * (xd + prevX_)));
+      prevX_ = xd;
+      prevF_ = fx;
+      return y;
+    }
+
+    // Chebyshev coefficients of F(x) = integral of sum a_n T_n, using
+    //   int T_0 = T_1,  int T_1 = (T_2 + T_0) / 4,
+    //   int T_n = T_{n+1} / (2(n+1)) - T_{n-1} / (2(n-1))   (n >= 2).
+    void bakeAntiderivative() noexcept
+    {
+      const std::size_t degree = effectiveDegree();
+      antiderivative_.fill(0.0);
+      antiderivative_[1] = coeffs_[0];
+      if (degree >= 1)
+      {
+        antiderivative_[0] += 0.25 * coeffs_[1];
+        antiderivative_[2] += 0.25 * coeffs_[1];
+      }
+      for (std::size_t n = 2; n <= degree; ++n)
+      {
+        const double a = coeffs_[n];
+        antiderivative_[n + 1] += a / (2.0 * static_cast<double>(n + 1));
+        antiderivative_[n - 1] -= a / (2.0 * static_cast<double>(n - 1));
+      }
+      antiderivativeDegree_ = degree + 1;
+
+      // Keep the history consistent with the new curve
+      prevF_ = evaluateAntiderivative(prevX_);
+    }
+
+    // Clenshaw summation of the antiderivative series (double precision:
+    // ADAA divides a difference of two nearby values).
+    inline double evaluateAntiderivative(double x) const noexcept
+    {
+      double b1 = 0.0, b2 = 0.0;
+      for (std::size_t k = antiderivativeDegree_; k > 0; --k)
+      {
+        const double b0 = antiderivative_[k] + 2.0 * x * b1 - b2;
+        b2 = b1;
+        b1 = b0;
+      }
+      return antiderivative_[0] + x * b1 - b2;
+    }
+
+    // Highest non-zero term within the active order (0 if all are zero).
+    std::size_t effectiveDegree() const noexcept
+    {
+      std::size_t degree = activeOrder_;
+      while (degree > 0 && coeffs_[degree] == 0.0f)
+        --degree;
+      return degree;
+    }
+
+    // Expand sum a_n T_n into power-basis coefficients (double precision).
+    void bakePolynomial() noexcept
+    {
+      const std::size_t degree = effectiveDegree();
+      std::array<double, MaxOrder + 1u> power{};
+      std::array<double, MaxOrder + 1u> tPrev{}; // T_{n-1} in power basis
+      std::array<double, MaxOrder + 1u> tCur{};  // T_n in power basis
+      tPrev[0] = 1.0;                            // T_0 = 1
+      tCur[1] = 1.0;                             // T_1 = x
+      power[0] = coeffs_[0];
+      if (degree >= 1)
+        power[1] += coeffs_[1];
+
+      for (std::size_t n = 1; n < degree; ++n)
+      {
+        // T_{n+1} = 2x T_n - T_{n-1}, written over T_{n-1}
+        for (std::size_t k = n + 1; k > 0; --k)
+          tPrev[k] = 2.0 * tCur[k - 1] - tPrev[k];
+        tPrev[0] = -tPrev[0];
+        std::swap(tPrev, tCur);
+        for (std::size_t k = 0; k <= n + 1; ++k)
+          power[k] += static_cast<double>(coeffs_[n + 1]) * tCur[k];
+      }
+
+      for (std::size_t k = 0; k <= MaxOrder; ++k)
+        power_[k] = static_cast<float>(power[k]);
+      degree_ = degree;
+    }
+
+    inline float evaluatePolynomial(float x) const noexcept
+    {
+      float y = power_[degree_];
+      for (std::size_t k = degree_; k > 0; --k)
+        y = y * x + power_[k - 1];
+      return y;
+    }
+
+    // Series value and slope at x, via T_n and T_n' recurrences (double).
+    void evaluateWithSlope(double x, std::size_t degree, double &value, double &slope) const noexcept
+    {
+      value = coeffs_[0];
+      slope = 0.0;
+      if (degree == 0)
+        return;
+
+      double tPrev = 1.0, t = x;   // T_0, T_1
+      double dPrev = 0.0, d = 1.0; // T_0', T_1'
+      value += coeffs_[1] * t;
+      slope += coeffs_[1] * d;
+      for (std::size_t n = 1; n < degree; ++n)
+      {
+        const double tNext = 2.0 * x * t - tPrev;
+        const double dNext = 2.0 * t + 2.0 * x * d - dPrev;
+        tPrev = t;
+        t = tNext;
+        dPrev = d;
+        d = dNext;
+        value += coeffs_[n + 1] * t;
+        slope += coeffs_[n + 1] * d;
+      }
+    }
+
+    // Bake the transfer curve into cubic Hermite segments over [-1, 1].
+    void bakeTable() noexcept
+    {
+      const std::size_t degree = effectiveDegree();
+      const double h = 2.0 / static_cast<double>(kTableSegments);
+
+      double f0, m0;
+      evaluateWithSlope(-1.0, degree, f0, m0);
+      for (std::size_t i = 0; i < kTableSegments; ++i)
+      {
+        double f1, m1;
+        evaluateWithSlope(-1.0 + h * static_cast<double>(i + 1), degree, f1, m1);
+
+        // p(t) = c0 + c1 t + c2 t^2 + c3 t^3 on t in [0, 1]
+        float *c = &table_[4u * i];
+        c[0] = static_cast<float>(f0);
+        c[1] = static_cast<float>(h * m0);
+        c[2] = static_cast<float>(3.0 * (f1 - f0) - h * (2.0 * m0 + m1));
+        c[3] = static_cast<float>(2.0 * (f0 - f1) + h * (m0 + m1));
+
+        f0 = f1;
+        m0 = m1;
+      }
+    }
+
+    inline float evaluateTable(float x) const noexcept
+    {
+      const float u = (x + 1.0f) * (0.5f * static_cast<float>(kTableSegments));
+      std::size_t i = static_cast<std::size_t>(u > 0.0f ? u : 0.0f);
+      if (i >= kTableSegments)
+        i = kTableSegments - 1u;
+      const float t = u - static_cast<float>(i);
+      const float *c = &table_[4u * i];
+      return c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+    }
+
     ChebyshevEvaluator<MaxOrder> evaluator_{};
 
     // coeffs_[n] is the weight for T_n(x).
@@ -374,6 +756,311 @@ namespace ShortwavDSP
 
     // Whether to use soft saturation vs. hard clamp for input domain control.
     bool useSoftClipInput_ = true;
+
+    // Baked forms for the Polynomial/Table modes; dirty_ is set by any
+    // setter that actually changes the series.
+    ChebyshevEvalMode mode_ = ChebyshevEvalMode::Recurrence;
+    bool dirty_ = true;
+    std::array<float, MaxOrder + 1u> power_{}; // Power-basis coefficients
+    std::size_t degree_ = 0;                   // Degree used by Horner
+    std::array<float, 4u * kTableSegments> table_{};
+
+    // Anti-aliasing: oversampling stages and the ADAA input history
+    Interpolator upsampler_;
+    Decimator downsampler_;
+    bool adaa_ = false;
+    std::array<double, MaxOrder + 2u> antiderivative_{}; // Chebyshev basis
+    std::size_t antiderivativeDegree_ = 0;
+    double prevX_ = 0.0;
+    double prevF_ = 0.0;
+
+    DspStats stats_;
+  };
+
+  //------------------------------------------------------------------------------
+  // ChebyshevWaveshaperBank - up to NumChannels channels, four per SIMD register
+  //------------------------------------------------------------------------------
+  //
+  // One shared series (order, coefficients, gain, mode and baked forms) applied
+  // to every channel: each evaluation step runs once per group of four lanes on
+  // simd::float4 with the coefficients broadcast. Only the Table mode lookup is
+  // per lane. Channels keep their own oversampling filters and ADAA history.
+  //
+  // ADAA here uses the divided difference of the antiderivative, summed with
+  //   D_0 = 0, D_1 = 1, D_{k+1} = 2x D_k + 2 T_k(x1) - D_{k-1},
+  // D_k = (T_k(x) - T_k(x1)) / (x - x1). There is no cancellation, so single
+  // precision is enough and no fallback is needed for tiny steps (D_k tends
+  // to T_k'). The result matches ChebyshevWaveshaper to float rounding.
+  //
+  // Usage:
+  //  ChebyshevWaveshaperBank<16> bank;
+  //  bank.setOrder(4);
+  //  bank.setCoefficient(2, 0.5f);
+  //  bank.processFrame(in, out, channels); // one sample per channel
+  //------------------------------------------------------------------------------
+
+  namespace detail
+  {
+    inline simd::float4 softClipToUnit(simd::float4 x) noexcept
+    {
+      const simd::float4 one(1.0f);
+      const simd::float4 above = one - one / (one + x);
+      const simd::float4 below = one / (one - x) - one;
+      return simd::ifelse(x > one, above, simd::ifelse(-one > x, below, x));
+    }
+
+    inline simd::float4 clampToUnit(simd::float4 x) noexcept
+    {
+      return simd::clamp(x, simd::float4(-1.0f), simd::float4(1.0f));
+    }
+
+    // Same denormal guard as the scalar path: |x| < 1e-30 -> 0
+    inline simd::float4 flushTinyToZero(simd::float4 x) noexcept
+    {
+      const simd::float4 tiny(1.0e-30f);
+      return simd::ifelse(x > tiny, x, simd::ifelse(-tiny > x, x, simd::float4(0.0f)));
+    }
+  } // namespace detail
+
+  template <std::size_t MaxOrder = 16u, int NumChannels = 16>
+  class ChebyshevWaveshaperBank
+  {
+  public:
+    static_assert(NumChannels >= 1, "ChebyshevWaveshaperBank needs at least one channel");
+
+    static constexpr int kNumChannels = NumChannels;
+    static constexpr int kNumGroups = (NumChannels + simd::float4::size - 1) / simd::float4::size;
+
+    ChebyshevWaveshaperBank() noexcept
+    {
+      reset();
+    }
+
+    // Shared series settings (same meaning as in ChebyshevWaveshaper)
+    void setOrder(std::size_t order) noexcept { shaper_.setOrder(order); }
+    std::size_t getOrder() const noexcept { return shaper_.getOrder(); }
+    void setCoefficient(std::size_t n, float value) noexcept { shaper_.setCoefficient(n, value); }
+    void setCoefficients(const float *values, std::size_t count) noexcept { shaper_.setCoefficients(values, count); }
+    void resetCoefficientsToLinear() noexcept { shaper_.resetCoefficientsToLinear(); }
+    void setOutputGain(float gain) noexcept { shaper_.setOutputGain(gain); }
+    float getOutputGain() const noexcept { return shaper_.getOutputGain(); }
+    void setUseSoftClipForInput(bool enabled) noexcept { shaper_.setUseSoftClipForInput(enabled); }
+    bool getUseSoftClipForInput() const noexcept { return shaper_.getUseSoftClipForInput(); }
+    void setEvalMode(ChebyshevEvalMode mode) noexcept { shaper_.setEvalMode(mode); }
+    ChebyshevEvalMode getEvalMode() const noexcept { return shaper_.getEvalMode(); }
+    void setAntiderivativeAntialiasing(bool enabled) noexcept { shaper_.setAntiderivativeAntialiasing(enabled); }
+    bool getAntiderivativeAntialiasing() const noexcept { return shaper_.getAntiderivativeAntialiasing(); }
+    bool needsPrepare() const noexcept { return shaper_.needsPrepare(); }
+    const DspStats &getStats() const noexcept { return stats_; }
+    DspStats &getStats() noexcept { return stats_; }
+
+    // Re-bake the shared series if it changed (otherwise done lazily).
+    void prepare() noexcept
+    {
+      if (!shaper_.needsPrepare())
+        return;
+      shaper_.prepare();
+      stats_.countCoefficientUpdates();
+      for (std::size_t k = 0; k <= MaxOrder + 1u; ++k)
+        antiderivative_[k] = static_cast<float>(shaper_.antiderivative_[k]);
+    }
+
+    // Internal oversampling factor for all channels (1, 2, 4 or 8).
+    void setOversampling(int factor) noexcept
+    {
+      for (int g = 0; g < kNumGroups; ++g)
+      {
+        upsampler_[g].setFactor(factor);
+        downsampler_[g].setFactor(factor);
+      }
+    }
+
+    int getOversampling() const noexcept
+    {
+      return downsampler_[0].getFactor();
+    }
+
+    // Clear every channel's oversampling filters and ADAA history.
+    void reset() noexcept
+    {
+      for (int g = 0; g < kNumGroups; ++g)
+      {
+        upsampler_[g].reset();
+        downsampler_[g].reset();
+        prevX_[g] = simd::float4(0.0f);
+      }
+    }
+
+    // Process one sample frame: in[c] -> out[c] for c < numChannels (clamped
+    // to NumChannels; in may equal out). Channels at or above numChannels keep
+    // their state untouched, except for the unused lanes of the last active
+    // group, which see silence.
+    inline void processFrame(const float *in, float *out, int numChannels = NumChannels) noexcept
+    {
+      DspStats::Timer timer(stats_, 1);
+      numChannels = std::max(0, std::min(numChannels, NumChannels));
+      if (shaper_.getOrder() == 0)
+      {
+        // Bypass, as in ChebyshevWaveshaper
+        if (in != out)
+          std::copy(in, in + numChannels, out);
+        return;
+      }
+
+      prepare();
+      switch (shaper_.getEvalMode())
+      {
+      case ChebyshevEvalMode::Polynomial:
+        renderFrame<ChebyshevEvalMode::Polynomial>(in, out, numChannels);
+        break;
+      case ChebyshevEvalMode::Table:
+        renderFrame<ChebyshevEvalMode::Table>(in, out, numChannels);
+        break;
+      default:
+        renderFrame<ChebyshevEvalMode::Recurrence>(in, out, numChannels);
+        break;
+      }
+    }
+
+    // Process planar buffers: input[c] / output[c] hold numSamples samples
+    // of channel c (input may be nullptr, or equal output, for in-place).
+    void processBuffer(const float *const *input, float *const *output, std::size_t numSamples,
+                       int numChannels = NumChannels) noexcept
+    {
+      if (input == nullptr)
+        input = output;
+      numChannels = std::max(0, std::min(numChannels, NumChannels));
+
+      float frame[NumChannels];
+      for (std::size_t i = 0; i < numSamples; ++i)
+      {
+        for (int c = 0; c < numChannels; ++c)
+          frame[c] = input[c][i];
+        processFrame(frame, frame, numChannels);
+        for (int c = 0; c < numChannels; ++c)
+          output[c][i] = frame[c];
+      }
+    }
+
+  private:
+    using float4 = simd::float4;
+
+    template <ChebyshevEvalMode Mode>
+    inline void renderFrame(const float *in, float *out, int numChannels) noexcept
+    {
+      const int factor = downsampler_[0].getFactor();
+      for (int c = 0, g = 0; c < numChannels; c += float4::size, ++g)
+      {
+        const int lanes = numChannels - c;
+        const float4 x = float4::loadPartial(in + c, lanes);
+        float4 y;
+        if (factor == 1)
+        {
+          y = shape<Mode>(g, x);
+        }
+        else
+        {
+          float4 sub[BasicDecimator<float4>::kMaxFactor];
+          upsampler_[g].process(x, sub);
+          for (int i = 0; i < factor; ++i)
+            sub[i] = shape<Mode>(g, sub[i]);
+          y = downsampler_[g].process(sub);
+        }
+        y.storePartial(out + c, lanes);
+      }
+    }
+
+    template <ChebyshevEvalMode Mode>
+    inline float4 shape(int group, float4 in) noexcept
+    {
+      const float4 x = shaper_.useSoftClipInput_
+                           ? detail::softClipToUnit(in)
+                           : detail::clampToUnit(in);
+
+      float4 y;
+      if (shaper_.adaa_)
+      {
+        y = antialiased(prevX_[group], x);
+        prevX_[group] = x;
+      }
+      else
+      {
+        y = evaluate<Mode>(x);
+      }
+      y = y * float4(shaper_.outputGain_);
+      stats_.countDenormalFlushes(y, 1.0e-30f);
+      return detail::flushTinyToZero(y);
+    }
+
+    template <ChebyshevEvalMode Mode>
+    inline float4 evaluate(float4 x) const noexcept
+    {
+      if (Mode == ChebyshevEvalMode::Polynomial)
+      {
+        // Horner on the shared power-basis coefficients
+        const std::size_t degree = shaper_.degree_;
+        float4 y(shaper_.power_[degree]);
+        for (std::size_t k = degree; k > 0; --k)
+          y = y * x + float4(shaper_.power_[k - 1]);
+        return y;
+      }
+      if (Mode == ChebyshevEvalMode::Table)
+      {
+        float lanes[float4::size];
+        x.store(lanes);
+        for (float &v : lanes)
+          v = shaper_.evaluateTable(v);
+        return float4::load(lanes);
+      }
+
+      const std::size_t order = shaper_.getOrder();
+      const float *a = shaper_.coeffs_.data();
+      float4 tPrev(1.0f);
+      float4 t = x;
+      float4 sum = float4(a[0]) + float4(a[1]) * x;
+      for (std::size_t n = 1; n < order; ++n)
+      {
+        const float4 tNext = float4(2.0f) * x * t - tPrev;
+        tPrev = t;
+        t = tNext;
+        sum += float4(a[n + 1]) * t;
+      }
+      return sum;
+    }
+
+    // Sum of b_k D_k(x, x1) over the antiderivative coefficients b_k
+    inline float4 antialiased(float4 x1, float4 x) const noexcept
+    {
+      const std::size_t degree = shaper_.antiderivativeDegree_;
+      const float4 two(2.0f);
+      float4 tPrev(1.0f); // T_0(x1)
+      float4 t = x1;      // T_1(x1)
+      float4 dPrev(0.0f); // D_0
+      float4 d(1.0f);     // D_1
+      float4 sum(antiderivative_[1]);
+      for (std::size_t k = 1; k < degree; ++k)
+      {
+        const float4 dNext = two * x * d + two * t - dPrev;
+        const float4 tNext = two * x1 * t - tPrev;
+        dPrev = d;
+        d = dNext;
+        tPrev = t;
+        t = tNext;
+        sum += float4(antiderivative_[k + 1]) * d;
+      }
+      return sum;
+    }
+
+    // Owner of the shared series and its baked forms (never processes audio)
+    ChebyshevWaveshaper<MaxOrder> shaper_;
+    std::array<float, MaxOrder + 2u> antiderivative_{};
+
+    BasicInterpolator<float4> upsampler_[kNumGroups];
+    BasicDecimator<float4> downsampler_[kNumGroups];
+    float4 prevX_[kNumGroups];
+    DspStats stats_;
   };
 
+  using PolyChebyshevWaveshaper = ChebyshevWaveshaperBank<16u, 16>;
+
 } // namespace ShortwavDSP
\ No newline at end of file
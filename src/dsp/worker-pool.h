@@ -0,0 +1,87 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+/*
+ * parallelFor - run independent loader tasks on a few threads
+ *
+ * For bulk work off the audio thread (decoding a large file in chunks).
+ * Threads are started per call and joined before it returns; the calling
+ * thread works too, so with one thread (or when no thread can be started)
+ * everything runs inline, in task order.
+ *
+ * Every participating thread first builds its own worker with makeWorker()
+ * (e.g. holding a file handle and a staging buffer), then claims task
+ * indices from a shared counter and runs worker(index), which returns false
+ * on failure. After a failure no new tasks are started.
+ *
+ * Usage:
+ *  bool ok = parallelFor(numChunks, defaultThreadCount(), [&]() {
+ *    return [&](size_t chunk) { return convertChunk(chunk); };
+ *  });
+ */
+
+namespace ShortwavDSP
+{
+
+  /// Threads to use for bulk loader work (hardware threads, at most kMax).
+  inline unsigned defaultThreadCount(unsigned kMax = 8) noexcept
+  {
+    const unsigned hardware = std::thread::hardware_concurrency();
+    return std::max(1u, std::min(hardware == 0 ? 1u : hardware, kMax));
+  }
+
+  /// Run worker(i) for every i in [0, numTasks) on up to maxThreads threads.
+  /// @return false if any task failed or threw
+  template <typename MakeWorker>
+  bool parallelFor(size_t numTasks, unsigned maxThreads, MakeWorker makeWorker)
+  {
+    std::atomic<size_t> next{0};
+    std::atomic<bool> ok{true};
+
+    auto run = [&]() {
+      try
+      {
+        auto worker = makeWorker();
+        for (size_t i = next.fetch_add(1); i < numTasks && ok.load(std::memory_order_relaxed);
+             i = next.fetch_add(1))
+        {
+          if (!worker(i))
+            ok.store(false);
+        }
+      }
+      catch (...)
+      {
+        ok.store(false);
+      }
+    };
+
+    const size_t helpers = std::min<size_t>(numTasks, std::max(1u, maxThreads)) - (numTasks > 0 ? 1 : 0);
+    std::vector<std::thread> threads;
+    try
+    {
+      threads.reserve(helpers);
+      for (size_t t = 0; t < helpers; ++t)
+        threads.emplace_back(run);
+    }
+    catch (const std::system_error &)
+    {
+      // Fewer threads than asked for; the ones running share the tasks
+    }
+    catch (const std::bad_alloc &)
+    {
+    }
+
+    run();
+    for (std::thread &thread : threads)
+      thread.join();
+    return ok.load();
+  }
+
+} // namespace ShortwavDSP
@@ -0,0 +1,684 @@
+// Micro-benchmarks for the ShortwavDSP kernels.
+//
+// Every DSP class is timed at several block sizes and channel counts and
+// reported as ns/sample, samples/sec and cycles/sample (one "sample" is one
+// channel of one frame). Results can be written as CSV or JSON and compared
+// against a stored baseline CSV, so CPU regressions show up before release.
+//
+// Build and run through run_benchmarks.sh, or by hand:
+//   g++ -std=c++17 -O2 -Isrc -DSHORTWAV_DSP_RUN_BENCHMARKS -o build_bench_dsp src/tests/bench_dsp.cpp
+//   ./build_bench_dsp --csv bench_results.csv --baseline bench_baseline.csv
+//
+// Options:
+//   --csv FILE            Write results as CSV (also the baseline format)
+//   --json FILE           Write results as JSON
+//   --baseline FILE       Compare against a baseline CSV; exit 1 on regression
+//   --save-baseline FILE  Write the results as a new baseline CSV
+//   --tolerance PCT       Allowed slowdown against the baseline (default 15)
+//   --filter TEXT         Only run kernels whose name contains TEXT
+//   --quick               Fewer samples per measurement (smoke runs)
+//
+// Timings are the best of several runs, which is the most repeatable figure
+// on a shared machine. Cycles come from the time-stamp counter on x86 (a
+// fixed reference clock, so they track ns/sample rather than core clocks)
+// and are reported as -1 elsewhere.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <x86intrin.h>
+#define SHORTWAV_BENCH_HAS_TSC 1
+#endif
+
+#include "../dsp/waveshaper.h"
+#include "../dsp/random-lfo.h"
+#include "../dsp/drift.h"
+#include "../dsp/formant-osc.h"
+#include "../dsp/3-band-eq.h"
+#include "../dsp/low-pass.h"
+#include "../dsp/wav-player.h"
+
+namespace
+{
+
+  //------------------------------------------------------------------------------
+  // Harness
+  //------------------------------------------------------------------------------
+
+  constexpr int kBlockSizes[] = {16, 64, 256, 1024};
+  constexpr int kMaxBlock = 1024;
+  constexpr int kMaxChannels = 16;
+
+  struct BenchResult
+  {
+    std::string kernel;
+    std::string variant;
+    int blockSize = 0;
+    int channels = 0;
+    double nsPerSample = 0.0;
+    double samplesPerSec = 0.0;
+    double cyclesPerSample = -1.0;
+
+    std::string key() const
+    {
+      return kernel + "/" + variant + "/" + std::to_string(blockSize) + "/" + std::to_string(channels);
+    }
+  };
+
+  // Planar scratch buffers shared by all cases: channel c of the input and
+  // output lives at in[c] / out[c], kMaxBlock frames each. Interleaved kernels
+  // use inInterleaved / outInterleaved.
+  struct Buffers
+  {
+    std::vector<float> inStorage, outStorage;
+    std::vector<float> inInterleaved, outInterleaved;
+    float *in[kMaxChannels];
+    float *out[kMaxChannels];
+
+    Buffers()
+        : inStorage(kMaxBlock * kMaxChannels), outStorage(kMaxBlock * kMaxChannels),
+          inInterleaved(kMaxBlock * kMaxChannels), outInterleaved(kMaxBlock * kMaxChannels)
+    {
+      for (int c = 0; c < kMaxChannels; ++c)
+      {
+        in[c] = inStorage.data() + c * kMaxBlock;
+        out[c] = outStorage.data() + c * kMaxBlock;
+        for (int i = 0; i < kMaxBlock; ++i)
+        {
+          // Band-rich test signal, different per channel
+          const float t = static_cast<float>(i) / 48000.0f;
+          in[c][i] = 0.5f * std::sin(2.0f * 3.14159265f * (110.0f + 50.0f * c) * t) +
+                     0.3f * std::sin(2.0f * 3.14159265f * (3100.0f + 7.0f * c) * t);
+        }
+      }
+      for (int i = 0; i < kMaxBlock; ++i)
+        for (int c = 0; c < kMaxChannels; ++c)
+          inInterleaved[i * kMaxChannels + c] = in[c][i];
+    }
+  };
+
+  // One benchmark: processes `frames` frames of `channels` channels per call.
+  struct BenchCase
+  {
+    std::string kernel;
+    std::string variant;
+    int channels;
+    std::function<void(int frames)> process;
+  };
+
+  struct Options
+  {
+    std::string csvPath, jsonPath, baselinePath, saveBaselinePath, filter;
+    double tolerancePct = 15.0;
+    bool quick = false;
+  };
+
+  inline uint64_t readCycles()
+  {
+#ifdef SHORTWAV_BENCH_HAS_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+  }
+
+  // Keeps results observable so the optimiser cannot drop the work
+  volatile float gSink = 0.0f;
+
+  BenchResult measure(const BenchCase &bench, int blockSize, const Buffers &buffers, bool quick)
+  {
+    using Clock = std::chrono::steady_clock;
+
+    const long long samplesPerRun = quick ? (1 << 16) : (1 << 19);
+    const long long blocks = std::max(1LL, samplesPerRun / (static_cast<long long>(blockSize) * bench.channels));
+    const int runs = quick ? 3 : 7;
+
+    // Warm caches, branch predictors and any lazy preparation
+    for (long long b = 0; b < std::max(1LL, blocks / 8); ++b)
+      bench.process(blockSize);
+
+    double bestNs = 0.0;
+    double bestCycles = 0.0;
+    for (int r = 0; r < runs; ++r)
+    {
+      const uint64_t c0 = readCycles();
+      const Clock::time_point t0 = Clock::now();
+      for (long long b = 0; b < blocks; ++b)
+        bench.process(blockSize);
+      const Clock::time_point t1 = Clock::now();
+      const uint64_t c1 = readCycles();
+
+      const double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+      if (r == 0 || ns < bestNs)
+      {
+        bestNs = ns;
+        bestCycles = static_cast<double>(c1 - c0);
+      }
+    }
+    gSink = gSink + buffers.out[0][0] + buffers.outInterleaved[0];
+
+    const double samples = static_cast<double>(blocks) * blockSize * bench.channels;
+    BenchResult result;
+    result.kernel = bench.kernel;
+    result.variant = bench.variant;
+    result.blockSize = blockSize;
+    result.channels = bench.channels;
+    result.nsPerSample = bestNs / samples;
+    result.samplesPerSec = (bestNs > 0.0) ? samples * 1e9 / bestNs : 0.0;
+#ifdef SHORTWAV_BENCH_HAS_TSC
+    result.cyclesPerSample = bestCycles / samples;
+#else
+    (void)bestCycles;
+#endif
+    return result;
+  }
+
+  //------------------------------------------------------------------------------
+  // Kernels
+  //------------------------------------------------------------------------------
+  //
+  // Each add*() function registers the cases for one DSP class. Processor
+  // state lives in shared_ptrs captured by the lambdas, so every case keeps
+  // its own instance for the whole run.
+
+  using CaseList = std::vector<BenchCase>;
+
+  void addThreeBandEQ(CaseList &cases, Buffers &b)
+  {
+    using ShortwavDSP::ThreeBandEQ;
+    auto make = [] {
+      auto eq = std::make_shared<ThreeBandEQ>();
+      eq->setSampleRate(48000.0f);
+      eq->setCrossoverFreqs(250.0f, 4000.0f);
+      eq->setGainsDB(4.0f, -2.0f, 3.0f);
+      return eq;
+    };
+
+    auto mono = make();
+    cases.push_back({"ThreeBandEQ", "mono", 1, [mono, &b](int n) {
+                       mono->processBuffer(b.in[0], b.out[0], static_cast<size_t>(n));
+                     }});
+    auto split = make();
+    cases.push_back({"ThreeBandEQ", "stereo-split", 2, [split, &b](int n) {
+                       split->processStereoBuffer(b.in[0], b.in[1], b.out[0], b.out[1], static_cast<size_t>(n));
+                     }});
+    auto interleaved = make();
+    cases.push_back({"ThreeBandEQ", "stereo-interleaved", 2, [interleaved, &b](int n) {
+                       interleaved->processStereoBufferInterleaved(b.inInterleaved.data(), b.outInterleaved.data(),
+                                                                   static_cast<size_t>(n));
+                     }});
+    for (int channels : {4, 16})
+    {
+      auto poly = make();
+      cases.push_back({"ThreeBandEQ", "poly", channels, [poly, channels, &b](int n) {
+                         for (int i = 0; i < n; ++i)
+                           poly->processPoly(b.inInterleaved.data() + i * kMaxChannels,
+                                             b.outInterleaved.data() + i * kMaxChannels, channels);
+                       }});
+    }
+
+    // Linkwitz-Riley crossover, and its per-channel band split
+    auto lrSplit = make();
+    lrSplit->setCrossoverMode(ShortwavDSP::CrossoverMode::LinkwitzRiley);
+    cases.push_back({"ThreeBandEQ", "lr-stereo-split", 2, [lrSplit, &b](int n) {
+                       lrSplit->processStereoBuffer(b.in[0], b.in[1], b.out[0], b.out[1], static_cast<size_t>(n));
+                     }});
+    for (int channels : {4, 16})
+    {
+      auto poly = make();
+      poly->setCrossoverMode(ShortwavDSP::CrossoverMode::LinkwitzRiley);
+      auto bands = std::make_shared<ThreeBandEQ::BandSplit>();
+      cases.push_back({"ThreeBandEQ", "lr-poly-bands", channels, [poly, bands, channels, &b](int n) {
+                         for (int i = 0; i < n; ++i)
+                           poly->processPoly(b.inInterleaved.data() + i * kMaxChannels,
+                                             b.outInterleaved.data() + i * kMaxChannels, channels, bands.get());
+                       }});
+    }
+  }
+
+  void addMoogLowPass(CaseList &cases, Buffers &b)
+  {
+    using namespace ShortwavDSP;
+
+    auto mono = std::make_shared<MoogLowPassFilter>();
+    mono->setSampleRate(48000.0f);
+    mono->setCutoff(1200.0f);
+    mono->setResonance(0.6f);
+    cases.push_back({"MoogLowPassFilter", "mono", 1, [mono, &b](int n) {
+                       mono->processBuffer(b.in[0], b.out[0], static_cast<size_t>(n));
+                     }});
+
+    auto stereo = std::make_shared<MoogLowPassFilter>();
+    stereo->setSampleRate(48000.0f);
+    stereo->setCutoff(1200.0f);
+    stereo->setResonance(0.6f);
+    cases.push_back({"MoogLowPassFilter", "stereo", 2, [stereo, &b](int n) {
+                       stereo->processStereoBuffer(b.in[0], b.in[1], b.out[0], b.out[1], static_cast<size_t>(n));
+                     }});
+
+    for (int channels : {4, 16})
+    {
+      auto poly = std::make_shared<PolyMoogLowPassFilter>();
+      poly->setSampleRate(48000.0f);
+      poly->setCutoff(1200.0f);
+      poly->setResonance(0.6f);
+      cases.push_back({"PolyMoogLowPassFilter", "poly", channels, [poly, channels, &b](int n) {
+                         poly->processBuffer(b.in, b.out, static_cast<size_t>(n), channels);
+                       }});
+    }
+
+    for (int oversampling : {1, 2, 4})
+    {
+      auto zdf = std::make_shared<ZdfLadderFilter>();
+      zdf->setSampleRate(48000.0f);
+      zdf->setOversampling(oversampling);
+      zdf->setSaturation(true);
+      zdf->setCutoff(1200.0f);
+      zdf->setResonance(0.6f);
+      cases.push_back({"ZdfLadderFilter", "os" + std::to_string(oversampling), 1, [zdf, &b](int n) {
+                         zdf->processBuffer(b.in[0], b.out[0], static_cast<size_t>(n));
+                       }});
+    }
+  }
+
+  void addWaveshaper(CaseList &cases, Buffers &b)
+  {
+    using namespace ShortwavDSP;
+
+    struct ModeName
+    {
+      ChebyshevEvalMode mode;
+      const char *name;
+    };
+    const ModeName modes[] = {{ChebyshevEvalMode::Recurrence, "recurrence"},
+                              {ChebyshevEvalMode::Polynomial, "polynomial"},
+                              {ChebyshevEvalMode::Table, "table"}};
+
+    for (std::size_t order : {2u, 4u, 8u, 16u})
+    {
+      for (const ModeName &m : modes)
+      {
+        auto shaper = std::make_shared<ChebyshevWaveshaper<16>>();
+        shaper->setOrder(order);
+        for (std::size_t k = 1; k <= order; ++k)
+          shaper->setCoefficient(k, 1.0f / static_cast<float>(k));
+        shaper->setEvalMode(m.mode);
+        const std::string variant = "order" + std::to_string(order) + "-" + m.name;
+        cases.push_back({"ChebyshevWaveshaper", variant, 1, [shaper, &b](int n) {
+                           shaper->processBuffer(b.in[0], b.out[0], static_cast<size_t>(n));
+                         }});
+      }
+    }
+
+    auto adaa = std::make_shared<ChebyshevWaveshaper<16>>();
+    adaa->setOrder(8);
+    for (std::size_t k = 1; k <= 8; ++k)
+      adaa->setCoefficient(k, 1.0f / static_cast<float>(k));
+    adaa->setAntiderivativeAntialiasing(true);
+    cases.push_back({"ChebyshevWaveshaper", "order8-adaa", 1, [adaa, &b](int n) {
+                       adaa->processBuffer(b.in[0], b.out[0], static_cast<size_t>(n));
+                     }});
+
+    auto bank = std::make_shared<PolyChebyshevWaveshaper>();
+    bank->setOrder(8);
+    for (std::size_t k = 1; k <= 8; ++k)
+      bank->setCoefficient(k, 1.0f / static_cast<float>(k));
+    cases.push_back({"ChebyshevWaveshaperBank", "order8", 16, [bank, &b](int n) {
+                       bank->processBuffer(b.in, b.out, static_cast<size_t>(n), 16);
+                     }});
+  }
+
+  void addFormantOscillator(CaseList &cases, Buffers &b)
+  {
+    using namespace ShortwavDSP;
+
+    for (int oversampling : {1, 4})
+    {
+      auto osc = std::make_shared<FormantOscillator>();
+      osc->setSampleRate(48000.0f);
+      osc->setOversampling(oversampling);
+      osc->setCarrierFreq(110.0f);
+      osc->setFormantFreq(800.0f);
+      osc->setFormantWidth(0.3f);
+      cases.push_back({"FormantOscillator", "os" + std::to_string(oversampling), 1, [osc, &b](int n) {
+                         osc->processBuffer(nullptr, b.out[0], static_cast<size_t>(n));
+                       }});
+    }
+
+    auto bank = std::make_shared<FormantOscillatorBank>();
+    bank->setSampleRate(48000.0f);
+    for (int v = 0; v < 16; ++v)
+      bank->setVoice(v, 55.0f * (1.0f + 0.25f * v), 800.0f + 40.0f * v, 0.3f);
+    cases.push_back({"FormantOscillatorBank", "voices", 16, [bank, &b](int n) {
+                       for (int i = 0; i < n; ++i)
+                         bank->processSample(b.outInterleaved.data() + i * kMaxChannels, 16);
+                     }});
+  }
+
+  void addRandomLFO(CaseList &cases, Buffers &b)
+  {
+    using namespace ShortwavDSP;
+
+    for (int decimation : {1, 32})
+    {
+      auto lfo = std::make_shared<RandomLFO>();
+      lfo->setSampleRate(48000.0f);
+      lfo->seed(1234u);
+      lfo->setRate(4.0f);
+      lfo->setSmooth(0.6f);
+      lfo->setDecimation(decimation);
+      cases.push_back({"RandomLFO", "decimation" + std::to_string(decimation), 1, [lfo, &b](int n) {
+                         lfo->processBuffer(b.out[0], static_cast<size_t>(n));
+                       }});
+    }
+
+    auto bank = std::make_shared<RandomLFOBank>();
+    bank->setSampleRate(48000.0f);
+    bank->seed(1234u);
+    bank->setAll(4.0f, 1.0f, 0.6f);
+    cases.push_back({"RandomLFOBank", "channels", 16, [bank, &b](int n) {
+                       bank->processBuffer(b.out, static_cast<size_t>(n), 16);
+                     }});
+  }
+
+  void addDriftGenerator(CaseList &cases, Buffers &b)
+  {
+    using namespace ShortwavDSP;
+
+    for (int decimation : {1, 32})
+    {
+      auto drift = std::make_shared<DriftGenerator>();
+      drift->setSampleRate(48000.0f);
+      drift->seed(99u);
+      drift->setRateHz(0.5f);
+      drift->setDecimation(decimation);
+      cases.push_back({"DriftGenerator", "decimation" + std::to_string(decimation), 1, [drift, &b](int n) {
+                         drift->processBuffer(b.out[0], static_cast<size_t>(n));
+                       }});
+    }
+
+    for (int decimation : {1, 32})
+    {
+      auto bank = std::make_shared<DriftGeneratorBank>();
+      bank->setSampleRate(48000.0f);
+      bank->seed(99u);
+      bank->setRateHz(0.5f);
+      bank->setDecimation(decimation);
+      cases.push_back({"DriftGeneratorBank", "decimation" + std::to_string(decimation), 16, [bank, &b](int n) {
+                         bank->processBuffer(b.out, static_cast<size_t>(n), 16);
+                       }});
+    }
+  }
+
+  // 16-bit PCM sine file in memory (same layout as the tests' generator)
+  std::vector<uint8_t> makeWav(size_t frames, uint16_t channels, uint32_t sampleRate)
+  {
+    const uint16_t bits = 16;
+    const size_t dataSize = frames * channels * 2;
+    std::vector<uint8_t> wav(44 + dataSize);
+    auto put16 = [&](size_t at, uint16_t v) { std::memcpy(wav.data() + at, &v, 2); };
+    auto put32 = [&](size_t at, uint32_t v) { std::memcpy(wav.data() + at, &v, 4); };
+    std::memcpy(wav.data(), "RIFF", 4);
+    put32(4, static_cast<uint32_t>(wav.size() - 8));
+    std::memcpy(wav.data() + 8, "WAVEfmt ", 8);
+    put32(16, 16);
+    put16(20, 1);
+    put16(22, channels);
+    put32(24, sampleRate);
+    put32(28, sampleRate * channels * 2);
+    put16(32, static_cast<uint16_t>(channels * 2));
+    put16(34, bits);
+    std::memcpy(wav.data() + 36, "data", 4);
+    put32(40, static_cast<uint32_t>(dataSize));
+    for (size_t i = 0; i < frames; ++i)
+      for (uint16_t c = 0; c < channels; ++c)
+      {
+        const float s = 0.8f * std::sin(2.0f * 3.14159265f * 220.0f * (1.0f + c) * i / sampleRate);
+        put16(44 + (i * channels + c) * 2, static_cast<uint16_t>(static_cast<int16_t>(s * 32767.0f)));
+      }
+    return wav;
+  }
+
+  void addWavPlayer(CaseList &cases, Buffers &b)
+  {
+    using namespace ShortwavDSP;
+
+    struct QualityName
+    {
+      InterpolationQuality quality;
+      const char *name;
+    };
+    const QualityName qualities[] = {{InterpolationQuality::None, "none"},
+                                     {InterpolationQuality::Linear, "linear"},
+                                     {InterpolationQuality::Cubic, "cubic"},
+                                     {InterpolationQuality::Sinc, "sinc"}};
+
+    const std::vector<uint8_t> wav = makeWav(48000 * 4, 2, 48000);
+    for (const QualityName &q : qualities)
+    {
+      for (int channels : {1, 2})
+      {
+        auto player = std::make_shared<WavPlayer>();
+        if (player->loadFromMemory(wav.data(), wav.size()) != WavError::None)
+        {
+          std::fprintf(stderr, "WavPlayer: could not load the benchmark file\n");
+          continue;
+        }
+        player->setSampleRate(48000.0f);
+        player->setLoopMode(LoopMode::Forward);
+        player->setSpeed(1.37f); // Fractional positions exercise the interpolator
+        player->setInterpolationQuality(q.quality);
+        player->play();
+        if (channels == 1)
+          cases.push_back({"WavPlayer", std::string(q.name) + "-mono", 1, [player, &b](int n) {
+                             player->processBuffer(b.out[0], static_cast<size_t>(n));
+                           }});
+        else
+          cases.push_back({"WavPlayer", std::string(q.name) + "-stereo", 2, [player, &b](int n) {
+                             player->processBufferStereoSplit(b.out[0], b.out[1], static_cast<size_t>(n));
+                           }});
+      }
+    }
+
+    // A 48 kHz file in a 44.1 kHz engine at unity speed: cubic interpolation
+    // on the file as is, or a copy after the load-time conversion
+    for (bool resample : {false, true})
+    {
+      auto player = std::make_shared<WavPlayer>();
+      player->setSampleRate(44100.0f);
+      player->setResampleOnLoad(resample);
+      if (player->loadFromMemory(wav.data(), wav.size()) != WavError::None)
+      {
+        std::fprintf(stderr, "WavPlayer: could not load the benchmark file\n");
+        continue;
+      }
+      player->setLoopMode(LoopMode::Forward);
+      player->play();
+      cases.push_back({"WavPlayer", resample ? "unity-resampled-stereo" : "unity-cubic-stereo", 2, [player, &b](int n) {
+                         player->processBufferStereoSplit(b.out[0], b.out[1], static_cast<size_t>(n));
+                       }});
+    }
+  }
+
+  //------------------------------------------------------------------------------
+  // Output and baseline comparison
+  //------------------------------------------------------------------------------
+
+  bool writeCsv(const std::string &path, const std::vector<BenchResult> &results)
+  {
+    FILE *f = std::fopen(path.c_str(), "w");
+    if (!f)
+      return false;
+    std::fprintf(f, "kernel,variant,block,channels,ns_per_sample,samples_per_sec,cycles_per_sample\n");
+    for (const BenchResult &r : results)
+      std::fprintf(f, "%s,%s,%d,%d,%.4f,%.0f,%.3f\n", r.kernel.c_str(), r.variant.c_str(), r.blockSize,
+                   r.channels, r.nsPerSample, r.samplesPerSec, r.cyclesPerSample);
+    return std::fclose(f) == 0;
+  }
+
+  bool writeJson(const std::string &path, const std::vector<BenchResult> &results)
+  {
+    FILE *f = std::fopen(path.c_str(), "w");
+    if (!f)
+      return false;
+    std::fprintf(f, "{\n  \"results\": [\n");
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+      const BenchResult &r = results[i];
+      std::fprintf(f,
+                   "    {\"kernel\": \"%s\", \"variant\": \"%s\", \"block\": %d, \"channels\": %d, "
+                   "\"ns_per_sample\": %.4f, \"samples_per_sec\": %.0f, \"cycles_per_sample\": %.3f}%s\n",
+                   r.kernel.c_str(), r.variant.c_str(), r.blockSize, r.channels, r.nsPerSample,
+                   r.samplesPerSec, r.cyclesPerSample, (i + 1 < results.size()) ? "," : "");
+    }
+    std::fprintf(f, "  ]\n}\n");
+    return std::fclose(f) == 0;
+  }
+
+  // Baseline CSV -> ns/sample by key (kernel/variant/block/channels)
+  bool readBaseline(const std::string &path, std::map<std::string, double> &baseline)
+  {
+    FILE *f = std::fopen(path.c_str(), "r");
+    if (!f)
+      return false;
+    char line[512];
+    bool header = true;
+    while (std::fgets(line, sizeof(line), f))
+    {
+      if (header)
+      {
+        header = false;
+        continue;
+      }
+      char kernel[128], variant[128];
+      int block = 0, channels = 0;
+      double ns = 0.0;
+      if (std::sscanf(line, "%127[^,],%127[^,],%d,%d,%lf", kernel, variant, &block, &channels, &ns) == 5)
+        baseline[std::string(kernel) + "/" + variant + "/" + std::to_string(block) + "/" +
+                 std::to_string(channels)] = ns;
+    }
+    std::fclose(f);
+    return true;
+  }
+
+  bool parseOptions(int argc, char **argv, Options &options)
+  {
+    for (int i = 1; i < argc; ++i)
+    {
+      const std::string arg = argv[i];
+      auto value = [&](std::string &out) {
+        if (i + 1 >= argc)
+          return false;
+        out = argv[++i];
+        return true;
+      };
+      std::string number;
+      if (arg == "--csv" && value(options.csvPath))
+        continue;
+      if (arg == "--json" && value(options.jsonPath))
+        continue;
+      if (arg == "--baseline" && value(options.baselinePath))
+        continue;
+      if (arg == "--save-baseline" && value(options.saveBaselinePath))
+        continue;
+      if (arg == "--filter" && value(options.filter))
+        continue;
+      if (arg == "--tolerance" && value(number))
+      {
+        options.tolerancePct = std::atof(number.c_str());
+        continue;
+      }
+      if (arg == "--quick")
+      {
+        options.quick = true;
+        continue;
+      }
+      std::fprintf(stderr, "Unknown or incomplete option: %s\n", arg.c_str());
+      return false;
+    }
+    return true;
+  }
+
+} // namespace
+
+// Gate main() the same way as test_dsp.cpp, so the file can be compiled
+// alongside other sources without defining an entry point.
+#ifdef SHORTWAV_DSP_RUN_BENCHMARKS
+int main(int argc, char **argv)
+{
+  ::Options options;
+  if (!::parseOptions(argc, argv, options))
+    return 2;
+
+  ::Buffers buffers;
+  ::CaseList cases;
+  ::addThreeBandEQ(cases, buffers);
+  ::addMoogLowPass(cases, buffers);
+  ::addWaveshaper(cases, buffers);
+  ::addFormantOscillator(cases, buffers);
+  ::addRandomLFO(cases, buffers);
+  ::addDriftGenerator(cases, buffers);
+  ::addWavPlayer(cases, buffers);
+
+  std::map<std::string, double> baseline;
+  const bool haveBaseline = !options.baselinePath.empty() && ::readBaseline(options.baselinePath, baseline);
+  if (!options.baselinePath.empty() && !haveBaseline)
+    std::printf("No baseline at %s (run with --save-baseline to create one)\n", options.baselinePath.c_str());
+
+  std::printf("%-24s %-22s %6s %3s %10s %14s %10s %9s\n", "kernel", "variant", "block", "ch", "ns/sample",
+              "samples/sec", "cyc/sample", "vs base");
+
+  std::vector<::BenchResult> results;
+  int regressions = 0;
+  for (const ::BenchCase &bench : cases)
+  {
+    if (!options.filter.empty() && bench.kernel.find(options.filter) == std::string::npos)
+      continue;
+    for (int blockSize : ::kBlockSizes)
+    {
+      const ::BenchResult r = ::measure(bench, blockSize, buffers, options.quick);
+      results.push_back(r);
+
+      char delta[32] = "";
+      const auto it = baseline.find(r.key());
+      if (it != baseline.end() && it->second > 0.0)
+      {
+        const double change = 100.0 * (r.nsPerSample / it->second - 1.0);
+        const bool regressed = change > options.tolerancePct;
+        regressions += regressed ? 1 : 0;
+        std::snprintf(delta, sizeof(delta), "%+.1f%%%s", change, regressed ? " !" : "");
+      }
+      std::printf("%-24s %-22s %6d %3d %10.3f %14.0f %10.2f %9s\n", r.kernel.c_str(), r.variant.c_str(),
+                  r.blockSize, r.channels, r.nsPerSample, r.samplesPerSec, r.cyclesPerSample, delta);
+      std::fflush(stdout);
+    }
+  }
+
+  if (!options.csvPath.empty() && !::writeCsv(options.csvPath, results))
+    std::fprintf(stderr, "Could not write %s\n", options.csvPath.c_str());
+  if (!options.jsonPath.empty() && !::writeJson(options.jsonPath, results))
+    std::fprintf(stderr, "Could not write %s\n", options.jsonPath.c_str());
+  if (!options.saveBaselinePath.empty())
+  {
+    if (::writeCsv(options.saveBaselinePath, results))
+      std::printf("Baseline written to %s\n", options.saveBaselinePath.c_str());
+    else
+      std::fprintf(stderr, "Could not write %s\n", options.saveBaselinePath.c_str());
+  }
+
+  std::printf("[BENCH SUMMARY] cases=%d regressions=%d tolerance=%.1f%%\n", static_cast<int>(results.size()),
+              regressions, options.tolerancePct);
+  return (haveBaseline && regressions > 0) ? 1 : 0;
+}
+#endif
@@ -20,9 +20,21 @@
 #include "../dsp/3-band-eq.h"
 #include "../dsp/low-pass.h"
 #include "../dsp/wav-player.h"
+#include "../dsp/peak-pyramid.h"
+#include "../dsp/control-rate.h"
+#include "../dsp/fast-math.h"
+#include "../dsp/snapshot.h"
+#include "../dsp/onset-detector.h"
+#include "../dsp/sinc-resampler.h"
+#include "../dsp/sinc-interpolator.h"
+#include "../dsp/spectrum-analyzer.h"
 #include <chrono>
 #include <thread>
+#include <atomic>
+#include <memory>
 #include <cstdlib>
+#include <filesystem>
+#include <string>
 
 namespace
 {
@@ -75,6 +87,21 @@ namespace
 #define T_ASSERT_NEAR(ctx, actual, expected, tol) \
   (ctx).assertNear((actual), (expected), (tol), #actual " ~= " #expected, __FILE__, __LINE__)
 
+  // Power of x at an exact DFT bin (Goertzel), x.size() samples at sampleRate
+  static double goertzelPower(const std::vector<float> &x, double freq, double sampleRate)
+  {
+    const double w = 2.0 * 3.14159265358979323846 * freq / sampleRate;
+    const double coeff = 2.0 * std::cos(w);
+    double s1 = 0.0, s2 = 0.0;
+    for (float v : x)
+    {
+      const double s0 = v + coeff * s1 - s2;
+      s2 = s1;
+      s1 = s0;
+    }
+    return s1 * s1 + s2 * s2 - coeff * s1 * s2;
+  }
+
   //------------------------------------------------------------------------------
   // ChebyshevWaveshaper tests
   //------------------------------------------------------------------------------
@@ -242,6 +269,308 @@ namespace
     T_ASSERT(ctx, std::isfinite(out));
   }
 
+  void test_waveshaper_baked_modes_match_recurrence(TestContext &ctx)
+  {
+    using ShortwavDSP::ChebyshevEvalMode;
+    using ShortwavDSP::ChebyshevWaveshaper;
+
+    // Polynomial mode is exact to float rounding at moderate orders; the
+    // Table mode holds a fixed tolerance all the way to order 32.
+    struct Case
+    {
+      std::size_t order;
+      ChebyshevEvalMode mode;
+      float tolerance;
+    };
+    const Case cases[] = {
+        {4, ChebyshevEvalMode::Polynomial, 1e-5f},
+        {8, ChebyshevEvalMode::Polynomial, 1e-4f},
+        {4, ChebyshevEvalMode::Table, 1e-5f},
+        {16, ChebyshevEvalMode::Table, 1e-3f},
+        {32, ChebyshevEvalMode::Table, 5e-3f},
+    };
+
+    for (const Case &c : cases)
+    {
+      ChebyshevWaveshaper<32> reference, baked;
+      uint32_t seed = 777u + static_cast<uint32_t>(c.order);
+      for (std::size_t n = 0; n <= c.order; ++n)
+      {
+        seed = seed * 1664525u + 1013904223u;
+        const float a = (static_cast<float>(seed >> 8) / 16777216.0f - 0.5f) / static_cast<float>(c.order);
+        reference.setCoefficient(n, a);
+        baked.setCoefficient(n, a);
+      }
+      reference.setOrder(c.order);
+      baked.setOrder(c.order);
+      baked.setEvalMode(c.mode);
+      T_ASSERT(ctx, baked.getEvalMode() == c.mode);
+
+      float maxDiff = 0.0f;
+      for (int i = 0; i <= 4000; ++i)
+      {
+        const float x = -1.0f + 2.0f * static_cast<float>(i) / 4000.0f;
+        maxDiff = std::max(maxDiff, std::fabs(baked.processSample(x) - reference.processSample(x)));
+      }
+      T_ASSERT(ctx, maxDiff < c.tolerance);
+    }
+  }
+
+  void test_waveshaper_bakes_only_on_change(TestContext &ctx)
+  {
+    using ShortwavDSP::ChebyshevEvalMode;
+    using ShortwavDSP::ChebyshevWaveshaper;
+
+    ChebyshevWaveshaper<16> ws;
+    ws.resetCoefficientsToLinear();
+    ws.setOrder(4);
+    T_ASSERT(ctx, !ws.needsPrepare()); // Recurrence mode never bakes
+
+    ws.setEvalMode(ChebyshevEvalMode::Table);
+    T_ASSERT(ctx, ws.needsPrepare());
+    ws.processSample(0.3f); // Lazy bake
+    T_ASSERT(ctx, !ws.needsPrepare());
+
+    // Re-writing identical values (as a module does every block) is free
+    ws.setCoefficient(1, 1.0f);
+    ws.setCoefficient(2, 0.0f);
+    ws.setOrder(4);
+    const float same[3] = {0.0f, 1.0f, 0.0f};
+    ws.setCoefficients(same, 3);
+    T_ASSERT(ctx, !ws.needsPrepare());
+
+    // A real change is picked up before the next sample: T2(0.5) = -0.5
+    ws.setCoefficient(1, 0.0f);
+    ws.setCoefficient(2, 1.0f);
+    T_ASSERT(ctx, ws.needsPrepare());
+    ws.setUseSoftClipForInput(false);
+    T_ASSERT_NEAR(ctx, ws.processSample(0.5f), -0.5f, 1e-5f);
+
+    // Switching modes re-bakes the new form
+    ws.setEvalMode(ChebyshevEvalMode::Polynomial);
+    T_ASSERT(ctx, ws.needsPrepare());
+    ws.prepare();
+    T_ASSERT(ctx, !ws.needsPrepare());
+    T_ASSERT_NEAR(ctx, ws.processSample(0.5f), -0.5f, 1e-6f);
+
+    // Order cuts off higher terms in the baked forms too
+    ws.setOrder(1);
+    T_ASSERT_NEAR(ctx, ws.processSample(0.5f), 0.0f, 1e-6f);
+  }
+
+  void test_waveshaper_oversampling_reduces_aliasing(TestContext &ctx)
+  {
+    using ShortwavDSP::ChebyshevEvalMode;
+    using ShortwavDSP::ChebyshevWaveshaper;
+
+    // T1 + 0.5 T16 on a 3 kHz sine at 44.1 kHz: the 16th harmonic (48 kHz)
+    // folds down to 3.9 kHz. 4410 samples hold whole periods of both tones.
+    const double sr = 44100.0;
+    const double pi = 3.14159265358979323846;
+    auto measure = [&](ChebyshevEvalMode mode, int factor, bool adaa, double &aliasDb, double &fundamental) {
+      ChebyshevWaveshaper<16> ws;
+      ws.setEvalMode(mode);
+      ws.setUseSoftClipForInput(false);
+      ws.setOrder(16);
+      ws.setCoefficient(1, 1.0f);
+      ws.setCoefficient(16, 0.5f);
+      ws.setOversampling(factor);
+      ws.setAntiderivativeAntialiasing(adaa);
+
+      const int warmup = 512;
+      std::vector<float> in(4410 + warmup);
+      for (std::size_t i = 0; i < in.size(); ++i)
+        in[i] = static_cast<float>(std::sin(2.0 * pi * 3000.0 * static_cast<double>(i) / sr));
+      ws.processBuffer(in.data(), in.data(), in.size());
+      std::vector<float> y(in.begin() + warmup, in.end());
+
+      const double fundamentalPower = goertzelPower(y, 3000.0, sr);
+      aliasDb = 10.0 * std::log10(goertzelPower(y, 3900.0, sr) / fundamentalPower);
+      fundamental = 2.0 * std::sqrt(fundamentalPower) / static_cast<double>(y.size());
+    };
+
+    const ChebyshevEvalMode modes[] = {ChebyshevEvalMode::Recurrence,
+                                       ChebyshevEvalMode::Polynomial,
+                                       ChebyshevEvalMode::Table};
+    for (ChebyshevEvalMode mode : modes)
+    {
+      double plainDb, fundamental;
+      measure(mode, 1, false, plainDb, fundamental);
+      T_ASSERT(ctx, plainDb > -10.0); // Folded T16 is only 6 dB down
+      T_ASSERT_NEAR(ctx, fundamental, 1.0, 0.01);
+
+      for (int factor : {2, 4, 8})
+      {
+        double aliasDb;
+        measure(mode, factor, false, aliasDb, fundamental);
+        T_ASSERT(ctx, aliasDb < -60.0);
+        T_ASSERT_NEAR(ctx, fundamental, 1.0, 0.01);
+      }
+
+      // ADAA alone: a large improvement at low cost, slight top-end droop
+      double adaaDb;
+      measure(mode, 1, true, adaaDb, fundamental);
+      T_ASSERT(ctx, adaaDb < plainDb - 12.0);
+      T_ASSERT_NEAR(ctx, fundamental, 1.0, 0.05);
+
+      // Combined with oversampling it is at least as clean
+      double combinedDb;
+      measure(mode, 2, true, combinedDb, fundamental);
+      T_ASSERT(ctx, combinedDb < -60.0);
+    }
+  }
+
+  void test_waveshaper_adaa_follows_static_curve(TestContext &ctx)
+  {
+    using ShortwavDSP::ChebyshevEvalMode;
+    using ShortwavDSP::ChebyshevWaveshaper;
+
+    const float coeffs[5] = {0.1f, 0.8f, 0.4f, -0.3f, 0.2f};
+    ChebyshevWaveshaper<16> reference;
+    reference.setCoefficients(coeffs, 5);
+    reference.setOrder(4);
+
+    ChebyshevWaveshaper<16> ws;
+    ws.setCoefficients(coeffs, 5);
+    ws.setOrder(4);
+    T_ASSERT(ctx, !ws.needsPrepare());
+    ws.setAntiderivativeAntialiasing(true);
+    T_ASSERT(ctx, ws.getAntiderivativeAntialiasing());
+    T_ASSERT(ctx, ws.needsPrepare()); // Antiderivative is baked in every mode
+    ws.prepare();
+    T_ASSERT(ctx, !ws.needsPrepare());
+
+    // Slow ramp: the mean over each step matches the curve at its midpoint
+    float maxDiff = 0.0f;
+    float prev = -0.9f;
+    ws.processSample(prev);
+    for (int i = 1; i <= 1800; ++i)
+    {
+      const float x = -0.9f + 0.001f * static_cast<float>(i);
+      const float y = ws.processSample(x);
+      maxDiff = std::max(maxDiff, std::fabs(y - reference.processSample(0.5f * (x + prev))));
+      prev = x;
+    }
+    T_ASSERT(ctx, maxDiff < 1e-4f);
+
+    // A held (DC) input settles exactly on the static curve
+    for (int i = 0; i < 4; ++i)
+      ws.processSample(0.37f);
+    T_ASSERT_NEAR(ctx, ws.processSample(0.37f), reference.processSample(0.37f), 1e-6f);
+
+    // Coefficient changes re-bake without a jump for a held input
+    ws.setCoefficient(2, 0.0f);
+    reference.setCoefficient(2, 0.0f);
+    T_ASSERT_NEAR(ctx, ws.processSample(0.37f), reference.processSample(0.37f), 1e-6f);
+
+    // Oversampling factors round down to 1/2/4/8
+    ws.setOversampling(0);
+    T_ASSERT(ctx, ws.getOversampling() == 1);
+    ws.setOversampling(3);
+    T_ASSERT(ctx, ws.getOversampling() == 2);
+    ws.setOversampling(8);
+    T_ASSERT(ctx, ws.getOversampling() == 8);
+    ws.setOversampling(100);
+    T_ASSERT(ctx, ws.getOversampling() == 8);
+
+    // Oversampled DC still reaches the static curve (unity DC gain)
+    ws.reset();
+    float y = 0.0f;
+    for (int i = 0; i < 64; ++i)
+      y = ws.processSample(0.37f);
+    T_ASSERT_NEAR(ctx, y, reference.processSample(0.37f), 1e-4f);
+  }
+
+  void test_waveshaper_bank_matches_mono(TestContext &ctx)
+  {
+    using ShortwavDSP::ChebyshevEvalMode;
+    using ShortwavDSP::ChebyshevWaveshaper;
+    using ShortwavDSP::ChebyshevWaveshaperBank;
+
+    // Seven channels (one partial group) against seven scalar instances
+    const float coeffs[9] = {0.05f, 0.9f, 0.3f, -0.2f, 0.1f, 0.05f, -0.04f, 0.03f, 0.02f};
+    const ChebyshevEvalMode modes[] = {ChebyshevEvalMode::Recurrence,
+                                       ChebyshevEvalMode::Polynomial,
+                                       ChebyshevEvalMode::Table};
+    constexpr int kChannels = 7;
+    for (ChebyshevEvalMode mode : modes)
+    {
+      for (int factor : {1, 4})
+      {
+        for (bool adaa : {false, true})
+        {
+          ChebyshevWaveshaperBank<16, 16> bank;
+          ChebyshevWaveshaper<16> mono[kChannels];
+          bank.setEvalMode(mode);
+          bank.setCoefficients(coeffs, 9);
+          bank.setOrder(8);
+          bank.setOutputGain(0.8f);
+          bank.setOversampling(factor);
+          bank.setAntiderivativeAntialiasing(adaa);
+          for (ChebyshevWaveshaper<16> &ws : mono)
+          {
+            ws.setEvalMode(mode);
+            ws.setCoefficients(coeffs, 9);
+            ws.setOrder(8);
+            ws.setOutputGain(0.8f);
+            ws.setOversampling(factor);
+            ws.setAntiderivativeAntialiasing(adaa);
+          }
+
+          float maxDiff = 0.0f;
+          for (int i = 0; i < 1000; ++i)
+          {
+            // Drive past +/-1 so the soft clip is exercised too
+            float frame[kChannels];
+            float in[kChannels];
+            for (int c = 0; c < kChannels; ++c)
+              frame[c] = in[c] = 1.3f * std::sin(0.01f * static_cast<float>((c + 1) * i + c));
+            bank.processFrame(frame, frame, kChannels); // In place
+            for (int c = 0; c < kChannels; ++c)
+              maxDiff = std::max(maxDiff, std::fabs(frame[c] - mono[c].processSample(in[c])));
+          }
+          // ADAA uses a divided-difference form in the bank: float rounding only
+          T_ASSERT(ctx, maxDiff < (adaa ? 1e-5f : 1e-6f));
+        }
+      }
+    }
+
+    // Planar buffers match frame-by-frame processing
+    ChebyshevWaveshaperBank<16, 16> frames;
+    ChebyshevWaveshaperBank<16, 16> planar;
+    frames.setCoefficients(coeffs, 9);
+    frames.setOrder(8);
+    planar.setCoefficients(coeffs, 9);
+    planar.setOrder(8);
+    std::vector<float> left(64), right(64);
+    for (int i = 0; i < 64; ++i)
+    {
+      left[i] = 0.02f * static_cast<float>(i) - 0.6f;
+      right[i] = -0.5f * left[i];
+    }
+    float *buffers[2] = {left.data(), right.data()};
+    float expected[2][64];
+    for (int i = 0; i < 64; ++i)
+    {
+      float frame[2] = {left[i], right[i]};
+      frames.processFrame(frame, frame, 2);
+      expected[0][i] = frame[0];
+      expected[1][i] = frame[1];
+    }
+    planar.processBuffer(nullptr, buffers, 64, 2);
+    bool same = true;
+    for (int i = 0; i < 64; ++i)
+      same = same && left[i] == expected[0][i] && right[i] == expected[1][i];
+    T_ASSERT(ctx, same);
+
+    // Order 0 bypasses every channel
+    planar.setOrder(0);
+    const float in[3] = {0.25f, -2.0f, 0.5f};
+    float out[3] = {0.0f, 0.0f, 0.0f};
+    planar.processFrame(in, out, 3);
+    T_ASSERT(ctx, out[0] == 0.25f && out[1] == -2.0f && out[2] == 0.5f);
+  }
+
   //------------------------------------------------------------------------------
   // RandomLFO tests
   //------------------------------------------------------------------------------
@@ -461,6 +790,185 @@ namespace
     T_ASSERT(ctx, std::isfinite(v1));
   }
 
+  void test_randomlfo_bank_matches_scalar(TestContext &ctx)
+  {
+    using ShortwavDSP::RandomLFO;
+    using ShortwavDSP::RandomLFOBank;
+
+    // Every channel with its own settings against a scalar LFO seeded alike
+    for (bool bipolar : {true, false})
+    {
+      RandomLFOBank bank;
+      RandomLFO mono[RandomLFOBank::kMaxChannels];
+      bank.setSampleRate(48000.f);
+      bank.seed(777u);
+      bank.setBipolar(bipolar);
+      for (int c = 0; c < RandomLFOBank::kMaxChannels; ++c)
+      {
+        const float rate = (c == 3) ? 0.0f : 0.5f + 2.0f * static_cast<float>(c);
+        const float depth = 0.3f + 0.04f * static_cast<float>(c);
+        const float smooth = static_cast<float>(c) / 15.0f;
+        mono[c].setSampleRate(48000.f);
+        mono[c].seed(RandomLFOBank::channelSeed(777u, c));
+        mono[c].reset();
+        mono[c].setRate(rate);
+        mono[c].setDepth(depth);
+        mono[c].setSmooth(smooth);
+        mono[c].setBipolar(bipolar);
+        bank.setChannel(c, rate, depth, smooth);
+      }
+
+      float maxDiff = 0.0f;
+      for (int i = 0; i < 48000; ++i)
+      {
+        float frame[RandomLFOBank::kMaxChannels];
+        bank.processFrame(frame);
+        for (int c = 0; c < RandomLFOBank::kMaxChannels; ++c)
+          maxDiff = std::max(maxDiff, std::fabs(frame[c] - mono[c].processSample()));
+      }
+      T_ASSERT(ctx, maxDiff == 0.0f);
+    }
+
+    // Channel 0 keeps the base seed, so a one-channel bank is a RandomLFO
+    T_ASSERT(ctx, RandomLFOBank::channelSeed(42u, 0) == 42u);
+  }
+
+  void test_randomlfo_bank_channels_independent(TestContext &ctx)
+  {
+    using ShortwavDSP::RandomLFO;
+    using ShortwavDSP::RandomLFOBank;
+
+    RandomLFOBank bank;
+    bank.setSampleRate(44100.f);
+    bank.seed(1u);
+    bank.setAll(20.0f, 1.0f, 0.2f);
+
+    // Derived seeds decorrelate the channels: no two follow the same path
+    const int n = 44100;
+    std::vector<float> out(static_cast<size_t>(n) * RandomLFOBank::kMaxChannels);
+    std::vector<float *> planar(RandomLFOBank::kMaxChannels);
+    for (int c = 0; c < RandomLFOBank::kMaxChannels; ++c)
+      planar[c] = out.data() + static_cast<size_t>(c) * n;
+    bank.processBuffer(planar.data(), (size_t)n);
+
+    float minDistance = 1e9f;
+    for (int a = 0; a < RandomLFOBank::kMaxChannels; ++a)
+    {
+      for (int b = a + 1; b < RandomLFOBank::kMaxChannels; ++b)
+      {
+        double sum = 0.0;
+        for (int i = 0; i < n; ++i)
+          sum += std::fabs(planar[a][i] - planar[b][i]);
+        minDistance = std::min(minDistance, static_cast<float>(sum / n));
+      }
+    }
+    T_ASSERT(ctx, minDistance > 0.05f);
+
+    // Channels beyond the active count (outside its last group) do not advance
+    RandomLFOBank partial;
+    partial.setSampleRate(44100.f);
+    partial.seed(5u);
+    partial.setAll(50.0f, 1.0f, 0.0f);
+    float frame[RandomLFOBank::kMaxChannels];
+    for (int i = 0; i < 10000; ++i)
+      partial.processFrame(frame, 3);
+    RandomLFO fresh;
+    fresh.setSampleRate(44100.f);
+    fresh.seed(RandomLFOBank::channelSeed(5u, 4));
+    fresh.reset();
+    fresh.setRate(50.0f);
+    fresh.setSmooth(0.0f);
+    partial.processFrame(frame, 5);
+    T_ASSERT(ctx, frame[4] == fresh.processSample());
+
+    // Re-seeding one channel restarts only that channel
+    RandomLFOBank reseeded;
+    RandomLFO single;
+    reseeded.setSampleRate(44100.f);
+    single.setSampleRate(44100.f);
+    reseeded.setAll(30.0f, 1.0f, 0.5f);
+    single.setRate(30.0f);
+    single.setSmooth(0.5f);
+    reseeded.seedChannel(2, 1234u);
+    single.seed(1234u);
+    single.reset();
+    bool same = true;
+    for (int i = 0; i < 5000; ++i)
+    {
+      reseeded.processFrame(frame, 4);
+      same = same && frame[2] == single.processSample();
+    }
+    T_ASSERT(ctx, same);
+  }
+
+  void test_randomlfo_decimated_mode(TestContext &ctx)
+  {
+    using ShortwavDSP::RandomLFO;
+
+    auto make = [](int decimation, bool bipolar) {
+      RandomLFO lfo;
+      lfo.setSampleRate(48000.f);
+      lfo.seed(2024u);
+      lfo.setRate(8.0f);
+      lfo.setSmooth(0.3f);
+      lfo.setDepth(0.8f);
+      lfo.setBipolar(bipolar);
+      lfo.reset(0.5f);
+      lfo.setDecimation(decimation);
+      return lfo;
+    };
+
+    for (bool bipolar : {true, false})
+    {
+      RandomLFO full = make(1, bipolar);
+      RandomLFO coarse = make(32, bipolar);
+      // The bipolar mapping allows the spring's small overshoot past +-depth
+      const float lo = bipolar ? -0.96f : 0.0f;
+      const float hi = bipolar ? 0.96f : 0.8f;
+
+      double fullSum = 0.0, coarseSum = 0.0;
+      float prev = coarse.processSample();
+      float maxStep = 0.0f, maxFullStep = 0.0f, prevFull = full.processSample();
+      bool inRange = true;
+      const int n = 48000 * 20;
+      for (int i = 0; i < n; ++i)
+      {
+        const float c = coarse.processSample();
+        const float f = full.processSample();
+        inRange = inRange && c >= lo - kEpsilon && c <= hi + kEpsilon;
+        maxStep = std::max(maxStep, std::fabs(c - prev));
+        maxFullStep = std::max(maxFullStep, std::fabs(f - prevFull));
+        fullSum += std::fabs(f - (bipolar ? 0.0f : 0.4f));
+        coarseSum += std::fabs(c - (bipolar ? 0.0f : 0.4f));
+        prev = c;
+        prevFull = f;
+      }
+      T_ASSERT(ctx, inRange);
+      // Interpolation keeps the output continuous, close to full-rate slopes
+      T_ASSERT(ctx, maxStep < 2.0f * maxFullStep);
+      // Similar movement overall
+      const double ratio = coarseSum / fullSum;
+      T_ASSERT(ctx, ratio > 0.6 && ratio < 1.6);
+    }
+
+    // Deterministic for a given seed and decimation
+    RandomLFO a = make(32, true);
+    RandomLFO b = make(32, true);
+    bool identical = true;
+    for (int i = 0; i < 100000; ++i)
+      identical = identical && a.processSample() == b.processSample();
+    T_ASSERT(ctx, identical);
+
+    // Switching modes continues from the current output without a jump
+    RandomLFO sw = make(1, true);
+    float last = 0.0f;
+    for (int i = 0; i < 48000; ++i)
+      last = sw.processSample();
+    sw.setDecimation(64);
+    T_ASSERT(ctx, sw.getDecimation() == 64);
+    T_ASSERT(ctx, std::fabs(sw.processSample() - last) < 1e-3f);
+  }
+
   //------------------------------------------------------------------------------
   // DriftGenerator tests
   //------------------------------------------------------------------------------
@@ -625,6 +1133,164 @@ namespace
     }
   }
 
+  void test_drift_generator_decimated_mode(TestContext &ctx)
+  {
+    using ShortwavDSP::DriftGenerator;
+
+    auto make = [](int decimation, float rate) {
+      DriftGenerator d;
+      d.setSampleRate(44100.0f);
+      d.setRateHz(rate);
+      d.setDepth(1.0f);
+      d.seed(99u);
+      d.reset(0.0f);
+      d.setDecimation(decimation);
+      return d;
+    };
+
+    // Same drift level as per-sample evaluation, continuous, and no larger
+    // per-sample steps than the slowest full-rate drift allows
+    for (float rate : {0.5f, 10.0f})
+    {
+      DriftGenerator full = make(1, rate);
+      DriftGenerator coarse = make(32, rate);
+      T_ASSERT(ctx, coarse.getDecimation() == 32);
+
+      const int n = 44100 * 60;
+      double fullSquares = 0.0, coarseSquares = 0.0;
+      float prev = 0.0f, maxStep = 0.0f;
+      bool finite = true;
+      for (int i = 0; i < n; ++i)
+      {
+        const float f = full.next();
+        const float c = coarse.next();
+        fullSquares += static_cast<double>(f) * f;
+        coarseSquares += static_cast<double>(c) * c;
+        maxStep = std::max(maxStep, std::fabs(c - prev));
+        finite = finite && std::isfinite(c);
+        prev = c;
+      }
+      const double ratio = std::sqrt(coarseSquares / fullSquares);
+      T_ASSERT(ctx, finite);
+      T_ASSERT(ctx, ratio > 0.6 && ratio < 1.6);
+      T_ASSERT(ctx, maxStep < 0.01f);
+    }
+
+    // Deterministic for a given seed and decimation
+    DriftGenerator a = make(32, 0.3f);
+    DriftGenerator b = make(32, 0.3f);
+    bool identical = true;
+    for (int i = 0; i < 100000; ++i)
+      identical = identical && a.next() == b.next();
+    T_ASSERT(ctx, identical);
+
+    // Switching modes continues from the current output without a jump
+    DriftGenerator sw = make(1, 2.0f);
+    float last = 0.0f;
+    for (int i = 0; i < 44100; ++i)
+      last = sw.next();
+    sw.setDecimation(16);
+    T_ASSERT(ctx, std::fabs(sw.next() - last) < 1e-3f);
+    sw.setDecimation(0); // Clamped to every sample
+    T_ASSERT(ctx, sw.getDecimation() == 1);
+  }
+
+  void test_drift_bank_matches_scalar(TestContext &ctx)
+  {
+    using ShortwavDSP::DriftGenerator;
+    using ShortwavDSP::DriftGeneratorBank;
+
+    // Every channel against a scalar generator seeded alike, per sample and
+    // decimated, including depth 0 (denormal guard active on every step)
+    for (int decimation : {1, 32})
+    {
+      for (float depth : {0.7f, 0.0f})
+      {
+        DriftGeneratorBank bank;
+        DriftGenerator mono[DriftGeneratorBank::kMaxChannels];
+        bank.setSampleRate(48000.0f);
+        bank.seed(4242u);
+        bank.setRateHz(1.5f);
+        bank.setDepth(depth);
+        bank.setDecimation(decimation);
+        bank.reset(0.1f);
+        for (int c = 0; c < DriftGeneratorBank::kMaxChannels; ++c)
+        {
+          mono[c].setSampleRate(48000.0f);
+          mono[c].seed(DriftGeneratorBank::channelSeed(4242u, c));
+          mono[c].setRateHz(1.5f);
+          mono[c].setDepth(depth);
+          mono[c].setDecimation(decimation);
+          mono[c].reset(0.1f);
+        }
+
+        float maxDiff = 0.0f;
+        for (int i = 0; i < 48000; ++i)
+        {
+          // Rate changes mid-run go through the shared coefficients
+          if (i == 20000)
+          {
+            bank.setRateHz(6.0f);
+            for (DriftGenerator &m : mono)
+              m.setRateHz(6.0f);
+          }
+          float frame[DriftGeneratorBank::kMaxChannels];
+          bank.processFrame(frame);
+          for (int c = 0; c < DriftGeneratorBank::kMaxChannels; ++c)
+            maxDiff = std::max(maxDiff, std::fabs(frame[c] - mono[c].next()));
+        }
+        T_ASSERT(ctx, maxDiff == 0.0f);
+      }
+    }
+
+    // Channel 0 keeps the base seed, so a one-channel bank is a DriftGenerator
+    T_ASSERT(ctx, DriftGeneratorBank::channelSeed(42u, 0) == 42u);
+  }
+
+  void test_drift_bank_channels_independent(TestContext &ctx)
+  {
+    using ShortwavDSP::DriftGeneratorBank;
+
+    DriftGeneratorBank bank;
+    bank.setSampleRate(44100.0f);
+    bank.seed(7u);
+    bank.setRateHz(2.0f);
+    bank.setDepth(1.0f);
+    bank.setDecimation(32);
+    bank.reset();
+
+    // Voices wander independently: low pairwise correlation
+    const int n = 44100 * 30;
+    std::vector<float> a(n), b(n);
+    float *planar[2] = {a.data(), b.data()};
+    bank.processBuffer(planar, static_cast<size_t>(n), 2);
+    double sa = 0.0, sb = 0.0, sab = 0.0, saa = 0.0, sbb = 0.0;
+    bool finite = true;
+    for (int i = 0; i < n; ++i)
+    {
+      finite = finite && std::isfinite(a[i]) && std::isfinite(b[i]);
+      sa += a[i];
+      sb += b[i];
+      sab += static_cast<double>(a[i]) * b[i];
+      saa += static_cast<double>(a[i]) * a[i];
+      sbb += static_cast<double>(b[i]) * b[i];
+    }
+    const double cov = sab / n - (sa / n) * (sb / n);
+    const double varA = saa / n - (sa / n) * (sa / n);
+    const double varB = sbb / n - (sb / n) * (sb / n);
+    T_ASSERT(ctx, finite);
+    T_ASSERT(ctx, varA > 0.0 && varB > 0.0);
+    T_ASSERT(ctx, std::fabs(cov / std::sqrt(varA * varB)) < 0.5);
+
+    // Channels enabled later start from the reset state and diverge too
+    float frame[DriftGeneratorBank::kMaxChannels];
+    for (int i = 0; i < 4410; ++i)
+      bank.processFrame(frame, 8);
+    T_ASSERT(ctx, frame[0] != frame[1]);
+    T_ASSERT(ctx, frame[4] != frame[5]);
+    T_ASSERT(ctx, std::isfinite(frame[4]) && std::isfinite(frame[5]));
+  }
+
   //------------------------------------------------------------------------------
   // FormantOscillator tests
   //------------------------------------------------------------------------------
@@ -1212,6 +1878,70 @@ namespace
     T_ASSERT(ctx, channelsDifferent);
   }
 
+  void test_threebandeq_stereo_buffers_match_per_sample(TestContext &ctx)
+  {
+    using ShortwavDSP::ThreeBandEQ;
+
+    // The packed stereo kernel must reproduce processStereoSample() exactly,
+    // including across a parameter ramp that ends mid-buffer
+    const int n = 700;
+    std::vector<float> inL(n), inR(n);
+    uint32_t rng = 4242u;
+    for (int i = 0; i < n; ++i)
+    {
+      rng = rng * 1664525u + 1013904223u;
+      inL[i] = static_cast<float>((rng >> 8) & 0xFFFFFF) / 16777216.0f * 2.0f - 1.0f;
+      inR[i] = 0.5f * std::sin(0.05f * static_cast<float>(i));
+    }
+
+    ThreeBandEQ ref, split, inter;
+    ThreeBandEQ *eqs[3] = {&ref, &split, &inter};
+    for (ThreeBandEQ *eq : eqs)
+    {
+      eq->setSampleRate(48000.0f);
+      eq->setParameterRamp(64);
+      eq->setCrossoverFreqs(300.0f, 3000.0f);
+      eq->setGains(1.8f, 0.4f, 1.3f);
+    }
+
+    std::vector<float> refL(n), refR(n);
+    for (int i = 0; i < n; ++i)
+    {
+      refL[i] = inL[i];
+      refR[i] = inR[i];
+      ref.processStereoSample(refL[i], refR[i]);
+    }
+
+    // Split buffers, in two calls so the state hand-off is covered too
+    std::vector<float> outL(n), outR(n);
+    split.processStereoBuffer(inL.data(), inR.data(), outL.data(), outR.data(), 37);
+    split.processStereoBuffer(inL.data() + 37, inR.data() + 37, outL.data() + 37, outR.data() + 37, n - 37);
+
+    // Interleaved, in place
+    std::vector<float> frames(2 * n);
+    for (int i = 0; i < n; ++i)
+    {
+      frames[2 * i] = inL[i];
+      frames[2 * i + 1] = inR[i];
+    }
+    inter.processStereoBufferInterleaved(frames.data(), frames.data(), n);
+
+    int mismatches = 0;
+    for (int i = 0; i < n; ++i)
+    {
+      if (outL[i] != refL[i] || outR[i] != refR[i])
+        ++mismatches;
+      if (frames[2 * i] != refL[i] || frames[2 * i + 1] != refR[i])
+        ++mismatches;
+    }
+    T_ASSERT(ctx, mismatches == 0);
+
+    // The mono path continues from the stereo left state
+    float a = 0.25f, b = 0.0f;
+    ref.processStereoSample(a, b);
+    T_ASSERT(ctx, split.processSample(0.25f) == a);
+  }
+
   void test_threebandeq_sample_rate_independence(TestContext &ctx)
   {
     using ShortwavDSP::ThreeBandEQ;
@@ -1457,78 +2187,443 @@ namespace
     // The assertion just ensures the algorithm completed successfully
   }
 
-  //------------------------------------------------------------------------------
-  // MoogLowPassFilter tests
-  //------------------------------------------------------------------------------
-
-  void test_lowpass_basic_construction_and_defaults(TestContext &ctx)
+  void test_threebandeq_poly_matches_scalar(TestContext &ctx)
   {
-    using ShortwavDSP::MoogLowPassFilter;
+    using ShortwavDSP::ThreeBandEQ;
 
-    MoogLowPassFilter filter;
-    
-    // Verify default parameter values are sensible
-    T_ASSERT(ctx, filter.getSampleRate() > 0.0f);
-    T_ASSERT(ctx, filter.getCutoff() > 0.0f);
-    T_ASSERT(ctx, filter.getResonance() >= 0.0f && filter.getResonance() <= 1.0f);
-    T_ASSERT(ctx, filter.isStateValid());
+    ThreeBandEQ eq;
+    eq.setSampleRate(48000.0f);
+    eq.setCrossoverFreqs(200.0f, 3000.0f);
+    eq.setGainsDB(6.0f, -4.0f, 3.0f);
+
+    // Reference: one scalar channel per poly channel, driven with the same
+    // coefficients the EQ derives internally (via a mono ThreeBandEQ each)
+    const int numChannels = ThreeBandEQ::kMaxPolyChannels;
+    std::vector<ThreeBandEQ> reference(numChannels);
+    for (auto &r : reference)
+    {
+      r.setSampleRate(48000.0f);
+      r.setCrossoverFreqs(200.0f, 3000.0f);
+      r.setGainsDB(6.0f, -4.0f, 3.0f);
+    }
+
+    float in[ThreeBandEQ::kMaxPolyChannels];
+    float out[ThreeBandEQ::kMaxPolyChannels];
+    float maxDiff = 0.0f;
+    for (int i = 0; i < 2000; ++i)
+    {
+      for (int c = 0; c < numChannels; ++c)
+      {
+        // Different frequency per channel so lanes cannot mask each other
+        in[c] = 0.5f * std::sin(2.0f * 3.14159265f * (50.0f + 300.0f * c) * i / 48000.0f);
+      }
+      eq.processPoly(in, out, numChannels);
+      for (int c = 0; c < numChannels; ++c)
+      {
+        const float expected = reference[c].processSample(in[c]);
+        maxDiff = std::max(maxDiff, std::fabs(out[c] - expected));
+      }
+    }
+    T_ASSERT_NEAR(ctx, maxDiff, 0.0f, kTightEpsilon);
   }
 
-  void test_lowpass_parameter_clamping(TestContext &ctx)
+  void test_threebandeq_poly_partial_channels(TestContext &ctx)
   {
-    using ShortwavDSP::MoogLowPassFilter;
-
-    MoogLowPassFilter filter;
-    filter.setSampleRate(48000.0f);
+    using ShortwavDSP::ThreeBandEQ;
 
-    // Test cutoff clamping - should clamp to [20Hz, Nyquist/2]
-    filter.setCutoff(-100.0f);
-    T_ASSERT(ctx, filter.getCutoff() >= 20.0f);
+    ThreeBandEQ eq;
+    eq.setSampleRate(44100.0f);
+    eq.setGains(2.0f, 0.5f, 1.5f);
 
-    filter.setCutoff(100000.0f); // Way above Nyquist
-    T_ASSERT(ctx, filter.getCutoff() < 24000.0f); // Should be < Nyquist/2
+    // 5 channels: one full group plus a single lane; must not touch out[5..]
+    const int numChannels = 5;
+    float in[ThreeBandEQ::kMaxPolyChannels];
+    float out[ThreeBandEQ::kMaxPolyChannels];
+    for (int c = 0; c < ThreeBandEQ::kMaxPolyChannels; ++c)
+    {
+      out[c] = -123.0f;
+    }
 
-    filter.setCutoff(1000.0f);
-    T_ASSERT_NEAR(ctx, filter.getCutoff(), 1000.0f, 1.0f);
+    ThreeBandEQ reference;
+    reference.setSampleRate(44100.0f);
+    reference.setGains(2.0f, 0.5f, 1.5f);
 
-    // Test resonance clamping - should clamp to [0, 1]
-    filter.setResonance(-0.5f);
-    T_ASSERT(ctx, filter.getResonance() >= 0.0f);
+    bool lane4Matches = true;
+    for (int i = 0; i < 500; ++i)
+    {
+      for (int c = 0; c < numChannels; ++c)
+      {
+        in[c] = (c == 4) ? std::sin(0.05f * i) : 0.0f;
+      }
+      eq.processPoly(in, out, numChannels);
+      const float expected = reference.processSample(in[4]);
+      if (std::fabs(out[4] - expected) > kTightEpsilon)
+        lane4Matches = false;
+    }
+    T_ASSERT(ctx, lane4Matches);
 
-    filter.setResonance(2.0f);
-    T_ASSERT(ctx, filter.getResonance() <= 1.0f);
+    // Silent channels stay (near) silent: no crosstalk between lanes
+    for (int c = 0; c < 4; ++c)
+    {
+      T_ASSERT(ctx, std::fabs(out[c]) < 1e-6f);
+    }
+    T_ASSERT(ctx, out[5] == -123.0f);
+    T_ASSERT(ctx, out[15] == -123.0f);
 
-    filter.setResonance(0.7f);
-    T_ASSERT_NEAR(ctx, filter.getResonance(), 0.7f, 0.01f);
+    // Zero channels is a no-op
+    eq.processPoly(in, out, 0);
+    T_ASSERT(ctx, out[5] == -123.0f);
   }
 
-  void test_lowpass_reset_clears_state(TestContext &ctx)
+  void test_threebandeq_poly_stereo_and_reset(TestContext &ctx)
   {
-    using ShortwavDSP::MoogLowPassFilter;
+    using ShortwavDSP::ThreeBandEQ;
 
-    MoogLowPassFilter filter;
-    filter.setSampleRate(44100.0f);
-    filter.setCutoff(1000.0f);
-    filter.setResonance(0.8f);
+    ThreeBandEQ eq;
+    eq.setSampleRate(48000.0f);
+    eq.setGains(3.0f, 1.0f, 1.0f);
 
-    // Process some samples to build up state
-    for (int i = 0; i < 100; ++i)
+    float inL[ThreeBandEQ::kMaxPolyChannels];
+    float inR[ThreeBandEQ::kMaxPolyChannels];
+    float outL[ThreeBandEQ::kMaxPolyChannels];
+    float outR[ThreeBandEQ::kMaxPolyChannels];
+    for (int c = 0; c < ThreeBandEQ::kMaxPolyChannels; ++c)
     {
-      filter.processSample(1.0f);
+      inL[c] = 0.5f;
+      inR[c] = 0.0f;
     }
 
-    // Reset should clear state
-    filter.reset();
-
-    // Process silence - output should remain near zero
-    float maxOutput = 0.0f;
-    for (int i = 0; i < 100; ++i)
+    // Left and right banks hold independent state
+    for (int i = 0; i < 1000; ++i)
     {
-      float out = filter.processSample(0.0f);
-      maxOutput = std::max(maxOutput, std::fabs(out));
+      eq.processPolyStereo(inL, inR, outL, outR, ThreeBandEQ::kMaxPolyChannels);
     }
+    T_ASSERT(ctx, std::fabs(outL[0]) > 0.1f);
+    T_ASSERT(ctx, std::fabs(outR[0]) < 1e-6f);
+    T_ASSERT_NEAR(ctx, outL[15], outL[0], kTightEpsilon);
 
-    T_ASSERT(ctx, maxOutput < 0.001f);
+    // Reset clears the poly state as well
+    eq.reset();
+    for (int c = 0; c < ThreeBandEQ::kMaxPolyChannels; ++c)
+    {
+      inL[c] = 0.0f;
+    }
+    eq.processPolyStereo(inL, inR, outL, outR, ThreeBandEQ::kMaxPolyChannels);
+    T_ASSERT(ctx, std::fabs(outL[0]) < 1e-6f);
+    T_ASSERT(ctx, std::fabs(outL[15]) < 1e-6f);
+  }
+
+  void test_threebandeq_magnitude_response_matches_measurement(TestContext &ctx)
+  {
+    using ShortwavDSP::ThreeBandEQ;
+
+    // Unity gains reconstruct the input (delayed by three samples) exactly
+    bool flat = true;
+    for (float f = 20.0f; f < 20000.0f; f *= 1.5f)
+      flat = flat && std::fabs(ThreeBandEQ::magnitudeResponse(f, 48000.0f, 150.0f, 2500.0f, 1.0f, 1.0f, 1.0f) - 1.0f) < 1e-5f;
+    T_ASSERT(ctx, flat);
+
+    // The analytic response matches the steady-state sine gain of the filter
+    const float sr = 48000.0f;
+    const float freqs[] = {40.0f, 150.0f, 600.0f, 2500.0f, 8000.0f, 16000.0f};
+    for (float f : freqs)
+    {
+      ThreeBandEQ eq;
+      eq.setSampleRate(sr);
+      eq.setCrossoverFreqs(150.0f, 2500.0f);
+      eq.setGains(2.0f, 0.5f, 1.5f);
+
+      const int settle = 24000;
+      const int measure = 24000;
+      double s = 0.0, c = 0.0;
+      for (int i = 0; i < settle + measure; ++i)
+      {
+        const double phase = 2.0 * M_PI * f * i / sr;
+        const float y = eq.processSample(0.5f * static_cast<float>(std::sin(phase)));
+        if (i >= settle)
+        {
+          s += y * std::sin(phase);
+          c += y * std::cos(phase);
+        }
+      }
+      const double measured = 2.0 * std::sqrt(s * s + c * c) / measure / 0.5;
+      const float expected = eq.getMagnitudeResponse(f);
+      T_ASSERT(ctx, expected == ThreeBandEQ::magnitudeResponse(f, sr, 150.0f, 2500.0f, 2.0f, 0.5f, 1.5f));
+      T_ASSERT_NEAR(ctx, 20.0 * std::log10(measured), 20.0f * std::log10(expected), 0.1f);
+    }
+  }
+
+  void test_threebandeq_band_tap(TestContext &ctx)
+  {
+    using ShortwavDSP::ThreeBandEQ;
+
+    ThreeBandEQ plain, tapped;
+    plain.setSampleRate(48000.0f);
+    tapped.setSampleRate(48000.0f);
+    plain.setGains(2.0f, 0.5f, 1.5f);
+    tapped.setGains(2.0f, 0.5f, 1.5f);
+
+    // Bands are (L + R) / 2 summed over the valid channels; outputs unchanged
+    const int channels = 6;
+    float inL[ThreeBandEQ::kMaxPolyChannels], inR[ThreeBandEQ::kMaxPolyChannels];
+    float plainL[ThreeBandEQ::kMaxPolyChannels], plainR[ThreeBandEQ::kMaxPolyChannels];
+    float outL[ThreeBandEQ::kMaxPolyChannels], outR[ThreeBandEQ::kMaxPolyChannels];
+    uint32_t seed = 29u;
+    bool identical = true;
+    bool sums = true;
+    for (int i = 0; i < 2000; ++i)
+    {
+      for (int ch = 0; ch < channels; ++ch)
+      {
+        seed = seed * 1664525u + 1013904223u;
+        inL[ch] = static_cast<float>(seed >> 8) / 8388608.0f - 1.0f;
+        inR[ch] = 0.5f * inL[ch];
+      }
+      float bands[3];
+      plain.processPolyStereo(inL, inR, plainL, plainR, channels);
+      tapped.processPolyStereo(inL, inR, outL, outR, channels, bands);
+      float mix = 0.0f;
+      for (int ch = 0; ch < channels; ++ch)
+      {
+        identical = identical && outL[ch] == plainL[ch] && outR[ch] == plainR[ch];
+        mix += 0.5f * (outL[ch] + outR[ch]);
+      }
+      sums = sums && std::fabs(bands[0] + bands[1] + bands[2] - mix) < 1e-4f;
+    }
+    T_ASSERT(ctx, identical);
+    T_ASSERT(ctx, sums);
+  }
+
+  void test_threebandeq_linkwitz_riley_crossover(TestContext &ctx)
+  {
+    using ShortwavDSP::CrossoverMode;
+    using ShortwavDSP::ThreeBandEQ;
+
+    // Unity gains sum to an allpass: flat magnitude (within 0.01 dB of float
+    // coefficient rounding) at any crossover setting
+    bool flat = true;
+    for (float f = 20.0f; f < 20000.0f; f *= 1.5f)
+      flat = flat && std::fabs(ThreeBandEQ::magnitudeResponse(f, 48000.0f, 150.0f, 2500.0f, 1.0f, 1.0f, 1.0f,
+                                                              CrossoverMode::LinkwitzRiley) - 1.0f) < 1e-3f;
+    T_ASSERT(ctx, flat);
+
+    // Steady-state sine gain through the filter, linear
+    auto measure = [](ThreeBandEQ &eq, float f, float sr) {
+      const int settle = 24000;
+      const int length = 24000;
+      double s = 0.0, c = 0.0;
+      for (int i = 0; i < settle + length; ++i)
+      {
+        const double phase = 2.0 * M_PI * f * i / sr;
+        const float y = eq.processSample(0.5f * static_cast<float>(std::sin(phase)));
+        if (i >= settle)
+        {
+          s += y * std::sin(phase);
+          c += y * std::cos(phase);
+        }
+      }
+      return 2.0 * std::sqrt(s * s + c * c) / length / 0.5;
+    };
+
+    const float sr = 48000.0f;
+    const float freqs[] = {40.0f, 150.0f, 600.0f, 2500.0f, 8000.0f, 16000.0f};
+    for (float f : freqs)
+    {
+      ThreeBandEQ eq;
+      eq.setSampleRate(sr);
+      eq.setCrossoverMode(CrossoverMode::LinkwitzRiley);
+      eq.setCrossoverFreqs(150.0f, 2500.0f);
+      eq.setGains(2.0f, 0.5f, 1.5f);
+      T_ASSERT(ctx, eq.getCrossoverMode() == CrossoverMode::LinkwitzRiley);
+
+      const float expected = eq.getMagnitudeResponse(f);
+      T_ASSERT(ctx, expected == ThreeBandEQ::magnitudeResponse(f, sr, 150.0f, 2500.0f, 2.0f, 0.5f, 1.5f,
+                                                               CrossoverMode::LinkwitzRiley));
+      T_ASSERT_NEAR(ctx, 20.0 * std::log10(measure(eq, f, sr)), 20.0f * std::log10(expected), 0.1f);
+    }
+
+    // Three octaves below the high crossover the high band alone is down
+    // more than 60 dB, where the Classic difference band still leaks through
+    ThreeBandEQ lr, classic;
+    lr.setCrossoverMode(CrossoverMode::LinkwitzRiley);
+    ThreeBandEQ *eqs[2] = {&lr, &classic};
+    for (ThreeBandEQ *eq : eqs)
+    {
+      eq->setSampleRate(sr);
+      eq->setCrossoverFreqs(150.0f, 2400.0f);
+      eq->setGains(0.0f, 0.0f, 1.0f);
+    }
+    T_ASSERT(ctx, 20.0 * std::log10(measure(lr, 300.0f, sr)) < -60.0);
+    T_ASSERT(ctx, 20.0 * std::log10(measure(classic, 300.0f, sr)) > -40.0);
+  }
+
+  void test_threebandeq_band_split(TestContext &ctx)
+  {
+    using ShortwavDSP::CrossoverMode;
+    using ShortwavDSP::ThreeBandEQ;
+
+    const int channels = 6;
+    const CrossoverMode modes[] = {CrossoverMode::Classic, CrossoverMode::LinkwitzRiley};
+    for (CrossoverMode mode : modes)
+    {
+      ThreeBandEQ plain, split, mono;
+      ThreeBandEQ *eqs[3] = {&plain, &split, &mono};
+      for (ThreeBandEQ *eq : eqs)
+      {
+        eq->setSampleRate(48000.0f);
+        eq->setCrossoverMode(mode);
+        eq->setGains(2.0f, 0.5f, 1.5f);
+      }
+
+      // Per-channel bands sum to each output; outputs and the mono tap are
+      // unchanged, and every poly lane matches the scalar path
+      float inL[ThreeBandEQ::kMaxPolyChannels], inR[ThreeBandEQ::kMaxPolyChannels];
+      float plainL[ThreeBandEQ::kMaxPolyChannels], plainR[ThreeBandEQ::kMaxPolyChannels];
+      float outL[ThreeBandEQ::kMaxPolyChannels], outR[ThreeBandEQ::kMaxPolyChannels];
+      ThreeBandEQ::BandSplit bandsL, bandsR;
+      uint32_t seed = 30u;
+      bool identical = true;
+      bool sums = true;
+      for (int i = 0; i < 2000; ++i)
+      {
+        for (int ch = 0; ch < channels; ++ch)
+        {
+          seed = seed * 1664525u + 1013904223u;
+          inL[ch] = static_cast<float>(seed >> 8) / 8388608.0f - 1.0f;
+          inR[ch] = 0.5f * inL[ch];
+        }
+        float bands[3];
+        plain.processPolyStereo(inL, inR, plainL, plainR, channels);
+        split.processPolyStereo(inL, inR, outL, outR, channels, bands, &bandsL, &bandsR);
+        identical = identical && mono.processSample(inL[0]) == plainL[0];
+
+        float mix[3] = {0.0f, 0.0f, 0.0f};
+        for (int ch = 0; ch < channels; ++ch)
+        {
+          identical = identical && outL[ch] == plainL[ch] && outR[ch] == plainR[ch];
+          sums = sums && std::fabs(bandsL.low[ch] + bandsL.mid[ch] + bandsL.high[ch] - outL[ch]) < 1e-5f;
+          sums = sums && std::fabs(bandsR.low[ch] + bandsR.mid[ch] + bandsR.high[ch] - outR[ch]) < 1e-5f;
+          mix[0] += 0.5f * (bandsL.low[ch] + bandsR.low[ch]);
+          mix[1] += 0.5f * (bandsL.mid[ch] + bandsR.mid[ch]);
+          mix[2] += 0.5f * (bandsL.high[ch] + bandsR.high[ch]);
+        }
+        for (int b = 0; b < 3; ++b)
+          sums = sums && std::fabs(bands[b] - mix[b]) < 1e-4f;
+      }
+      T_ASSERT(ctx, identical);
+      T_ASSERT(ctx, sums);
+    }
+
+    // The packed Linkwitz-Riley stereo kernel reproduces processStereoSample()
+    // exactly, across a crossover ramp that ends mid-buffer
+    const int n = 700;
+    std::vector<float> inL(n), inR(n);
+    uint32_t rng = 3030u;
+    for (int i = 0; i < n; ++i)
+    {
+      rng = rng * 1664525u + 1013904223u;
+      inL[i] = static_cast<float>((rng >> 8) & 0xFFFFFF) / 16777216.0f * 2.0f - 1.0f;
+      inR[i] = 0.5f * std::sin(0.05f * static_cast<float>(i));
+    }
+
+    ThreeBandEQ ref, buffered;
+    ThreeBandEQ *eqs[2] = {&ref, &buffered};
+    for (ThreeBandEQ *eq : eqs)
+    {
+      eq->setSampleRate(48000.0f);
+      eq->setCrossoverMode(CrossoverMode::LinkwitzRiley);
+      eq->setParameterRamp(64);
+      eq->setCrossoverFreqs(300.0f, 3000.0f);
+      eq->setGains(1.8f, 0.4f, 1.3f);
+    }
+
+    std::vector<float> refL(inL), refR(inR), outL(n), outR(n);
+    for (int i = 0; i < n; ++i)
+      ref.processStereoSample(refL[i], refR[i]);
+    buffered.processStereoBuffer(inL.data(), inR.data(), outL.data(), outR.data(), 37);
+    buffered.processStereoBuffer(inL.data() + 37, inR.data() + 37, outL.data() + 37, outR.data() + 37, n - 37);
+
+    int mismatches = 0;
+    for (int i = 0; i < n; ++i)
+    {
+      if (outL[i] != refL[i] || outR[i] != refR[i])
+        ++mismatches;
+    }
+    T_ASSERT(ctx, mismatches == 0);
+  }
+
+  //------------------------------------------------------------------------------
+  // MoogLowPassFilter tests
+  //------------------------------------------------------------------------------
+
+  void test_lowpass_basic_construction_and_defaults(TestContext &ctx)
+  {
+    using ShortwavDSP::MoogLowPassFilter;
+
+    MoogLowPassFilter filter;
+    
+    // Verify default parameter values are sensible
+    T_ASSERT(ctx, filter.getSampleRate() > 0.0f);
+    T_ASSERT(ctx, filter.getCutoff() > 0.0f);
+    T_ASSERT(ctx, filter.getResonance() >= 0.0f && filter.getResonance() <= 1.0f);
+    T_ASSERT(ctx, filter.isStateValid());
+  }
+
+  void test_lowpass_parameter_clamping(TestContext &ctx)
+  {
+    using ShortwavDSP::MoogLowPassFilter;
+
+    MoogLowPassFilter filter;
+    filter.setSampleRate(48000.0f);
+
+    // Test cutoff clamping - should clamp to [20Hz, Nyquist/2]
+    filter.setCutoff(-100.0f);
+    T_ASSERT(ctx, filter.getCutoff() >= 20.0f);
+
+    filter.setCutoff(100000.0f); // Way above Nyquist
+    T_ASSERT(ctx, filter.getCutoff() < 24000.0f); // Should be < Nyquist/2
+
+    filter.setCutoff(1000.0f);
+    T_ASSERT_NEAR(ctx, filter.getCutoff(), 1000.0f, 1.0f);
+
+    // Test resonance clamping - should clamp to [0, 1]
+    filter.setResonance(-0.5f);
+    T_ASSERT(ctx, filter.getResonance() >= 0.0f);
+
+    filter.setResonance(2.0f);
+    T_ASSERT(ctx, filter.getResonance() <= 1.0f);
+
+    filter.setResonance(0.7f);
+    T_ASSERT_NEAR(ctx, filter.getResonance(), 0.7f, 0.01f);
+  }
+
+  void test_lowpass_reset_clears_state(TestContext &ctx)
+  {
+    using ShortwavDSP::MoogLowPassFilter;
+
+    MoogLowPassFilter filter;
+    filter.setSampleRate(44100.0f);
+    filter.setCutoff(1000.0f);
+    filter.setResonance(0.8f);
+
+    // Process some samples to build up state
+    for (int i = 0; i < 100; ++i)
+    {
+      filter.processSample(1.0f);
+    }
+
+    // Reset should clear state
+    filter.reset();
+
+    // Process silence - output should remain near zero
+    float maxOutput = 0.0f;
+    for (int i = 0; i < 100; ++i)
+    {
+      float out = filter.processSample(0.0f);
+      maxOutput = std::max(maxOutput, std::fabs(out));
+    }
+
+    T_ASSERT(ctx, maxOutput < 0.001f);
   }
 
   void test_lowpass_silence_produces_silence(TestContext &ctx)
@@ -2084,1160 +3179,3070 @@ namespace
   }
 
   //------------------------------------------------------------------------------
-  // WavPlayer tests
+  // Control-rate processing tests (LinearRamp, ControlRateDivider, ramps)
   //------------------------------------------------------------------------------
 
-  // Helper to generate a valid WAV file in memory for testing
-  std::vector<uint8_t> generateTestWav(size_t numSamples, uint16_t channels = 1,
-                                        uint32_t sampleRate = 44100, uint16_t bitsPerSample = 16,
-                                        float frequency = 440.0f)
+  void test_linear_ramp_behavior(TestContext &ctx)
   {
-    const size_t bytesPerSample = bitsPerSample / 8;
-    const size_t dataSize = numSamples * channels * bytesPerSample;
-    const size_t headerSize = 44; // Standard WAV header size
-    std::vector<uint8_t> wav(headerSize + dataSize);
-
-    // RIFF header
-    std::memcpy(wav.data(), "RIFF", 4);
-    uint32_t fileSize = static_cast<uint32_t>(wav.size() - 8);
-    std::memcpy(wav.data() + 4, &fileSize, 4);
-    std::memcpy(wav.data() + 8, "WAVE", 4);
-
-    // fmt chunk
-    std::memcpy(wav.data() + 12, "fmt ", 4);
-    uint32_t fmtSize = 16;
-    std::memcpy(wav.data() + 16, &fmtSize, 4);
-    uint16_t audioFormat = 1; // PCM
-    std::memcpy(wav.data() + 20, &audioFormat, 2);
-    std::memcpy(wav.data() + 22, &channels, 2);
-    std::memcpy(wav.data() + 24, &sampleRate, 4);
-    uint32_t byteRate = sampleRate * channels * bytesPerSample;
-    std::memcpy(wav.data() + 28, &byteRate, 4);
-    uint16_t blockAlign = static_cast<uint16_t>(channels * bytesPerSample);
-    std::memcpy(wav.data() + 32, &blockAlign, 2);
-    std::memcpy(wav.data() + 34, &bitsPerSample, 2);
+    ShortwavDSP::LinearRamp ramp(0.0f);
+    T_ASSERT(ctx, !ramp.isActive());
+
+    // Ramp lands exactly on the target after numSteps samples
+    ramp.setTarget(1.0f, 4);
+    T_ASSERT(ctx, ramp.isActive());
+    T_ASSERT_NEAR(ctx, ramp.next(), 0.25f, kTightEpsilon);
+    T_ASSERT_NEAR(ctx, ramp.next(), 0.5f, kTightEpsilon);
+    T_ASSERT_NEAR(ctx, ramp.next(), 0.75f, kTightEpsilon);
+    T_ASSERT(ctx, ramp.next() == 1.0f);
+    T_ASSERT(ctx, !ramp.isActive());
+    T_ASSERT(ctx, ramp.next() == 1.0f);
+
+    // Retargeting mid-ramp continues from the current value
+    ramp.setTarget(0.0f, 10);
+    ramp.next();
+    const float mid = ramp.getValue();
+    ramp.setTarget(2.0f, 2);
+    T_ASSERT_NEAR(ctx, ramp.next(), mid + (2.0f - mid) * 0.5f, kTightEpsilon);
+    T_ASSERT(ctx, ramp.next() == 2.0f);
+
+    // Zero/negative steps jump immediately
+    ramp.setTarget(-3.0f, 0);
+    T_ASSERT(ctx, ramp.getValue() == -3.0f);
+    T_ASSERT(ctx, !ramp.isActive());
+  }
 
-    // data chunk
-    std::memcpy(wav.data() + 36, "data", 4);
-    uint32_t dataSizeU32 = static_cast<uint32_t>(dataSize);
-    std::memcpy(wav.data() + 40, &dataSizeU32, 4);
+  void test_control_rate_startup_division(TestContext &ctx)
+  {
+    using ShortwavDSP::ControlRateDivider;
+    using ShortwavDSP::ControlRateStartup;
 
-    // Generate sine wave samples
-    for (size_t i = 0; i < numSamples; ++i)
+    // New instance: added without being restored
     {
-      float phase = 2.0f * 3.14159265f * frequency * static_cast<float>(i) / static_cast<float>(sampleRate);
-      for (uint16_t c = 0; c < channels; ++c)
-      {
-        float sample = std::sin(phase + (c == 1 ? 3.14159265f / 2.0f : 0.0f)); // Phase offset for R channel
-        size_t offset = headerSize + (i * channels + c) * bytesPerSample;
+      ControlRateDivider divider;
+      ControlRateStartup startup(divider);
+      startup.added();
+      T_ASSERT(ctx, divider.getDivision() == ControlRateDivider::kDefaultDivision);
+    }
 
-        if (bitsPerSample == 8)
-        {
-          uint8_t val = static_cast<uint8_t>((sample + 1.0f) * 127.5f);
-          wav[offset] = val;
-        }
-        else if (bitsPerSample == 16)
-        {
-          int16_t val = static_cast<int16_t>(sample * 32767.0f);
-          std::memcpy(wav.data() + offset, &val, 2);
-        }
-        else if (bitsPerSample == 24)
-        {
-          int32_t val = static_cast<int32_t>(sample * 8388607.0f);
-          wav[offset] = static_cast<uint8_t>(val & 0xFF);
-          wav[offset + 1] = static_cast<uint8_t>((val >> 8) & 0xFF);
-          wav[offset + 2] = static_cast<uint8_t>((val >> 16) & 0xFF);
-        }
-        else if (bitsPerSample == 32)
-        {
-          int32_t val = static_cast<int32_t>(sample * 2147483647.0f);
-          std::memcpy(wav.data() + offset, &val, 4);
-        }
-      }
+    // Old patch with no module data: the host never applies any saved data
+    {
+      ControlRateDivider divider;
+      ControlRateStartup startup(divider);
+      startup.restoring();
+      startup.added();
+      T_ASSERT(ctx, divider.getDivision() == ControlRateStartup::kLegacyDivision);
     }
 
-    return wav;
+    // Patch with a saved division keeps it
+    {
+      ControlRateDivider divider;
+      ControlRateStartup startup(divider);
+      startup.restoring();
+      divider.setDivision(32);
+      startup.added();
+      T_ASSERT(ctx, divider.getDivision() == 32);
+    }
   }
 
-  // Generate float WAV data
-  std::vector<uint8_t> generateTestWavFloat(size_t numSamples, uint16_t channels = 1,
-                                             uint32_t sampleRate = 44100, float frequency = 440.0f)
+  void test_control_rate_divider_blocks(TestContext &ctx)
   {
-    const size_t bytesPerSample = 4;
-    const size_t dataSize = numSamples * channels * bytesPerSample;
-    const size_t headerSize = 44;
-    std::vector<uint8_t> wav(headerSize + dataSize);
+    ShortwavDSP::ControlRateDivider divider;
+    T_ASSERT(ctx, divider.getDivision() == ShortwavDSP::ControlRateDivider::kDefaultDivision);
 
-    // RIFF header
-    std::memcpy(wav.data(), "RIFF", 4);
-    uint32_t fileSize = static_cast<uint32_t>(wav.size() - 8);
-    std::memcpy(wav.data() + 4, &fileSize, 4);
-    std::memcpy(wav.data() + 8, "WAVE", 4);
+    divider.setDivision(16);
+    int ticks = 0;
+    for (int i = 0; i < 160; ++i)
+    {
+      const bool start = divider.tick();
+      if (start)
+        ++ticks;
+      T_ASSERT(ctx, start == (i % 16 == 0));
+    }
+    T_ASSERT(ctx, ticks == 10);
+
+    // Division changes take effect at the next block boundary only
+    divider.reset();
+    T_ASSERT(ctx, divider.tick());
+    T_ASSERT(ctx, divider.getBlockSize() == 16);
+    divider.setDivision(64);
+    int samplesUntilNext = 1;
+    while (!divider.tick())
+      ++samplesUntilNext;
+    T_ASSERT(ctx, samplesUntilNext == 16);
+    T_ASSERT(ctx, divider.getBlockSize() == 64);
+
+    // Clamping
+    divider.setDivision(0);
+    T_ASSERT(ctx, divider.getDivision() == 1);
+    divider.setDivision(100000);
+    T_ASSERT(ctx, divider.getDivision() == ShortwavDSP::ControlRateDivider::kMaxDivision);
+
+    // Division 1 ticks every sample
+    divider.setDivision(1);
+    divider.reset();
+    bool everySample = true;
+    for (int i = 0; i < 10; ++i)
+      everySample = everySample && divider.tick();
+    T_ASSERT(ctx, everySample);
+  }
 
-    // fmt chunk
-    std::memcpy(wav.data() + 12, "fmt ", 4);
-    uint32_t fmtSize = 16;
-    std::memcpy(wav.data() + 16, &fmtSize, 4);
-    uint16_t audioFormat = 3; // IEEE float
-    std::memcpy(wav.data() + 20, &audioFormat, 2);
-    std::memcpy(wav.data() + 22, &channels, 2);
-    std::memcpy(wav.data() + 24, &sampleRate, 4);
-    uint32_t byteRate = sampleRate * channels * bytesPerSample;
-    std::memcpy(wav.data() + 28, &byteRate, 4);
-    uint16_t blockAlign = static_cast<uint16_t>(channels * bytesPerSample);
-    std::memcpy(wav.data() + 32, &blockAlign, 2);
-    uint16_t bitsPerSample = 32;
-    std::memcpy(wav.data() + 34, &bitsPerSample, 2);
+  void test_threebandeq_parameter_ramp_settles(TestContext &ctx)
+  {
+    using ShortwavDSP::ThreeBandEQ;
 
-    // data chunk
-    std::memcpy(wav.data() + 36, "data", 4);
-    uint32_t dataSizeU32 = static_cast<uint32_t>(dataSize);
-    std::memcpy(wav.data() + 40, &dataSizeU32, 4);
+    // Ramped EQ must end up bit-identical to one set immediately
+    ThreeBandEQ ramped;
+    ThreeBandEQ immediate;
+    ramped.setSampleRate(48000.0f);
+    immediate.setSampleRate(48000.0f);
 
-    // Generate samples
-    for (size_t i = 0; i < numSamples; ++i)
+    // Settle both on a DC input at unity gain
+    for (int i = 0; i < 2000; ++i)
+    {
+      ramped.processSample(0.5f);
+      immediate.processSample(0.5f);
+    }
+
+    ramped.setParameterRamp(32);
+    T_ASSERT(ctx, ramped.getParameterRamp() == 32);
+    ramped.setGainsDB(9.0f, -6.0f, 3.0f);
+    immediate.setGainsDB(9.0f, -6.0f, 3.0f);
+
+    // Getters report the target right away
+    T_ASSERT_NEAR(ctx, ramped.getLowGainDB(), 9.0f, 1e-4f);
+
+    // The immediate EQ jumps to the new DC level, the ramped one glides there
+    float prevRamped = 0.5f, prevImmediate = 0.5f;
+    float maxJumpRamped = 0.0f, maxJumpImmediate = 0.0f;
+    for (int i = 0; i < 32; ++i)
+    {
+      const float yr = ramped.processSample(0.5f);
+      const float yi = immediate.processSample(0.5f);
+      maxJumpRamped = std::max(maxJumpRamped, std::fabs(yr - prevRamped));
+      maxJumpImmediate = std::max(maxJumpImmediate, std::fabs(yi - prevImmediate));
+      prevRamped = yr;
+      prevImmediate = yi;
+    }
+    T_ASSERT(ctx, maxJumpImmediate > 0.5f);
+    T_ASSERT(ctx, maxJumpRamped < maxJumpImmediate * 0.1f);
+    T_ASSERT_NEAR(ctx, prevRamped, prevImmediate, 1e-4f);
+
+    // Crossover changes ramp too and settle on the same coefficients
+    ramped.setCrossoverFreqs(120.0f, 3500.0f);
+    immediate.setCrossoverFreqs(120.0f, 3500.0f);
+    for (int i = 0; i < 32; ++i)
+    {
+      ramped.processSample(0.0f);
+      immediate.processSample(0.0f);
+    }
+
+    ramped.reset();
+    immediate.reset();
+    float maxDiff = 0.0f;
+    bool finite = true;
+    for (int i = 0; i < 500; ++i)
+    {
+      const float x = std::sin(0.03f * i);
+      const float yr = ramped.processSample(x);
+      const float yi = immediate.processSample(x);
+      finite = finite && std::isfinite(yr);
+      maxDiff = std::max(maxDiff, std::fabs(yr - yi));
+    }
+    T_ASSERT(ctx, finite);
+    T_ASSERT(ctx, maxDiff == 0.0f);
+  }
+
+  void test_lowpass_parameter_ramp_settles(TestContext &ctx)
+  {
+    using ShortwavDSP::MoogLowPassFilter;
+
+    MoogLowPassFilter ramped;
+    MoogLowPassFilter immediate;
+    ramped.setSampleRate(48000.0f);
+    immediate.setSampleRate(48000.0f);
+    ramped.setCutoff(200.0f);
+    immediate.setCutoff(200.0f);
+
+    ramped.setParameterRamp(64);
+    T_ASSERT(ctx, ramped.getParameterRamp() == 64);
+    ramped.setCutoff(2000.0f);
+    ramped.setResonance(0.6f);
+    immediate.setCutoff(2000.0f);
+    immediate.setResonance(0.6f);
+    T_ASSERT_NEAR(ctx, ramped.getCutoff(), 2000.0f, kEpsilon);
+
+    // First sample after the change still uses a cutoff close to 200 Hz,
+    // so its step response is much slower than the immediate filter's
+    const float rampedFirst = ramped.processSample(1.0f);
+    const float immediateFirst = immediate.processSample(1.0f);
+    T_ASSERT(ctx, rampedFirst < immediateFirst);
+
+    for (int i = 1; i < 64; ++i)
+    {
+      ramped.processSample(0.0f);
+      immediate.processSample(0.0f);
+    }
+
+    ramped.reset();
+    immediate.reset();
+    float maxDiff = 0.0f;
+    bool finite = true;
+    for (int i = 0; i < 500; ++i)
+    {
+      const float x = (i % 50 < 25) ? 0.5f : -0.5f;
+      const float yr = ramped.processSample(x);
+      const float yi = immediate.processSample(x);
+      finite = finite && std::isfinite(yr);
+      maxDiff = std::max(maxDiff, std::fabs(yr - yi));
+    }
+    T_ASSERT(ctx, finite);
+    T_ASSERT(ctx, maxDiff == 0.0f);
+    T_ASSERT(ctx, ramped.isStateValid());
+  }
+
+  void test_fast_math_accuracy(TestContext &ctx)
+  {
+    using ShortwavDSP::detail::fastExp;
+    using ShortwavDSP::detail::fastExp2;
+    using ShortwavDSP::detail::fastSin;
+
+    double sinError = 0.0;
+    for (int i = -70000; i <= 70000; ++i)
+    {
+      const float x = 1e-4f * static_cast<float>(i); // About +-2 pi
+      sinError = std::max(sinError, std::fabs(static_cast<double>(fastSin(x)) - std::sin(static_cast<double>(x))));
+    }
+    T_ASSERT(ctx, sinError < 3e-7);
+
+    double exp2Error = 0.0;
+    for (int i = -12600; i <= 12700; ++i)
+    {
+      const float x = 0.01f * static_cast<float>(i);
+      const double exact = std::exp2(static_cast<double>(x));
+      exp2Error = std::max(exp2Error, std::fabs(fastExp2(x) - exact) / exact);
+    }
+    T_ASSERT(ctx, exp2Error < 3e-7);
+    T_ASSERT_NEAR(ctx, fastExp(-1.0f), std::exp(-1.0f), 1e-6f);
+    T_ASSERT(ctx, fastExp2(-200.0f) == 0.0f);
+    T_ASSERT(ctx, std::isfinite(fastExp2(1000.0f)));
+  }
+
+  void test_coefficient_setters_skip_unchanged(TestContext &ctx)
+  {
+    using ShortwavDSP::MoogLowPassFilter;
+    using ShortwavDSP::ThreeBandEQ;
+
+    // Re-sending unchanged values mid-ramp (a control-rate caller with static
+    // knobs) must not restart the ramp: it still settles on schedule
+    MoogLowPassFilter filter;
+    MoogLowPassFilter immediate;
+    filter.setSampleRate(48000.0f);
+    immediate.setSampleRate(48000.0f);
+    filter.setParameterRamp(64);
+    filter.setCutoff(3000.0f);
+    filter.setResonance(0.5f);
+    immediate.setCutoff(3000.0f);
+    immediate.setResonance(0.5f);
+    for (int i = 0; i < 64; ++i)
+    {
+      if (i % 16 == 0)
+      {
+        filter.setCutoff(3000.0f);
+        filter.setResonance(0.5f);
+      }
+      filter.processSample(0.0f);
+    }
+    filter.reset();
+    float maxDiff = 0.0f;
+    for (int i = 0; i < 200; ++i)
+    {
+      const float x = (i % 40 < 20) ? 0.5f : -0.5f;
+      maxDiff = std::max(maxDiff, std::fabs(filter.processSample(x) - immediate.processSample(x)));
+    }
+    T_ASSERT(ctx, maxDiff == 0.0f);
+
+    ThreeBandEQ eq;
+    ThreeBandEQ eqImmediate;
+    eq.setSampleRate(48000.0f);
+    eqImmediate.setSampleRate(48000.0f);
+    eq.setParameterRamp(64);
+    eq.setCrossoverFreqs(150.0f, 4000.0f);
+    eq.setGainsDB(6.0f, -3.0f, 2.0f);
+    eqImmediate.setCrossoverFreqs(150.0f, 4000.0f);
+    eqImmediate.setGainsDB(6.0f, -3.0f, 2.0f);
+    for (int i = 0; i < 64; ++i)
+    {
+      if (i % 16 == 0)
+      {
+        eq.setCrossoverFreqs(150.0f, 4000.0f);
+        eq.setGainsDB(6.0f, -3.0f, 2.0f);
+      }
+      eq.processSample(0.0f);
+    }
+    eq.reset();
+    maxDiff = 0.0f;
+    for (int i = 0; i < 200; ++i)
+    {
+      const float x = std::sin(0.05f * static_cast<float>(i));
+      maxDiff = std::max(maxDiff, std::fabs(eq.processSample(x) - eqImmediate.processSample(x)));
+    }
+    T_ASSERT(ctx, maxDiff == 0.0f);
+    T_ASSERT_NEAR(ctx, eq.getLowGainDB(), 6.0f, 1e-4f);
+    T_ASSERT_NEAR(ctx, eq.getMidGainDB(), -3.0f, 1e-4f);
+
+    // A filter configured only through setters (no setSampleRate) still works
+    MoogLowPassFilter fresh;
+    fresh.setCutoff(1000.0f);
+    float energy = 0.0f;
+    for (int i = 0; i < 100; ++i)
+      energy += std::fabs(fresh.processSample(1.0f));
+    T_ASSERT(ctx, energy > 0.0f);
+  }
+
+  void test_lowpass_stereo_buffer_independent_state(TestContext &ctx)
+  {
+    using ShortwavDSP::MoogLowPassFilter;
+
+    MoogLowPassFilter stereo, monoL, monoR;
+    for (MoogLowPassFilter *f : {&stereo, &monoL, &monoR})
+    {
+      f->setSampleRate(48000.0f);
+      f->setCutoff(300.0f);
+      f->setParameterRamp(64);
+      f->setCutoff(2000.0f); // Ramp must advance once per frame, not per channel
+      f->setResonance(0.5f);
+    }
+
+    const size_t n = 256;
+    std::vector<float> inL(n, 0.0f), inR(n, 0.0f), outL(n), outR(n);
+    inL[0] = 1.0f; // Impulse on the left only
+    for (size_t i = 0; i < n; ++i)
+      inR[i] = std::sin(0.1f * i) * ((i >= 100) ? 1.0f : 0.0f);
+
+    stereo.processStereoBuffer(inL.data(), inR.data(), outL.data(), outR.data(), n);
+
+    float maxDiff = 0.0f;
+    float rightBeforeSignal = 0.0f;
+    for (size_t i = 0; i < n; ++i)
+    {
+      maxDiff = std::max(maxDiff, std::fabs(outL[i] - monoL.processSample(inL[i])));
+      maxDiff = std::max(maxDiff, std::fabs(outR[i] - monoR.processSample(inR[i])));
+      if (i < 100)
+        rightBeforeSignal = std::max(rightBeforeSignal, std::fabs(outR[i]));
+    }
+    T_ASSERT(ctx, maxDiff == 0.0f);
+    T_ASSERT(ctx, rightBeforeSignal == 0.0f); // No left impulse leaks into the right
+    T_ASSERT(ctx, stereo.isStateValid());
+  }
+
+  void test_lowpass_multichannel_matches_mono(TestContext &ctx)
+  {
+    using ShortwavDSP::MoogLowPassFilter;
+    using ShortwavDSP::PolyMoogLowPassFilter;
+    using ShortwavDSP::StereoMoogLowPassFilter;
+
+    const int numChannels = 11; // Exercises a partial SIMD group
+    PolyMoogLowPassFilter poly;
+    MoogLowPassFilter mono[numChannels];
+    StereoMoogLowPassFilter stereo;
+    T_ASSERT(ctx, PolyMoogLowPassFilter::kNumGroups == 4);
+    T_ASSERT(ctx, StereoMoogLowPassFilter::kNumGroups == 1);
+
+    auto setup = [](auto &f) {
+      f.setSampleRate(44100.0f);
+      f.setCutoff(800.0f);
+      f.setResonance(0.2f);
+    };
+    setup(poly);
+    setup(stereo);
+    for (MoogLowPassFilter &m : mono)
+      setup(m);
+
+    const size_t n = 600;
+    std::vector<std::vector<float>> planarIn(2, std::vector<float>(n)), planarOut(2, std::vector<float>(n));
+    float maxDiff = 0.0f;
+    for (size_t i = 0; i < n; ++i)
+    {
+      if (i == 200)
+      {
+        // Control-rate style update mid-stream
+        poly.setParameterRamp(32);
+        poly.setCutoff(5000.0f);
+        poly.setResonance(0.9f);
+        for (MoogLowPassFilter &m : mono)
+        {
+          m.setParameterRamp(32);
+          m.setCutoff(5000.0f);
+          m.setResonance(0.9f);
+        }
+      }
+
+      float in[numChannels], out[numChannels];
+      for (int c = 0; c < numChannels; ++c)
+        in[c] = std::sin(0.01f * (c + 1) * i) + ((i % 97 == 0) ? 0.5f : 0.0f);
+      poly.processFrame(in, out, numChannels);
+      for (int c = 0; c < numChannels; ++c)
+        maxDiff = std::max(maxDiff, std::fabs(out[c] - mono[c].processSample(in[c])));
+
+      planarIn[0][i] = in[0];
+      planarIn[1][i] = in[1];
+    }
+    T_ASSERT(ctx, maxDiff < 1e-6f);
+    T_ASSERT(ctx, poly.isStateValid());
+
+    // Planar and stereo entry points agree (channels 0/1 never ramped here)
+    const float *inPtrs[2] = {planarIn[0].data(), planarIn[1].data()};
+    float *outPtrs[2] = {planarOut[0].data(), planarOut[1].data()};
+    stereo.processBuffer(inPtrs, outPtrs, n, 2);
+    StereoMoogLowPassFilter stereo2;
+    setup(stereo2);
+    std::vector<float> outL(n), outR(n);
+    stereo2.processStereoBuffer(planarIn[0].data(), planarIn[1].data(), outL.data(), outR.data(), n);
+    float stereoDiff = 0.0f;
+    for (size_t i = 0; i < n; ++i)
+      stereoDiff = std::max({stereoDiff, std::fabs(outL[i] - planarOut[0][i]), std::fabs(outR[i] - planarOut[1][i])});
+    T_ASSERT(ctx, stereoDiff == 0.0f);
+  }
+
+  // Steady-state gain of a ZDF ladder for a sine at freq (from the RMS, since
+  // sampled peaks near fs / 4 depend on the output phase)
+  template <typename Filter>
+  static float zdfSineGain(Filter &filter, float freq, float sr)
+  {
+    filter.reset();
+    const int numSamples = static_cast<int>(sr * 0.25f);
+    double sumSquares = 0.0;
+    int count = 0;
+    for (int i = 0; i < numSamples; ++i)
+    {
+      const float y = filter.processSample(std::sin(2.0f * 3.14159265f * freq * i / sr));
+      if (i >= numSamples / 2)
+      {
+        sumSquares += static_cast<double>(y) * y;
+        ++count;
+      }
+    }
+    return static_cast<float>(std::sqrt(2.0 * sumSquares / count));
+  }
+
+  void test_zdf_ladder_tracks_high_cutoff(TestContext &ctx)
+  {
+    using ShortwavDSP::ZdfLadderFilter;
+
+    const float sr = 48000.0f;
+    const int factors[] = {1, 2, 4};
+    for (int factor : factors)
+    {
+      ZdfLadderFilter filter;
+      filter.setSampleRate(sr);
+      filter.setOversampling(factor);
+      T_ASSERT(ctx, filter.getOversampling() == factor);
+
+      // Prewarped bilinear stages: each one-pole is exactly -3 dB at the
+      // cutoff, so the 4-pole ladder sits at -12 dB there, even at sr / 4
+      filter.setCutoff(12000.0f);
+      filter.setResonance(0.0f);
+      const float atCutoff = zdfSineGain(filter, 12000.0f, sr);
+      T_ASSERT_NEAR(ctx, atCutoff, 0.25f, 0.02f);
+      T_ASSERT_NEAR(ctx, zdfSineGain(filter, 100.0f, sr), 1.0f, 0.02f);
+
+      // The resonant peak stays on the cutoff
+      filter.setCutoff(9000.0f);
+      filter.setResonance(0.9f);
+      const float below = zdfSineGain(filter, 9000.0f / 1.25f, sr);
+      const float peak = zdfSineGain(filter, 9000.0f, sr);
+      const float above = zdfSineGain(filter, 9000.0f * 1.25f, sr);
+      T_ASSERT(ctx, peak > below);
+      T_ASSERT(ctx, peak > above);
+      T_ASSERT(ctx, peak > 1.0f);
+    }
+
+    ZdfLadderFilter filter;
+    filter.setOversampling(3); // Rounds down
+    T_ASSERT(ctx, filter.getOversampling() == 2);
+    filter.setOversampling(16);
+    T_ASSERT(ctx, filter.getOversampling() == 4);
+    filter.setSampleRate(sr);
+    filter.setCutoff(40000.0f);
+    T_ASSERT_NEAR(ctx, filter.getCutoff(), sr * 0.475f, 0.1f);
+  }
+
+  void test_zdf_ladder_stable_under_audio_rate_modulation(TestContext &ctx)
+  {
+    using ShortwavDSP::ZdfLadderFilter;
+
+    const float sr = 48000.0f;
+    for (int saturate = 0; saturate < 2; ++saturate)
+    {
+      ZdfLadderFilter filter;
+      filter.setSampleRate(sr);
+      filter.setSaturation(saturate != 0);
+      filter.setResonance(saturate ? 1.0f : 0.97f);
+
+      // Cutoff swept 50 Hz - 20 kHz by a 2 kHz sine, updated every sample
+      float peak = 0.0f;
+      bool finite = true;
+      uint32_t seed = 12345u;
+      for (int i = 0; i < 48000; ++i)
+      {
+        const float lfo = std::sin(2.0f * 3.14159265f * 2000.0f * i / sr);
+        filter.setCutoff(50.0f * std::pow(400.0f, 0.5f + 0.5f * lfo));
+        seed = seed * 1664525u + 1013904223u;
+        const float noise = static_cast<float>(seed >> 8) / 8388608.0f - 1.0f;
+        const float y = filter.processSample(0.5f * noise);
+        finite = finite && std::isfinite(y);
+        peak = std::max(peak, std::fabs(y));
+      }
+      T_ASSERT(ctx, finite);
+      T_ASSERT(ctx, filter.isStateValid());
+      T_ASSERT(ctx, peak < (saturate ? 2.0f : 20.0f));
+    }
+
+    // Saturated self-oscillation settles to a bounded tone
+    ZdfLadderFilter osc;
+    osc.setSampleRate(sr);
+    osc.setSaturation(true);
+    osc.setCutoff(1000.0f);
+    osc.setResonance(1.0f);
+    osc.processSample(1.0f);
+    float tail = 0.0f;
+    for (int i = 0; i < 96000; ++i)
+    {
+      const float y = osc.processSample(0.0f);
+      if (i > 48000)
+        tail = std::max(tail, std::fabs(y));
+    }
+    T_ASSERT(ctx, std::isfinite(tail));
+    T_ASSERT(ctx, tail < 1.5f);
+  }
+
+  void test_zdf_ladder_buffer_matches_per_sample(TestContext &ctx)
+  {
+    using ShortwavDSP::ZdfLadderFilter;
+    using ShortwavDSP::ZdfLadderFilter4;
+    using ShortwavDSP::simd::float4;
+
+    const float sr = 44100.0f;
+    const size_t n = 512;
+    const int factors[] = {1, 2, 4};
+    for (int factor : factors)
+    {
+      ZdfLadderFilter perSample, buffered;
+      ZdfLadderFilter4 lanes;
+      auto setup = [&](auto &f) {
+        f.setSampleRate(sr);
+        f.setOversampling(factor);
+        f.setSaturation(true);
+        f.setCutoff(500.0f);
+        f.setResonance(0.3f);
+        f.setParameterRamp(100);
+        f.setCutoff(15000.0f); // Ramp runs across the first 100 samples
+        f.setResonance(0.8f);
+      };
+      setup(perSample);
+      setup(buffered);
+      setup(lanes);
+
+      std::vector<float> in(n), out(n);
+      std::vector<float4> in4(n), out4(n);
+      for (size_t i = 0; i < n; ++i)
+      {
+        in[i] = 0.8f * std::sin(0.05f * i) + ((i % 37 == 0) ? 0.5f : 0.0f);
+        float lane[4] = {in[i], 0.5f * in[i], -in[i], 0.0f};
+        in4[i] = float4::load(lane);
+      }
+      buffered.processBuffer(in.data(), out.data(), 200); // Split mid-stream
+      buffered.processBuffer(in.data() + 200, out.data() + 200, n - 200);
+      lanes.processBuffer(in4.data(), out4.data(), n);
+
+      float maxDiff = 0.0f;
+      float maxLaneDiff = 0.0f;
+      for (size_t i = 0; i < n; ++i)
+      {
+        const float y = perSample.processSample(in[i]);
+        maxDiff = std::max(maxDiff, std::fabs(y - out[i]));
+        maxLaneDiff = std::max(maxLaneDiff, std::fabs(y - out4[i][0]));
+      }
+      T_ASSERT(ctx, maxDiff == 0.0f);
+      T_ASSERT(ctx, maxLaneDiff < 1e-5f);
+      T_ASSERT(ctx, std::fabs(out4[n - 1][3]) < 1e-6f); // Silent lane stays silent
+      T_ASSERT(ctx, lanes.isStateValid());
+    }
+  }
+
+  void test_formantosc_parameter_ramp(TestContext &ctx)
+  {
+    using ShortwavDSP::FormantOscillator;
+
+    FormantOscillator ramped;
+    FormantOscillator immediate;
+    ramped.setSampleRate(48000.0f);
+    immediate.setSampleRate(48000.0f);
+    ramped.setCarrierFreq(220.0f);
+    immediate.setCarrierFreq(220.0f);
+
+    // Ramp to a new pitch over 16 samples, then both oscillators must run at
+    // the same frequency (same phase increment => same period of output).
+    ramped.setParameterRamp(16);
+    ramped.setCarrierFreq(440.0f);
+    ramped.setFormantFreq(1200.0f);
+    immediate.setCarrierFreq(440.0f);
+    immediate.setFormantFreq(1200.0f);
+
+    std::vector<float> a(16), b(16);
+    ramped.processBuffer(nullptr, a.data(), a.size());
+    immediate.processBuffer(nullptr, b.data(), b.size());
+    bool differs = false;
+    for (size_t i = 0; i < a.size(); ++i)
+      differs = differs || (a[i] != b[i]);
+    T_ASSERT(ctx, differs);
+
+    ramped.reset();
+    immediate.reset();
+    float maxDiff = 0.0f;
+    bool finite = true;
+    for (int i = 0; i < 1000; ++i)
+    {
+      const float yr = ramped.processSample();
+      const float yi = immediate.processSample();
+      finite = finite && std::isfinite(yr);
+      maxDiff = std::max(maxDiff, std::fabs(yr - yi));
+    }
+    T_ASSERT(ctx, finite);
+    T_ASSERT(ctx, maxDiff == 0.0f);
+  }
+
+  void test_formantosc_oversampling_reduces_aliasing(TestContext &ctx)
+  {
+    using ShortwavDSP::FormantOscillator;
+
+    // Carrier 1 kHz at 44.1 kHz: true partials sit on multiples of 1 kHz,
+    // while components folded around Nyquist land 100 Hz (or 900 Hz) off them.
+    const double sr = 44100.0;
+    auto aliasRatio = [&](int factor) {
+      FormantOscillator osc;
+      osc.setSampleRate(static_cast<float>(sr));
+      osc.setOversampling(factor);
+      osc.setCarrierFreq(1000.0f);
+      osc.setFormantFreq(15000.0f);
+      osc.setFormantWidth(0.6f);
+      std::vector<float> x(4410 + 44100);
+      osc.processBuffer(nullptr, x.data(), x.size());
+      x.erase(x.begin(), x.begin() + 4410); // Skip DC blocker / filter settling
+
+      double harmonic = 0.0, alias = 0.0;
+      for (int k = 1; k <= 21; ++k)
+      {
+        harmonic += goertzelPower(x, 1000.0 * k, sr);
+        alias += goertzelPower(x, 1000.0 * k - 900.0, sr) + goertzelPower(x, 1000.0 * k - 100.0, sr);
+      }
+      return alias / harmonic;
+    };
+
+    FormantOscillator osc;
+    T_ASSERT(ctx, osc.getOversampling() == 1);
+    osc.setOversampling(3); // Rounds down
+    T_ASSERT(ctx, osc.getOversampling() == 2);
+    osc.setOversampling(64);
+    T_ASSERT(ctx, osc.getOversampling() == 8);
+
+    const double r1 = aliasRatio(1);
+    const double r4 = aliasRatio(4);
+    const double r8 = aliasRatio(8);
+    T_ASSERT(ctx, r1 > 1e-4);      // Audible aliasing at 1x
+    T_ASSERT(ctx, r4 < r1 * 0.01); // At least 20 dB less
+    T_ASSERT(ctx, r8 <= r4 * 1.5);
+  }
+
+  void test_formantosc_integer_phase_wraps_exactly(TestContext &ctx)
+  {
+    using ShortwavDSP::FormantOscillator;
+
+    // A carrier of exactly sr/64 repeats every 64 samples: the integer phase
+    // accumulator must come back to the same value with no drift.
+    FormantOscillator osc;
+    osc.setSampleRate(48000.0f);
+    osc.setCarrierFreq(750.0f);
+    osc.setFormantFreq(5250.0f); // Harmonic ratio 7
+    osc.setFormantWidth(0.3f);
+
+    std::vector<float> warm(48000);
+    osc.processBuffer(nullptr, warm.data(), warm.size());
+    std::vector<float> a(64), b(64);
+    osc.setOutputGain(1.0f);
+    osc.processBuffer(nullptr, a.data(), a.size());
+    osc.processBuffer(nullptr, b.data(), b.size());
+
+    float maxDiff = 0.0f;
+    for (size_t i = 0; i < a.size(); ++i)
+      maxDiff = std::max(maxDiff, std::fabs(a[i] - b[i]));
+    T_ASSERT(ctx, maxDiff < 1e-4f); // Only the DC blocker tail differs
+  }
+
+  void test_formantosc_shared_table(TestContext &ctx)
+  {
+    using ShortwavDSP::FormantOscillator;
+
+    const float *table = FormantOscillator::getFormantTable();
+    T_ASSERT(ctx, table != nullptr);
+    T_ASSERT(ctx, reinterpret_cast<uintptr_t>(table) % 64 == 0);
+    T_ASSERT(ctx, FormantOscillator::getFormantTable() == table);
+
+    // Many instances share one table and still render identically
+    std::vector<FormantOscillator> voices(32);
+    bool identical = true;
+    std::vector<float> first(256), other(256);
+    for (size_t v = 0; v < voices.size(); ++v)
+    {
+      voices[v].setSampleRate(48000.0f);
+      voices[v].setCarrierFreq(220.0f);
+      voices[v].setFormantFreq(900.0f);
+      voices[v].processBuffer(nullptr, v == 0 ? first.data() : other.data(), 256);
+      if (v > 0)
+        identical = identical && other == first;
+    }
+    T_ASSERT(ctx, identical);
+    T_ASSERT(ctx, FormantOscillator::getFormantTable() == table);
+
+    // Table is finite, and the narrowest width is pure DC (0.5)
+    bool finite = true;
+    for (int i = 0; i < FormantOscillator::kTableSize * FormantOscillator::kMaxWidthIndex; ++i)
+      finite = finite && std::isfinite(table[i]);
+    T_ASSERT(ctx, finite);
+    T_ASSERT_NEAR(ctx, table[0], 0.5f, kTightEpsilon);
+  }
+
+  void test_formantosc_bank_matches_scalar(TestContext &ctx)
+  {
+    using ShortwavDSP::FormantOscillator;
+    using ShortwavDSP::FormantOscillatorBank;
+
+    for (int factor : {1, 4})
+    {
+      const int voices = 11; // Partial last group
+      FormantOscillatorBank bank;
+      std::vector<FormantOscillator> refs(voices);
+      bank.setSampleRate(48000.0f);
+      bank.setOversampling(factor);
+      T_ASSERT(ctx, bank.getOversampling() == factor);
+
+      auto configure = [&](int ramp, float detune) {
+        bank.setParameterRamp(ramp);
+        for (int v = 0; v < voices; ++v)
+        {
+          // Voice 3 is silent (carrier 0)
+          const float carrier = (v == 3) ? 0.0f : 110.0f * (1.0f + 0.37f * v) * detune;
+          const float formant = 400.0f + 350.0f * v;
+          const float width = 0.05f + 0.09f * v;
+          bank.setVoice(v, carrier, formant, width);
+          refs[v].setParameterRamp(ramp);
+          refs[v].setCarrierFreq(carrier);
+          refs[v].setFormantFreq(formant);
+          refs[v].setFormantWidth(width);
+        }
+      };
+
+      for (int v = 0; v < voices; ++v)
+      {
+        refs[v].setSampleRate(48000.0f);
+        refs[v].setOversampling(factor);
+      }
+      configure(0, 1.0f);
+
+      float maxDiff = 0.0f;
+      float out[FormantOscillatorBank::kMaxVoices];
+      for (int n = 0; n < 4000; ++n)
+      {
+        if (n == 2000)
+          configure(32, 1.5f); // Ramped pitch change mid-run
+        bank.processSample(out, voices);
+        for (int v = 0; v < voices; ++v)
+          maxDiff = std::max(maxDiff, std::fabs(out[v] - refs[v].processSample()));
+      }
+      T_ASSERT(ctx, maxDiff < 1e-4f);
+    }
+  }
+
+  void test_generators_process_buffer_matches_per_sample(TestContext &ctx)
+  {
+    ShortwavDSP::RandomLFO lfoA;
+    ShortwavDSP::RandomLFO lfoB;
+    lfoA.setSampleRate(48000.0f);
+    lfoB.setSampleRate(48000.0f);
+    lfoA.seed(42);
+    lfoB.seed(42);
+    lfoA.setRate(10.0f);
+    lfoB.setRate(10.0f);
+
+    std::vector<float> block(64);
+    bool lfoMatches = true;
+    for (int b = 0; b < 50; ++b)
+    {
+      lfoA.processBuffer(block.data(), block.size());
+      for (size_t i = 0; i < block.size(); ++i)
+        lfoMatches = lfoMatches && (block[i] == lfoB.processSample());
+    }
+    T_ASSERT(ctx, lfoMatches);
+
+    ShortwavDSP::DriftGenerator driftA;
+    ShortwavDSP::DriftGenerator driftB;
+    driftA.setSampleRate(48000.0f);
+    driftB.setSampleRate(48000.0f);
+    driftA.seed(7);
+    driftB.seed(7);
+    driftA.setRateHz(1.0f);
+    driftB.setRateHz(1.0f);
+
+    bool driftMatches = true;
+    for (int b = 0; b < 50; ++b)
+    {
+      driftA.processBuffer(block.data(), block.size());
+      for (size_t i = 0; i < block.size(); ++i)
+        driftMatches = driftMatches && (block[i] == driftB.next());
+    }
+    T_ASSERT(ctx, driftMatches);
+  }
+
+  //------------------------------------------------------------------------------
+  // WavPlayer tests
+  //------------------------------------------------------------------------------
+
+  // Helper to generate a valid WAV file in memory for testing
+  std::vector<uint8_t> generateTestWav(size_t numSamples, uint16_t channels = 1,
+                                        uint32_t sampleRate = 44100, uint16_t bitsPerSample = 16,
+                                        float frequency = 440.0f)
+  {
+    const size_t bytesPerSample = bitsPerSample / 8;
+    const size_t dataSize = numSamples * channels * bytesPerSample;
+    const size_t headerSize = 44; // Standard WAV header size
+    std::vector<uint8_t> wav(headerSize + dataSize);
+
+    // RIFF header
+    std::memcpy(wav.data(), "RIFF", 4);
+    uint32_t fileSize = static_cast<uint32_t>(wav.size() - 8);
+    std::memcpy(wav.data() + 4, &fileSize, 4);
+    std::memcpy(wav.data() + 8, "WAVE", 4);
+
+    // fmt chunk
+    std::memcpy(wav.data() + 12, "fmt ", 4);
+    uint32_t fmtSize = 16;
+    std::memcpy(wav.data() + 16, &fmtSize, 4);
+    uint16_t audioFormat = 1; // PCM
+    std::memcpy(wav.data() + 20, &audioFormat, 2);
+    std::memcpy(wav.data() + 22, &channels, 2);
+    std::memcpy(wav.data() + 24, &sampleRate, 4);
+    uint32_t byteRate = sampleRate * channels * bytesPerSample;
+    std::memcpy(wav.data() + 28, &byteRate, 4);
+    uint16_t blockAlign = static_cast<uint16_t>(channels * bytesPerSample);
+    std::memcpy(wav.data() + 32, &blockAlign, 2);
+    std::memcpy(wav.data() + 34, &bitsPerSample, 2);
+
+    // data chunk
+    std::memcpy(wav.data() + 36, "data", 4);
+    uint32_t dataSizeU32 = static_cast<uint32_t>(dataSize);
+    std::memcpy(wav.data() + 40, &dataSizeU32, 4);
+
+    // Generate sine wave samples
+    for (size_t i = 0; i < numSamples; ++i)
     {
       float phase = 2.0f * 3.14159265f * frequency * static_cast<float>(i) / static_cast<float>(sampleRate);
       for (uint16_t c = 0; c < channels; ++c)
       {
-        float sample = std::sin(phase + (c == 1 ? 3.14159265f / 2.0f : 0.0f));
-        size_t offset = headerSize + (i * channels + c) * bytesPerSample;
-        std::memcpy(wav.data() + offset, &sample, 4);
+        float sample = std::sin(phase + (c == 1 ? 3.14159265f / 2.0f : 0.0f)); // Phase offset for R channel
+        size_t offset = headerSize + (i * channels + c) * bytesPerSample;
+
+        if (bitsPerSample == 8)
+        {
+          uint8_t val = static_cast<uint8_t>((sample + 1.0f) * 127.5f);
+          wav[offset] = val;
+        }
+        else if (bitsPerSample == 16)
+        {
+          int16_t val = static_cast<int16_t>(sample * 32767.0f);
+          std::memcpy(wav.data() + offset, &val, 2);
+        }
+        else if (bitsPerSample == 24)
+        {
+          int32_t val = static_cast<int32_t>(sample * 8388607.0f);
+          wav[offset] = static_cast<uint8_t>(val & 0xFF);
+          wav[offset + 1] = static_cast<uint8_t>((val >> 8) & 0xFF);
+          wav[offset + 2] = static_cast<uint8_t>((val >> 16) & 0xFF);
+        }
+        else if (bitsPerSample == 32)
+        {
+          int32_t val = static_cast<int32_t>(sample * 2147483647.0f);
+          std::memcpy(wav.data() + offset, &val, 4);
+        }
+      }
+    }
+
+    return wav;
+  }
+
+  // Generate float WAV data
+  std::vector<uint8_t> generateTestWavFloat(size_t numSamples, uint16_t channels = 1,
+                                             uint32_t sampleRate = 44100, float frequency = 440.0f)
+  {
+    const size_t bytesPerSample = 4;
+    const size_t dataSize = numSamples * channels * bytesPerSample;
+    const size_t headerSize = 44;
+    std::vector<uint8_t> wav(headerSize + dataSize);
+
+    // RIFF header
+    std::memcpy(wav.data(), "RIFF", 4);
+    uint32_t fileSize = static_cast<uint32_t>(wav.size() - 8);
+    std::memcpy(wav.data() + 4, &fileSize, 4);
+    std::memcpy(wav.data() + 8, "WAVE", 4);
+
+    // fmt chunk
+    std::memcpy(wav.data() + 12, "fmt ", 4);
+    uint32_t fmtSize = 16;
+    std::memcpy(wav.data() + 16, &fmtSize, 4);
+    uint16_t audioFormat = 3; // IEEE float
+    std::memcpy(wav.data() + 20, &audioFormat, 2);
+    std::memcpy(wav.data() + 22, &channels, 2);
+    std::memcpy(wav.data() + 24, &sampleRate, 4);
+    uint32_t byteRate = sampleRate * channels * bytesPerSample;
+    std::memcpy(wav.data() + 28, &byteRate, 4);
+    uint16_t blockAlign = static_cast<uint16_t>(channels * bytesPerSample);
+    std::memcpy(wav.data() + 32, &blockAlign, 2);
+    uint16_t bitsPerSample = 32;
+    std::memcpy(wav.data() + 34, &bitsPerSample, 2);
+
+    // data chunk
+    std::memcpy(wav.data() + 36, "data", 4);
+    uint32_t dataSizeU32 = static_cast<uint32_t>(dataSize);
+    std::memcpy(wav.data() + 40, &dataSizeU32, 4);
+
+    // Generate samples
+    for (size_t i = 0; i < numSamples; ++i)
+    {
+      float phase = 2.0f * 3.14159265f * frequency * static_cast<float>(i) / static_cast<float>(sampleRate);
+      for (uint16_t c = 0; c < channels; ++c)
+      {
+        float sample = std::sin(phase + (c == 1 ? 3.14159265f / 2.0f : 0.0f));
+        size_t offset = headerSize + (i * channels + c) * bytesPerSample;
+        std::memcpy(wav.data() + offset, &sample, 4);
+      }
+    }
+
+    return wav;
+  }
+
+  void test_wavplayer_construction_and_defaults(TestContext &ctx)
+  {
+    using ShortwavDSP::WavPlayer;
+    using ShortwavDSP::PlaybackState;
+    using ShortwavDSP::LoopMode;
+    using ShortwavDSP::InterpolationQuality;
+
+    WavPlayer player;
+
+    // Check default values
+    T_ASSERT(ctx, !player.isLoaded());
+    T_ASSERT(ctx, player.getState() == PlaybackState::Stopped);
+    T_ASSERT(ctx, !player.isPlaying());
+    T_ASSERT_NEAR(ctx, player.getSpeed(), 1.0f, kTightEpsilon);
+    T_ASSERT_NEAR(ctx, player.getPitch(), 1.0f, kTightEpsilon);
+    T_ASSERT_NEAR(ctx, player.getVolume(), 1.0f, kTightEpsilon);
+    T_ASSERT(ctx, !player.getReverse());
+    T_ASSERT(ctx, player.getLoopMode() == LoopMode::Off);
+    T_ASSERT(ctx, player.getInterpolationQuality() == InterpolationQuality::Cubic);
+    T_ASSERT(ctx, player.getNumSamples() == 0);
+    T_ASSERT(ctx, player.getNumChannels() == 1);
+    T_ASSERT_NEAR(ctx, player.getDurationSeconds(), 0.0f, kTightEpsilon);
+  }
+
+  void test_wavplayer_load_from_memory_16bit_mono(TestContext &ctx)
+  {
+    using ShortwavDSP::WavPlayer;
+    using ShortwavDSP::WavError;
+
+    WavPlayer player;
+
+    // Generate test WAV: 1 second of 440Hz sine at 44100Hz, 16-bit mono
+    auto wav = generateTestWav(44100, 1, 44100, 16, 440.0f);
+
+    auto result = player.loadFromMemory(wav.data(), wav.size());
+    T_ASSERT(ctx, result == WavError::None);
+    T_ASSERT(ctx, player.isLoaded());
+    T_ASSERT(ctx, player.getNumSamples() == 44100);
+    T_ASSERT(ctx, player.getNumChannels() == 1);
+    T_ASSERT(ctx, player.getFileSampleRate() == 44100);
+    T_ASSERT(ctx, player.getBitsPerSample() == 16);
+    T_ASSERT_NEAR(ctx, player.getDurationSeconds(), 1.0f, 0.001f);
+  }
+
+  void test_wavplayer_load_from_memory_24bit_stereo(TestContext &ctx)
+  {
+    using ShortwavDSP::WavPlayer;
+    using ShortwavDSP::WavError;
+
+    WavPlayer player;
+
+    // Generate test WAV: 0.5 second of 880Hz sine at 48000Hz, 24-bit stereo
+    auto wav = generateTestWav(24000, 2, 48000, 24, 880.0f);
+
+    auto result = player.loadFromMemory(wav.data(), wav.size());
+    T_ASSERT(ctx, result == WavError::None);
+    T_ASSERT(ctx, player.isLoaded());
+    T_ASSERT(ctx, player.getNumSamples() == 24000);
+    T_ASSERT(ctx, player.getNumChannels() == 2);
+    T_ASSERT(ctx, player.getFileSampleRate() == 48000);
+    T_ASSERT(ctx, player.getBitsPerSample() == 24);
+  }
+
+  void test_wavplayer_load_from_memory_32bit_float(TestContext &ctx)
+  {
+    using ShortwavDSP::WavPlayer;
+    using ShortwavDSP::WavError;
+
+    WavPlayer player;
+
+    // Generate test WAV: 32-bit float
+    auto wav = generateTestWavFloat(22050, 1, 44100, 440.0f);
+
+    auto result = player.loadFromMemory(wav.data(), wav.size());
+    T_ASSERT(ctx, result == WavError::None);
+    T_ASSERT(ctx, player.isLoaded());
+    T_ASSERT(ctx, player.getNumSamples() == 22050);
+    T_ASSERT(ctx, player.getNumChannels() == 1);
+    T_ASSERT(ctx, player.getBitsPerSample() == 32);
+  }
+
+  void test_wavplayer_load_from_memory_8bit(TestContext &ctx)
+  {
+    using ShortwavDSP::WavPlayer;
+    using ShortwavDSP::WavError;
+
+    WavPlayer player;
+
+    // Generate test WAV: 8-bit mono
+    auto wav = generateTestWav(4410, 1, 44100, 8, 440.0f);
+
+    auto result = player.loadFromMemory(wav.data(), wav.size());
+    T_ASSERT(ctx, result == WavError::None);
+    T_ASSERT(ctx, player.isLoaded());
+    T_ASSERT(ctx, player.getBitsPerSample() == 8);
+  }
+
+  void test_wavplayer_load_from_memory_unsupported_depths(TestContext &ctx)
+  {
+    using ShortwavDSP::WavPlayer;
+    using ShortwavDSP::WavError;
+
+    // Well-formed headers with depths the decoders cannot read are rejected
+    // before any sample is converted (no reads past the data chunk)
+    WavPlayer player;
+    auto pcm12 = generateTestWav(4410, 1, 44100, 12, 440.0f);
+    T_ASSERT(ctx, player.loadFromMemory(pcm12.data(), pcm12.size()) == WavError::UnsupportedFormat);
+    T_ASSERT(ctx, !player.isLoaded());
+
+    // 64-bit float: same layout as the 32-bit generator, twice the bytes
+    auto float64 = generateTestWavFloat(2205, 2, 44100, 440.0f);
+    const uint16_t bits = 64;
+    const uint16_t blockAlign = 2 * 8;
+    const uint32_t byteRate = 44100u * blockAlign;
+    std::memcpy(float64.data() + 28, &byteRate, 4);
+    std::memcpy(float64.data() + 32, &blockAlign, 2);
+    std::memcpy(float64.data() + 34, &bits, 2);
+    T_ASSERT(ctx, player.loadFromMemory(float64.data(), float64.size()) == WavError::UnsupportedFormat);
+    T_ASSERT(ctx, !player.isLoaded());
+
+    // A supported file still loads afterwards
+    auto pcm16 = generateTestWav(441, 1, 44100, 16, 440.0f);
+    T_ASSERT(ctx, player.loadFromMemory(pcm16.data(), pcm16.size()) == WavError::None);
+  }
+
+  void test_wavplayer_invalid_wav_data(TestContext &ctx)
+  {
+    using ShortwavDSP::WavPlayer;
+    using ShortwavDSP::WavError;
+
+    WavPlayer player;
+
+    // Test null pointer
+    auto result1 = player.loadFromMemory(nullptr, 100);
+    T_ASSERT(ctx, result1 == WavError::InvalidParameter);
+
+    // Test too small data (returns InvalidParameter because size check fails first)
+    uint8_t smallData[10] = {0};
+    auto result2 = player.loadFromMemory(smallData, 10);
+    T_ASSERT(ctx, result2 == WavError::InvalidParameter);
+
+    // Test invalid RIFF header
+    uint8_t invalidRiff[44] = {0};
+    std::memcpy(invalidRiff, "XXXX", 4);
+    auto result3 = player.loadFromMemory(invalidRiff, 44);
+    T_ASSERT(ctx, result3 == WavError::InvalidFormat);
+
+    // Test valid RIFF but invalid WAVE
+    std::memcpy(invalidRiff, "RIFF", 4);
+    std::memcpy(invalidRiff + 8, "XXXX", 4);
+    auto result4 = player.loadFromMemory(invalidRiff, 44);
+    T_ASSERT(ctx, result4 == WavError::InvalidFormat);
+  }
+
+  void test_wavplayer_playback_controls(TestContext &ctx)
+  {
+    using ShortwavDSP::WavPlayer;
+    using ShortwavDSP::WavError;
+    using ShortwavDSP::PlaybackState;
+
+    WavPlayer player;
+    auto wav = generateTestWav(44100, 1, 44100, 16);
+    player.loadFromMemory(wav.data(), wav.size());
+
+    // Initial state
+    T_ASSERT(ctx, player.getState() == PlaybackState::Stopped);
+
+    // Play
+    player.play();
+    T_ASSERT(ctx, player.getState() == PlaybackState::Playing);
+    T_ASSERT(ctx, player.isPlaying());
+
+    // Pause
+    player.pause();
+    T_ASSERT(ctx, player.getState() == PlaybackState::Paused);
+    T_ASSERT(ctx, !player.isPlaying());
+
+    // Resume
+    player.play();
+    T_ASSERT(ctx, player.isPlaying());
+
+    // Stop (should reset position)
+    player.stop();
+    T_ASSERT(ctx, player.getState() == PlaybackState::Stopped);
+    T_ASSERT_NEAR(ctx, player.getPlaybackPosition(), 0.0f, kTightEpsilon);
+  }
+
+  void test_wavplayer_seek_functionality(TestContext &ctx)
+  {
+    using ShortwavDSP::WavPlayer;
+    using ShortwavDSP::WavError;
+
+    WavPlayer player;
+    auto wav = generateTestWav(44100, 1, 44100, 16);
+    player.loadFromMemory(wav.data(), wav.size());
+
+    // Seek to middle
+    player.seek(0.5f);
+    T_ASSERT_NEAR(ctx, player.getPlaybackPosition(), 0.5f, 0.001f);
+
+    // Seek to start
+    player.seek(0.0f);
+    T_ASSERT_NEAR(ctx, player.getPlaybackPosition(), 0.0f, kTightEpsilon);
+
+    // Seek to end
+    player.seek(1.0f);
+    T_ASSERT_NEAR(ctx, player.getPlaybackPosition(), 1.0f, 0.001f);
+
+    // Seek by sample
+    player.seekToSample(22050);
+    T_ASSERT_NEAR(ctx, player.getPlaybackPositionSamples(), 22050.0, 1.0);
+
+    // Seek out of bounds (should clamp)
+    player.seek(2.0f);
+    T_ASSERT(ctx, player.getPlaybackPosition() <= 1.0f);
+
+    player.seek(-1.0f);
+    T_ASSERT(ctx, player.getPlaybackPosition() >= 0.0f);
+  }
+
+  void test_wavplayer_parameter_setters(TestContext &ctx)
+  {
+    using ShortwavDSP::WavPlayer;
+    using ShortwavDSP::LoopMode;
+    using ShortwavDSP::InterpolationQuality;
+
+    WavPlayer player;
+
+    // Speed
+    player.setSpeed(2.0f);
+    T_ASSERT_NEAR(ctx, player.getSpeed(), 2.0f, kTightEpsilon);
+
+    player.setSpeed(0.5f);
+    T_ASSERT_NEAR(ctx, player.getSpeed(), 0.5f, kTightEpsilon);
+
+    // Speed clamping
+    player.setSpeed(0.001f);
+    T_ASSERT(ctx, player.getSpeed() >= 0.01f);
+
+    player.setSpeed(1000.0f);
+    T_ASSERT(ctx, player.getSpeed() <= 100.0f);
+
+    // Pitch
+    player.setPitch(2.0f);
+    T_ASSERT_NEAR(ctx, player.getPitch(), 2.0f, kTightEpsilon);
+
+    // Volume
+    player.setVolume(0.5f);
+    T_ASSERT_NEAR(ctx, player.getVolume(), 0.5f, kTightEpsilon);
+
+    player.setVolume(0.0f);
+    T_ASSERT_NEAR(ctx, player.getVolume(), 0.0f, kTightEpsilon);
+
+    // Reverse
+    player.setReverse(true);
+    T_ASSERT(ctx, player.getReverse());
+
+    player.setReverse(false);
+    T_ASSERT(ctx, !player.getReverse());
+
+    // Loop mode
+    player.setLoopMode(LoopMode::Forward);
+    T_ASSERT(ctx, player.getLoopMode() == LoopMode::Forward);
+
+    player.setLoopMode(LoopMode::PingPong);
+    T_ASSERT(ctx, player.getLoopMode() == LoopMode::PingPong);
+
+    // Interpolation
+    player.setInterpolationQuality(InterpolationQuality::None);
+    T_ASSERT(ctx, player.getInterpolationQuality() == InterpolationQuality::None);
+
+    player.setInterpolationQuality(InterpolationQuality::Linear);
+    T_ASSERT(ctx, player.getInterpolationQuality() == InterpolationQuality::Linear);
+  }
+
+  void test_wavplayer_process_sample_mono(TestContext &ctx)
+  {
+    using ShortwavDSP::WavPlayer;
+    using ShortwavDSP::WavError;
+
+    WavPlayer player;
+    auto wav = generateTestWav(4410, 1, 44100, 16, 440.0f);
+    player.loadFromMemory(wav.data(), wav.size());
+    player.setSampleRate(44100.0f);
+
+    // Not playing - should return silence
+    float sample = player.processSample();
+    T_ASSERT_NEAR(ctx, sample, 0.0f, kTightEpsilon);
+
+    // Start playing
+    player.play();
+    player.setVolume(1.0f);
+
+    // Process samples and verify they're in valid range
+    bool allValid = true;
+    for (int i = 0; i < 1000; ++i)
+    {
+      float s = player.processSample();
+      if (!std::isfinite(s) || s < -1.5f || s > 1.5f)
+      {
+        allValid = false;
+        break;
+      }
+    }
+    T_ASSERT(ctx, allValid);
+
+    // Position should have advanced
+    T_ASSERT(ctx, player.getPlaybackPositionSamples() > 0.0);
+  }
+
+  void test_wavplayer_process_sample_stereo(TestContext &ctx)
+  {
+    using ShortwavDSP::WavPlayer;
+    using ShortwavDSP::WavError;
+
+    WavPlayer player;
+    auto wav = generateTestWav(4410, 2, 44100, 16, 440.0f);
+    player.loadFromMemory(wav.data(), wav.size());
+    player.setSampleRate(44100.0f);
+    player.play();
+
+    // Process stereo samples
+    bool allValid = true;
+    for (int i = 0; i < 1000; ++i)
+    {
+      float left, right;
+      player.processSampleStereo(left, right);
+      if (!std::isfinite(left) || !std::isfinite(right) ||
+          left < -1.5f || left > 1.5f || right < -1.5f || right > 1.5f)
+      {
+        allValid = false;
+        break;
+      }
+    }
+    T_ASSERT(ctx, allValid);
+  }
+
+  void test_wavplayer_buffer_processing(TestContext &ctx)
+  {
+    using ShortwavDSP::WavPlayer;
+    using ShortwavDSP::WavError;
+
+    WavPlayer player;
+    auto wav = generateTestWav(44100, 1, 44100, 16, 440.0f);
+    player.loadFromMemory(wav.data(), wav.size());
+    player.setSampleRate(44100.0f);
+    player.play();
+
+    // Process buffer
+    std::vector<float> buffer(512);
+    player.processBuffer(buffer.data(), buffer.size());
+
+    // Verify all samples are valid
+    bool allValid = true;
+    for (size_t i = 0; i < buffer.size(); ++i)
+    {
+      if (!std::isfinite(buffer[i]))
+      {
+        allValid = false;
+        break;
       }
     }
-
-    return wav;
+    T_ASSERT(ctx, allValid);
   }
 
-  void test_wavplayer_construction_and_defaults(TestContext &ctx)
+  void test_wavplayer_stereo_buffer_processing(TestContext &ctx)
   {
     using ShortwavDSP::WavPlayer;
-    using ShortwavDSP::PlaybackState;
-    using ShortwavDSP::LoopMode;
-    using ShortwavDSP::InterpolationQuality;
+    using ShortwavDSP::WavError;
 
     WavPlayer player;
+    auto wav = generateTestWav(44100, 2, 44100, 16, 440.0f);
+    player.loadFromMemory(wav.data(), wav.size());
+    player.setSampleRate(44100.0f);
+    player.play();
 
-    // Check default values
-    T_ASSERT(ctx, !player.isLoaded());
-    T_ASSERT(ctx, player.getState() == PlaybackState::Stopped);
-    T_ASSERT(ctx, !player.isPlaying());
-    T_ASSERT_NEAR(ctx, player.getSpeed(), 1.0f, kTightEpsilon);
-    T_ASSERT_NEAR(ctx, player.getPitch(), 1.0f, kTightEpsilon);
-    T_ASSERT_NEAR(ctx, player.getVolume(), 1.0f, kTightEpsilon);
-    T_ASSERT(ctx, !player.getReverse());
-    T_ASSERT(ctx, player.getLoopMode() == LoopMode::Off);
-    T_ASSERT(ctx, player.getInterpolationQuality() == InterpolationQuality::Cubic);
-    T_ASSERT(ctx, player.getNumSamples() == 0);
-    T_ASSERT(ctx, player.getNumChannels() == 1);
-    T_ASSERT_NEAR(ctx, player.getDurationSeconds(), 0.0f, kTightEpsilon);
+    // Test interleaved stereo buffer
+    std::vector<float> interleavedBuffer(1024); // 512 frames * 2 channels
+    player.processBufferStereo(interleavedBuffer.data(), 512);
+
+    bool allValid = true;
+    for (size_t i = 0; i < interleavedBuffer.size(); ++i)
+    {
+      if (!std::isfinite(interleavedBuffer[i]))
+      {
+        allValid = false;
+        break;
+      }
+    }
+    T_ASSERT(ctx, allValid);
+
+    // Test split stereo buffers
+    std::vector<float> left(256), right(256);
+    player.processBufferStereoSplit(left.data(), right.data(), 256);
+
+    for (size_t i = 0; i < 256; ++i)
+    {
+      if (!std::isfinite(left[i]) || !std::isfinite(right[i]))
+      {
+        allValid = false;
+        break;
+      }
+    }
+    T_ASSERT(ctx, allValid);
   }
 
-  void test_wavplayer_load_from_memory_16bit_mono(TestContext &ctx)
+  void test_wavplayer_interpolation_quality(TestContext &ctx)
   {
     using ShortwavDSP::WavPlayer;
     using ShortwavDSP::WavError;
+    using ShortwavDSP::InterpolationQuality;
 
     WavPlayer player;
+    auto wav = generateTestWav(4410, 1, 44100, 16, 440.0f);
+    player.loadFromMemory(wav.data(), wav.size());
+    player.setSampleRate(44100.0f);
 
-    // Generate test WAV: 1 second of 440Hz sine at 44100Hz, 16-bit mono
-    auto wav = generateTestWav(44100, 1, 44100, 16, 440.0f);
+    // Test each interpolation quality
+    const InterpolationQuality qualities[] = {
+        InterpolationQuality::None,
+        InterpolationQuality::Linear,
+        InterpolationQuality::Cubic,
+        InterpolationQuality::Sinc};
 
-    auto result = player.loadFromMemory(wav.data(), wav.size());
-    T_ASSERT(ctx, result == WavError::None);
-    T_ASSERT(ctx, player.isLoaded());
-    T_ASSERT(ctx, player.getNumSamples() == 44100);
-    T_ASSERT(ctx, player.getNumChannels() == 1);
-    T_ASSERT(ctx, player.getFileSampleRate() == 44100);
-    T_ASSERT(ctx, player.getBitsPerSample() == 16);
-    T_ASSERT_NEAR(ctx, player.getDurationSeconds(), 1.0f, 0.001f);
+    for (auto quality : qualities)
+    {
+      player.setInterpolationQuality(quality);
+      player.seek(0.0f);
+      player.play();
+
+      bool valid = true;
+      for (int i = 0; i < 100; ++i)
+      {
+        float s = player.processSample();
+        if (!std::isfinite(s))
+        {
+          valid = false;
+          break;
+        }
+      }
+      T_ASSERT(ctx, valid);
+      player.stop();
+    }
   }
 
-  void test_wavplayer_load_from_memory_24bit_stereo(TestContext &ctx)
+  void test_wavplayer_speed_variation(TestContext &ctx)
   {
     using ShortwavDSP::WavPlayer;
     using ShortwavDSP::WavError;
+    using ShortwavDSP::LoopMode;
 
     WavPlayer player;
+    auto wav = generateTestWav(44100, 1, 44100, 16, 440.0f);
+    player.loadFromMemory(wav.data(), wav.size());
+    player.setSampleRate(44100.0f);
+    player.setLoopMode(LoopMode::Off);
 
-    // Generate test WAV: 0.5 second of 880Hz sine at 48000Hz, 24-bit stereo
-    auto wav = generateTestWav(24000, 2, 48000, 24, 880.0f);
+    // Test double speed - should finish in half the time
+    player.setSpeed(2.0f);
+    player.setPitch(1.0f);
+    player.seek(0.0f);
+    player.play();
 
-    auto result = player.loadFromMemory(wav.data(), wav.size());
-    T_ASSERT(ctx, result == WavError::None);
-    T_ASSERT(ctx, player.isLoaded());
-    T_ASSERT(ctx, player.getNumSamples() == 24000);
-    T_ASSERT(ctx, player.getNumChannels() == 2);
-    T_ASSERT(ctx, player.getFileSampleRate() == 48000);
-    T_ASSERT(ctx, player.getBitsPerSample() == 24);
+    // Process enough samples
+    int samplesProcessed = 0;
+    while (player.isPlaying() && samplesProcessed < 100000)
+    {
+      player.processSample();
+      samplesProcessed++;
+    }
+
+    // At 2x speed, should take ~22050 samples to finish 44100 sample file
+    T_ASSERT(ctx, samplesProcessed < 30000);
+    T_ASSERT(ctx, samplesProcessed > 20000);
+
+    // Test half speed
+    player.setSpeed(0.5f);
+    player.seek(0.0f);
+    player.play();
+
+    samplesProcessed = 0;
+    while (player.isPlaying() && samplesProcessed < 200000)
+    {
+      player.processSample();
+      samplesProcessed++;
+    }
+
+    // At 0.5x speed, should take ~88200 samples
+    T_ASSERT(ctx, samplesProcessed > 80000);
   }
 
-  void test_wavplayer_load_from_memory_32bit_float(TestContext &ctx)
+  void test_wavplayer_pitch_variation(TestContext &ctx)
   {
     using ShortwavDSP::WavPlayer;
     using ShortwavDSP::WavError;
 
     WavPlayer player;
+    auto wav = generateTestWav(44100, 1, 44100, 16, 440.0f);
+    player.loadFromMemory(wav.data(), wav.size());
+    player.setSampleRate(44100.0f);
+    player.setSpeed(1.0f);
 
-    // Generate test WAV: 32-bit float
-    auto wav = generateTestWavFloat(22050, 1, 44100, 440.0f);
+    // Test octave up (2x pitch)
+    player.setPitch(2.0f);
+    player.seek(0.0f);
+    player.play();
 
-    auto result = player.loadFromMemory(wav.data(), wav.size());
-    T_ASSERT(ctx, result == WavError::None);
-    T_ASSERT(ctx, player.isLoaded());
-    T_ASSERT(ctx, player.getNumSamples() == 22050);
-    T_ASSERT(ctx, player.getNumChannels() == 1);
-    T_ASSERT(ctx, player.getBitsPerSample() == 32);
+    bool allFinite = true;
+    for (int i = 0; i < 1000; ++i)
+    {
+      float s = player.processSample();
+      if (!std::isfinite(s))
+      {
+        allFinite = false;
+        break;
+      }
+    }
+    T_ASSERT(ctx, allFinite);
+
+    // Test octave down (0.5x pitch)
+    player.setPitch(0.5f);
+    player.seek(0.0f);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+      float s = player.processSample();
+      if (!std::isfinite(s))
+      {
+        allFinite = false;
+        break;
+      }
+    }
+    T_ASSERT(ctx, allFinite);
   }
 
-  void test_wavplayer_load_from_memory_8bit(TestContext &ctx)
+  void test_wavplayer_reverse_playback(TestContext &ctx)
   {
     using ShortwavDSP::WavPlayer;
     using ShortwavDSP::WavError;
+    using ShortwavDSP::LoopMode;
 
     WavPlayer player;
+    auto wav = generateTestWav(4410, 1, 44100, 16, 440.0f);
+    player.loadFromMemory(wav.data(), wav.size());
+    player.setSampleRate(44100.0f);
+    player.setLoopMode(LoopMode::Off);
 
-    // Generate test WAV: 8-bit mono
-    auto wav = generateTestWav(4410, 1, 44100, 8, 440.0f);
+    // Enable reverse playback
+    player.setReverse(true);
+    player.stop(); // Reset to end position for reverse
+    player.play();
 
-    auto result = player.loadFromMemory(wav.data(), wav.size());
-    T_ASSERT(ctx, result == WavError::None);
-    T_ASSERT(ctx, player.isLoaded());
-    T_ASSERT(ctx, player.getBitsPerSample() == 8);
+    // Process samples - position should decrease
+    double startPos = player.getPlaybackPositionSamples();
+    for (int i = 0; i < 100; ++i)
+    {
+      player.processSample();
+    }
+    double endPos = player.getPlaybackPositionSamples();
+
+    T_ASSERT(ctx, endPos < startPos);
+
+    // All samples should be valid
+    player.stop();
+    player.play();
+    bool allValid = true;
+    int count = 0;
+    while (player.isPlaying() && count < 10000)
+    {
+      float s = player.processSample();
+      if (!std::isfinite(s))
+      {
+        allValid = false;
+        break;
+      }
+      count++;
+    }
+    T_ASSERT(ctx, allValid);
   }
 
-  void test_wavplayer_invalid_wav_data(TestContext &ctx)
+  void test_wavplayer_loop_forward(TestContext &ctx)
   {
     using ShortwavDSP::WavPlayer;
     using ShortwavDSP::WavError;
+    using ShortwavDSP::LoopMode;
 
     WavPlayer player;
+    auto wav = generateTestWav(1000, 1, 44100, 16, 440.0f);
+    player.loadFromMemory(wav.data(), wav.size());
+    player.setSampleRate(44100.0f);
+    player.setLoopMode(LoopMode::Forward);
+    player.play();
 
-    // Test null pointer
-    auto result1 = player.loadFromMemory(nullptr, 100);
-    T_ASSERT(ctx, result1 == WavError::InvalidParameter);
-
-    // Test too small data (returns InvalidParameter because size check fails first)
-    uint8_t smallData[10] = {0};
-    auto result2 = player.loadFromMemory(smallData, 10);
-    T_ASSERT(ctx, result2 == WavError::InvalidParameter);
-
-    // Test invalid RIFF header
-    uint8_t invalidRiff[44] = {0};
-    std::memcpy(invalidRiff, "XXXX", 4);
-    auto result3 = player.loadFromMemory(invalidRiff, 44);
-    T_ASSERT(ctx, result3 == WavError::InvalidFormat);
-
-    // Test valid RIFF but invalid WAVE
-    std::memcpy(invalidRiff, "RIFF", 4);
-    std::memcpy(invalidRiff + 8, "XXXX", 4);
-    auto result4 = player.loadFromMemory(invalidRiff, 44);
-    T_ASSERT(ctx, result4 == WavError::InvalidFormat);
+    // Process more samples than file contains
+    int samplesProcessed = 0;
+    bool allValid = true;
+    for (int i = 0; i < 5000; ++i)
+    {
+      float s = player.processSample();
+      if (!std::isfinite(s))
+      {
+        allValid = false;
+        break;
+      }
+      samplesProcessed++;
+    }
+
+    // Should still be playing (looping)
+    T_ASSERT(ctx, player.isPlaying());
+    T_ASSERT(ctx, allValid);
+    T_ASSERT(ctx, samplesProcessed == 5000);
   }
 
-  void test_wavplayer_playback_controls(TestContext &ctx)
+  void test_wavplayer_loop_pingpong(TestContext &ctx)
   {
     using ShortwavDSP::WavPlayer;
     using ShortwavDSP::WavError;
-    using ShortwavDSP::PlaybackState;
+    using ShortwavDSP::LoopMode;
 
     WavPlayer player;
-    auto wav = generateTestWav(44100, 1, 44100, 16);
+    auto wav = generateTestWav(1000, 1, 44100, 16, 440.0f);
     player.loadFromMemory(wav.data(), wav.size());
-
-    // Initial state
-    T_ASSERT(ctx, player.getState() == PlaybackState::Stopped);
-
-    // Play
+    player.setSampleRate(44100.0f);
+    player.setLoopMode(LoopMode::PingPong);
     player.play();
-    T_ASSERT(ctx, player.getState() == PlaybackState::Playing);
-    T_ASSERT(ctx, player.isPlaying());
 
-    // Pause
-    player.pause();
-    T_ASSERT(ctx, player.getState() == PlaybackState::Paused);
-    T_ASSERT(ctx, !player.isPlaying());
+    // Process enough samples for multiple direction changes
+    bool allValid = true;
+    for (int i = 0; i < 5000; ++i)
+    {
+      float s = player.processSample();
+      if (!std::isfinite(s) || s < -2.0f || s > 2.0f)
+      {
+        allValid = false;
+        break;
+      }
+    }
 
-    // Resume
-    player.play();
     T_ASSERT(ctx, player.isPlaying());
-
-    // Stop (should reset position)
-    player.stop();
-    T_ASSERT(ctx, player.getState() == PlaybackState::Stopped);
-    T_ASSERT_NEAR(ctx, player.getPlaybackPosition(), 0.0f, kTightEpsilon);
+    T_ASSERT(ctx, allValid);
   }
 
-  void test_wavplayer_seek_functionality(TestContext &ctx)
+  void test_wavplayer_volume_control(TestContext &ctx)
   {
     using ShortwavDSP::WavPlayer;
     using ShortwavDSP::WavError;
 
     WavPlayer player;
-    auto wav = generateTestWav(44100, 1, 44100, 16);
+    auto wav = generateTestWav(4410, 1, 44100, 16, 440.0f);
     player.loadFromMemory(wav.data(), wav.size());
+    player.setSampleRate(44100.0f);
 
-    // Seek to middle
-    player.seek(0.5f);
-    T_ASSERT_NEAR(ctx, player.getPlaybackPosition(), 0.5f, 0.001f);
+    // Test silence
+    player.setVolume(0.0f);
+    player.play();
+    player.seek(0.25f); // Seek past zero crossing
 
-    // Seek to start
-    player.seek(0.0f);
-    T_ASSERT_NEAR(ctx, player.getPlaybackPosition(), 0.0f, kTightEpsilon);
+    float silentSample = player.processSample();
+    T_ASSERT_NEAR(ctx, silentSample, 0.0f, kTightEpsilon);
 
-    // Seek to end
-    player.seek(1.0f);
-    T_ASSERT_NEAR(ctx, player.getPlaybackPosition(), 1.0f, 0.001f);
+    // Test half volume
+    player.setVolume(0.5f);
+    player.seek(0.25f);
+    player.play();
 
-    // Seek by sample
-    player.seekToSample(22050);
-    T_ASSERT_NEAR(ctx, player.getPlaybackPositionSamples(), 22050.0, 1.0);
+    // Get reference at full volume
+    player.setVolume(1.0f);
+    player.seek(0.25f);
+    float fullSample = player.processSample();
 
-    // Seek out of bounds (should clamp)
-    player.seek(2.0f);
-    T_ASSERT(ctx, player.getPlaybackPosition() <= 1.0f);
+    player.setVolume(0.5f);
+    player.seek(0.25f);
+    float halfSample = player.processSample();
 
-    player.seek(-1.0f);
-    T_ASSERT(ctx, player.getPlaybackPosition() >= 0.0f);
+    // Half volume should be approximately half amplitude
+    if (std::fabs(fullSample) > 0.1f)
+    {
+      T_ASSERT_NEAR(ctx, halfSample / fullSample, 0.5f, 0.1f);
+    }
   }
 
-  void test_wavplayer_parameter_setters(TestContext &ctx)
+  void test_wavplayer_sample_rate_conversion(TestContext &ctx)
   {
     using ShortwavDSP::WavPlayer;
+    using ShortwavDSP::WavError;
     using ShortwavDSP::LoopMode;
-    using ShortwavDSP::InterpolationQuality;
 
     WavPlayer player;
+    // Load 44100Hz file
+    auto wav = generateTestWav(44100, 1, 44100, 16, 440.0f);
+    player.loadFromMemory(wav.data(), wav.size());
 
-    // Speed
-    player.setSpeed(2.0f);
-    T_ASSERT_NEAR(ctx, player.getSpeed(), 2.0f, kTightEpsilon);
-
-    player.setSpeed(0.5f);
-    T_ASSERT_NEAR(ctx, player.getSpeed(), 0.5f, kTightEpsilon);
-
-    // Speed clamping
-    player.setSpeed(0.001f);
-    T_ASSERT(ctx, player.getSpeed() >= 0.01f);
-
-    player.setSpeed(1000.0f);
-    T_ASSERT(ctx, player.getSpeed() <= 100.0f);
+    // Play at 96000Hz (should play slower in terms of samples)
+    player.setSampleRate(96000.0f);
+    player.setLoopMode(LoopMode::Off);
+    player.play();
 
-    // Pitch
-    player.setPitch(2.0f);
-    T_ASSERT_NEAR(ctx, player.getPitch(), 2.0f, kTightEpsilon);
+    int samplesProcessed = 0;
+    while (player.isPlaying() && samplesProcessed < 200000)
+    {
+      player.processSample();
+      samplesProcessed++;
+    }
 
-    // Volume
-    player.setVolume(0.5f);
-    T_ASSERT_NEAR(ctx, player.getVolume(), 0.5f, kTightEpsilon);
+    // At 96kHz output rate with 44.1kHz source, should need ~96000 samples
+    // to play 1 second of audio
+    T_ASSERT(ctx, samplesProcessed > 90000);
+    T_ASSERT(ctx, samplesProcessed < 100000);
+  }
 
-    player.setVolume(0.0f);
-    T_ASSERT_NEAR(ctx, player.getVolume(), 0.0f, kTightEpsilon);
+  void test_wavplayer_raw_sample_access(TestContext &ctx)
+  {
+    using ShortwavDSP::WavPlayer;
+    using ShortwavDSP::WavError;
 
-    // Reverse
-    player.setReverse(true);
-    T_ASSERT(ctx, player.getReverse());
+    WavPlayer player;
+    auto wav = generateTestWav(1000, 2, 44100, 16, 440.0f);
+    player.loadFromMemory(wav.data(), wav.size());
 
-    player.setReverse(false);
-    T_ASSERT(ctx, !player.getReverse());
+    // Access raw samples
+    float sample0L = player.getRawSample(0, 0);
+    float sample0R = player.getRawSample(0, 1);
+    float sample500L = player.getRawSample(500, 0);
 
-    // Loop mode
-    player.setLoopMode(LoopMode::Forward);
-    T_ASSERT(ctx, player.getLoopMode() == LoopMode::Forward);
+    T_ASSERT(ctx, std::isfinite(sample0L));
+    T_ASSERT(ctx, std::isfinite(sample0R));
+    T_ASSERT(ctx, std::isfinite(sample500L));
 
-    player.setLoopMode(LoopMode::PingPong);
-    T_ASSERT(ctx, player.getLoopMode() == LoopMode::PingPong);
+    // Out of bounds should return 0
+    float outOfBounds = player.getRawSample(10000, 0);
+    T_ASSERT_NEAR(ctx, outOfBounds, 0.0f, kTightEpsilon);
 
-    // Interpolation
-    player.setInterpolationQuality(InterpolationQuality::None);
-    T_ASSERT(ctx, player.getInterpolationQuality() == InterpolationQuality::None);
+    // Invalid channel should return 0
+    float invalidChannel = player.getRawSample(0, 5);
+    T_ASSERT_NEAR(ctx, invalidChannel, 0.0f, kTightEpsilon);
 
-    player.setInterpolationQuality(InterpolationQuality::Linear);
-    T_ASSERT(ctx, player.getInterpolationQuality() == InterpolationQuality::Linear);
+    // Test audio data pointer
+    T_ASSERT(ctx, player.getAudioData() != nullptr);
+    T_ASSERT(ctx, player.getAudioDataSize() == 1000 * 2);
   }
 
-  void test_wavplayer_process_sample_mono(TestContext &ctx)
+  void test_wavplayer_unload(TestContext &ctx)
   {
     using ShortwavDSP::WavPlayer;
     using ShortwavDSP::WavError;
+    using ShortwavDSP::PlaybackState;
 
     WavPlayer player;
-    auto wav = generateTestWav(4410, 1, 44100, 16, 440.0f);
+    auto wav = generateTestWav(44100, 1, 44100, 16);
     player.loadFromMemory(wav.data(), wav.size());
-    player.setSampleRate(44100.0f);
 
-    // Not playing - should return silence
-    float sample = player.processSample();
-    T_ASSERT_NEAR(ctx, sample, 0.0f, kTightEpsilon);
-
-    // Start playing
-    player.play();
-    player.setVolume(1.0f);
+    T_ASSERT(ctx, player.isLoaded());
+    T_ASSERT(ctx, player.getNumSamples() > 0);
 
-    // Process samples and verify they're in valid range
-    bool allValid = true;
-    for (int i = 0; i < 1000; ++i)
-    {
-      float s = player.processSample();
-      if (!std::isfinite(s) || s < -1.5f || s > 1.5f)
-      {
-        allValid = false;
-        break;
-      }
-    }
-    T_ASSERT(ctx, allValid);
+    player.unload();
 
-    // Position should have advanced
-    T_ASSERT(ctx, player.getPlaybackPositionSamples() > 0.0);
+    T_ASSERT(ctx, !player.isLoaded());
+    T_ASSERT(ctx, player.getNumSamples() == 0);
+    T_ASSERT(ctx, player.getState() == PlaybackState::Stopped);
+    T_ASSERT(ctx, player.getAudioData() != nullptr || player.getAudioDataSize() == 0);
   }
 
-  void test_wavplayer_process_sample_stereo(TestContext &ctx)
+  void test_wavplayer_move_semantics(TestContext &ctx)
   {
     using ShortwavDSP::WavPlayer;
     using ShortwavDSP::WavError;
 
-    WavPlayer player;
-    auto wav = generateTestWav(4410, 2, 44100, 16, 440.0f);
-    player.loadFromMemory(wav.data(), wav.size());
-    player.setSampleRate(44100.0f);
-    player.play();
+    WavPlayer player1;
+    auto wav = generateTestWav(44100, 2, 48000, 16);
+    player1.loadFromMemory(wav.data(), wav.size());
+    player1.setSpeed(1.5f);
+    player1.seek(0.5f);
 
-    // Process stereo samples
-    bool allValid = true;
-    for (int i = 0; i < 1000; ++i)
-    {
-      float left, right;
-      player.processSampleStereo(left, right);
-      if (!std::isfinite(left) || !std::isfinite(right) ||
-          left < -1.5f || left > 1.5f || right < -1.5f || right > 1.5f)
-      {
-        allValid = false;
-        break;
-      }
-    }
-    T_ASSERT(ctx, allValid);
+    // Move construct
+    WavPlayer player2(std::move(player1));
+
+    T_ASSERT(ctx, player2.isLoaded());
+    T_ASSERT(ctx, player2.getNumSamples() == 44100);
+    T_ASSERT(ctx, player2.getNumChannels() == 2);
+    T_ASSERT_NEAR(ctx, player2.getSpeed(), 1.5f, kTightEpsilon);
+    T_ASSERT_NEAR(ctx, player2.getPlaybackPosition(), 0.5f, 0.01f);
+
+    // Move assign
+    WavPlayer player3;
+    player3 = std::move(player2);
+
+    T_ASSERT(ctx, player3.isLoaded());
+    T_ASSERT(ctx, player3.getNumSamples() == 44100);
   }
 
-  void test_wavplayer_buffer_processing(TestContext &ctx)
+  void test_wavplayer_error_string_conversion(TestContext &ctx)
+  {
+    using ShortwavDSP::WavError;
+    using ShortwavDSP::wavErrorToString;
+
+    // Test all error codes have valid strings
+    T_ASSERT(ctx, std::strlen(wavErrorToString(WavError::None)) > 0);
+    T_ASSERT(ctx, std::strlen(wavErrorToString(WavError::FileNotFound)) > 0);
+    T_ASSERT(ctx, std::strlen(wavErrorToString(WavError::InvalidFormat)) > 0);
+    T_ASSERT(ctx, std::strlen(wavErrorToString(WavError::UnsupportedFormat)) > 0);
+    T_ASSERT(ctx, std::strlen(wavErrorToString(WavError::CorruptedData)) > 0);
+    T_ASSERT(ctx, std::strlen(wavErrorToString(WavError::OutOfMemory)) > 0);
+    T_ASSERT(ctx, std::strlen(wavErrorToString(WavError::ReadError)) > 0);
+    T_ASSERT(ctx, std::strlen(wavErrorToString(WavError::InvalidState)) > 0);
+    T_ASSERT(ctx, std::strlen(wavErrorToString(WavError::InvalidParameter)) > 0);
+  }
+
+  void test_wavplayer_denormal_protection(TestContext &ctx)
   {
     using ShortwavDSP::WavPlayer;
     using ShortwavDSP::WavError;
 
     WavPlayer player;
-    auto wav = generateTestWav(44100, 1, 44100, 16, 440.0f);
+    auto wav = generateTestWav(1000, 1, 44100, 16, 440.0f);
     player.loadFromMemory(wav.data(), wav.size());
     player.setSampleRate(44100.0f);
+    player.setVolume(1e-20f); // Extremely small volume
     player.play();
 
-    // Process buffer
-    std::vector<float> buffer(512);
-    player.processBuffer(buffer.data(), buffer.size());
-
-    // Verify all samples are valid
+    // Process samples - should not produce denormals
     bool allValid = true;
-    for (size_t i = 0; i < buffer.size(); ++i)
+    for (int i = 0; i < 500; ++i)
     {
-      if (!std::isfinite(buffer[i]))
+      float s = player.processSample();
+      // Check for denormals (very small numbers that slow down CPU)
+      if (!std::isfinite(s) || (s != 0.0f && std::fabs(s) < 1e-30f))
       {
-        allValid = false;
-        break;
+        // Allow exact zeros but flag very tiny non-zero values
+        if (s != 0.0f && std::fabs(s) < 1e-35f)
+        {
+          allValid = false;
+          break;
+        }
       }
     }
     T_ASSERT(ctx, allValid);
   }
 
-  void test_wavplayer_stereo_buffer_processing(TestContext &ctx)
+  void test_wavplayer_concurrent_parameter_changes(TestContext &ctx)
   {
     using ShortwavDSP::WavPlayer;
     using ShortwavDSP::WavError;
+    using ShortwavDSP::LoopMode;
 
     WavPlayer player;
-    auto wav = generateTestWav(44100, 2, 44100, 16, 440.0f);
+    auto wav = generateTestWav(44100, 1, 44100, 16, 440.0f);
     player.loadFromMemory(wav.data(), wav.size());
     player.setSampleRate(44100.0f);
+    player.setLoopMode(LoopMode::Forward);
     player.play();
 
-    // Test interleaved stereo buffer
-    std::vector<float> interleavedBuffer(1024); // 512 frames * 2 channels
-    player.processBufferStereo(interleavedBuffer.data(), 512);
-
+    // Simulate rapid parameter changes while processing
     bool allValid = true;
-    for (size_t i = 0; i < interleavedBuffer.size(); ++i)
+    for (int i = 0; i < 10000; ++i)
     {
-      if (!std::isfinite(interleavedBuffer[i]))
+      // Change parameters every 100 samples
+      if (i % 100 == 0)
       {
-        allValid = false;
-        break;
+        player.setSpeed(0.5f + (i % 10) * 0.1f);
+        player.setPitch(0.8f + (i % 5) * 0.1f);
+        player.setVolume(0.5f + (i % 3) * 0.2f);
       }
-    }
-    T_ASSERT(ctx, allValid);
-
-    // Test split stereo buffers
-    std::vector<float> left(256), right(256);
-    player.processBufferStereoSplit(left.data(), right.data(), 256);
 
-    for (size_t i = 0; i < 256; ++i)
-    {
-      if (!std::isfinite(left[i]) || !std::isfinite(right[i]))
+      float s = player.processSample();
+      if (!std::isfinite(s))
       {
         allValid = false;
         break;
       }
     }
     T_ASSERT(ctx, allValid);
+    T_ASSERT(ctx, player.isPlaying());
   }
 
-  void test_wavplayer_interpolation_quality(TestContext &ctx)
+  void test_wavplayer_boundary_sample_access(TestContext &ctx)
   {
     using ShortwavDSP::WavPlayer;
     using ShortwavDSP::WavError;
+    using ShortwavDSP::LoopMode;
     using ShortwavDSP::InterpolationQuality;
 
     WavPlayer player;
-    auto wav = generateTestWav(4410, 1, 44100, 16, 440.0f);
+    // Small file to test boundary conditions
+    auto wav = generateTestWav(100, 1, 44100, 16, 440.0f);
     player.loadFromMemory(wav.data(), wav.size());
     player.setSampleRate(44100.0f);
+    player.setLoopMode(LoopMode::Off);
 
-    // Test each interpolation quality
-    const InterpolationQuality qualities[] = {
-        InterpolationQuality::None,
-        InterpolationQuality::Linear,
-        InterpolationQuality::Cubic};
+    // Test with cubic interpolation at boundaries
+    player.setInterpolationQuality(InterpolationQuality::Cubic);
 
-    for (auto quality : qualities)
-    {
-      player.setInterpolationQuality(quality);
-      player.seek(0.0f);
-      player.play();
+    // Seek near end
+    player.seekToSample(98);
+    player.play();
 
-      bool valid = true;
-      for (int i = 0; i < 100; ++i)
+    bool allValid = true;
+    for (int i = 0; i < 10; ++i)
+    {
+      float s = player.processSample();
+      if (!std::isfinite(s))
       {
-        float s = player.processSample();
-        if (!std::isfinite(s))
-        {
-          valid = false;
-          break;
-        }
+        allValid = false;
+        break;
       }
-      T_ASSERT(ctx, valid);
-      player.stop();
     }
+    T_ASSERT(ctx, allValid);
+
+    // Test at start
+    player.seek(0.0f);
+    player.play();
+    float startSample = player.processSample();
+    T_ASSERT(ctx, std::isfinite(startSample));
   }
 
-  void test_wavplayer_speed_variation(TestContext &ctx)
+  void test_wavplayer_performance_benchmark(TestContext &ctx)
   {
     using ShortwavDSP::WavPlayer;
     using ShortwavDSP::WavError;
     using ShortwavDSP::LoopMode;
 
     WavPlayer player;
-    auto wav = generateTestWav(44100, 1, 44100, 16, 440.0f);
+    auto wav = generateTestWav(44100, 2, 44100, 16, 440.0f);
     player.loadFromMemory(wav.data(), wav.size());
-    player.setSampleRate(44100.0f);
-    player.setLoopMode(LoopMode::Off);
-
-    // Test double speed - should finish in half the time
-    player.setSpeed(2.0f);
-    player.setPitch(1.0f);
-    player.seek(0.0f);
+    player.setSampleRate(48000.0f);
+    player.setLoopMode(LoopMode::Forward);
     player.play();
 
-    // Process enough samples
-    int samplesProcessed = 0;
-    while (player.isPlaying() && samplesProcessed < 100000)
+    // Benchmark buffer processing
+    const size_t bufferSize = 512;
+    const int iterations = 1000;
+    std::vector<float> buffer(bufferSize * 2); // Stereo
+
+    for (int iter = 0; iter < iterations; ++iter)
     {
-      player.processSample();
-      samplesProcessed++;
+      player.processBufferStereo(buffer.data(), bufferSize);
     }
 
-    // At 2x speed, should take ~22050 samples to finish 44100 sample file
-    T_ASSERT(ctx, samplesProcessed < 30000);
-    T_ASSERT(ctx, samplesProcessed > 20000);
-
-    // Test half speed
-    player.setSpeed(0.5f);
-    player.seek(0.0f);
-    player.play();
-
-    samplesProcessed = 0;
-    while (player.isPlaying() && samplesProcessed < 200000)
+    // Verify final output is valid
+    bool allValid = true;
+    for (size_t i = 0; i < buffer.size(); ++i)
     {
-      player.processSample();
-      samplesProcessed++;
+      if (!std::isfinite(buffer[i]))
+      {
+        allValid = false;
+        break;
+      }
     }
-
-    // At 0.5x speed, should take ~88200 samples
-    T_ASSERT(ctx, samplesProcessed > 80000);
+    T_ASSERT(ctx, allValid);
+    T_ASSERT(ctx, player.isPlaying());
   }
 
-  void test_wavplayer_pitch_variation(TestContext &ctx)
+  void test_wavplayer_empty_file_handling(TestContext &ctx)
   {
     using ShortwavDSP::WavPlayer;
     using ShortwavDSP::WavError;
 
     WavPlayer player;
-    auto wav = generateTestWav(44100, 1, 44100, 16, 440.0f);
-    player.loadFromMemory(wav.data(), wav.size());
-    player.setSampleRate(44100.0f);
-    player.setSpeed(1.0f);
-
-    // Test octave up (2x pitch)
-    player.setPitch(2.0f);
-    player.seek(0.0f);
-    player.play();
-
-    bool allFinite = true;
-    for (int i = 0; i < 1000; ++i)
-    {
-      float s = player.processSample();
-      if (!std::isfinite(s))
-      {
-        allFinite = false;
-        break;
-      }
-    }
-    T_ASSERT(ctx, allFinite);
 
-    // Test octave down (0.5x pitch)
-    player.setPitch(0.5f);
-    player.seek(0.0f);
+    // Create a WAV with valid header but zero data
+    std::vector<uint8_t> emptyWav(44);
+    std::memcpy(emptyWav.data(), "RIFF", 4);
+    uint32_t fileSize = 36;
+    std::memcpy(emptyWav.data() + 4, &fileSize, 4);
+    std::memcpy(emptyWav.data() + 8, "WAVE", 4);
+    std::memcpy(emptyWav.data() + 12, "fmt ", 4);
+    uint32_t fmtSize = 16;
+    std::memcpy(emptyWav.data() + 16, &fmtSize, 4);
+    uint16_t audioFormat = 1;
+    std::memcpy(emptyWav.data() + 20, &audioFormat, 2);
+    uint16_t channels = 1;
+    std::memcpy(emptyWav.data() + 22, &channels, 2);
+    uint32_t sampleRate = 44100;
+    std::memcpy(emptyWav.data() + 24, &sampleRate, 4);
+    uint32_t byteRate = 88200;
+    std::memcpy(emptyWav.data() + 28, &byteRate, 4);
+    uint16_t blockAlign = 2;
+    std::memcpy(emptyWav.data() + 32, &blockAlign, 2);
+    uint16_t bitsPerSample = 16;
+    std::memcpy(emptyWav.data() + 34, &bitsPerSample, 2);
+    std::memcpy(emptyWav.data() + 36, "data", 4);
+    uint32_t dataSize = 0;
+    std::memcpy(emptyWav.data() + 40, &dataSize, 4);
 
-    for (int i = 0; i < 1000; ++i)
-    {
-      float s = player.processSample();
-      if (!std::isfinite(s))
-      {
-        allFinite = false;
-        break;
-      }
-    }
-    T_ASSERT(ctx, allFinite);
+    auto result = player.loadFromMemory(emptyWav.data(), emptyWav.size());
+    T_ASSERT(ctx, result == WavError::CorruptedData);
+    T_ASSERT(ctx, !player.isLoaded());
   }
 
-  void test_wavplayer_reverse_playback(TestContext &ctx)
+  void test_wavplayer_not_loaded_operations(TestContext &ctx)
   {
     using ShortwavDSP::WavPlayer;
-    using ShortwavDSP::WavError;
-    using ShortwavDSP::LoopMode;
+    using ShortwavDSP::PlaybackState;
 
     WavPlayer player;
-    auto wav = generateTestWav(4410, 1, 44100, 16, 440.0f);
-    player.loadFromMemory(wav.data(), wav.size());
-    player.setSampleRate(44100.0f);
-    player.setLoopMode(LoopMode::Off);
 
-    // Enable reverse playback
-    player.setReverse(true);
-    player.stop(); // Reset to end position for reverse
+    // Operations on unloaded player should be safe
     player.play();
+    T_ASSERT(ctx, player.getState() == PlaybackState::Stopped);
+
+    float sample = player.processSample();
+    T_ASSERT_NEAR(ctx, sample, 0.0f, kTightEpsilon);
 
-    // Process samples - position should decrease
-    double startPos = player.getPlaybackPositionSamples();
-    for (int i = 0; i < 100; ++i)
-    {
-      player.processSample();
-    }
-    double endPos = player.getPlaybackPositionSamples();
+    float left, right;
+    player.processSampleStereo(left, right);
+    T_ASSERT_NEAR(ctx, left, 0.0f, kTightEpsilon);
+    T_ASSERT_NEAR(ctx, right, 0.0f, kTightEpsilon);
 
-    T_ASSERT(ctx, endPos < startPos);
+    std::vector<float> buffer(100, 1.0f);
+    player.processBuffer(buffer.data(), buffer.size());
+    T_ASSERT_NEAR(ctx, buffer[0], 0.0f, kTightEpsilon);
 
-    // All samples should be valid
-    player.stop();
-    player.play();
-    bool allValid = true;
-    int count = 0;
-    while (player.isPlaying() && count < 10000)
-    {
-      float s = player.processSample();
-      if (!std::isfinite(s))
-      {
-        allValid = false;
-        break;
-      }
-      count++;
-    }
-    T_ASSERT(ctx, allValid);
+    player.seek(0.5f);
+    T_ASSERT_NEAR(ctx, player.getPlaybackPosition(), 0.0f, kTightEpsilon);
   }
 
-  void test_wavplayer_loop_forward(TestContext &ctx)
+  void test_wavplayer_mono_to_stereo_duplication(TestContext &ctx)
   {
     using ShortwavDSP::WavPlayer;
     using ShortwavDSP::WavError;
-    using ShortwavDSP::LoopMode;
 
     WavPlayer player;
     auto wav = generateTestWav(1000, 1, 44100, 16, 440.0f);
     player.loadFromMemory(wav.data(), wav.size());
     player.setSampleRate(44100.0f);
-    player.setLoopMode(LoopMode::Forward);
     player.play();
 
-    // Process more samples than file contains
-    int samplesProcessed = 0;
-    bool allValid = true;
-    for (int i = 0; i < 5000; ++i)
+    // When reading mono as stereo, both channels should be identical
+    for (int i = 0; i < 100; ++i)
     {
-      float s = player.processSample();
-      if (!std::isfinite(s))
-      {
-        allValid = false;
-        break;
-      }
-      samplesProcessed++;
+      float left, right;
+      player.processSampleStereo(left, right);
+      T_ASSERT_NEAR(ctx, left, right, kTightEpsilon);
     }
-
-    // Should still be playing (looping)
-    T_ASSERT(ctx, player.isPlaying());
-    T_ASSERT(ctx, allValid);
-    T_ASSERT(ctx, samplesProcessed == 5000);
   }
 
-  void test_wavplayer_loop_pingpong(TestContext &ctx)
+  void test_wavplayer_stereo_to_mono_mixdown(TestContext &ctx)
   {
     using ShortwavDSP::WavPlayer;
     using ShortwavDSP::WavError;
-    using ShortwavDSP::LoopMode;
 
     WavPlayer player;
-    auto wav = generateTestWav(1000, 1, 44100, 16, 440.0f);
+    auto wav = generateTestWav(1000, 2, 44100, 16, 440.0f);
     player.loadFromMemory(wav.data(), wav.size());
     player.setSampleRate(44100.0f);
-    player.setLoopMode(LoopMode::PingPong);
     player.play();
 
-    // Process enough samples for multiple direction changes
+    // Mono output from stereo file should be finite
     bool allValid = true;
-    for (int i = 0; i < 5000; ++i)
+    for (int i = 0; i < 100; ++i)
     {
-      float s = player.processSample();
-      if (!std::isfinite(s) || s < -2.0f || s > 2.0f)
+      float mono = player.processSample();
+      if (!std::isfinite(mono))
       {
         allValid = false;
         break;
       }
     }
-
-    T_ASSERT(ctx, player.isPlaying());
     T_ASSERT(ctx, allValid);
   }
 
-  void test_wavplayer_volume_control(TestContext &ctx)
+  // Scratch file in the system temp directory for the file-based loader
+  // tests, removed when it goes out of scope (whichever way the test ends)
+  struct TempWavFile
   {
-    using ShortwavDSP::WavPlayer;
-    using ShortwavDSP::WavError;
+    std::string path;
+    explicit TempWavFile(const char *name)
+        : path((std::filesystem::temp_directory_path() / name).string()) {}
+    ~TempWavFile() { std::remove(path.c_str()); }
+    TempWavFile(const TempWavFile &) = delete;
+    TempWavFile &operator=(const TempWavFile &) = delete;
+    const char *c_str() const { return path.c_str(); }
+  };
 
-    WavPlayer player;
-    auto wav = generateTestWav(4410, 1, 44100, 16, 440.0f);
-    player.loadFromMemory(wav.data(), wav.size());
-    player.setSampleRate(44100.0f);
+  // Write a generated WAV image to disk (for file-based loaders)
+  bool writeTestWavFile(const char *path, const std::vector<uint8_t> &wav)
+  {
+    FILE *file = std::fopen(path, "wb");
+    if (file == nullptr)
+      return false;
+    const bool ok = std::fwrite(wav.data(), 1, wav.size(), file) == wav.size();
+    std::fclose(file);
+    return ok;
+  }
 
-    // Test silence
-    player.setVolume(0.0f);
-    player.play();
-    player.seek(0.25f); // Seek past zero crossing
+  void test_wavplayer_memory_mapped_matches_resident(TestContext &ctx)
+  {
+    using ShortwavDSP::WavPlayer;
+    using ShortwavDSP::WavError;
+    using ShortwavDSP::WavStorageMode;
 
-    float silentSample = player.processSample();
-    T_ASSERT_NEAR(ctx, silentSample, 0.0f, kTightEpsilon);
+    const TempWavFile file("shortwav_test_mmap.wav");
+    const char *path = file.c_str();
 
-    // Test half volume
-    player.setVolume(0.5f);
-    player.seek(0.25f);
-    player.play();
+    struct Case
+    {
+      std::vector<uint8_t> wav;
+      uint16_t channels;
+    };
+    const Case cases[] = {
+        {generateTestWav(3000, 1, 44100, 8, 440.0f), 1},
+        {generateTestWav(3000, 1, 44100, 16, 440.0f), 1},
+        {generateTestWav(3000, 2, 48000, 24, 880.0f), 2},
+        {generateTestWav(3000, 2, 44100, 32, 220.0f), 2},
+        {generateTestWavFloat(3000, 2, 44100, 330.0f), 2},
+    };
 
-    // Get reference at full volume
-    player.setVolume(1.0f);
-    player.seek(0.25f);
-    float fullSample = player.processSample();
+    for (const Case &c : cases)
+    {
+      if (!writeTestWavFile(path, c.wav))
+      {
+        T_ASSERT(ctx, false);
+        continue;
+      }
 
-    player.setVolume(0.5f);
-    player.seek(0.25f);
-    float halfSample = player.processSample();
+      WavPlayer resident;
+      WavPlayer mapped;
+      T_ASSERT(ctx, resident.loadFile(path) == WavError::None);
+      T_ASSERT(ctx, mapped.loadFile(path, WavStorageMode::MemoryMapped) == WavError::None);
 
-    // Half volume should be approximately half amplitude
-    if (std::fabs(fullSample) > 0.1f)
-    {
-      T_ASSERT_NEAR(ctx, halfSample / fullSample, 0.5f, 0.1f);
+      T_ASSERT(ctx, resident.getStorageMode() == WavStorageMode::Resident);
+      if (ShortwavDSP::detail::MappedFile::isSupported())
+      {
+        T_ASSERT(ctx, mapped.getStorageMode() == WavStorageMode::MemoryMapped);
+        T_ASSERT(ctx, mapped.getAudioDataSize() == 0);
+      }
+      T_ASSERT(ctx, mapped.isLoaded());
+      T_ASSERT(ctx, mapped.getNumSamples() == resident.getNumSamples());
+      T_ASSERT(ctx, mapped.getNumChannels() == c.channels);
+      T_ASSERT(ctx, mapped.getFileSampleRate() == resident.getFileSampleRate());
+      T_ASSERT(ctx, mapped.getBitsPerSample() == resident.getBitsPerSample());
+
+      // Lazily converted samples must be bit-identical to the decoded buffer
+      bool rawMatches = true;
+      for (size_t i = 0; i < resident.getNumSamples(); ++i)
+        for (uint16_t ch = 0; ch < c.channels; ++ch)
+          rawMatches = rawMatches && (mapped.getRawSample(i, ch) == resident.getRawSample(i, ch));
+      T_ASSERT(ctx, rawMatches);
+
+      // Interpolated playback (fractional rate, cubic) must match too
+      for (WavPlayer *p : {&resident, &mapped})
+      {
+        p->setSampleRate(44100.0f);
+        p->setPitch(1.37f);
+        p->setLoopMode(ShortwavDSP::LoopMode::Forward);
+        p->play();
+      }
+      bool playbackMatches = true;
+      for (int i = 0; i < 4000; ++i)
+      {
+        float rl, rr, ml, mr;
+        resident.processSampleStereo(rl, rr);
+        mapped.processSampleStereo(ml, mr);
+        playbackMatches = playbackMatches && (rl == ml) && (rr == mr);
+      }
+      T_ASSERT(ctx, playbackMatches);
     }
   }
 
-  void test_wavplayer_sample_rate_conversion(TestContext &ctx)
+  void test_wavplayer_block_render_matches_checked_path(TestContext &ctx)
   {
     using ShortwavDSP::WavPlayer;
     using ShortwavDSP::WavError;
+    using ShortwavDSP::WavStorageMode;
     using ShortwavDSP::LoopMode;
+    using ShortwavDSP::InterpolationQuality;
 
-    WavPlayer player;
-    // Load 44100Hz file
-    auto wav = generateTestWav(44100, 1, 44100, 16, 440.0f);
-    player.loadFromMemory(wav.data(), wav.size());
-
-    // Play at 96000Hz (should play slower in terms of samples)
-    player.setSampleRate(96000.0f);
-    player.setLoopMode(LoopMode::Off);
-    player.play();
+    // A memory-mapped buffer renders every frame through the checked path,
+    // so it is the reference for the resident block renderer's fast spans
+    const TempWavFile file("shortwav_test_block.wav");
+    const char *path = file.c_str();
+    const LoopMode loops[] = {LoopMode::Off, LoopMode::Forward, LoopMode::PingPong};
+    const InterpolationQuality qualities[] = {InterpolationQuality::None, InterpolationQuality::Linear,
+                                              InterpolationQuality::Cubic, InterpolationQuality::Sinc};
 
-    int samplesProcessed = 0;
-    while (player.isPlaying() && samplesProcessed < 200000)
+    int mismatches = 0;
+    for (uint16_t channels : {1, 2})
     {
-      player.processSample();
-      samplesProcessed++;
-    }
+      if (!writeTestWavFile(path, generateTestWavFloat(501, channels, 44100, 330.0f)))
+      {
+        T_ASSERT(ctx, false);
+        continue;
+      }
 
-    // At 96kHz output rate with 44.1kHz source, should need ~96000 samples
-    // to play 1 second of audio
-    T_ASSERT(ctx, samplesProcessed > 90000);
-    T_ASSERT(ctx, samplesProcessed < 100000);
+      for (LoopMode loop : loops)
+        for (InterpolationQuality quality : qualities)
+          for (bool reverse : {false, true})
+          {
+            WavPlayer block;
+            WavPlayer reference;
+            T_ASSERT(ctx, block.loadFile(path) == WavError::None);
+            T_ASSERT(ctx, reference.loadFile(path, WavStorageMode::MemoryMapped) == WavError::None);
+            for (WavPlayer *p : {&block, &reference})
+            {
+              p->setSampleRate(44100.0f);
+              p->setSpeed(3.37f); // Several loop/end crossings per run
+              p->setVolume(0.8f);
+              p->setLoopMode(loop);
+              p->setInterpolationQuality(quality);
+              p->setReverse(reverse);
+              p->play();
+            }
+
+            // Odd block sizes, split and interleaved stereo, and the mono mix
+            const size_t blockSize = 77;
+            std::vector<float> left(blockSize), right(blockSize), frames(2 * blockSize);
+            for (int b = 0; b < 12; ++b)
+            {
+              if (b % 3 == 0)
+              {
+                block.processBufferStereoSplit(left.data(), right.data(), blockSize);
+                for (size_t i = 0; i < blockSize; ++i)
+                {
+                  float l, r;
+                  reference.processSampleStereo(l, r);
+                  mismatches += (l != left[i]) || (r != right[i]);
+                }
+              }
+              else if (b % 3 == 1)
+              {
+                block.processBufferStereo(frames.data(), blockSize);
+                for (size_t i = 0; i < blockSize; ++i)
+                {
+                  float l, r;
+                  reference.processSampleStereo(l, r);
+                  mismatches += (l != frames[2 * i]) || (r != frames[2 * i + 1]);
+                }
+              }
+              else
+              {
+                block.processBuffer(left.data(), blockSize);
+                for (size_t i = 0; i < blockSize; ++i)
+                  mismatches += reference.processSample() != left[i];
+              }
+            }
+            mismatches += block.getPlaybackPositionSamples() != reference.getPlaybackPositionSamples();
+            mismatches += block.getState() != reference.getState();
+          }
+    }
+    T_ASSERT(ctx, mismatches == 0);
   }
 
-  void test_wavplayer_raw_sample_access(TestContext &ctx)
+  void test_wavplayer_voice_pool(TestContext &ctx)
   {
     using ShortwavDSP::WavPlayer;
     using ShortwavDSP::WavError;
+    using ShortwavDSP::LoopMode;
 
+    const auto wav = generateTestWavFloat(4000, 2, 44100, 330.0f);
     WavPlayer player;
-    auto wav = generateTestWav(1000, 2, 44100, 16, 440.0f);
-    player.loadFromMemory(wav.data(), wav.size());
-
-    // Access raw samples
-    float sample0L = player.getRawSample(0, 0);
-    float sample0R = player.getRawSample(0, 1);
-    float sample500L = player.getRawSample(500, 0);
-
-    T_ASSERT(ctx, std::isfinite(sample0L));
-    T_ASSERT(ctx, std::isfinite(sample0R));
-    T_ASSERT(ctx, std::isfinite(sample500L));
-
-    // Out of bounds should return 0
-    float outOfBounds = player.getRawSample(10000, 0);
-    T_ASSERT_NEAR(ctx, outOfBounds, 0.0f, kTightEpsilon);
-
-    // Invalid channel should return 0
-    float invalidChannel = player.getRawSample(0, 5);
-    T_ASSERT_NEAR(ctx, invalidChannel, 0.0f, kTightEpsilon);
+    WavPlayer reference;
+    T_ASSERT(ctx, player.loadFromMemory(wav.data(), wav.size()) == WavError::None);
+    T_ASSERT(ctx, reference.loadFromMemory(wav.data(), wav.size()) == WavError::None);
+    for (WavPlayer *p : {&player, &reference})
+    {
+      p->setSampleRate(44100.0f);
+      p->setPitch(1.37f);
+      p->setLoopMode(LoopMode::Off);
+    }
 
-    // Test audio data pointer
-    T_ASSERT(ctx, player.getAudioData() != nullptr);
-    T_ASSERT(ctx, player.getAudioDataSize() == 1000 * 2);
+    // A voice over the whole file renders exactly like the main playhead
+    player.setVoiceCount(4);
+    T_ASSERT(ctx, player.getVoiceCount() == 4);
+    T_ASSERT(ctx, player.triggerVoice(0, 4000, 7) == 0);
+    reference.play();
+    float left[WavPlayer::kMaxVoices], right[WavPlayer::kMaxVoices];
+    bool matches = true;
+    for (int i = 0; i < 500; ++i)
+    {
+      float l, r;
+      reference.processSampleStereo(l, r);
+      player.processVoicesStereo(left, right);
+      matches = matches && left[0] == l && right[0] == r && left[1] == 0.0f;
+    }
+    T_ASSERT(ctx, matches);
+    T_ASSERT(ctx, !player.isPlaying()); // The main playhead is unaffected
+
+    // Retriggering takes a free voice; the first keeps playing
+    T_ASSERT(ctx, player.triggerVoice(1000, 1100, 8) == 1);
+    player.processVoicesStereo(left, right);
+    T_ASSERT(ctx, player.getActiveVoiceCount() == 2);
+    T_ASSERT(ctx, left[0] != 0.0f && left[1] != 0.0f);
+
+    // A one-shot voice stops at the end of its region (100 frames / 1.37)
+    for (int i = 0; i < 80; ++i)
+      player.processVoicesStereo(left, right);
+    T_ASSERT(ctx, !player.isVoiceActive(1));
+    T_ASSERT(ctx, player.isVoiceActive(0));
+
+    // With every voice busy, the oldest is stolen
+    T_ASSERT(ctx, player.triggerVoice(100, 3000, 1) == 1);
+    T_ASSERT(ctx, player.triggerVoice(200, 3000, 2) == 2);
+    T_ASSERT(ctx, player.triggerVoice(300, 3000, 2) == 3);
+    T_ASSERT(ctx, player.triggerVoice(400, 3000, 3) == 0);
+    T_ASSERT(ctx, player.getActiveVoiceCount() == 4);
+
+    // Release by tag, then stop the rest
+    player.releaseVoices(2);
+    T_ASSERT(ctx, player.getActiveVoiceCount() == 2);
+    T_ASSERT(ctx, !player.isVoiceActive(2) && !player.isVoiceActive(3));
+    player.stopVoices();
+    T_ASSERT(ctx, player.getActiveVoiceCount() == 0);
+
+    // Reloading silences voices started on the old buffer
+    T_ASSERT(ctx, player.triggerVoice(0, 4000) >= 0);
+    T_ASSERT(ctx, player.loadFromMemory(wav.data(), wav.size()) == WavError::None);
+    player.processVoicesStereo(left, right);
+    T_ASSERT(ctx, player.getActiveVoiceCount() == 0);
+    T_ASSERT(ctx, left[0] == 0.0f && right[0] == 0.0f);
   }
 
-  void test_wavplayer_unload(TestContext &ctx)
+  void test_wavplayer_memory_mapped_lifecycle(TestContext &ctx)
   {
     using ShortwavDSP::WavPlayer;
     using ShortwavDSP::WavError;
-    using ShortwavDSP::PlaybackState;
+    using ShortwavDSP::WavStorageMode;
+
+    const TempWavFile file("shortwav_test_mmap_lifecycle.wav");
+    const char *path = file.c_str();
 
     WavPlayer player;
-    auto wav = generateTestWav(44100, 1, 44100, 16);
-    player.loadFromMemory(wav.data(), wav.size());
+    T_ASSERT(ctx, player.loadFile("does_not_exist.wav", WavStorageMode::MemoryMapped) == WavError::FileNotFound);
+    T_ASSERT(ctx, !player.isLoaded());
 
-    T_ASSERT(ctx, player.isLoaded());
-    T_ASSERT(ctx, player.getNumSamples() > 0);
+    // Data chunk claims more bytes than the file holds
+    auto truncated = generateTestWav(1000, 1, 44100, 16, 440.0f);
+    truncated.resize(44 + 100);
+    T_ASSERT(ctx, writeTestWavFile(path, truncated));
+    T_ASSERT(ctx, player.loadFile(path, WavStorageMode::MemoryMapped) == WavError::CorruptedData);
+    T_ASSERT(ctx, !player.isLoaded());
 
-    player.unload();
+    auto wav = generateTestWav(1000, 2, 44100, 16, 440.0f);
+    T_ASSERT(ctx, writeTestWavFile(path, wav));
+    T_ASSERT(ctx, player.loadFile(path, WavStorageMode::MemoryMapped) == WavError::None);
+    const float expected = player.getRawSample(100, 1);
 
+    // Moving keeps the mapping alive in the destination
+    WavPlayer moved(std::move(player));
+    T_ASSERT(ctx, moved.isLoaded());
     T_ASSERT(ctx, !player.isLoaded());
-    T_ASSERT(ctx, player.getNumSamples() == 0);
-    T_ASSERT(ctx, player.getState() == PlaybackState::Stopped);
-    T_ASSERT(ctx, player.getAudioData() != nullptr || player.getAudioDataSize() == 0);
+    T_ASSERT(ctx, moved.getRawSample(100, 1) == expected);
+
+    // Switching back to resident storage releases the mapping
+    T_ASSERT(ctx, moved.loadFile(path) == WavError::None);
+    T_ASSERT(ctx, moved.getStorageMode() == WavStorageMode::Resident);
+    T_ASSERT(ctx, moved.getRawSample(100, 1) == expected);
+
+    T_ASSERT(ctx, moved.loadFile(path, WavStorageMode::MemoryMapped) == WavError::None);
+    moved.unload();
+    T_ASSERT(ctx, !moved.isLoaded());
+    T_ASSERT(ctx, moved.getStorageMode() == WavStorageMode::Resident);
+    T_ASSERT_NEAR(ctx, moved.getRawSample(0, 0), 0.0f, kTightEpsilon);
   }
 
-  void test_wavplayer_move_semantics(TestContext &ctx)
+  void test_wavplayer_streaming_matches_resident(TestContext &ctx)
   {
     using ShortwavDSP::WavPlayer;
     using ShortwavDSP::WavError;
+    using ShortwavDSP::WavStorageMode;
+    using ShortwavDSP::LoopMode;
 
-    WavPlayer player1;
-    auto wav = generateTestWav(44100, 2, 48000, 16);
-    player1.loadFromMemory(wav.data(), wav.size());
-    player1.setSpeed(1.5f);
-    player1.seek(0.5f);
-
-    // Move construct
-    WavPlayer player2(std::move(player1));
-
-    T_ASSERT(ctx, player2.isLoaded());
-    T_ASSERT(ctx, player2.getNumSamples() == 44100);
-    T_ASSERT(ctx, player2.getNumChannels() == 2);
-    T_ASSERT_NEAR(ctx, player2.getSpeed(), 1.5f, kTightEpsilon);
-    T_ASSERT_NEAR(ctx, player2.getPlaybackPosition(), 0.5f, 0.01f);
-
-    // Move assign
-    WavPlayer player3;
-    player3 = std::move(player2);
-
-    T_ASSERT(ctx, player3.isLoaded());
-    T_ASSERT(ctx, player3.getNumSamples() == 44100);
-  }
-
-  void test_wavplayer_error_string_conversion(TestContext &ctx)
-  {
-    using ShortwavDSP::WavError;
-    using ShortwavDSP::wavErrorToString;
-
-    // Test all error codes have valid strings
-    T_ASSERT(ctx, std::strlen(wavErrorToString(WavError::None)) > 0);
-    T_ASSERT(ctx, std::strlen(wavErrorToString(WavError::FileNotFound)) > 0);
-    T_ASSERT(ctx, std::strlen(wavErrorToString(WavError::InvalidFormat)) > 0);
-    T_ASSERT(ctx, std::strlen(wavErrorToString(WavError::UnsupportedFormat)) > 0);
-    T_ASSERT(ctx, std::strlen(wavErrorToString(WavError::CorruptedData)) > 0);
-    T_ASSERT(ctx, std::strlen(wavErrorToString(WavError::OutOfMemory)) > 0);
-    T_ASSERT(ctx, std::strlen(wavErrorToString(WavError::ReadError)) > 0);
-    T_ASSERT(ctx, std::strlen(wavErrorToString(WavError::InvalidState)) > 0);
-    T_ASSERT(ctx, std::strlen(wavErrorToString(WavError::InvalidParameter)) > 0);
-  }
-
-  void test_wavplayer_denormal_protection(TestContext &ctx)
-  {
-    using ShortwavDSP::WavPlayer;
-    using ShortwavDSP::WavError;
+    const TempWavFile file("shortwav_test_stream.wav");
+    const char *path = file.c_str();
+    T_ASSERT(ctx, writeTestWavFile(path, generateTestWav(20000, 2, 44100, 16, 440.0f)));
 
-    WavPlayer player;
-    auto wav = generateTestWav(1000, 1, 44100, 16, 440.0f);
-    player.loadFromMemory(wav.data(), wav.size());
-    player.setSampleRate(44100.0f);
-    player.setVolume(1e-20f); // Extremely small volume
-    player.play();
+    struct Scenario
+    {
+      LoopMode loop;
+      bool reverse;
+      float pitch;
+    };
+    const Scenario scenarios[] = {
+        {LoopMode::Forward, false, 1.0f},  // Wraps via the head preload
+        {LoopMode::Forward, true, 1.37f},  // Reverse read-ahead
+        {LoopMode::PingPong, false, 2.5f}, // Direction changes at both ends
+    };
 
-    // Process samples - should not produce denormals
-    bool allValid = true;
-    for (int i = 0; i < 500; ++i)
+    for (const Scenario &sc : scenarios)
     {
-      float s = player.processSample();
-      // Check for denormals (very small numbers that slow down CPU)
-      if (!std::isfinite(s) || (s != 0.0f && std::fabs(s) < 1e-30f))
+      WavPlayer resident;
+      WavPlayer streamed;
+      streamed.setStreamBufferFrames(1024);
+      streamed.setStreamPreloadFrames(256);
+      T_ASSERT(ctx, resident.loadFile(path) == WavError::None);
+      T_ASSERT(ctx, streamed.loadFile(path, WavStorageMode::Streaming) == WavError::None);
+      T_ASSERT(ctx, streamed.isStreaming());
+      T_ASSERT(ctx, streamed.getStorageMode() == WavStorageMode::Streaming);
+      T_ASSERT(ctx, streamed.getNumSamples() == resident.getNumSamples());
+      T_ASSERT(ctx, streamed.getAudioDataSize() == 0);
+
+      for (WavPlayer *p : {&resident, &streamed})
       {
-        // Allow exact zeros but flag very tiny non-zero values
-        if (s != 0.0f && std::fabs(s) < 1e-35f)
+        p->setSampleRate(44100.0f);
+        p->setLoopMode(sc.loop);
+        p->setReverse(sc.reverse);
+        p->setPitch(sc.pitch);
+        p->play();
+      }
+
+      // Service between 64-sample blocks, as a background reader would
+      bool matches = true;
+      for (int block = 0; block < 1000; ++block)
+      {
+        streamed.serviceStream();
+        for (int i = 0; i < 64; ++i)
         {
-          allValid = false;
-          break;
+          float rl, rr, sl, sr;
+          resident.processSampleStereo(rl, rr);
+          streamed.processSampleStereo(sl, sr);
+          matches = matches && (rl == sl) && (rr == sr);
         }
       }
+      T_ASSERT(ctx, matches);
+      T_ASSERT(ctx, streamed.getStreamUnderruns() == 0);
+    }
+  }
+
+  void test_wavplayer_streaming_underrun_and_seek(TestContext &ctx)
+  {
+    using ShortwavDSP::WavPlayer;
+    using ShortwavDSP::WavError;
+    using ShortwavDSP::WavStorageMode;
+
+    const TempWavFile file("shortwav_test_stream_seek.wav");
+    const char *path = file.c_str();
+    T_ASSERT(ctx, writeTestWavFile(path, generateTestWav(20000, 1, 44100, 24, 440.0f)));
+
+    WavPlayer streamed;
+    T_ASSERT(ctx, streamed.loadFile("does_not_exist.wav", WavStorageMode::Streaming) == WavError::FileNotFound);
+    T_ASSERT(ctx, !streamed.isLoaded());
+    T_ASSERT(ctx, streamed.serviceStream() == 0);
+
+    WavPlayer resident;
+    streamed.setStreamBufferFrames(1024);
+    streamed.setStreamPreloadFrames(256);
+    T_ASSERT(ctx, resident.loadFile(path) == WavError::None);
+    T_ASSERT(ctx, streamed.loadFile(path, WavStorageMode::Streaming) == WavError::None);
+
+    for (WavPlayer *p : {&resident, &streamed})
+    {
+      p->setSampleRate(44100.0f);
+      p->setInterpolationQuality(ShortwavDSP::InterpolationQuality::Linear);
+      p->seekToSample(10000);
+      p->play();
     }
-    T_ASSERT(ctx, allValid);
+
+    // Seek target is neither buffered nor preloaded: silence, counted
+    float first = streamed.processSample();
+    resident.processSample();
+    T_ASSERT_NEAR(ctx, first, 0.0f, kTightEpsilon);
+    T_ASSERT(ctx, streamed.getStreamUnderruns() == 1);
+    T_ASSERT(ctx, streamed.isPlaying()); // Underrun never stops or blocks playback
+
+    // Once the reader catches up, output is identical again
+    T_ASSERT(ctx, streamed.serviceStream() > 0);
+    bool matches = true;
+    for (int i = 0; i < 500; ++i)
+      matches = matches && (streamed.processSample() == resident.processSample());
+    T_ASSERT(ctx, matches);
+    T_ASSERT(ctx, streamed.getStreamUnderruns() == 1);
+
+    // Buffered frames are visible through getRawSample, others read as 0
+    T_ASSERT(ctx, streamed.getRawSample(10100, 0) == resident.getRawSample(10100, 0));
+    T_ASSERT(ctx, streamed.getRawSample(100, 0) == resident.getRawSample(100, 0)); // Head preload
+    T_ASSERT_NEAR(ctx, streamed.getRawSample(15000, 0), 0.0f, kTightEpsilon);
+
+    streamed.resetStreamUnderruns();
+    T_ASSERT(ctx, streamed.getStreamUnderruns() == 0);
+
+    streamed.unload();
+    T_ASSERT(ctx, !streamed.isStreaming());
+    T_ASSERT(ctx, !streamed.isLoaded());
   }
 
-  void test_wavplayer_concurrent_parameter_changes(TestContext &ctx)
+  void test_wavplayer_buffer_swap_reclaim(TestContext &ctx)
   {
     using ShortwavDSP::WavPlayer;
     using ShortwavDSP::WavError;
-    using ShortwavDSP::LoopMode;
+
+    std::vector<uint8_t> wavA = generateTestWav(1000, 1, 44100, 16, 440.0f);
+    std::vector<uint8_t> wavB = generateTestWav(2000, 2, 48000, 16, 220.0f);
 
     WavPlayer player;
-    auto wav = generateTestWav(44100, 1, 44100, 16, 440.0f);
-    player.loadFromMemory(wav.data(), wav.size());
     player.setSampleRate(44100.0f);
-    player.setLoopMode(LoopMode::Forward);
+    T_ASSERT(ctx, player.loadFromMemory(wavA.data(), wavA.size()) == WavError::None);
     player.play();
+    player.processSample(); // Audio thread now holds buffer A
 
-    // Simulate rapid parameter changes while processing
-    bool allValid = true;
-    for (int i = 0; i < 10000; ++i)
-    {
-      // Change parameters every 100 samples
-      if (i % 100 == 0)
-      {
-        player.setSpeed(0.5f + (i % 10) * 0.1f);
-        player.setPitch(0.8f + (i % 5) * 0.1f);
-        player.setVolume(0.5f + (i % 3) * 0.2f);
-      }
+    std::weak_ptr<const ShortwavDSP::detail::SampleBuffer> oldBuffer = player.getSampleBuffer();
+    T_ASSERT(ctx, !oldBuffer.expired());
 
-      float s = player.processSample();
-      if (!std::isfinite(s))
-      {
-        allValid = false;
-        break;
-      }
-    }
-    T_ASSERT(ctx, allValid);
-    T_ASSERT(ctx, player.isPlaying());
+    // Reload without stopping: A stays alive while the audio thread may read it
+    T_ASSERT(ctx, player.loadFromMemory(wavB.data(), wavB.size()) == WavError::None);
+    T_ASSERT(ctx, player.getNumSamples() == 2000);
+    T_ASSERT(ctx, player.getNumChannels() == 2);
+    T_ASSERT(ctx, player.collectRetired() == 1);
+    T_ASSERT(ctx, !oldBuffer.expired());
+
+    // Next block picks up B, after which A is released off the audio thread
+    player.processSample();
+    T_ASSERT(ctx, player.collectRetired() == 0);
+    T_ASSERT(ctx, oldBuffer.expired());
+
+    player.unload();
+    T_ASSERT(ctx, !player.isLoaded());
+    T_ASSERT_NEAR(ctx, player.processSample(), 0.0f, kTightEpsilon);
   }
 
-  void test_wavplayer_boundary_sample_access(TestContext &ctx)
+  void test_snapshot_publisher_reclaim(TestContext &ctx)
+  {
+    using Table = std::vector<int>;
+    ShortwavDSP::SnapshotPublisher<Table> publisher;
+    T_ASSERT(ctx, publisher.acquire() == nullptr);
+    T_ASSERT(ctx, !publisher.get());
+
+    publisher.publish(std::make_shared<Table>(Table{1, 2, 3}));
+    const Table *a = publisher.acquire(); // Audio thread now holds A
+    T_ASSERT(ctx, a != nullptr && a->size() == 3);
+    std::weak_ptr<const Table> oldTable = publisher.get();
+
+    // Replacing A keeps it alive while the audio thread may read it
+    publisher.publish(std::make_shared<Table>(Table{4}));
+    T_ASSERT(ctx, publisher.get()->size() == 1);
+    T_ASSERT(ctx, publisher.collect() == 1);
+    T_ASSERT(ctx, !oldTable.expired());
+    T_ASSERT(ctx, (*a)[2] == 3);
+
+    // The next acquire moves to B, after which A is released
+    const Table *b = publisher.acquire();
+    T_ASSERT(ctx, b != nullptr && (*b)[0] == 4);
+    T_ASSERT(ctx, publisher.collect() == 0);
+    T_ASSERT(ctx, oldTable.expired());
+
+    // Publishing null clears the snapshot
+    publisher.publish(nullptr);
+    T_ASSERT(ctx, publisher.acquire() == nullptr);
+    T_ASSERT(ctx, publisher.collect() == 0);
+  }
+
+  void test_onset_detector_finds_bursts(TestContext &ctx)
   {
+    using ShortwavDSP::OnsetDetector;
     using ShortwavDSP::WavPlayer;
     using ShortwavDSP::WavError;
-    using ShortwavDSP::LoopMode;
-    using ShortwavDSP::InterpolationQuality;
 
-    WavPlayer player;
-    // Small file to test boundary conditions
-    auto wav = generateTestWav(100, 1, 44100, 16, 440.0f);
-    player.loadFromMemory(wav.data(), wav.size());
-    player.setSampleRate(44100.0f);
-    player.setLoopMode(LoopMode::Off);
+    // Quiet 220 Hz hum with three decaying noise bursts of rising level
+    const size_t frames = 44100;
+    const size_t bursts[3] = {8000, 20000, 33000};
+    const float levels[3] = {0.3f, 0.5f, 0.8f};
+    std::vector<float> signal(frames);
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < frames; ++i)
+    {
+      float x = 0.01f * std::sin(2.0f * 3.14159265f * 220.0f * static_cast<float>(i) / 44100.0f);
+      for (int b = 0; b < 3; ++b)
+      {
+        if (i >= bursts[b])
+        {
+          seed = seed * 1664525u + 1013904223u;
+          const float noise = static_cast<float>(seed >> 8) / 8388608.0f - 1.0f;
+          x += levels[b] * std::exp(-static_cast<float>(i - bursts[b]) / 1500.0f) * noise;
+        }
+      }
+      signal[i] = x;
+    }
 
-    // Test with cubic interpolation at boundaries
-    player.setInterpolationQuality(InterpolationQuality::Cubic);
+    // Fed in chunks that do not line up with the hop size
+    OnsetDetector detector;
+    detector.begin(frames, 1, 44100);
+    for (size_t first = 0; first < frames; first += 1000)
+      detector.process(signal.data() + first, std::min<size_t>(1000, frames - first));
+    std::vector<OnsetDetector::Onset> onsets = detector.finish();
+    T_ASSERT(ctx, onsets.size() == 3);
 
-    // Seek near end
-    player.seekToSample(98);
-    player.play();
+    for (size_t i = 0; i < onsets.size() && i < 3; ++i)
+    {
+      // Starts just before the attack, on a sign change of the signal
+      const size_t f = onsets[i].frame;
+      T_ASSERT(ctx, f <= bursts[i] && f + 5 * OnsetDetector::kHopFrames > bursts[i]);
+      T_ASSERT(ctx, f > 0 && (signal[f - 1] >= 0.0f) != (signal[f] >= 0.0f));
+      T_ASSERT(ctx, onsets[i].strength >= OnsetDetector::kThreshold);
+    }
 
-    bool allValid = true;
-    for (int i = 0; i < 10; ++i)
+    // A steady tone has no onsets
+    std::vector<float> tone(frames);
+    for (size_t i = 0; i < frames; ++i)
+      tone[i] = 0.5f * std::sin(2.0f * 3.14159265f * 330.0f * static_cast<float>(i) / 44100.0f);
+    detector.begin(frames, 1, 44100);
+    detector.process(tone.data(), frames);
+    T_ASSERT(ctx, detector.finish().empty());
+
+    // The loader fills SampleBuffer::onsets during its peak pass
+    std::vector<uint8_t> wav = generateTestWavFloat(frames, 1, 44100);
+    std::memcpy(wav.data() + 44, signal.data(), frames * sizeof(float));
+    WavPlayer player;
+    T_ASSERT(ctx, player.loadFromMemory(wav.data(), wav.size()) == WavError::None);
+    auto buffer = player.getSampleBuffer();
+    T_ASSERT(ctx, buffer && buffer->onsets.size() == onsets.size());
+    bool same = buffer != nullptr;
+    for (size_t i = 0; same && i < onsets.size() && i < buffer->onsets.size(); ++i)
+      same = buffer->onsets[i].frame == onsets[i].frame && buffer->onsets[i].strength == onsets[i].strength;
+    T_ASSERT(ctx, same);
+  }
+
+  void test_sinc_resampler_quality(TestContext &ctx)
+  {
+    using ShortwavDSP::resampleSinc;
+    const float kTwoPi = 2.0f * 3.14159265f;
+
+    auto tone = [&](size_t frames, double rate, double freq) {
+      std::vector<float> x(frames);
+      for (size_t i = 0; i < frames; ++i)
+        x[i] = 0.5f * static_cast<float>(std::sin(kTwoPi * freq * static_cast<double>(i) / rate));
+      return x;
+    };
+
+    // In-band tones survive down- and upsampling (interior, away from the edges)
+    const double cases[3][2] = {{48000.0, 44100.0}, {96000.0, 44100.0}, {22050.0, 44100.0}};
+    for (const auto &c : cases)
     {
-      float s = player.processSample();
-      if (!std::isfinite(s))
+      std::vector<float> in = tone(static_cast<size_t>(c[0] / 2), c[0], 1000.0);
+      std::vector<float> out;
+      T_ASSERT(ctx, resampleSinc(in.data(), in.size(), 1, c[0], c[1], out));
+      T_ASSERT(ctx, out.size() == static_cast<size_t>(std::ceil(in.size() * c[1] / c[0])));
+      float maxErr = 0.0f;
+      for (size_t m = 200; m + 200 < out.size(); ++m)
       {
-        allValid = false;
-        break;
+        const float ideal = 0.5f * static_cast<float>(std::sin(kTwoPi * 1000.0 * static_cast<double>(m) / c[1]));
+        maxErr = std::max(maxErr, std::fabs(out[m] - ideal));
       }
+      T_ASSERT(ctx, maxErr < 1e-3f);
     }
-    T_ASSERT(ctx, allValid);
 
-    // Test at start
-    player.seek(0.0f);
-    player.play();
-    float startSample = player.processSample();
-    T_ASSERT(ctx, std::isfinite(startSample));
+    // Content above the new Nyquist is removed instead of aliased
+    std::vector<float> high = tone(48000, 96000.0, 30000.0);
+    std::vector<float> out;
+    T_ASSERT(ctx, resampleSinc(high.data(), high.size(), 1, 96000.0, 44100.0, out));
+    double sumSquares = 0.0;
+    for (size_t m = 200; m + 200 < out.size(); ++m)
+      sumSquares += static_cast<double>(out[m]) * out[m];
+    const double rms = std::sqrt(sumSquares / static_cast<double>(out.size() - 400));
+    T_ASSERT(ctx, rms < 0.5 * 0.7071 * 1e-3); // Below -60 dB
+
+    // Interleaved channels are converted independently
+    std::vector<float> stereo(2 * 4800);
+    for (size_t i = 0; i < 4800; ++i)
+    {
+      stereo[2 * i] = 0.25f;
+      stereo[2 * i + 1] = -0.5f;
+    }
+    T_ASSERT(ctx, resampleSinc(stereo.data(), 4800, 2, 48000.0, 44100.0, out));
+    T_ASSERT_NEAR(ctx, out[2 * 2000], 0.25f, 1e-3f);
+    T_ASSERT_NEAR(ctx, out[2 * 2000 + 1], -0.5f, 1e-3f);
+
+    // Progress rises through [0, 1); a false return abandons the conversion
+    std::vector<float> fractions;
+    T_ASSERT(ctx, resampleSinc(high.data(), high.size(), 1, 96000.0, 44100.0, out, [&](float f) {
+      fractions.push_back(f);
+      return true;
+    }));
+    T_ASSERT(ctx, fractions.size() == (out.size() + ShortwavDSP::kResampleProgressFrames - 1) /
+                                           ShortwavDSP::kResampleProgressFrames);
+    T_ASSERT(ctx, fractions.front() == 0.0f && fractions.back() < 1.0f);
+    int calls = 0;
+    T_ASSERT(ctx, !resampleSinc(high.data(), high.size(), 1, 96000.0, 44100.0, out, [&](float) {
+      return ++calls < 2;
+    }));
+    T_ASSERT(ctx, calls == 2 && out.empty());
   }
 
-  void test_wavplayer_performance_benchmark(TestContext &ctx)
+  void test_sinc_interpolator_accuracy(TestContext &ctx)
   {
-    using ShortwavDSP::WavPlayer;
-    using ShortwavDSP::WavError;
-    using ShortwavDSP::LoopMode;
+    using ShortwavDSP::SincInterpolator;
+    const SincInterpolator &sinc = SincInterpolator::shared();
+    const double kTwoPi = 2.0 * 3.14159265358979;
 
-    WavPlayer player;
-    auto wav = generateTestWav(44100, 2, 44100, 16, 440.0f);
-    player.loadFromMemory(wav.data(), wav.size());
-    player.setSampleRate(48000.0f);
-    player.setLoopMode(LoopMode::Forward);
-    player.play();
+    // Tones up to 0.3 of the sample rate stay within -60 dB of the ideal
+    // band-limited value; cubic is far off at the top of that range
+    for (double freq : {0.1, 0.3})
+    {
+      std::vector<float> x(256), y(2 * 256);
+      for (int i = 0; i < 256; ++i)
+      {
+        x[i] = static_cast<float>(0.5 * std::sin(kTwoPi * freq * i + 0.3));
+        y[2 * i] = x[i];
+        y[2 * i + 1] = -0.5f * x[i];
+      }
 
-    // Benchmark buffer processing
-    const size_t bufferSize = 512;
-    const int iterations = 1000;
-    std::vector<float> buffer(bufferSize * 2); // Stereo
+      float sincErr = 0.0f, cubicErr = 0.0f, stereoErr = 0.0f;
+      for (int t = 0; t < 1000; ++t)
+      {
+        const double pos = 100.0 + t * 0.0371;
+        const int i = static_cast<int>(pos);
+        const float frac = static_cast<float>(pos - i);
+        const float ideal = static_cast<float>(0.5 * std::sin(kTwoPi * freq * pos + 0.3));
+        const float m = sinc.mono(&x[i], frac);
+        sincErr = std::max(sincErr, std::fabs(m - ideal));
+        cubicErr = std::max(cubicErr, std::fabs(ShortwavDSP::detail::cubicInterpolate(x[i - 1], x[i], x[i + 1], x[i + 2], frac) - ideal));
+
+        // The interleaved kernel gives each channel the mono result
+        float l, r;
+        sinc.stereo(&y[2 * i], frac, l, r);
+        stereoErr = std::max(stereoErr, std::max(std::fabs(l - m), std::fabs(r + 0.5f * m)));
+      }
+      T_ASSERT(ctx, sincErr < 5e-4f);
+      T_ASSERT(ctx, stereoErr < 1e-6f);
+      if (freq > 0.2)
+        T_ASSERT(ctx, sincErr * 20.0f < cubicErr);
+    }
 
-    for (int iter = 0; iter < iterations; ++iter)
+    // Fraction 0 returns the frame itself
+    std::vector<float> noise(64);
+    uint32_t seed = 1;
+    for (float &v : noise)
     {
-      player.processBufferStereo(buffer.data(), bufferSize);
+      seed = seed * 1664525u + 1013904223u;
+      v = static_cast<float>(seed >> 8) / 8388608.0f - 1.0f;
     }
+    bool exact = true;
+    for (int i = 8; i < 56; ++i)
+      exact = exact && sinc.mono(&noise[i], 0.0f) == noise[i];
+    T_ASSERT(ctx, exact);
+  }
 
-    // Verify final output is valid
-    bool allValid = true;
-    for (size_t i = 0; i < buffer.size(); ++i)
+  void test_band_analyzer_spectrum_and_levels(TestContext &ctx)
+  {
+    using ShortwavDSP::BandAnalyzer;
+
+    // FFT: an impulse is flat, a bin-centred cosine lands in its bin
+    ShortwavDSP::Fft fft(64);
+    std::vector<std::complex<float>> data(64);
+    data[0] = 1.0f;
+    fft.forward(data.data());
+    bool impulseFlat = true;
+    for (const std::complex<float> &x : data)
+      impulseFlat = impulseFlat && std::fabs(x.real() - 1.0f) < 1e-6f && std::fabs(x.imag()) < 1e-6f;
+    T_ASSERT(ctx, impulseFlat);
+    for (int n = 0; n < 64; ++n)
+      data[n] = static_cast<float>(std::cos(2.0 * M_PI * 5.0 * n / 64.0));
+    fft.forward(data.data());
+    T_ASSERT_NEAR(ctx, std::abs(data[5]), 32.0f, 1e-3f);
+    T_ASSERT(ctx, std::abs(data[6]) < 1e-3f && std::abs(data[20]) < 1e-3f);
+
+    // A 1 kHz sine at half scale in the mid band
+    BandAnalyzer analyzer(20.0f, 20000.0f, 200);
+    analyzer.setSampleRate(48000.0f);
+    T_ASSERT(ctx, !analyzer.get());
+    for (int i = 0; i < 4 * static_cast<int>(BandAnalyzer::kFftSize); ++i)
     {
-      if (!std::isfinite(buffer[i]))
+      const float bands[3] = {0.0f, 0.5f * static_cast<float>(std::sin(2.0 * M_PI * 1000.0 * i / 48000.0)), 0.0f};
+      T_ASSERT(ctx, analyzer.push(bands));
+      if (i % 1000 == 0)
+        analyzer.update();
+    }
+    analyzer.update();
+    std::shared_ptr<const BandAnalyzer::Analysis> a = analyzer.get();
+    T_ASSERT(ctx, a && a->sequence == 16 && a->spectrumDB.size() == 200);
+    if (a)
+    {
+      int nearest = 0;
+      for (int i = 0; i < 200; ++i)
       {
-        allValid = false;
-        break;
+        if (std::fabs(analyzer.pointFrequency(i) - 1000.0f) < std::fabs(analyzer.pointFrequency(nearest) - 1000.0f))
+          nearest = i;
       }
+      T_ASSERT_NEAR(ctx, a->spectrumDB[nearest], -6.02f, 1.5f);
+      T_ASSERT(ctx, a->spectrumDB[0] < -60.0f && a->spectrumDB[199] < -60.0f);
+      T_ASSERT_NEAR(ctx, a->peakDB[1], -6.02f, 0.05f);
+      T_ASSERT_NEAR(ctx, a->holdDB[1], -6.02f, 0.05f);
+      T_ASSERT_NEAR(ctx, a->rmsDB[1], -9.03f, 0.1f);
+      T_ASSERT(ctx, a->rmsDB[0] == BandAnalyzer::kFloorDB && a->peakDB[2] == BandAnalyzer::kFloorDB);
     }
-    T_ASSERT(ctx, allValid);
-    T_ASSERT(ctx, player.isPlaying());
+
+    // Without a consumer the ring fills and further frames are dropped
+    BandAnalyzer stalled(20.0f, 20000.0f, 50);
+    const float frame[3] = {0.1f, 0.1f, 0.1f};
+    for (int i = 0; i < 20000; ++i)
+      stalled.push(frame);
+    T_ASSERT(ctx, stalled.getDroppedFrames() == 20000 - 4 * BandAnalyzer::kFftSize);
+    T_ASSERT(ctx, stalled.update() && stalled.get()->sequence == 16);
   }
 
-  void test_wavplayer_empty_file_handling(TestContext &ctx)
+  void test_dsp_stats_counters(TestContext &ctx)
   {
-    using ShortwavDSP::WavPlayer;
-    using ShortwavDSP::WavError;
+    using ShortwavDSP::DspStats;
+    using ShortwavDSP::DspStatsSnapshot;
 
-    WavPlayer player;
+    // Counters only move in instrumented builds; otherwise every snapshot is zero
+    const bool on = DspStats::kEnabled;
+    const uint64_t none = 0;
 
-    // Create a WAV with valid header but zero data
-    std::vector<uint8_t> emptyWav(44);
-    std::memcpy(emptyWav.data(), "RIFF", 4);
-    uint32_t fileSize = 36;
-    std::memcpy(emptyWav.data() + 4, &fileSize, 4);
-    std::memcpy(emptyWav.data() + 8, "WAVE", 4);
-    std::memcpy(emptyWav.data() + 12, "fmt ", 4);
-    uint32_t fmtSize = 16;
-    std::memcpy(emptyWav.data() + 16, &fmtSize, 4);
-    uint16_t audioFormat = 1;
-    std::memcpy(emptyWav.data() + 20, &audioFormat, 2);
-    uint16_t channels = 1;
-    std::memcpy(emptyWav.data() + 22, &channels, 2);
-    uint32_t sampleRate = 44100;
-    std::memcpy(emptyWav.data() + 24, &sampleRate, 4);
-    uint32_t byteRate = 88200;
-    std::memcpy(emptyWav.data() + 28, &byteRate, 4);
-    uint16_t blockAlign = 2;
-    std::memcpy(emptyWav.data() + 32, &blockAlign, 2);
-    uint16_t bitsPerSample = 16;
-    std::memcpy(emptyWav.data() + 34, &bitsPerSample, 2);
-    std::memcpy(emptyWav.data() + 36, "data", 4);
-    uint32_t dataSize = 0;
-    std::memcpy(emptyWav.data() + 40, &dataSize, 4);
+    // Timed calls and coefficient updates (unchanged setter values are free)
+    ShortwavDSP::MoogLowPassFilter filter;
+    filter.setSampleRate(48000.0f);
+    filter.getStats().reset();
+    filter.setCutoff(2000.0f);
+    filter.setCutoff(2000.0f);
+    for (int i = 0; i < 64; ++i)
+      filter.processSample(0.25f);
+    DspStatsSnapshot s = filter.getStats().snapshot();
+    T_ASSERT(ctx, s.calls == (on ? 64u : none) && s.samples == (on ? 64u : none));
+    T_ASSERT(ctx, s.coefficientUpdates == (on ? 1u : none));
+    T_ASSERT(ctx, on ? s.cycles > 0 : s.cycles == 0);
+
+    // Copies carry the counts; reset clears them
+    ShortwavDSP::MoogLowPassFilter copy = filter;
+    T_ASSERT(ctx, copy.getStats().snapshot().calls == s.calls);
+    filter.getStats().reset();
+    T_ASSERT(ctx, filter.getStats().snapshot().calls == 0 && filter.getStats().snapshot().cyclesPerSample() == 0.0);
+
+    // Denormal guard hits: a drift scaled far below the guard threshold is
+    // flushed on every sample, by the scalar generator and the SIMD bank
+    ShortwavDSP::DriftGenerator drift;
+    drift.setSampleRate(48000.0f);
+    drift.setDepth(1.0e-35f);
+    ShortwavDSP::DriftGeneratorBank bank;
+    bank.setSampleRate(48000.0f);
+    bank.setDepth(1.0e-35f);
+    float frame[ShortwavDSP::DriftGeneratorBank::kMaxChannels];
+    for (int i = 0; i < 256; ++i)
+    {
+      drift.next();
+      bank.processFrame(frame, 4);
+    }
+    T_ASSERT(ctx, on ? drift.getStats().snapshot().denormalFlushes > 200 : drift.getStats().snapshot().denormalFlushes == 0);
+    T_ASSERT(ctx, on ? bank.getStats().snapshot().denormalFlushes > 800 : bank.getStats().snapshot().denormalFlushes == 0);
+    T_ASSERT(ctx, bank.getStats().snapshot().calls == (on ? 256u : none));
 
-    auto result = player.loadFromMemory(emptyWav.data(), emptyWav.size());
-    T_ASSERT(ctx, result == WavError::CorruptedData);
-    T_ASSERT(ctx, !player.isLoaded());
+    // WavPlayer: one timed call per block, frames per interpolation tier
+    std::vector<uint8_t> wav = generateTestWav(4000, 1, 44100, 16, 440.0f);
+    ShortwavDSP::WavPlayer player;
+    player.setSampleRate(44100.0f);
+    T_ASSERT(ctx, player.loadFromMemory(wav.data(), wav.size()) == ShortwavDSP::WavError::None);
+    player.setSpeed(0.5f);
+    player.setInterpolationQuality(ShortwavDSP::InterpolationQuality::Linear);
+    player.play();
+    std::vector<float> out(128);
+    player.processBuffer(out.data(), 64);
+    player.setInterpolationQuality(ShortwavDSP::InterpolationQuality::Sinc);
+    player.processBuffer(out.data(), 128);
+    s = player.getStats().snapshot();
+    T_ASSERT(ctx, s.calls == (on ? 2u : none) && s.samples == (on ? 192u : none));
+    T_ASSERT(ctx, s.tiers[static_cast<int>(ShortwavDSP::InterpolationQuality::Linear)] == (on ? 64u : none));
+    T_ASSERT(ctx, s.tiers[static_cast<int>(ShortwavDSP::InterpolationQuality::Sinc)] == (on ? 128u : none));
+    T_ASSERT(ctx, s.underruns == 0);
   }
 
-  void test_wavplayer_not_loaded_operations(TestContext &ctx)
+  void test_wavplayer_resample_on_load(TestContext &ctx)
   {
     using ShortwavDSP::WavPlayer;
-    using ShortwavDSP::PlaybackState;
+    using ShortwavDSP::WavError;
+
+    const size_t frames = 24000;
+    std::vector<uint8_t> wav = generateTestWavFloat(frames, 2, 48000, 1000.0f);
+
+    WavPlayer plain;
+    T_ASSERT(ctx, plain.loadFromMemory(wav.data(), wav.size()) == WavError::None);
 
     WavPlayer player;
+    player.setSampleRate(44100.0f);
+    player.setResampleOnLoad(true);
+    T_ASSERT(ctx, player.loadFromMemory(wav.data(), wav.size()) == WavError::None);
+    T_ASSERT(ctx, player.getNumSamples() == 22050);
+    T_ASSERT(ctx, player.getFileSampleRate() == 48000);
+    T_ASSERT_NEAR(ctx, player.getDurationSeconds(), 0.5f, 1e-6f);
 
-    // Operations on unloaded player should be safe
+    // Unity speed reads the converted frames unchanged, whatever the quality
+    auto buffer = player.getSampleBuffer();
+    T_ASSERT(ctx, buffer && buffer->sampleRate == 44100 && buffer->sourceSamples);
+    std::vector<float> out(2 * 1024);
     player.play();
-    T_ASSERT(ctx, player.getState() == PlaybackState::Stopped);
+    player.processBufferStereo(out.data(), 1024);
+    bool exact = true;
+    for (size_t i = 0; i < out.size(); ++i)
+      exact = exact && out[i] == buffer->samples[i];
+    T_ASSERT(ctx, exact);
 
-    float sample = player.processSample();
-    T_ASSERT_NEAR(ctx, sample, 0.0f, kTightEpsilon);
+    // Back to the file's rate: the original samples return, playback goes on
+    player.setSampleRate(48000.0f);
+    T_ASSERT(ctx, player.resampleToOutputRate() == WavError::None);
+    T_ASSERT(ctx, player.getLoadProgress() == 1.0f);
+    T_ASSERT(ctx, player.getNumSamples() == frames);
+    T_ASSERT(ctx, player.isPlaying());
+    T_ASSERT_NEAR(ctx, static_cast<float>(player.getPlaybackPositionSamples()), 1024.0f * 48000.0f / 44100.0f, 1e-2f);
+    auto restored = player.getSampleBuffer();
+    T_ASSERT(ctx, restored && !restored->sourceSamples && restored->samples == plain.getSampleBuffer()->samples);
+
+    // Matching rate or disabled conversion: nothing to do
+    const uint64_t generation = player.getBufferGeneration();
+    T_ASSERT(ctx, player.resampleToOutputRate() == WavError::None);
+    player.setResampleOnLoad(false);
+    player.setSampleRate(96000.0f);
+    T_ASSERT(ctx, player.resampleToOutputRate() == WavError::None);
+    T_ASSERT(ctx, player.getBufferGeneration() == generation);
+
+    // After abortConversions() a conversion gives up and publishes nothing
+    player.setResampleOnLoad(true);
+    player.abortConversions();
+    T_ASSERT(ctx, player.resampleToOutputRate() == WavError::InvalidState);
+    T_ASSERT(ctx, player.getLoadProgress() == 1.0f);
+    T_ASSERT(ctx, player.getBufferGeneration() == generation && player.getFileSampleRate() == 48000);
+    T_ASSERT(ctx, player.getSampleBuffer()->sampleRate == 48000);
+  }
 
-    float left, right;
-    player.processSampleStereo(left, right);
-    T_ASSERT_NEAR(ctx, left, 0.0f, kTightEpsilon);
-    T_ASSERT_NEAR(ctx, right, 0.0f, kTightEpsilon);
+  void test_wavplayer_parallel_decode(TestContext &ctx)
+  {
+    using ShortwavDSP::WavPlayer;
+    using ShortwavDSP::WavError;
+    using ShortwavDSP::detail::PcmFormat;
 
-    std::vector<float> buffer(100, 1.0f);
-    player.processBuffer(buffer.data(), buffer.size());
-    T_ASSERT_NEAR(ctx, buffer[0], 0.0f, kTightEpsilon);
+    // Block kernels decode exactly what the per-sample decoder does, at any
+    // length and alignment (random bytes cover every code, NaNs included)
+    struct Layout
+    {
+      PcmFormat format;
+      size_t bytes;
+    };
+    const Layout layouts[] = {{PcmFormat::UInt8, 1}, {PcmFormat::Int16, 2}, {PcmFormat::Int24, 3},
+                              {PcmFormat::Int32, 4}, {PcmFormat::Float32, 4}};
+    uint32_t seed = 27u;
+    std::vector<uint8_t> raw(4 * 101 + 1);
+    for (uint8_t &b : raw)
+    {
+      seed = seed * 1664525u + 1013904223u;
+      b = static_cast<uint8_t>(seed >> 24);
+    }
+    for (const Layout &layout : layouts)
+    {
+      bool identical = true;
+      for (size_t count = 0; count <= 100; ++count)
+      {
+        std::vector<float> block(count);
+        ShortwavDSP::detail::decodePcmBlock(raw.data() + 1, block.data(), count, layout.format);
+        for (size_t i = 0; i < count; ++i)
+        {
+          const float expected = ShortwavDSP::detail::decodePcmSample(raw.data() + 1 + i * layout.bytes, layout.format);
+          identical = identical && std::memcmp(&block[i], &expected, sizeof(float)) == 0;
+        }
+      }
+      T_ASSERT(ctx, identical);
+    }
 
-    player.seek(0.5f);
-    T_ASSERT_NEAR(ctx, player.getPlaybackPosition(), 0.0f, kTightEpsilon);
+    // A file past the parallel threshold (several chunks, a partial last one)
+    // loads the same from disk and from memory as the per-sample decode
+    const size_t frames = 2200001;
+    std::vector<uint8_t> wav = generateTestWav(frames, 2, 44100, 16, 440.0f);
+    const TempWavFile file("shortwav_test_parallel.wav");
+    const char *path = file.c_str();
+    T_ASSERT(ctx, writeTestWavFile(path, wav));
+
+    WavPlayer fromFile;
+    WavPlayer fromMemory;
+    T_ASSERT(ctx, fromFile.getLoadProgress() == 1.0f);
+    T_ASSERT(ctx, fromFile.loadFile(path) == WavError::None);
+    T_ASSERT(ctx, fromMemory.loadFromMemory(wav.data(), wav.size()) == WavError::None);
+    T_ASSERT(ctx, fromFile.getLoadProgress() == 1.0f && fromMemory.getLoadProgress() == 1.0f);
+
+    auto fileBuffer = fromFile.getSampleBuffer();
+    auto memoryBuffer = fromMemory.getSampleBuffer();
+    T_ASSERT(ctx, fileBuffer && memoryBuffer && fileBuffer->samples.size() == 2 * frames);
+    bool matches = true;
+    for (size_t i = 0; fileBuffer && memoryBuffer && i < 2 * frames; ++i)
+    {
+      const float expected = ShortwavDSP::detail::decodePcmSample(wav.data() + 44 + 2 * i, PcmFormat::Int16);
+      matches = matches && fileBuffer->samples[i] == expected && memoryBuffer->samples[i] == expected;
+    }
+    T_ASSERT(ctx, matches);
+
+    // A failed load still ends at 1
+    T_ASSERT(ctx, fromFile.loadFile("shortwav_missing_file.wav") == WavError::FileNotFound);
+    T_ASSERT(ctx, fromFile.getLoadProgress() == 1.0f);
   }
 
-  void test_wavplayer_mono_to_stereo_duplication(TestContext &ctx)
+  void test_wavplayer_reload_while_playing(TestContext &ctx)
   {
     using ShortwavDSP::WavPlayer;
     using ShortwavDSP::WavError;
 
+    std::vector<uint8_t> wavA = generateTestWav(4000, 1, 44100, 16, 440.0f);
+    std::vector<uint8_t> wavB = generateTestWav(1500, 2, 22050, 24, 330.0f);
+
     WavPlayer player;
-    auto wav = generateTestWav(1000, 1, 44100, 16, 440.0f);
-    player.loadFromMemory(wav.data(), wav.size());
     player.setSampleRate(44100.0f);
-    player.play();
+    player.setLoopMode(ShortwavDSP::LoopMode::Forward);
+    T_ASSERT(ctx, player.loadFromMemory(wavA.data(), wavA.size()) == WavError::None);
+
+    // Loader thread swaps files and restarts playback while the audio loop runs
+    std::atomic<bool> done{false};
+    std::atomic<bool> loadsOk{true};
+    std::thread loader([&]() {
+      for (int i = 0; i < 200; ++i)
+      {
+        const std::vector<uint8_t> &wav = (i & 1) ? wavA : wavB;
+        if (player.loadFromMemory(wav.data(), wav.size()) != WavError::None)
+          loadsOk.store(false);
+        player.play();
+      }
+      done.store(true);
+    });
 
-    // When reading mono as stereo, both channels should be identical
-    for (int i = 0; i < 100; ++i)
+    float block[64];
+    bool finite = true;
+    while (!done.load())
     {
-      float left, right;
-      player.processSampleStereo(left, right);
-      T_ASSERT_NEAR(ctx, left, right, kTightEpsilon);
+      player.processBuffer(block, 64);
+      for (float v : block)
+        finite = finite && std::isfinite(v) && std::abs(v) <= 1.0f;
     }
+    loader.join();
+
+    T_ASSERT(ctx, loadsOk.load());
+    T_ASSERT(ctx, finite);
+    T_ASSERT(ctx, player.isLoaded());
+    player.processSample();
+    T_ASSERT(ctx, player.collectRetired() == 0);
   }
 
-  void test_wavplayer_stereo_to_mono_mixdown(TestContext &ctx)
+  void test_peak_pyramid_matches_brute_force(TestContext &ctx)
   {
-    using ShortwavDSP::WavPlayer;
-    using ShortwavDSP::WavError;
+    using ShortwavDSP::PeakPyramid;
 
-    WavPlayer player;
-    auto wav = generateTestWav(1000, 2, 44100, 16, 440.0f);
-    player.loadFromMemory(wav.data(), wav.size());
-    player.setSampleRate(44100.0f);
-    player.play();
+    // Stereo noise-like signal with an odd length (partial last block)
+    const size_t frames = 50000 + 37;
+    std::vector<float> data(frames * 2);
+    uint32_t seed = 12345u;
+    for (float &v : data)
+    {
+      seed = seed * 1664525u + 1013904223u;
+      v = static_cast<float>(seed >> 8) / 8388608.0f - 1.0f;
+    }
 
-    // Mono output from stereo file should be finite
-    bool allValid = true;
-    for (int i = 0; i < 100; ++i)
+    PeakPyramid peaks;
+    T_ASSERT(ctx, peaks.empty());
+    T_ASSERT(ctx, peaks.build(frames, 2, [&](size_t first, size_t count, float *out) {
+      std::copy(data.begin() + first * 2, data.begin() + (first + count) * 2, out);
+      return true;
+    }));
+    T_ASSERT(ctx, peaks.getNumFrames() == frames);
+    T_ASSERT(ctx, peaks.getLevel(peaks.getNumLevels() - 1).size() == 1);
+
+    const size_t B = PeakPyramid::kBaseBlockFrames;
+    const size_t ranges[][2] = {{0, frames}, {0, B}, {B * 3, B * 4}, {B * 5, B * 1000},
+                                {B * 7, frames}, {B * 100, B * 101 + 1}, {frames - 10, frames}};
+    bool ok = true;
+    for (const auto &r : ranges)
     {
-      float mono = player.processSample();
-      if (!std::isfinite(mono))
+      // Brute force over the same block-widened range
+      const size_t lo = (r[0] / B) * B;
+      const size_t hi = std::min(frames, ((r[1] + B - 1) / B) * B);
+      float mn = 1e9f, mx = -1e9f;
+      double sq = 0.0;
+      for (size_t f = lo; f < hi; ++f)
       {
-        allValid = false;
-        break;
+        const float v = (data[f * 2] + data[f * 2 + 1]) * 0.5f;
+        mn = std::min(mn, v);
+        mx = std::max(mx, v);
+        sq += static_cast<double>(v) * v;
       }
+      const float rms = static_cast<float>(std::sqrt(sq / static_cast<double>(hi - lo)));
+
+      PeakPyramid::Entry e = peaks.query(r[0], r[1]);
+      ok = ok && e.min == mn && e.max == mx && std::abs(e.rms - rms) < 1e-4f;
     }
-    T_ASSERT(ctx, allValid);
+    T_ASSERT(ctx, ok);
+
+    // Empty and out-of-range queries
+    PeakPyramid::Entry none = peaks.query(frames, frames + 100);
+    T_ASSERT(ctx, none.min == 0.0f && none.max == 0.0f && none.rms == 0.0f);
+
+    // Failing reader leaves the pyramid empty
+    T_ASSERT(ctx, !peaks.build(frames, 2, [](size_t, size_t, float *) { return false; }));
+    T_ASSERT(ctx, peaks.empty());
+  }
+
+  void test_wavplayer_peaks_built_for_all_storage_modes(TestContext &ctx)
+  {
+    using ShortwavDSP::WavPlayer;
+    using ShortwavDSP::WavError;
+    using ShortwavDSP::WavStorageMode;
+
+    const TempWavFile file("shortwav_test_peaks.wav");
+    const char *path = file.c_str();
+    T_ASSERT(ctx, writeTestWavFile(path, generateTestWav(30000, 2, 44100, 16, 100.0f)));
+
+    WavPlayer resident, mapped, streamed;
+    T_ASSERT(ctx, resident.loadFile(path) == WavError::None);
+    T_ASSERT(ctx, mapped.loadFile(path, WavStorageMode::MemoryMapped) == WavError::None);
+    T_ASSERT(ctx, streamed.loadFile(path, WavStorageMode::Streaming) == WavError::None);
+
+    const uint64_t generation = resident.getBufferGeneration();
+    auto a = resident.getSampleBuffer();
+    auto b = mapped.getSampleBuffer();
+    auto c = streamed.getSampleBuffer();
+    T_ASSERT(ctx, a && b && c);
+    T_ASSERT(ctx, a->peaks.getNumFrames() == 30000);
+
+    bool same = true;
+    for (size_t start = 0; start < 30000; start += 1000)
+    {
+      auto pa = a->peaks.query(start, start + 1000);
+      auto pb = b->peaks.query(start, start + 1000);
+      auto pc = c->peaks.query(start, start + 1000);
+      same = same && pa.min == pb.min && pa.max == pb.max && pa.rms == pb.rms;
+      same = same && pa.min == pc.min && pa.max == pc.max && pa.rms == pc.rms;
+    }
+    T_ASSERT(ctx, same);
+
+    // Channels are averaged: (sin + cos) / 2 peaks at 0.707 with an RMS of 0.5
+    auto whole = a->peaks.query(0, 30000);
+    T_ASSERT_NEAR(ctx, whole.max, 0.7071f, 0.01f);
+    T_ASSERT_NEAR(ctx, whole.min, -0.7071f, 0.01f);
+    T_ASSERT_NEAR(ctx, whole.rms, 0.5f, 0.01f);
+
+    resident.unload();
+    T_ASSERT(ctx, resident.getBufferGeneration() != generation);
   }
 
   // ============================================================================
@@ -3585,6 +6590,11 @@ int main()
   ::test_waveshaper_order_and_coefficients(ctx);
   ::test_waveshaper_process_buffer(ctx);
   ::test_waveshaper_invalid_params_and_denorm_guard(ctx);
+  ::test_waveshaper_baked_modes_match_recurrence(ctx);
+  ::test_waveshaper_bakes_only_on_change(ctx);
+  ::test_waveshaper_oversampling_reduces_aliasing(ctx);
+  ::test_waveshaper_adaa_follows_static_curve(ctx);
+  ::test_waveshaper_bank_matches_mono(ctx);
 
   // RandomLFO
   ::test_randomlfo_basic_determinism(ctx);
@@ -3592,6 +6602,9 @@ int main()
   ::test_randomlfo_bipolar_unipolar_and_depth(ctx);
   ::test_randomlfo_smooth_parameter_effect(ctx);
   ::test_randomlfo_boundary_conditions(ctx);
+  ::test_randomlfo_bank_matches_scalar(ctx);
+  ::test_randomlfo_bank_channels_independent(ctx);
+  ::test_randomlfo_decimated_mode(ctx);
 
   // DriftGenerator
   ::test_drift_generator_basic_finiteness(ctx);
@@ -3599,6 +6612,9 @@ int main()
   ::test_drift_generator_determinism(ctx);
   ::test_drift_generator_parameter_effects(ctx);
   ::test_drift_generator_boundary_conditions(ctx);
+  ::test_drift_generator_decimated_mode(ctx);
+  ::test_drift_bank_matches_scalar(ctx);
+  ::test_drift_bank_channels_independent(ctx);
 
   // FormantOscillator
   ::test_formantosc_basic_output(ctx);
@@ -3619,6 +6635,7 @@ int main()
   ::test_threebandeq_mid_band_cut(ctx);
   ::test_threebandeq_high_band_response(ctx);
   ::test_threebandeq_stereo_processing(ctx);
+  ::test_threebandeq_stereo_buffers_match_per_sample(ctx);
   ::test_threebandeq_sample_rate_independence(ctx);
   ::test_threebandeq_crossover_frequency_behavior(ctx);
   ::test_threebandeq_extreme_gain_values(ctx);
@@ -3626,6 +6643,13 @@ int main()
   ::test_threebandeq_reset_behavior(ctx);
   ::test_threebandeq_phase_continuity(ctx);
   ::test_threebandeq_performance_benchmark(ctx);
+  ::test_threebandeq_poly_matches_scalar(ctx);
+  ::test_threebandeq_poly_partial_channels(ctx);
+  ::test_threebandeq_poly_stereo_and_reset(ctx);
+  ::test_threebandeq_magnitude_response_matches_measurement(ctx);
+  ::test_threebandeq_band_tap(ctx);
+  ::test_threebandeq_linkwitz_riley_crossover(ctx);
+  ::test_threebandeq_band_split(ctx);
 
   // MoogLowPassFilter
   ::test_lowpass_basic_construction_and_defaults(ctx);
@@ -3648,12 +6672,33 @@ int main()
   ::test_lowpass_impulse_response(ctx);
   ::test_lowpass_performance_benchmark(ctx);
 
+  // Control-rate processing
+  ::test_linear_ramp_behavior(ctx);
+  ::test_control_rate_divider_blocks(ctx);
+  ::test_control_rate_startup_division(ctx);
+  ::test_threebandeq_parameter_ramp_settles(ctx);
+  ::test_lowpass_parameter_ramp_settles(ctx);
+  ::test_fast_math_accuracy(ctx);
+  ::test_coefficient_setters_skip_unchanged(ctx);
+  ::test_lowpass_stereo_buffer_independent_state(ctx);
+  ::test_lowpass_multichannel_matches_mono(ctx);
+  ::test_zdf_ladder_tracks_high_cutoff(ctx);
+  ::test_zdf_ladder_stable_under_audio_rate_modulation(ctx);
+  ::test_zdf_ladder_buffer_matches_per_sample(ctx);
+  ::test_formantosc_parameter_ramp(ctx);
+  ::test_formantosc_oversampling_reduces_aliasing(ctx);
+  ::test_formantosc_integer_phase_wraps_exactly(ctx);
+  ::test_formantosc_shared_table(ctx);
+  ::test_formantosc_bank_matches_scalar(ctx);
+  ::test_generators_process_buffer_matches_per_sample(ctx);
+
   // WavPlayer
   ::test_wavplayer_construction_and_defaults(ctx);
   ::test_wavplayer_load_from_memory_16bit_mono(ctx);
   ::test_wavplayer_load_from_memory_24bit_stereo(ctx);
   ::test_wavplayer_load_from_memory_32bit_float(ctx);
   ::test_wavplayer_load_from_memory_8bit(ctx);
+  ::test_wavplayer_load_from_memory_unsupported_depths(ctx);
   ::test_wavplayer_invalid_wav_data(ctx);
   ::test_wavplayer_playback_controls(ctx);
   ::test_wavplayer_seek_functionality(ctx);
@@ -3682,6 +6727,24 @@ int main()
   ::test_wavplayer_not_loaded_operations(ctx);
   ::test_wavplayer_mono_to_stereo_duplication(ctx);
   ::test_wavplayer_stereo_to_mono_mixdown(ctx);
+  ::test_wavplayer_memory_mapped_matches_resident(ctx);
+  ::test_wavplayer_block_render_matches_checked_path(ctx);
+  ::test_wavplayer_voice_pool(ctx);
+  ::test_wavplayer_memory_mapped_lifecycle(ctx);
+  ::test_wavplayer_streaming_matches_resident(ctx);
+  ::test_wavplayer_streaming_underrun_and_seek(ctx);
+  ::test_wavplayer_buffer_swap_reclaim(ctx);
+  ::test_snapshot_publisher_reclaim(ctx);
+  ::test_wavplayer_reload_while_playing(ctx);
+  ::test_peak_pyramid_matches_brute_force(ctx);
+  ::test_wavplayer_peaks_built_for_all_storage_modes(ctx);
+  ::test_onset_detector_finds_bursts(ctx);
+  ::test_sinc_resampler_quality(ctx);
+  ::test_wavplayer_resample_on_load(ctx);
+  ::test_wavplayer_parallel_decode(ctx);
+  ::test_sinc_interpolator_accuracy(ctx);
+  ::test_band_analyzer_spectrum_and_levels(ctx);
+  ::test_dsp_stats_counters(ctx);
 
   // Module integration tests
   ::test_module_parameter_mapping(ctx);